@@ -0,0 +1,60 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Animation/Player.h"
+#include "Magnum/AnimationTools/Compress.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+
+#define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
+
+using namespace Magnum;
+
+/* Make sure the name doesn't conflict with any other snippets to avoid linker
+   warnings, unlike with `int main()` there now has to be a declaration to
+   avoid -Wmisssing-prototypes */
+void mainAnimationTools();
+void mainAnimationTools() {
+{
+/* [packQuaternions] */
+Containers::StridedArrayView1D<const Float> keys = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<const Quaternion> rotations = DOXYGEN_ELLIPSIS({});
+
+/* Half the memory of the original rotations, unpacked on the fly in each
+   advance() */
+Containers::Array<Vector4s> packed = AnimationTools::packQuaternions(rotations);
+Animation::TrackView<const Float, const Vector4s, Quaternion> track{keys, packed,
+    AnimationTools::slerpShortestPathPacked};
+
+Quaternion rotation;
+Animation::Player<Float> player;
+player.add(track, rotation);
+/* [packQuaternions] */
+}
+}
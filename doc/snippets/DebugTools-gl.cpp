@@ -165,6 +165,16 @@ DebugTools::FrameProfilerGL _profiler{
 /* [FrameProfilerGL-usage] */
 }
 
+{
+/* [FrameProfilerGL-usage-statistics] */
+DebugTools::FrameProfilerGL _profiler{
+    DebugTools::FrameProfilerGL::Value::DrawCalls|
+    DebugTools::FrameProfilerGL::Value::ProgramSwitches|
+    DebugTools::FrameProfilerGL::Value::BindCalls|
+    DebugTools::FrameProfilerGL::Value::UniformUploads, 50};
+/* [FrameProfilerGL-usage-statistics] */
+}
+
 {
 GL::Texture2D texture;
 Range2Di rect;
@@ -26,12 +26,15 @@
 
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Path.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
@@ -49,6 +52,8 @@
 #include "Magnum/GL/Renderbuffer.h"
 #include "Magnum/GL/RenderbufferFormat.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderCompileQueue.h"
+#include "Magnum/GL/StreamingBuffer.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
 #include "Magnum/GL/Version.h"
@@ -59,6 +64,7 @@
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/Primitives/Cube.h"
 #include "Magnum/Primitives/Plane.h"
+#include "Magnum/Shaders/Flat.h"
 #include "Magnum/Shaders/FlatGL.h"
 #include "Magnum/Shaders/PhongGL.h"
 #include "Magnum/Trade/MeshData.h"
@@ -478,6 +484,34 @@ MyShader shader{std::move(state)};
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+/* [AbstractShaderProgram-binary-cache] */
+GL::AbstractShaderProgram::setBinaryCacheDirectory(
+    Utility::Path::join(*Utility::Path::homeDirectory(), ".cache/myapp/shaders"));
+
+/* If already compiled in a previous run, this is loaded from the cache */
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setLightCount(3)};
+/* [AbstractShaderProgram-binary-cache] */
+}
+#endif
+
+{
+Shaders::PhongGL::Configuration configurations[1];
+/* [ShaderCompileQueue-usage] */
+GL::ShaderCompileQueue<Shaders::PhongGL> queue;
+for(const Shaders::PhongGL::Configuration& configuration: configurations)
+    queue.add(Shaders::PhongGL::compile(configuration));
+
+// every frame ...
+queue.poll();
+if(!queue.pendingCount()) {
+    // All done, use queue.shader(i) for rendering ...
+}
+/* [ShaderCompileQueue-usage] */
+}
+
 {
 GL::Framebuffer framebuffer{{}};
 /* [AbstractFramebuffer-read1] */
@@ -685,6 +719,20 @@ MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::geometry_shader4);
 }
 #endif
 
+{
+/* [Context-statistics] */
+GL::Context& context = GL::Context::current();
+context.setStatisticsEnabled(true);
+
+// render the frame ...
+
+GL::Context::Statistics statistics = context.statistics();
+Debug{} << statistics.drawCalls << "draws," << statistics.programSwitches
+    << "program switches," << statistics.textureBinds << "texture binds";
+context.resetStatistics();
+/* [Context-statistics] */
+}
+
 #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
 {
 char data[1]{};
@@ -1234,6 +1282,24 @@ shader.draw(mesh);
 /* [Mesh-draw] */
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+GL::Mesh mesh;
+Shaders::PhongGL shader{NoCreate};
+/* [Mesh-draw-indirect] */
+GL::DrawElementsIndirectCommand commands[]{
+    /* count, instanceCount, firstIndex, baseVertex, baseInstance */
+    {36, 1, 0, 0, 0},
+    {36, 1, 36, 24, 0},
+    DOXYGEN_ELLIPSIS()
+};
+GL::Buffer commandBuffer{GL::Buffer::TargetHint::DrawIndirect, commands};
+
+shader.drawIndirect(mesh, commandBuffer, 0, Containers::arraySize(commands));
+/* [Mesh-draw-indirect] */
+}
+#endif
+
 
 {
 /* [Mesh-addVertexBuffer1] */
@@ -1430,6 +1496,26 @@ q.endConditionalRender();
 #endif
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+{
+GL::Buffer materialUniform;
+/* [AbstractTexture-bindless] */
+GL::Texture2D texture;
+texture.setMinificationFilter(GL::SamplerFilter::Linear)
+    .setMagnificationFilter(GL::SamplerFilter::Linear)
+    .setStorage(1, GL::TextureFormat::RGBA8, {256, 256});
+    // upload the data ...
+
+/* Query the handle, make it resident and pass it to the shader */
+texture.makeHandleResident();
+materialUniform.setData({
+    Shaders::FlatMaterialUniform{}
+        .setTextureHandle(texture.handle())
+});
+/* [AbstractTexture-bindless] */
+}
+#endif
+
 #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
 {
 char data[1]{};
@@ -1612,6 +1698,29 @@ GL::CompressedBufferImage3D image = texture.compressedSubImage(0, range, {},
 #endif
 #endif
 
+#ifndef MAGNUM_TARGET_GLES2
+{
+struct: GL::AbstractShaderProgram {} shader;
+GL::Mesh mesh;
+Matrix4 transformationProjectionMatrix;
+/* [StreamingBuffer-usage] */
+GL::StreamingBuffer uniforms{1024*1024, GL::Buffer::TargetHint::Uniform};
+
+// every frame ...
+Containers::Pair<GLintptr, Containers::ArrayView<char>> allocation =
+    uniforms.allocate(sizeof(Matrix4), GL::Buffer::uniformOffsetAlignment());
+*reinterpret_cast<Matrix4*>(allocation.second().data()) =
+    transformationProjectionMatrix;
+
+uniforms.flush();
+uniforms.buffer().bind(GL::Buffer::Target::Uniform, 0,
+    allocation.first(), sizeof(Matrix4));
+shader.draw(mesh);
+uniforms.fence();
+/* [StreamingBuffer-usage] */
+}
+#endif
+
 #ifndef MAGNUM_TARGET_WEBGL
 {
 /* [TimeQuery-usage1] */
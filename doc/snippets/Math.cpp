@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
@@ -36,6 +37,7 @@
 #include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Half.h"
+#include "Magnum/Math/IntersectionBatch.h"
 #include "Magnum/Math/PackingBatch.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/Math/Swizzle.h"
@@ -1189,6 +1191,24 @@ static_cast<void>(sinAngle);
 static_cast<void>(tanAngleSqPlusOne);
 }
 
+{
+Matrix4 projection, transformation;
+/* [Intersection-sphereFrustumInto] */
+struct Object {
+    Vector3 center;
+    Float radius;
+    /* … */
+};
+Containers::ArrayView<const Object> objects = DOXYGEN_ELLIPSIS({});
+
+Containers::BitArray visible{NoInit, objects.size()};
+Math::Intersection::sphereFrustumInto(
+    Containers::stridedArrayView(objects).slice(&Object::center),
+    Containers::stridedArrayView(objects).slice(&Object::radius),
+    Frustum::fromMatrix(projection*transformation), visible);
+/* [Intersection-sphereFrustumInto] */
+}
+
 {
 /* [Matrix-conversion] */
 Matrix2x2 floatingPoint{Vector2{1.3f, 2.7f}, Vector2{-15.0f, 7.0f}};
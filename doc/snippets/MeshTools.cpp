@@ -31,7 +31,10 @@
 #include <Corrade/PluginManager/Manager.h>
 
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/Combine.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Concatenate.h"
@@ -42,6 +45,7 @@
 #include "Magnum/MeshTools/GenerateIndices.h"
 #include "Magnum/MeshTools/GenerateNormals.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Meshlets.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/Primitives/Cube.h"
@@ -210,6 +214,25 @@ MeshTools::flipNormalsInPlace(skybox.mutableIndices<UnsignedInt>(),
 /* [meshtools-copy] */
 }
 
+{
+Trade::MeshData mesh{{}, 0};
+Matrix4 transformationProjection;
+Vector3 viewPosition;
+void drawMeshlet(const MeshTools::Meshlets& meshlets, const MeshTools::Meshlet& meshlet);
+/* [buildMeshlets] */
+MeshTools::Meshlets meshlets = MeshTools::buildMeshlets(mesh);
+
+Frustum frustum = Frustum::fromMatrix(transformationProjection);
+for(const MeshTools::Meshlet& meshlet: meshlets.meshlets) {
+    if(!Math::Intersection::sphereFrustum(meshlet.center, meshlet.radius, frustum) ||
+       MeshTools::isMeshletBackfacing(meshlet, viewPosition))
+        continue;
+
+    drawMeshlet(meshlets, meshlet);
+}
+/* [buildMeshlets] */
+}
+
 {
 Trade::MeshData mesh{{}, 0};
 /* [combineFaceAttributes] */
@@ -25,6 +25,8 @@
 */
 
 #include <algorithm> /* std::sort() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Intersection.h"
@@ -36,6 +38,7 @@
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
 
@@ -390,4 +393,45 @@ camera.draw(drawableTransformations);
 /* [Drawable-culling] */
 }
 
+{
+Object3D cameraObject;
+SceneGraph::Camera3D camera{cameraObject};
+SceneGraph::DrawableGroup3D drawableGroup;
+/* [Drawable-culling-sorted] */
+/* Bounds relative to the object each drawable is attached to, and a
+   material ID for each */
+Containers::Array<Range3D> bounds;
+Containers::Array<UnsignedInt> materialIds;
+DOXYGEN_ELLIPSIS()
+
+/* Draw only drawables that are visible, grouped by material and sorted
+   front-to-back in each group to reduce overdraw */
+camera.draw(drawableGroup, bounds, materialIds,
+    SceneGraph::DrawableDepthOrder::FrontToBack);
+/* [Drawable-culling-sorted] */
+}
+
+{
+SceneGraph::DrawableGroup3D drawables;
+/* [FlatScene] */
+SceneGraph::FlatScene3D scene;
+
+/* Objects are lightweight handles to transformations stored in the scene */
+auto* cameraObject = new SceneGraph::FlatObject3D{scene};
+cameraObject->setTransformation(Matrix4::translation(Vector3::zAxis(5.0f)));
+auto& camera = cameraObject->addFeature<SceneGraph::Camera3D>();
+
+auto* root = new SceneGraph::FlatObject3D{scene};
+for(std::size_t i = 0; i != 100000; ++i) {
+    auto* object = new SceneGraph::FlatObject3D{*root};
+    DOXYGEN_ELLIPSIS(static_cast<void>(object);) // add drawable features
+}
+
+/* Only objects with changed transformations, and their children, get their
+   absolute transformation recalculated, in a single batch */
+root->transform(Matrix4::rotationY(1.0_degf));
+camera.draw(drawables);
+/* [FlatScene] */
+}
+
 }
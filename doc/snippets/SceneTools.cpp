@@ -29,12 +29,14 @@
 #include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/Triple.h>
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Transform.h"
+#include "Magnum/SceneTools/AbsoluteTransformations.h"
 #include "Magnum/SceneTools/Filter.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/Trade/SceneData.h"
@@ -49,6 +51,26 @@ using namespace Magnum;
    avoid -Wmisssing-prototypes */
 void mainSceneTools();
 void mainSceneTools() {
+{
+/* [AbsoluteTransformations] */
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+SceneTools::AbsoluteTransformations3D transformations{scene};
+
+/* Every frame, set new local transformations for objects that changed and
+   recalculate absolute transformations of them and all their children */
+Containers::StridedArrayView1D<const Containers::Pair<UnsignedInt, Matrix4>>
+    animated = DOXYGEN_ELLIPSIS({});
+for(const Containers::Pair<UnsignedInt, Matrix4>& i: animated)
+    transformations.setTransformation(i.first(), i.second());
+transformations.update();
+
+/* Absolute transformations are indexed by object ID */
+Containers::StridedArrayView1D<const Matrix4> absolute =
+    transformations.absoluteTransformations();
+/* [AbsoluteTransformations] */
+static_cast<void>(absolute);
+}
+
 {
 /* [filterFieldEntries-shared-mapping] */
 Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
@@ -1135,6 +1135,41 @@ shader
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+{
+GL::Buffer projectionUniform, lightUniform, materialUniform,
+    transformationUniform, drawUniform;
+Containers::Array<GL::MeshView> meshViews;
+/* [PhongGL-bindless] */
+Containers::Array<GL::Texture2D> textures = DOXYGEN_ELLIPSIS({});
+
+/* Make all textures resident and put their handles into a buffer, one for
+   each material */
+Containers::Array<Shaders::PhongTextureHandleUniform> handles{textures.size()};
+for(std::size_t i = 0; i != textures.size(); ++i) {
+    textures[i].makeHandleResident();
+    handles[i].setDiffuseTextureHandle(textures[i].handle());
+}
+GL::Buffer textureHandleUniform{handles};
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::MultiDraw|
+              Shaders::PhongGL::Flag::DiffuseTexture|
+              Shaders::PhongGL::Flag::BindlessTextures)
+    .setMaterialCount(textures.size())
+    .setDrawCount(meshViews.size())};
+shader
+    DOXYGEN_ELLIPSIS(.bindProjectionBuffer(projectionUniform)
+    .bindLightBuffer(lightUniform)
+    .bindMaterialBuffer(materialUniform)
+    .bindTransformationBuffer(transformationUniform)
+    .bindDrawBuffer(drawUniform))
+    .bindTextureHandleBuffer(textureHandleUniform)
+    .draw(meshViews);
+/* [PhongGL-bindless] */
+}
+#endif
+
 #if !defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG) || __GNUC__ >= 5
 {
 /* [VectorGL-usage1] */
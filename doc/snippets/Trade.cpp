@@ -248,6 +248,27 @@ importer->openFile("scene.gltf"); // memory-maps all files
 }
 #endif
 
+{
+/* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
+   the converter pointer. I don't care, I just want you to check compilation
+   errors, not more! */
+PluginManager::Manager<Trade::AbstractImporter> manager;
+Containers::Pointer<Trade::AbstractImporter> importer = manager.loadAndInstantiate("SomethingWhatever");
+/* [AbstractImporter-usage-batch] */
+/* Import all images, on all hardware threads if the importer supports that */
+Containers::Array<UnsignedInt> ids{NoInit, importer->image2DCount()};
+for(UnsignedInt i = 0; i != ids.size(); ++i) ids[i] = i;
+Containers::Array<Containers::Optional<Trade::ImageData2D>> images =
+    importer->images2D(ids, 0);
+
+for(UnsignedInt i = 0; i != images.size(); ++i) {
+    if(!images[i]) Fatal{} << "Importing image" << i << "failed";
+
+    // use the image ...
+}
+/* [AbstractImporter-usage-batch] */
+}
+
 {
 /* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
    the converter pointer. I don't care, I just want you to check compilation
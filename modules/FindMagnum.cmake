@@ -49,6 +49,7 @@
 # OpenGL ES libraries). Additional dependencies are specified by the
 # components. The optional components are:
 #
+#  AnimationTools               - AnimationTools library
 #  AnyAudioImporter             - Any audio importer
 #  AnyImageConverter            - Any image converter
 #  AnyImageImporter             - Any image importer
@@ -386,6 +387,18 @@ if(NOT TARGET Magnum::Magnum)
     # Dependent libraries
     set_property(TARGET Magnum::Magnum APPEND PROPERTY INTERFACE_LINK_LIBRARIES
          Corrade::Utility)
+
+    # With CORRADE_BUILD_MULTITHREADED, the multithreaded
+    # Animation::Player::advance() uses std::thread. The library links to
+    # Threads::Threads privately, so it has to be propagated only for static
+    # builds. The multithreaded APIs in MeshTools, SceneTools, Trade and
+    # ObjImporter then get it transitively through Magnum::Magnum.
+    if(MAGNUM_BUILD_STATIC AND CORRADE_BUILD_MULTITHREADED)
+        set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+        find_package(Threads REQUIRED)
+        set_property(TARGET Magnum::Magnum APPEND PROPERTY
+            INTERFACE_LINK_LIBRARIES Threads::Threads)
+    endif()
 else()
     set(MAGNUM_LIBRARY Magnum::Magnum)
 endif()
@@ -393,8 +406,8 @@ endif()
 # Component distinction (listing them explicitly to avoid mistakes with finding
 # components from other repositories)
 set(_MAGNUM_LIBRARY_COMPONENTS
-    Audio DebugTools GL MaterialTools MeshTools Primitives SceneGraph
-    SceneTools Shaders ShaderTools Text TextureTools Trade
+    AnimationTools Audio DebugTools GL MaterialTools MeshTools Primitives
+    SceneGraph SceneTools Shaders ShaderTools Text TextureTools Trade
     WindowlessEglApplication EglContext OpenGLTester)
 # These libraries are excluded from DLL detection if Magnum is built as shared.
 # Additionally, all *Application and *Context libraries are excluded as well.
@@ -463,6 +476,8 @@ if(MAGNUM_TARGET_GL)
     set(_MAGNUM_DebugTools_GL_DEPENDENCY_IS_OPTIONAL ON)
 endif()
 
+set(_MAGNUM_AnimationTools_DEPENDENCIES Trade)
+
 set(_MAGNUM_MaterialTools_DEPENDENCIES Trade)
 
 set(_MAGNUM_MeshTools_DEPENDENCIES Trade)
@@ -581,6 +596,7 @@ endif()
 
 # Special cases of include paths. Libraries not listed here have a path suffix
 # and include name derived from the library name in the loop below.
+set(_MAGNUM_ANIMATIONTOOLS_INCLUDE_PATH_NAMES Compress.h)
 set(_MAGNUM_MATERIALTOOLS_INCLUDE_PATH_NAMES PhongToPbrMetallicRoughness.h)
 set(_MAGNUM_MESHTOOLS_INCLUDE_PATH_NAMES CompressIndices.h)
 set(_MAGNUM_OPENGLTESTER_INCLUDE_PATH_SUFFIX Magnum/GL)
@@ -1028,6 +1044,8 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
             # No additional dependencies for CGL context
             # No additional dependencies for WGL context
 
+        # No special setup for AnimationTools library
+
         # Audio library
         elseif(_component STREQUAL Audio)
             find_package(OpenAL)
@@ -58,6 +58,7 @@ cmake .. \
     -DCMAKE_PREFIX_PATH=$HOME/deps \
     -DCMAKE_BUILD_TYPE=Release \
     -DCORRADE_RC_EXECUTABLE=$HOME/deps-native/bin/corrade-rc \
+    -DMAGNUM_WITH_ANIMATIONTOOLS=OFF \
     -DMAGNUM_WITH_AUDIO=OFF \
     `# Needed by VkMeshVkTest, together with TgaImporter and AnyImageImporter` \
     -DMAGNUM_WITH_DEBUGTOOLS=ON \
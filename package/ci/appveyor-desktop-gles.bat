@@ -28,6 +28,7 @@ cmake .. ^
     -DMAGNUM_TARGET_GLES=ON ^
     -DMAGNUM_TARGET_GLES2=%TARGET_GLES2% ^
     -DMAGNUM_TARGET_EGL=OFF ^
+    -DMAGNUM_WITH_ANIMATIONTOOLS=OFF ^
     -DMAGNUM_WITH_AUDIO=OFF ^
     -DMAGNUM_WITH_MATERIALTOOLS=OFF ^
     -DMAGNUM_WITH_SCENETOOLS=OFF ^
@@ -24,6 +24,7 @@ cmake .. \
     -DCMAKE_INSTALL_RPATH=$HOME/swiftshader/lib \
     -DMAGNUM_TARGET_GLES=ON \
     -DMAGNUM_TARGET_GLES2=$TARGET_GLES2 \
+    -DMAGNUM_WITH_ANIMATIONTOOLS=OFF \
     -DMAGNUM_WITH_AUDIO=OFF \
     -DMAGNUM_WITH_MATERIALTOOLS=OFF \
     -DMAGNUM_WITH_SCENETOOLS=OFF \
@@ -32,6 +32,7 @@ cmake .. \
     -DCMAKE_PREFIX_PATH="$HOME/deps;$HOME/vulkan-loader" \
     -DCMAKE_INSTALL_PREFIX=$HOME/deps \
     -DCMAKE_BUILD_TYPE=Debug \
+    -DMAGNUM_WITH_ANIMATIONTOOLS=OFF \
     -DMAGNUM_WITH_AUDIO=OFF \
     `# Needed by VkImageVkTest, and by VkMeshVkTest, together with` \
     `# TgaImporter and AnyImageImporter` \
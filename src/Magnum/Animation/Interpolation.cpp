@@ -26,6 +26,9 @@
 
 #include "Interpolation.h"
 
+#include <cmath>
+#include <Corrade/Utility/Algorithms.h>
+
 #include "Magnum/Math/CubicHermite.h"
 #include "Magnum/Math/DualQuaternion.h"
 
@@ -120,6 +123,76 @@ template<class T> auto TypeTraits<Math::CubicHermite<T>, T>::interpolator(Interp
     CORRADE_ASSERT_UNREACHABLE("Animation::interpolatorFor(): can't deduce interpolator function for" << interpolation, {});
 }
 
+template<class T> void BatchTraits<Math::Quaternion<T>, Math::Quaternion<T>>::interpolate(const Interpolation interpolation, const Containers::StridedArrayView1D<const Math::Quaternion<T>>& a, const Containers::StridedArrayView1D<const Math::Quaternion<T>>& b, const Float t, const Containers::StridedArrayView1D<Math::Quaternion<T>>& destination) {
+    if(interpolation == Interpolation::Constant) {
+        Utility::copy(t >= 1.0f ? b : a, destination);
+        return;
+    }
+    if(interpolation != Interpolation::Linear) {
+        BatchTraitsFallback<Math::Quaternion<T>, Math::Quaternion<T>>::interpolate(interpolation, a, b, t, destination);
+        return;
+    }
+
+    /* The same calculation as in Math::slerpShortestPath(), but done on blocks
+       of quaternions with their components deinterleaved. The dot product,
+       the shortest path flip and the final weighted sum are then each a loop
+       over plain arrays and only the acos() and sin() calls stay scalar. */
+    constexpr std::size_t BlockSize = 16;
+    T componentsA[4][BlockSize];
+    T componentsB[4][BlockSize];
+    T cosHalfAngle[BlockSize];
+    T weightA[BlockSize];
+    T weightB[BlockSize];
+    T divisor[BlockSize];
+    for(std::size_t offset = 0, max = destination.size(); offset < max; offset += BlockSize) {
+        const std::size_t count = Math::min(max - offset, BlockSize);
+
+        for(std::size_t i = 0; i != count; ++i) {
+            const Math::Quaternion<T>& qa = a[offset + i];
+            const Math::Quaternion<T>& qb = b[offset + i];
+            for(std::size_t c = 0; c != 4; ++c) {
+                componentsA[c][i] = qa.data()[c];
+                componentsB[c][i] = qb.data()[c];
+            }
+        }
+
+        for(std::size_t i = 0; i != count; ++i)
+            cosHalfAngle[i] =
+                componentsA[0][i]*componentsB[0][i] +
+                componentsA[1][i]*componentsB[1][i] +
+                componentsA[2][i]*componentsB[2][i] +
+                componentsA[3][i]*componentsB[3][i];
+
+        for(std::size_t c = 0; c != 4; ++c)
+            for(std::size_t i = 0; i != count; ++i)
+                componentsA[c][i] = cosHalfAngle[i] < T(0) ? -componentsA[c][i] : componentsA[c][i];
+
+        /* Quaternions that are very close fall back to a linear interpolation
+           to avoid division by zero, which is the same as a slerp with the
+           weights being the interpolation factor and a divisor of 1 */
+        for(std::size_t i = 0; i != count; ++i) {
+            const T absCosHalfAngle = std::abs(cosHalfAngle[i]);
+            if(absCosHalfAngle >= T(1) - Math::TypeTraits<T>::epsilon()) {
+                weightA[i] = T(1) - T(t);
+                weightB[i] = T(t);
+                divisor[i] = T(1);
+            } else {
+                const T angle = std::acos(absCosHalfAngle);
+                weightA[i] = std::sin((T(1) - T(t))*angle);
+                weightB[i] = std::sin(T(t)*angle);
+                divisor[i] = std::sin(angle);
+            }
+        }
+
+        for(std::size_t c = 0; c != 4; ++c)
+            for(std::size_t i = 0; i != count; ++i)
+                componentsA[c][i] = (weightA[i]*componentsA[c][i] + weightB[i]*componentsB[c][i])/divisor[i];
+
+        for(std::size_t i = 0; i != count; ++i)
+            destination[offset + i] = Math::Quaternion<T>{{componentsA[0][i], componentsA[1][i], componentsA[2][i]}, componentsA[3][i]};
+    }
+}
+
 template struct MAGNUM_EXPORT TypeTraits<Math::Complex<Float>, Math::Complex<Float>>;
 template struct MAGNUM_EXPORT TypeTraits<Math::Quaternion<Float>, Math::Quaternion<Float>>;
 template struct MAGNUM_EXPORT TypeTraits<Math::DualQuaternion<Float>, Math::DualQuaternion<Float>>;
@@ -128,6 +201,7 @@ template struct MAGNUM_EXPORT TypeTraits<Math::CubicHermite<Math::Vector2<Float>
 template struct MAGNUM_EXPORT TypeTraits<Math::CubicHermite<Math::Vector3<Float>>, Math::Vector3<Float>>;
 template struct MAGNUM_EXPORT TypeTraits<Math::CubicHermite<Math::Complex<Float>>, Math::Complex<Float>>;
 template struct MAGNUM_EXPORT TypeTraits<Math::CubicHermite<Math::Quaternion<Float>>, Math::Quaternion<Float>>;
+template struct MAGNUM_EXPORT BatchTraits<Math::Quaternion<Float>, Math::Quaternion<Float>>;
 
 }
 
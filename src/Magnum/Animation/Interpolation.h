@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
+ * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::interpolateInto(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
  */
 
 #include <Corrade/Containers/StridedArrayView.h>
@@ -224,6 +224,68 @@ Used internally from @ref Track::atStrict() / @ref TrackView::atStrict(), see
 */
 template<class K, class V, class R = ResultOf<V>> R interpolateStrict(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint);
 
+/**
+@brief Interpolate many animation tracks sharing the same keys
+@tparam K           Key type
+@tparam V           Value type
+@tparam R           Result type
+@param keys         Keys
+@param values       Values, first dimension being keyframes and second tracks
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@param hint         Hint for keyframe search
+@param destination  Where to put the interpolated values, one for each track
+@m_since_latest
+
+Batch variant of @ref interpolate() for tracks that share the same keyframe
+times, which is common for skeletal animations where all joints are keyed at
+the same time. The keyframe search and the interpolation factor calculation is
+done just once for all tracks, after which @p interpolator is called for each
+track with values from two consecutive rows of @p values, giving the same
+results as if @ref interpolate() was called for each track separately. If
+the rows of @p values and @p destination are contiguous, the final loop is
+a linear pass over memory.
+
+Only the keyframe search is shared, @p interpolator is still called through a
+function pointer for each track separately. Use the
+@ref interpolateInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Extrapolation, Extrapolation, Interpolation, K, std::size_t&, const Containers::StridedArrayView1D<R>&)
+overload to have the builtin interpolators inlined into the per-track loop.
+
+Expects that the first dimension of @p values has the same size as @p keys and
+the second dimension has the same size as @p destination.
+@see @ref Player::addInto()
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination);
+
+/**
+@brief Interpolate many animation tracks sharing the same keys using a builtin interpolator
+@m_since_latest
+
+Compared to @ref interpolateInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Extrapolation, Extrapolation, R(*)(const V&, const V&, Float), K, std::size_t&, const Containers::StridedArrayView1D<R>&)
+the interpolator isn't called through a function pointer but is picked from
+@p interpolation once for all tracks, giving the same results as the function
+returned by @ref interpolatorFor():
+
+-   @ref Interpolation::Constant copies one of the two keyframe rows of
+    @p values to @p destination
+-   @ref Interpolation::Linear for scalar and vector types is a
+    @ref Math::lerp() loop with the interpolation factor shared by all
+    tracks, which the compiler can vectorize if the rows of @p values and
+    @p destination are contiguous
+-   @ref Interpolation::Linear for @ref Math::Quaternion is a
+    @ref Math::slerpShortestPath() done on blocks of tracks with their
+    components deinterleaved, so everything except the trigonometric
+    functions is a linear pass over each component
+
+Other value types and interpolation modes fall back to calling the
+@ref interpolatorFor() result for each track.
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Extrapolation before, Extrapolation after, Interpolation interpolation, K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination);
+
 /**
 @brief Combine easing function and an interpolator
 
@@ -467,6 +529,127 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
         Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
 }
 
+namespace Implementation {
+
+/* Keyframe search shared by both interpolateInto() overloads, the same logic
+   as in interpolate(). Returns false if the result should be
+   default-constructed, otherwise fills the two keyframes and the
+   interpolation factor. */
+template<class K> bool interpolateIntoKeyframes(const Containers::StridedArrayView1D<const K>& keys, const Extrapolation before, const Extrapolation after, K frame, std::size_t& hint, std::size_t& first, std::size_t& second, Float& factor) {
+    first = second = 0;
+    factor = 0.0f;
+
+    if(!keys.size()) return false;
+
+    if(keys.size() == 1)
+        return !((frame < keys[0] && before == Extrapolation::DefaultConstructed) ||
+                 (frame > keys[0] && after == Extrapolation::DefaultConstructed));
+
+    /* Rewind from the beginning if hint is too late */
+    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
+
+    /* Go through the keys until we find a pair that is around given time */
+    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
+        ++hint;
+
+    bool defaultConstructed = false;
+    if(frame < keys[hint]) {
+        if(before == Extrapolation::DefaultConstructed) defaultConstructed = true;
+        if(before == Extrapolation::Constant) frame = keys[hint];
+    } else if(frame >= keys[hint + 1]) {
+        if(after == Extrapolation::DefaultConstructed) defaultConstructed = true;
+        if(after == Extrapolation::Constant) frame = keys[hint + 1];
+    }
+
+    first = hint;
+    second = hint + 1;
+    factor = Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+    return !defaultConstructed;
+}
+
+/* Interpolating two keyframe rows into the destination. The generic variant
+   calls the interpolatorFor() result for each track. */
+template<class V, class R> struct BatchTraitsFallback {
+    static void interpolate(Interpolation interpolation, const Containers::StridedArrayView1D<const V>& a, const Containers::StridedArrayView1D<const V>& b, Float t, const Containers::StridedArrayView1D<R>& destination) {
+        const auto interpolator = TypeTraits<V, R>::interpolator(interpolation);
+        #ifdef CORRADE_GRACEFUL_ASSERT
+        if(!interpolator) return;
+        #endif
+        for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+            destination[i] = interpolator(a[i], b[i], t);
+    }
+};
+template<class V, class R> struct BatchTraits: BatchTraitsFallback<V, R> {};
+
+/* Scalar and vector types with the interpolators inlined */
+template<class V> struct BatchTraits<V, V> {
+    static void interpolate(Interpolation interpolation, const Containers::StridedArrayView1D<const V>& a, const Containers::StridedArrayView1D<const V>& b, Float t, const Containers::StridedArrayView1D<V>& destination) {
+        if(interpolation == Interpolation::Constant) {
+            const Containers::StridedArrayView1D<const V>& source = t >= 1.0f ? b : a;
+            for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+                destination[i] = source[i];
+        } else if(interpolation == Interpolation::Linear) {
+            for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+                destination[i] = Math::lerp(a[i], b[i], t);
+        } else BatchTraitsFallback<V, V>::interpolate(interpolation, a, b, t, destination);
+    }
+};
+
+/* Types where linear interpolation isn't a lerp() */
+template<> struct BatchTraits<bool, bool>: BatchTraitsFallback<bool, bool> {};
+template<std::size_t size> struct BatchTraits<Math::BitVector<size>, Math::BitVector<size>>: BatchTraitsFallback<Math::BitVector<size>, Math::BitVector<size>> {};
+template<class T> struct BatchTraits<Math::Complex<T>, Math::Complex<T>>: BatchTraitsFallback<Math::Complex<T>, Math::Complex<T>> {};
+template<class T> struct BatchTraits<Math::DualQuaternion<T>, Math::DualQuaternion<T>>: BatchTraitsFallback<Math::DualQuaternion<T>, Math::DualQuaternion<T>> {};
+
+/* Quaternions, with the slerp done on deinterleaved components */
+template<class T> struct
+#ifndef CORRADE_TARGET_CLANG_CL
+/* Clang-CL complains that it's ignored if it's on the class, so putting it
+   on the function instead. However MSVC doesn't like that, so doing this only
+   for Clang-CL. */
+MAGNUM_EXPORT
+#endif
+BatchTraits<Math::Quaternion<T>, Math::Quaternion<T>> {
+    static
+    #ifdef CORRADE_TARGET_CLANG_CL
+    MAGNUM_EXPORT
+    #endif
+    void interpolate(Interpolation interpolation, const Containers::StridedArrayView1D<const Math::Quaternion<T>>& a, const Containers::StridedArrayView1D<const Math::Quaternion<T>>& b, Float t, const Containers::StridedArrayView1D<Math::Quaternion<T>>& destination);
+};
+
+}
+
+template<class K, class V, class R> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateInto(): keys and values don't have the same size", );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateInto(): values and destination don't have the same track count", );
+
+    std::size_t first, second;
+    Float factor;
+    if(!Implementation::interpolateIntoKeyframes(keys, before, after, frame, hint, first, second, factor)) {
+        for(R& i: destination) i = R{};
+        return;
+    }
+
+    const Containers::StridedArrayView1D<const V> firstValues = values[first];
+    const Containers::StridedArrayView1D<const V> secondValues = values[second];
+    for(std::size_t i = 0, max = destination.size(); i != max; ++i)
+        destination[i] = interpolator(firstValues[i], secondValues[i], factor);
+}
+
+template<class K, class V, class R> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Extrapolation before, const Extrapolation after, const Interpolation interpolation, K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0], "Animation::interpolateInto(): keys and values don't have the same size", );
+    CORRADE_ASSERT(destination.size() == values.size()[1], "Animation::interpolateInto(): values and destination don't have the same track count", );
+
+    std::size_t first, second;
+    Float factor;
+    if(!Implementation::interpolateIntoKeyframes(keys, before, after, frame, hint, first, second, factor)) {
+        for(R& i: destination) i = R{};
+        return;
+    }
+
+    Implementation::BatchTraits<typename std::remove_const<V>::type, R>::interpolate(interpolation, values[first], values[second], factor, destination);
+}
+
 }}
 
 #endif
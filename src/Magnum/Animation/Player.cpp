@@ -26,8 +26,30 @@
 
 #include "Player.hpp"
 
+#include "Magnum/Implementation/parallelFor.h"
+
 namespace Magnum { namespace Animation {
 
+namespace Implementation {
+
+namespace {
+
+/* Interpolating a track is in the order of tens of nanoseconds, while
+   spawning a thread is in the order of tens of microseconds, so it makes
+   sense to spawn a thread only if it has enough work to do */
+constexpr std::size_t MinTracksPerThread = 256;
+
+}
+
+void playerParallelFor(const UnsignedInt threadCount, const std::size_t count, void(*const function)(std::size_t, std::size_t, void*), void* const state) {
+    const std::size_t chunkCount = Math::max(Math::min(std::size_t(Magnum::Implementation::parallelForThreadCount(threadCount)), count/MinTracksPerThread), std::size_t{1});
+    Magnum::Implementation::parallelFor(chunkCount, count, [function, state](std::size_t, const std::size_t begin, const std::size_t end) {
+        function(begin, end, state);
+    });
+}
+
+}
+
 Debug& operator<<(Debug& debug, const State value) {
     debug << "Animation::State" << Debug::nospace;
 
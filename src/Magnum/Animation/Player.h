@@ -32,6 +32,7 @@
 
 #include <chrono>
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Animation/Track.h"
 #include "Magnum/Math/Range.h"
@@ -73,6 +74,19 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, State value);
 
 namespace Implementation {
     template<class, class> struct DefaultScaler;
+
+    /* Defined in Player.cpp to not need <thread> in the (installed) Player.hpp
+       header. Calls function(begin, end, state) on up to threadCount threads
+       with contiguous [begin, end) ranges covering [0, count). */
+    MAGNUM_EXPORT void playerParallelFor(UnsignedInt threadCount, std::size_t count, void(*function)(std::size_t, std::size_t, void*), void* state);
+
+    /* Type-erased values and destination of a track batch added with
+       Player::addInto(). Heap-allocated so the pointer passed to the advancer
+       stays valid when more tracks get added. */
+    struct PlayerBatch {
+        Containers::StridedArrayView2D<const void> values;
+        Containers::StridedArrayView1D<void> destination;
+    };
 }
 
 /**
@@ -119,6 +133,12 @@ interpolated value changes, which is useful for triggering other events. See
 @ref addRawCallback() that allows for greater control and further performance
 optimizations. See its documentation for a usage example code snippet.
 
+If many tracks share the same keys, which is common for skeletal animations,
+it's possible to add them all at once with @ref addInto(). The keyframe search
+is then done just once for the whole batch and the results are written to a
+contiguous destination view using @ref interpolateInto(), with the builtin
+interpolators inlined.
+
 The animation is implicitly played only once, use @ref setPlayCount() to set a
 number of repeats or make it repeat indefinitely. By default, the
 @ref duration() of an animation is calculated implicitly from all added tracks.
@@ -268,6 +288,49 @@ template<class T, class K
          */
         static void advance(T time, std::initializer_list<Containers::Reference<Player<T, K>>> players);
 
+        /**
+         * @brief Advance multiple players at the same time on multiple threads
+         * @param time          Time
+         * @param players       Players to advance
+         * @param threadCount   Count of threads to use. If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         * @m_since_latest
+         *
+         * Updates the playback state of each player the same way as
+         * @ref advance(T), and then interpolates tracks added with
+         * @ref add() from all players that are currently playing on up to
+         * @p threadCount threads. The tracks are split across threads
+         * independently of which player they belong to, so a single player
+         * with many tracks gets parallelized as well. Each thread
+         * gets at least a few hundred tracks in order to amortize the cost of
+         * spawning the threads, so for small players the work is done
+         * on just the calling thread.
+         *
+         * Tracks added with @ref addWithCallback(),
+         * @ref addWithCallbackOnChange() or @ref addRawCallback() are then
+         * advanced on the calling thread, after all @ref add() tracks are
+         * updated. The callbacks are fired in the order of @p players and,
+         * within each player, in the order in which the tracks were added,
+         * so callback order is the same for any @p threadCount. Unlike
+         * @ref advance(T), a callback thus always sees destination
+         * locations of all @ref add() tracks already updated for given
+         * @p time.
+         *
+         * Expects that the destination locations of @ref add() tracks are
+         * distinct from each other. If Corrade isn't built with
+         * @ref CORRADE_BUILD_MULTITHREADED or threads aren't available on
+         * given platform, such as on Emscripten without
+         * @cb{.sh} -pthread @ce, the work is done serially on the calling
+         * thread with the same result.
+         */
+        static void advance(T time, Containers::ArrayView<const Containers::Reference<Player<T, K>>> players, UnsignedInt threadCount);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        static void advance(T time, std::initializer_list<Containers::Reference<Player<T, K>>> players, UnsignedInt threadCount);
+
         /** @brief Constructor */
         explicit Player();
 
@@ -635,6 +698,56 @@ template<class T, class K
         }
         #endif
 
+        /**
+         * @brief Add a batch of tracks sharing the same keys
+         * @param keys          Keys shared by all tracks
+         * @param values        Values, first dimension being keyframes and
+         *      second tracks
+         * @param interpolation Interpolation mode
+         * @param before        Extrapolation mode before first keyframe
+         * @param after         Extrapolation mode after last keyframe
+         * @param destination   Where to put the interpolated values, one for
+         *      each track
+         * @m_since_latest
+         *
+         * The @p destination is updated with new values after each call to
+         * @ref advance() as long as the animation is playing, using
+         * @ref interpolateInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Extrapolation, Extrapolation, Interpolation, K, std::size_t&, const Containers::StridedArrayView1D<R>&).
+         * The whole batch counts as a single track in @ref size(), with
+         * @ref track() returning the first track of the batch. Ownership of
+         * the data is *not* transferred to the @ref Player and you have to
+         * ensure that both the @p keys, @p values and @p destination are kept
+         * in scope for the whole lifetime of the @ref Player instance.
+         *
+         * Expects that the first dimension of @p values has the same size as
+         * @p keys, the second dimension has the same size as @p destination
+         * and that there's at least one track.
+         */
+        template<class V, class R = ResultOf<V>> Player<T, K>& addInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Interpolation interpolation, Extrapolation before, Extrapolation after, const Containers::StridedArrayView1D<R>& destination);
+
+        /**
+         * @overload
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref addInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Interpolation, Extrapolation, Extrapolation, const Containers::StridedArrayView1D<R>&)
+         * with both @p before and @p after set to @p extrapolation.
+         */
+        template<class V, class R = ResultOf<V>> Player<T, K>& addInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Interpolation interpolation, Extrapolation extrapolation, const Containers::StridedArrayView1D<R>& destination) {
+            return addInto(keys, values, interpolation, extrapolation, extrapolation, destination);
+        }
+
+        /**
+         * @overload
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref addInto(const Containers::StridedArrayView1D<const K>&, const Containers::StridedArrayView2D<const V>&, Interpolation, Extrapolation, Extrapolation, const Containers::StridedArrayView1D<R>&)
+         * with both @p before and @p after set to
+         * @ref Extrapolation::Constant.
+         */
+        template<class V, class R = ResultOf<V>> Player<T, K>& addInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Interpolation interpolation, const Containers::StridedArrayView1D<R>& destination) {
+            return addInto(keys, values, interpolation, Extrapolation::Constant, Extrapolation::Constant, destination);
+        }
+
         /**
          * @brief State
          *
@@ -806,11 +919,13 @@ template<class T, class K
     private:
         struct Track;
 
-        Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData);
+        Player<T, K>& addInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, bool hasCallback = true);
+        Player<T, K>& addBatchInternal(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), const Containers::StridedArrayView2D<const void>& values, const Containers::StridedArrayView1D<void>& destination);
 
         Containers::Optional<std::pair<UnsignedInt, K>> elapsedInternal(T time, T& updatedStartTime, T& updatedPauseTime, State& updatedState) const;
 
         Containers::Array<Track> _tracks;
+        Containers::Array<Containers::Pointer<Implementation::PlayerBatch>> _batches;
         Math::Range1D<K> _duration;
         UnsignedInt _playCount{1};
         State _state{State::Stopped};
@@ -822,7 +937,7 @@ template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>
     return addInternal(track,
         [](const TrackViewStorage<const K>& track, K key, std::size_t& hint, void* destination, void(*)(), void*) {
             *static_cast<R*>(destination) = static_cast<const TrackView<const K, const V, R>&>(track).at(key, hint);
-        }, &destination, nullptr, nullptr);
+        }, &destination, nullptr, nullptr, false);
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -874,6 +989,23 @@ template<class T, class K> template<class V, class R, class Callback> Player<T,
 }
 #endif
 
+template<class T, class K> template<class V, class R> Player<T, K>& Player<T, K>::addInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Interpolation interpolation, const Extrapolation before, const Extrapolation after, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0],
+        "Animation::Player::addInto(): expected" << keys.size() << "keyframes but got" << values.size()[0], *this);
+    CORRADE_ASSERT(destination.size() == values.size()[1],
+        "Animation::Player::addInto(): expected" << values.size()[1] << "destination items but got" << destination.size(), *this);
+    CORRADE_ASSERT(values.size()[1],
+        "Animation::Player::addInto(): expected at least one track", *this);
+    /* The first track of the batch is what's exposed through track(), the
+       advancer then interpolates all of them */
+    return addBatchInternal(
+        TrackView<const K, const V, R>{keys, values.template transposed<0, 1>()[0], interpolation, before, after},
+        [](const TrackViewStorage<const K>& track, K key, std::size_t& hint, void* batch, void(*)(), void*) {
+            const Implementation::PlayerBatch& b = *static_cast<const Implementation::PlayerBatch*>(batch);
+            interpolateInto<K, V, R>(track.keys(), Containers::arrayCast<const V>(b.values), track.before(), track.after(), track.interpolation(), key, hint, Containers::arrayCast<R>(b.destination));
+        }, values, destination);
+}
+
 #if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
 extern template class MAGNUM_EXPORT Player<Float, Float>;
 extern template class MAGNUM_EXPORT Player<std::chrono::nanoseconds, Float>;
@@ -62,7 +62,7 @@ namespace Implementation {
 template<class T, class K> struct Player<T, K>::Track  {
     /* Not sure why is this still needed for emplace_back(). It's 2018,
        COME ON  ¯\_(ツ)_/¯ */
-    /*implicit*/ Track(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, std::size_t hint) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, hint{hint} {}
+    /*implicit*/ Track(const TrackViewStorage<const K>& track, void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* destination, void(*userCallback)(), void* userCallbackData, std::size_t hint, bool hasCallback) noexcept: track{track}, advancer{advancer}, destination{destination}, userCallback{userCallback}, userCallbackData{userCallbackData}, hint{hint}, hasCallback{hasCallback} {}
 
     TrackViewStorage<const K> track;
     void (*advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*);
@@ -70,6 +70,9 @@ template<class T, class K> struct Player<T, K>::Track  {
     void(*userCallback)();
     void* userCallbackData;
     std::size_t hint;
+    /* Tracks without a callback only write to their destination and thus
+       can be advanced in parallel */
+    bool hasCallback;
 };
 #endif
 
@@ -102,15 +105,20 @@ template<class T, class K> const TrackViewStorage<const K>& Player<T, K>::track(
     return _tracks[i].track;
 }
 
-template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData) {
+template<class T, class K> Player<T, K>& Player<T, K>::addInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), void* const destination, void(*const userCallback)(), void* const userCallbackData, const bool hasCallback) {
     if(_tracks.isEmpty() && _duration == Math::Range1D<K>{})
         _duration = track.duration();
     else
         _duration = Math::join(track.duration(), _duration);
-    arrayAppend(_tracks, InPlaceInit, track, advancer, destination, userCallback, userCallbackData, 0u);
+    arrayAppend(_tracks, InPlaceInit, track, advancer, destination, userCallback, userCallbackData, 0u, hasCallback);
     return *this;
 }
 
+template<class T, class K> Player<T, K>& Player<T, K>::addBatchInternal(const TrackViewStorage<const K>& track, void(*const advancer)(const TrackViewStorage<const K>&, K, std::size_t&, void*, void(*)(), void*), const Containers::StridedArrayView2D<const void>& values, const Containers::StridedArrayView1D<void>& destination) {
+    arrayAppend(_batches, Containers::Pointer<Implementation::PlayerBatch>{new Implementation::PlayerBatch{values, destination}});
+    return addInternal(track, advancer, _batches.back().get(), nullptr, nullptr, false);
+}
+
 template<class T, class K> Player<T, K>& Player<T, K>::play(T startTime) {
     /* In case we were paused, move start time backwards by the duration that
        was already played back */
@@ -309,6 +317,41 @@ template<class T, class K> Player<T, K>& Player<T, K>::advance(const T time) {
     return *this;
 }
 
+template<class T, class K> void Player<T, K>::advance(const T time, const Containers::ArrayView<const Containers::Reference<Player<T, K>>> players, const UnsignedInt threadCount) {
+    /* Update state of all players serially and gather the tracks to advance
+       together with the key at which to advance them, the ones with callbacks
+       separately so they can be fired in a deterministic order */
+    Containers::Array<std::pair<Track*, K>> tracks;
+    Containers::Array<std::pair<Track*, K>> callbackTracks;
+    for(Player<T, K>& p: players) {
+        const Containers::Optional<std::pair<UnsignedInt, K>> elapsed = Implementation::playerElapsed(p._duration.size(), p._playCount, p._scaler, time, p._startTime, p._stopPauseTime, p._state);
+        if(!elapsed) continue;
+
+        /* Properly handle durations that don't start at 0 */
+        const K key = p._duration.min() + elapsed->second;
+        for(Track& t: p._tracks)
+            arrayAppend(t.hasCallback ? callbackTracks : tracks, InPlaceInit, &t, key);
+    }
+
+    /* Tracks without callbacks each write to a different location and have
+       their own hint, so they can be advanced in parallel */
+    Implementation::playerParallelFor(threadCount, tracks.size(), [](const std::size_t begin, const std::size_t end, void* const state) {
+        for(const std::pair<Track*, K>& i: static_cast<Containers::Array<std::pair<Track*, K>>*>(state)->slice(begin, end)) {
+            Track& t = *i.first;
+            t.advancer(t.track, i.second, t.hint, t.destination, t.userCallback, t.userCallbackData);
+        }
+    }, &tracks);
+
+    for(const std::pair<Track*, K>& i: callbackTracks) {
+        Track& t = *i.first;
+        t.advancer(t.track, i.second, t.hint, t.destination, t.userCallback, t.userCallbackData);
+    }
+}
+
+template<class T, class K> void Player<T, K>::advance(const T time, const std::initializer_list<Containers::Reference<Player<T, K>>> players, const UnsignedInt threadCount) {
+    advance(time, Containers::ArrayView<const Containers::Reference<Player<T, K>>>{players.begin(), players.size()}, threadCount);
+}
+
 }}
 
 #endif
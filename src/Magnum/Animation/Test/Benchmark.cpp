@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Reference.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Animation/Player.h"
@@ -51,6 +53,14 @@ struct Benchmark: TestSuite::Tester {
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
 
+    void playerAdvanceManyTracks();
+    void playerAdvanceManyTracksInto();
+    void playerAdvanceManyPlayers();
+    void playerAdvanceManyPlayersThreaded();
+    void interpolateManyTracks();
+    void interpolateIntoManyTracks();
+    void interpolateIntoManyTracksInterpolation();
+
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
     Containers::Array<std::pair<Float, Int>> _interleaved;
@@ -58,10 +68,11 @@ struct Benchmark: TestSuite::Tester {
     Containers::StridedArrayView1D<const Int> _valuesInterleaved;
     TrackView<const Float, const Int> _track;
     TrackView<const Float, const Int> _trackInterleaved;
+    Containers::Array<Float> _manyTrackValues;
 };
 
 namespace {
-    enum: std::size_t { DataSize = 2000 };
+    enum: std::size_t { DataSize = 2000, TrackCount = 64, PlayerCount = 32 };
 }
 
 Benchmark::Benchmark() {
@@ -81,7 +92,15 @@ Benchmark::Benchmark() {
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+
+                   &Benchmark::playerAdvanceManyTracks,
+                   &Benchmark::playerAdvanceManyTracksInto,
+                   &Benchmark::playerAdvanceManyPlayers,
+                   &Benchmark::playerAdvanceManyPlayersThreaded,
+                   &Benchmark::interpolateManyTracks,
+                   &Benchmark::interpolateIntoManyTracks,
+                   &Benchmark::interpolateIntoManyTracksInterpolation}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{DirectInit, DataSize, 1};
@@ -95,6 +114,9 @@ Benchmark::Benchmark() {
     _track = TrackView<const Float, const Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
+
+    /* TrackCount tracks sharing _keys, with keyframes in rows */
+    _manyTrackValues = Containers::Array<Float>{DirectInit, DataSize*TrackCount, 1.0f};
 }
 
 void Benchmark::interpolateEmpty() {
@@ -261,6 +283,123 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceManyTracks() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[TrackCount]{};
+    Player<Float> player;
+    for(std::size_t i = 0; i != TrackCount; ++i)
+        player.add(TrackView<const Float, const Float>{
+            Containers::arrayView(_keys),
+            values.transposed<0, 1>()[i], Math::lerp}, result[i]);
+    player.play({});
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            player.advance(i);
+    }
+    CORRADE_COMPARE(result[0], 1.0f);
+    CORRADE_COMPARE(result[TrackCount - 1], 1.0f);
+}
+
+void Benchmark::playerAdvanceManyTracksInto() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[TrackCount]{};
+    Player<Float> player;
+    player.addInto(_keys, values, Interpolation::Linear, Containers::stridedArrayView(result));
+    player.play({});
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            player.advance(i);
+    }
+    CORRADE_COMPARE(result[0], 1.0f);
+    CORRADE_COMPARE(result[TrackCount - 1], 1.0f);
+}
+
+void Benchmark::playerAdvanceManyPlayers() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[PlayerCount][TrackCount]{};
+    Player<Float> players[PlayerCount];
+    Containers::Array<Containers::Reference<Player<Float>>> playerReferences;
+    for(std::size_t i = 0; i != PlayerCount; ++i) {
+        arrayAppend(playerReferences, players[i]);
+        for(std::size_t j = 0; j != TrackCount; ++j)
+            players[i].add(TrackView<const Float, const Float>{
+                Containers::arrayView(_keys),
+                values.transposed<0, 1>()[j], Math::lerp}, result[i][j]);
+        players[i].play({});
+    }
+    CORRADE_BENCHMARK(10) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            for(Player<Float>& player: playerReferences) player.advance(i);
+    }
+    CORRADE_COMPARE(result[0][0], 1.0f);
+    CORRADE_COMPARE(result[PlayerCount - 1][TrackCount - 1], 1.0f);
+}
+
+void Benchmark::playerAdvanceManyPlayersThreaded() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[PlayerCount][TrackCount]{};
+    Player<Float> players[PlayerCount];
+    Containers::Array<Containers::Reference<Player<Float>>> playerReferences;
+    for(std::size_t i = 0; i != PlayerCount; ++i) {
+        arrayAppend(playerReferences, players[i]);
+        for(std::size_t j = 0; j != TrackCount; ++j)
+            players[i].add(TrackView<const Float, const Float>{
+                Containers::arrayView(_keys),
+                values.transposed<0, 1>()[j], Math::lerp}, result[i][j]);
+        players[i].play({});
+    }
+    CORRADE_BENCHMARK(10) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            Player<Float>::advance(i, playerReferences, 0);
+    }
+    CORRADE_COMPARE(result[0][0], 1.0f);
+    CORRADE_COMPARE(result[PlayerCount - 1][TrackCount - 1], 1.0f);
+}
+
+void Benchmark::interpolateManyTracks() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[TrackCount]{};
+    std::size_t hints[TrackCount]{};
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            for(std::size_t j = 0; j != TrackCount; ++j)
+                result[j] = interpolate<Float, Float>(_keys, values.transposed<0, 1>()[j], {}, {}, Math::lerp, i, hints[j]);
+    }
+    CORRADE_COMPARE(result[0], 1.0f);
+    CORRADE_COMPARE(result[TrackCount - 1], 1.0f);
+}
+
+void Benchmark::interpolateIntoManyTracks() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[TrackCount]{};
+    std::size_t hint{};
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            interpolateInto<Float, Float>(_keys, values, {}, {}, Math::lerp, i, hint, Containers::stridedArrayView(result));
+    }
+    CORRADE_COMPARE(result[0], 1.0f);
+    CORRADE_COMPARE(result[TrackCount - 1], 1.0f);
+}
+
+void Benchmark::interpolateIntoManyTracksInterpolation() {
+    const Containers::StridedArrayView2D<const Float> values{_manyTrackValues, {DataSize, TrackCount}};
+
+    Float result[TrackCount]{};
+    std::size_t hint{};
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            interpolateInto<Float, Float>(_keys, values, {}, {}, Interpolation::Linear, i, hint, Containers::stridedArrayView(result));
+    }
+    CORRADE_COMPARE(result[0], 1.0f);
+    CORRADE_COMPARE(result[TrackCount - 1], 1.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
@@ -78,6 +78,18 @@ struct InterpolationTest: TestSuite::Tester {
     void interpolateIntegerKey();
     void interpolateStrictIntegerKey();
 
+    void interpolateInto();
+    void interpolateIntoSingleKeyframe();
+    void interpolateIntoNoKeyframe();
+    void interpolateIntoHint();
+    void interpolateIntoError();
+    void interpolateIntoInterpolation();
+    void interpolateIntoInterpolationConstant();
+    void interpolateIntoInterpolationQuaternion();
+    void interpolateIntoInterpolationQuaternionConstant();
+    void interpolateIntoInterpolationFallback();
+    void interpolateIntoInterpolationInvalid();
+
     void ease();
     void easeClamped();
     void unpack();
@@ -200,7 +212,29 @@ InterpolationTest::InterpolationTest() {
               &InterpolationTest::interpolateStrictError,
 
               &InterpolationTest::interpolateIntegerKey,
-              &InterpolationTest::interpolateStrictIntegerKey,
+              &InterpolationTest::interpolateStrictIntegerKey});
+
+    addInstancedTests({&InterpolationTest::interpolateInto},
+                       Containers::arraySize(Data));
+
+    addInstancedTests({&InterpolationTest::interpolateIntoSingleKeyframe},
+                       Containers::arraySize(SingleKeyframeData));
+
+    addTests({&InterpolationTest::interpolateIntoNoKeyframe});
+
+    addInstancedTests({&InterpolationTest::interpolateIntoHint},
+                       Containers::arraySize(HintData));
+
+    addTests({&InterpolationTest::interpolateIntoError});
+
+    addInstancedTests({&InterpolationTest::interpolateIntoInterpolation},
+                       Containers::arraySize(Data));
+
+    addTests({&InterpolationTest::interpolateIntoInterpolationConstant,
+              &InterpolationTest::interpolateIntoInterpolationQuaternion,
+              &InterpolationTest::interpolateIntoInterpolationQuaternionConstant,
+              &InterpolationTest::interpolateIntoInterpolationFallback,
+              &InterpolationTest::interpolateIntoInterpolationInvalid,
 
               &InterpolationTest::ease,
               &InterpolationTest::easeClamped,
@@ -579,6 +613,228 @@ void InterpolationTest::interpolateStrictError() {
         "Animation::interpolateStrict(): keys and values don't have the same size\n");
 }
 
+/* Three tracks sharing Keys, the first is the same as Values, the second
+   scaled two times and the third negated */
+constexpr Float ValuesInto[]{
+    3.0f, 6.0f, -3.0f,
+    1.0f, 2.0f, -1.0f,
+    2.5f, 5.0f, -2.5f,
+    0.5f, 1.0f, -0.5f
+};
+
+void InterpolationTest::interpolateInto() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t hint{};
+    Float out[3];
+    Animation::interpolateInto<Float, Float>(
+        Keys, Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+        data.extrapolationBefore, data.extrapolationAfter,
+        Math::lerp, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(out[2], -data.expectedValue);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoSingleKeyframe() {
+    const auto& data = SingleKeyframeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t hint{};
+    Float out[3];
+    Animation::interpolateInto<Float, Float>(
+        Containers::arrayView(Keys).prefix(1),
+        Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}}.prefix(1),
+        data.extrapolation, data.extrapolation,
+        Math::lerp, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(out[2], -data.expectedValue);
+    CORRADE_COMPARE(hint, 0);
+}
+
+void InterpolationTest::interpolateIntoNoKeyframe() {
+    std::size_t hint{};
+    Float out[]{1.0f, 2.0f, 3.0f};
+    Animation::interpolateInto<Float, Float>(
+        nullptr, Containers::StridedArrayView2D<const Float>{Containers::ArrayView<const Float>{}, {0, 3}},
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Math::lerp, 3.5f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], Float{});
+    CORRADE_COMPARE(out[1], Float{});
+    CORRADE_COMPARE(out[2], Float{});
+    CORRADE_COMPARE(hint, 0);
+}
+
+void InterpolationTest::interpolateIntoHint() {
+    const auto& data = HintData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t hint = data.hint;
+    Float out[3];
+    Animation::interpolateInto<Float, Float>(
+        Keys, Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Math::lerp, 4.75f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], 1.0f);
+    CORRADE_COMPARE(out[1], 2.0f);
+    CORRADE_COMPARE(out[2], -1.0f);
+    CORRADE_COMPARE(hint, 2);
+}
+
+void InterpolationTest::interpolateIntoError() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float destination[3];
+    Float destinationWrongSize[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destination));
+    } {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float>(
+            Keys, Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, Containers::stridedArrayView(destinationWrongSize));
+    }
+
+    CORRADE_COMPARE(out,
+        "Animation::interpolateInto(): keys and values don't have the same size\n"
+        "Animation::interpolateInto(): values and destination don't have the same track count\n");
+}
+
+void InterpolationTest::interpolateIntoInterpolation() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t hint{};
+    Float out[3];
+    Animation::interpolateInto<Float, Float>(
+        Keys, Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+        data.extrapolationBefore, data.extrapolationAfter,
+        Interpolation::Linear, data.time, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(out[2], -data.expectedValue);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoInterpolationConstant() {
+    std::size_t hint{};
+    Float out[3];
+    /* Halfway between the second and third keyframe, should pick the
+       second */
+    Animation::interpolateInto<Float, Float>(
+        Keys, Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Interpolation::Constant, 3.0f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], 1.0f);
+    CORRADE_COMPARE(out[1], 2.0f);
+    CORRADE_COMPARE(out[2], -1.0f);
+    CORRADE_COMPARE(hint, 1);
+}
+
+void InterpolationTest::interpolateIntoInterpolationQuaternion() {
+    /* More tracks than the size of a block that's processed at once, with a
+       mix of quaternions that are far apart, ones that are on opposite
+       hemispheres and ones that are almost the same */
+    constexpr std::size_t TrackCount = 37;
+    const Float keys[]{0.0f, 2.0f};
+    Quaternion values[2][TrackCount];
+    for(std::size_t i = 0; i != TrackCount; ++i) {
+        values[0][i] = Quaternion::rotation(Deg(10.0f*i), Vector3::xAxis());
+        if(i % 3 == 0)
+            values[1][i] = Quaternion::rotation(Deg(170.0f - 5.0f*i), Vector3{1.0f, 1.0f, 0.0f}.normalized());
+        else if(i % 3 == 1)
+            values[1][i] = -Quaternion::rotation(Deg(45.0f + 2.0f*i), Vector3::zAxis());
+        else
+            values[1][i] = values[0][i];
+    }
+
+    std::size_t hint{};
+    Quaternion out[TrackCount];
+    Animation::interpolateInto<Float, Quaternion>(
+        keys, Containers::StridedArrayView2D<const Quaternion>{Containers::arrayView(&values[0][0], 2*TrackCount), {2, TrackCount}},
+        Extrapolation::Constant, Extrapolation::Constant,
+        Interpolation::Linear, 0.5f, hint, Containers::stridedArrayView(out));
+    for(std::size_t i = 0; i != TrackCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i], Math::slerpShortestPath(values[0][i], values[1][i], 0.25f));
+    }
+}
+
+void InterpolationTest::interpolateIntoInterpolationQuaternionConstant() {
+    const Float keys[]{0.0f, 2.0f};
+    const Quaternion values[]{
+        Quaternion::rotation(15.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(35.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(75.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(-25.0_degf, Vector3::zAxis())
+    };
+
+    std::size_t hint{};
+    Quaternion out[2];
+    Animation::interpolateInto<Float, Quaternion>(
+        keys, Containers::StridedArrayView2D<const Quaternion>{values, {2, 2}},
+        Extrapolation::Constant, Extrapolation::Constant,
+        Interpolation::Constant, 1.5f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], values[0]);
+    CORRADE_COMPARE(out[1], values[1]);
+
+    Animation::interpolateInto<Float, Quaternion>(
+        keys, Containers::StridedArrayView2D<const Quaternion>{values, {2, 2}},
+        Extrapolation::Constant, Extrapolation::Constant,
+        Interpolation::Constant, 2.0f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], values[2]);
+    CORRADE_COMPARE(out[1], values[3]);
+}
+
+void InterpolationTest::interpolateIntoInterpolationFallback() {
+    /* Complex numbers don't have an inlined variant, the interpolatorFor()
+       result should get used */
+    const Float keys[]{0.0f, 2.0f};
+    const Complex values[]{
+        Complex::rotation(15.0_degf),
+        Complex::rotation(-35.0_degf),
+        Complex::rotation(75.0_degf),
+        Complex::rotation(25.0_degf)
+    };
+
+    std::size_t hint{};
+    Complex out[2];
+    Animation::interpolateInto<Float, Complex>(
+        keys, Containers::StridedArrayView2D<const Complex>{values, {2, 2}},
+        Extrapolation::Constant, Extrapolation::Constant,
+        Interpolation::Linear, 1.0f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(out[0], Complex::rotation(45.0_degf));
+    CORRADE_COMPARE(out[1], Complex::rotation(-5.0_degf));
+}
+
+void InterpolationTest::interpolateIntoInterpolationInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::size_t hint{};
+    Float out[3];
+
+    Containers::String outError;
+    Error redirectError{&outError};
+    Animation::interpolateInto<Float, Float>(
+        Keys, Containers::StridedArrayView2D<const Float>{ValuesInto, {4, 3}},
+        Extrapolation::Constant, Extrapolation::Constant,
+        Interpolation::Spline, 1.0f, hint, Containers::stridedArrayView(out));
+    CORRADE_COMPARE(outError, "Animation::interpolatorFor(): can't deduce interpolator function for Animation::Interpolation::Spline\n");
+}
+
 void InterpolationTest::ease() {
     auto lerpQuadratic = Animation::ease<Float, Math::lerp, Easing::quadraticIn>();
 
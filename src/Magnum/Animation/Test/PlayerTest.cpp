@@ -63,6 +63,7 @@ struct PlayerTest: TestSuite::Tester {
     void advancePlayCountInfinite();
     void advanceChrono();
     void advanceList();
+    void advanceListThreaded();
     void advanceZeroDurationStop();
     void advanceZeroDurationPause();
     void advanceZeroDurationInfinitePlayCount();
@@ -87,6 +88,8 @@ struct PlayerTest: TestSuite::Tester {
     template<class T> void addWithCallbackOnChange();
     template<class T> void addWithCallbackOnChangeTemplate();
     template<class T> void addRawCallback();
+    void addInto();
+    void addIntoInvalid();
 
     void runFor100YearsFloat();
     void runFor100YearsChrono();
@@ -102,6 +105,15 @@ struct PlayerTest: TestSuite::Tester {
     Animation::TrackView<Float, Float> mutableView = mutableTrack;
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} AdvanceListThreadedData[]{
+    {"single thread", 1},
+    {"four threads", 4},
+    {"all hardware threads", 0}
+};
+
 const struct {
     const char* name;
     Float offsetFloat;
@@ -182,7 +194,12 @@ PlayerTest::PlayerTest() {
               &PlayerTest::addWithCallbackOnChangeTemplate<Track<Float, Float>>,
               &PlayerTest::addWithCallbackOnChangeTemplate<TrackView<Float, Float>>,
               &PlayerTest::addRawCallback<Track<Float, Float>>,
-              &PlayerTest::addRawCallback<TrackView<Float, Float>>});
+              &PlayerTest::addRawCallback<TrackView<Float, Float>>,
+              &PlayerTest::addInto,
+              &PlayerTest::addIntoInvalid});
+
+    addInstancedTests({&PlayerTest::advanceListThreaded},
+        Containers::arraySize(AdvanceListThreadedData));
 
     addInstancedTests({
         &PlayerTest::runFor100YearsFloat,
@@ -803,6 +820,87 @@ void PlayerTest::advanceList() {
     CORRADE_COMPARE(valueB, 2.75f);
 }
 
+void PlayerTest::advanceListThreaded() {
+    auto&& data = AdvanceListThreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Enough tracks to make the work spread across multiple threads */
+    Float valuesA[1000];
+    Float valuesB[700];
+    Float valuesC[10];
+    for(Float& i: valuesA) i = -1.0f;
+    for(Float& i: valuesB) i = -1.0f;
+    for(Float& i: valuesC) i = -1.0f;
+
+    struct CallbackData {
+        Int id;
+        const Float* observed;
+        Containers::Array<std::pair<Int, Float>>* calls;
+    };
+    Containers::Array<std::pair<Int, Float>> calls;
+    CallbackData callbackData[]{
+        {0, &valuesA[999], &calls},
+        {1, &valuesA[0], &calls},
+        {2, &valuesB[0], &calls},
+        {3, &valuesC[0], &calls}
+    };
+    auto callback = [](Float, const Float&, void* userData) {
+        const CallbackData& data = *static_cast<CallbackData*>(userData);
+        arrayAppend(*data.calls, InPlaceInit, data.id, *data.observed);
+    };
+
+    /* Callback tracks added before, in between and after the regular tracks,
+       they should see the regular tracks already updated */
+    Player<std::chrono::nanoseconds, Float> a, b, c;
+    a.addWithCallback(Track, callback, &callbackData[0]);
+    for(std::size_t i = 0; i != 500; ++i) a.add(Track, valuesA[i]);
+    a.addWithCallback(Track, callback, &callbackData[1]);
+    for(std::size_t i = 500; i != 1000; ++i) a.add(Track, valuesA[i]);
+    a.play(std::chrono::seconds{2});
+    for(Float& i: valuesB) b.add(Track, i);
+    b.addWithCallback(Track, callback, &callbackData[2])
+     .play(std::chrono::seconds{1});
+    /* C is not playing, so nothing should get updated there */
+    for(Float& i: valuesC) c.add(Track, i);
+    c.addWithCallback(Track, callback, &callbackData[3]);
+
+    /* 1.75 secs in for A, 2.75 seconds in for B */
+    Containers::Reference<Player<std::chrono::nanoseconds, Float>> players[]{a, b, c};
+    Player<std::chrono::nanoseconds, Float>::advance(std::chrono::milliseconds{3750}, players, data.threadCount);
+    CORRADE_COMPARE(a.state(), State::Playing);
+    CORRADE_COMPARE(b.state(), State::Playing);
+    CORRADE_COMPARE(c.state(), State::Stopped);
+    CORRADE_COMPARE(a.elapsed(std::chrono::milliseconds{3750}),
+        std::make_pair(0, 1.75f));
+    CORRADE_COMPARE(b.elapsed(std::chrono::milliseconds{3750}),
+        std::make_pair(0, 2.75f));
+    for(std::size_t i = 0; i != Containers::arraySize(valuesA); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(valuesA[i], 4.0f);
+    }
+    for(std::size_t i = 0; i != Containers::arraySize(valuesB); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(valuesB[i], 2.75f);
+    }
+    for(std::size_t i = 0; i != Containers::arraySize(valuesC); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(valuesC[i], -1.0f);
+    }
+    CORRADE_COMPARE_AS(calls, (Containers::arrayView<std::pair<Int, Float>>({
+        {0, 4.0f},
+        {1, 4.0f},
+        {2, 2.75f}
+    })), TestSuite::Compare::Container);
+
+    /* The initializer list variant should work the same. 1.9 secs in for A,
+       2.9 seconds in for B. */
+    Player<std::chrono::nanoseconds, Float>::advance(std::chrono::milliseconds{3900}, {a, b}, data.threadCount);
+    CORRADE_COMPARE(valuesA[0], 4.6f);
+    CORRADE_COMPARE(valuesA[999], 4.6f);
+    CORRADE_COMPARE(valuesB[0], 2.3f);
+    CORRADE_COMPARE(calls.size(), 6);
+}
+
 void PlayerTest::advanceZeroDurationStop() {
     Float value = -1.0f;
     Player<Float> player;
@@ -1329,6 +1427,69 @@ template<class T> void PlayerTest::addRawCallback() {
         TestSuite::Compare::Container);
 }
 
+void PlayerTest::addInto() {
+    /* Three tracks with the same keys as Track, the first having the same
+       values, the second doubled and the third negated */
+    const Float keys[]{1.0f, 2.5f, 3.0f, 4.0f};
+    const Float values[]{
+        1.5f,  3.0f, -1.5f,
+        3.0f,  6.0f, -3.0f,
+        5.0f, 10.0f, -5.0f,
+        2.0f,  4.0f, -2.0f
+    };
+
+    Float value = -1.0f;
+    Float out[]{-1.0f, -1.0f, -1.0f};
+    Player<Float> a;
+    a.addInto(keys, Containers::StridedArrayView2D<const Float>{values, {4, 3}}, Interpolation::Linear, Containers::stridedArrayView(out));
+    /* Adding more tracks and moving the player shouldn't affect the batch */
+    a.add(Track, value);
+    Player<Float> player = Utility::move(a);
+    player.play(2.0f);
+
+    CORRADE_COMPARE(player.size(), 2);
+    CORRADE_COMPARE(player.duration().size(), 3.0f);
+    CORRADE_COMPARE(player.state(), State::Playing);
+    CORRADE_COMPARE(player.track(0).interpolation(), Interpolation::Linear);
+    CORRADE_COMPARE(player.track(0).before(), Extrapolation::Constant);
+    CORRADE_COMPARE(player.track(0).after(), Extrapolation::Constant);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Float>(player.track(0).values()),
+        Containers::arrayView<Float>({1.5f, 3.0f, 5.0f, 2.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<Float>({-1.0f, -1.0f, -1.0f}),
+        TestSuite::Compare::Container);
+
+    /* 1.75 secs in */
+    player.advance(3.75f);
+    CORRADE_COMPARE(value, 4.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<Float>({4.0f, 8.0f, -4.0f}),
+        TestSuite::Compare::Container);
+}
+
+void PlayerTest::addIntoInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Float keys[]{1.0f, 2.5f, 3.0f, 4.0f};
+    const Float values[12]{};
+    Float destination[3];
+    Float destinationWrongSize[2];
+
+    Player<Float> player;
+
+    Containers::String out;
+    Error redirectError{&out};
+    player.addInto(Containers::arrayView(keys).prefix(3), Containers::StridedArrayView2D<const Float>{values, {4, 3}}, Interpolation::Linear, Containers::stridedArrayView(destination));
+    player.addInto(keys, Containers::StridedArrayView2D<const Float>{values, {4, 3}}, Interpolation::Linear, Containers::stridedArrayView(destinationWrongSize));
+    player.addInto(keys, Containers::StridedArrayView2D<const Float>{values, {4, 0}}, Interpolation::Linear, Containers::StridedArrayView1D<Float>{});
+    CORRADE_COMPARE(out,
+        "Animation::Player::addInto(): expected 3 keyframes but got 4\n"
+        "Animation::Player::addInto(): expected 3 destination items but got 2\n"
+        "Animation::Player::addInto(): expected at least one track\n");
+    CORRADE_VERIFY(player.isEmpty());
+}
+
 void PlayerTest::runFor100YearsFloat() {
     auto&& data = RunFor100YearsData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
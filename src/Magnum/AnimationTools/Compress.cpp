@@ -0,0 +1,287 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compress.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/AnimationData.h"
+
+namespace Magnum { namespace AnimationTools {
+
+namespace {
+
+/* Greedily extends a segment starting at a kept keyframe for as long as all
+   keyframes inside it can be reconstructed from the segment endpoints.
+   `fits(begin, end, i, t)` returns whether keyframe `i` is within tolerance
+   when interpolating between `begin` and `end` with factor `t`. Keyframes
+   `first` and `last` are always kept. */
+template<class Fits> void reduceKeyframesInto(const Containers::StridedArrayView1D<const Float>& keys, const std::size_t first, const std::size_t last, const Fits& fits, Containers::Array<UnsignedInt>& out) {
+    arrayAppend(out, UnsignedInt(first));
+
+    std::size_t begin = first;
+    for(std::size_t end = first + 2; end <= last; ++end) {
+        /* If the segment is zero-length, there's a discontinuity inside that
+           has to be preserved. The interpolation factor would be NaN for it
+           anyway. */
+        bool segmentFits = keys[end] != keys[begin];
+        for(std::size_t i = begin + 1; segmentFits && i != end; ++i)
+            segmentFits = fits(begin, end, i, Math::lerpInverted(keys[begin], keys[end], keys[i]));
+
+        /* If the segment doesn't fit anymore, the keyframe before has to be
+           kept and a new segment starts from there */
+        if(!segmentFits) {
+            begin = end - 1;
+            arrayAppend(out, UnsignedInt(begin));
+        }
+    }
+
+    if(last != first)
+        arrayAppend(out, UnsignedInt(last));
+}
+
+/* Maximal absolute difference in any component. The callers compare the
+   result with <= so NaNs never fit any tolerance. */
+Float difference(const Float a, const Float b) {
+    return Math::abs(a - b);
+}
+
+template<class T> Float difference(const T& a, const T& b) {
+    return Math::abs(a - b).max();
+}
+
+Float difference(const Complex& a, const Complex& b) {
+    return difference(Vector2{a}, Vector2{b});
+}
+
+Float difference(const Quaternion& a, const Quaternion& b) {
+    /* q and -q represent the same rotation, pick the smaller difference */
+    const Vector4 va{a.vector(), a.scalar()};
+    const Vector4 vb{b.vector(), b.scalar()};
+    return Math::min(difference(va, vb), difference(va, -vb));
+}
+
+template<class T> void reduceLinearTrackInto(const Trade::AnimationData& animation, const UnsignedInt id, const Float tolerance, Containers::Array<UnsignedInt>& out) {
+    const Animation::TrackView<const Float, const T> track = animation.track<T>(id);
+    const Containers::StridedArrayView1D<const Float> keys = track.keys();
+    const Containers::StridedArrayView1D<const T> values = track.values();
+    const auto interpolator = track.interpolator();
+    if(keys.isEmpty()) return;
+
+    /* Extrapolation outside of the track range uses the first two / last two
+       keyframes, keep them to not change the extrapolated slope */
+    const std::size_t last = keys.size() - 1;
+    const std::size_t first = track.before() == Animation::Extrapolation::Extrapolated && last > 1 ? 1 : 0;
+    const std::size_t lastReduced = track.after() == Animation::Extrapolation::Extrapolated && last > 1 ? last - 1 : last;
+
+    if(first) arrayAppend(out, 0u);
+    reduceKeyframesInto(keys, first, lastReduced, [&](const std::size_t begin, const std::size_t end, const std::size_t i, const Float t) {
+        return difference(interpolator(values[begin], values[end], t), values[i]) <= tolerance;
+    }, out);
+    if(lastReduced != last)
+        arrayAppend(out, UnsignedInt(last));
+}
+
+void reduceConstantTrackInto(const Animation::TrackViewStorage<const Float>& track, const UnsignedInt typeSize, Containers::Array<UnsignedInt>& out) {
+    const Containers::StridedArrayView2D<const char> values = Containers::arrayCast<2, const char>(track.values(), typeSize);
+    const std::size_t size = values.size()[0];
+    if(!size) return;
+
+    /* Keep only keyframes that change the value, plus the last one so the
+       track duration stays the same */
+    arrayAppend(out, 0u);
+    std::size_t previous = 0;
+    for(std::size_t i = 1; i < size - 1; ++i) {
+        if(std::memcmp(values[i].data(), values[previous].data(), typeSize) == 0)
+            continue;
+        previous = i;
+        arrayAppend(out, UnsignedInt(i));
+    }
+    if(size > 1)
+        arrayAppend(out, UnsignedInt(size - 1));
+}
+
+}
+
+Containers::Array<UnsignedInt> reduceKeyframes(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView2D<const Float>& values, const Float tolerance) {
+    CORRADE_ASSERT(values.size()[0] == keys.size(),
+        "AnimationTools::reduceKeyframes(): expected" << keys.size() << "values but got" << values.size()[0], {});
+    CORRADE_ASSERT(tolerance >= 0.0f,
+        "AnimationTools::reduceKeyframes(): expected a non-negative tolerance but got" << tolerance, {});
+
+    Containers::Array<UnsignedInt> out;
+    if(!keys.isEmpty()) reduceKeyframesInto(keys, 0, keys.size() - 1, [&](const std::size_t begin, const std::size_t end, const std::size_t i, const Float t) {
+        const Containers::StridedArrayView1D<const Float> a = values[begin];
+        const Containers::StridedArrayView1D<const Float> b = values[end];
+        const Containers::StridedArrayView1D<const Float> value = values[i];
+        for(std::size_t j = 0; j != value.size(); ++j)
+            if(!(Math::abs(Math::lerp(a[j], b[j], t) - value[j]) <= tolerance))
+                return false;
+        return true;
+    }, out);
+
+    /* Convert back to a default deleter to make the returned array usable
+       with plugins */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+Trade::AnimationData compress(const Trade::AnimationData& animation, const Float tolerance) {
+    CORRADE_ASSERT(tolerance >= 0.0f,
+        "AnimationTools::compress(): expected a non-negative tolerance but got" << tolerance,
+        (Trade::AnimationData{nullptr, nullptr}));
+
+    /* Calculate which keyframes to keep in each track */
+    Containers::Array<UnsignedInt> keyframes;
+    Containers::Array<std::size_t> keyframeOffsets{NoInit, animation.trackCount() + 1};
+    for(UnsignedInt i = 0; i != animation.trackCount(); ++i) {
+        keyframeOffsets[i] = keyframes.size();
+
+        const Trade::AnimationTrackType type = animation.trackType(i);
+        const Animation::TrackViewStorage<const Float> track = animation.track(i);
+        if(track.interpolation() == Animation::Interpolation::Linear && type == animation.trackResultType(i)) {
+            if(type == Trade::AnimationTrackType::Float) {
+                reduceLinearTrackInto<Float>(animation, i, tolerance, keyframes);
+                continue;
+            }
+            if(type == Trade::AnimationTrackType::Vector2) {
+                reduceLinearTrackInto<Vector2>(animation, i, tolerance, keyframes);
+                continue;
+            }
+            if(type == Trade::AnimationTrackType::Vector3) {
+                reduceLinearTrackInto<Vector3>(animation, i, tolerance, keyframes);
+                continue;
+            }
+            if(type == Trade::AnimationTrackType::Vector4) {
+                reduceLinearTrackInto<Vector4>(animation, i, tolerance, keyframes);
+                continue;
+            }
+            if(type == Trade::AnimationTrackType::Complex) {
+                reduceLinearTrackInto<Complex>(animation, i, tolerance, keyframes);
+                continue;
+            }
+            if(type == Trade::AnimationTrackType::Quaternion) {
+                reduceLinearTrackInto<Quaternion>(animation, i, tolerance, keyframes);
+                continue;
+            }
+        }
+
+        if(track.interpolation() == Animation::Interpolation::Constant) {
+            reduceConstantTrackInto(track, Trade::animationTrackTypeSize(type), keyframes);
+            continue;
+        }
+
+        /* Otherwise keep all keyframes */
+        for(UnsignedInt j = 0, max = track.size(); j != max; ++j)
+            arrayAppend(keyframes, j);
+    }
+    keyframeOffsets[animation.trackCount()] = keyframes.size();
+
+    /* Calculate the total data size, with keys and values of each track
+       after each other and values aligned according to their type */
+    std::size_t dataSize = 0;
+    for(UnsignedInt i = 0; i != animation.trackCount(); ++i) {
+        const std::size_t count = keyframeOffsets[i + 1] - keyframeOffsets[i];
+        const Trade::AnimationTrackType type = animation.trackType(i);
+        const UnsignedInt alignment = Trade::animationTrackTypeAlignment(type);
+        dataSize = (dataSize + count*sizeof(Float) + alignment - 1)/alignment*alignment;
+        dataSize += count*Trade::animationTrackTypeSize(type);
+    }
+
+    /* Copy the kept keyframes over */
+    Containers::Array<char> data{ValueInit, dataSize};
+    Containers::Array<Trade::AnimationTrackData> tracks{animation.trackCount()};
+    std::size_t offset = 0;
+    for(UnsignedInt i = 0; i != animation.trackCount(); ++i) {
+        const Containers::ArrayView<const UnsignedInt> kept = keyframes.slice(keyframeOffsets[i], keyframeOffsets[i + 1]);
+        const Trade::AnimationTrackType type = animation.trackType(i);
+        const UnsignedInt typeSize = Trade::animationTrackTypeSize(type);
+        const UnsignedInt alignment = Trade::animationTrackTypeAlignment(type);
+        const Animation::TrackViewStorage<const Float> track = animation.track(i);
+        const Containers::StridedArrayView1D<const Float> keys = track.keys();
+        const Containers::StridedArrayView2D<const char> values = Containers::arrayCast<2, const char>(track.values(), typeSize);
+
+        const Containers::ArrayView<Float> outputKeys = Containers::arrayCast<Float>(data.sliceSize(offset, kept.size()*sizeof(Float)));
+        offset = (offset + kept.size()*sizeof(Float) + alignment - 1)/alignment*alignment;
+        const Containers::StridedArrayView2D<char> outputValues{data.sliceSize(offset, kept.size()*typeSize), {kept.size(), typeSize}};
+        offset += kept.size()*typeSize;
+
+        for(std::size_t j = 0; j != kept.size(); ++j) {
+            outputKeys[j] = keys[kept[j]];
+            std::memcpy(outputValues[j].data(), values[kept[j]].data(), typeSize);
+        }
+
+        tracks[i] = Trade::AnimationTrackData{
+            animation.trackTargetName(i),
+            animation.trackTarget(i),
+            type, animation.trackResultType(i),
+            outputKeys,
+            outputValues.transposed<0, 1>()[0],
+            track.interpolation(),
+            track.interpolator(),
+            track.before(), track.after()};
+    }
+
+    CORRADE_INTERNAL_ASSERT(offset == dataSize);
+
+    return Trade::AnimationData{Utility::move(data), Utility::move(tracks), animation.duration(), animation.importerState()};
+}
+
+Containers::Array<Vector4s> packQuaternions(const Containers::StridedArrayView1D<const Quaternion>& quaternions) {
+    Containers::Array<Vector4s> out{NoInit, quaternions.size()};
+    packQuaternionsInto(quaternions, out);
+    return out;
+}
+
+void packQuaternionsInto(const Containers::StridedArrayView1D<const Quaternion>& quaternions, const Containers::StridedArrayView1D<Vector4s>& destination) {
+    CORRADE_ASSERT(destination.size() == quaternions.size(),
+        "AnimationTools::packQuaternionsInto(): expected" << quaternions.size() << "destination items but got" << destination.size(), );
+
+    for(std::size_t i = 0; i != quaternions.size(); ++i) {
+        const Quaternion& quaternion = quaternions[i];
+        CORRADE_ASSERT(quaternion.isNormalized(),
+            "AnimationTools::packQuaternionsInto(): quaternion" << i << "is not normalized:" << quaternion, );
+        destination[i] = Math::pack<Vector4s>(Vector4{quaternion.vector(), quaternion.scalar()});
+    }
+}
+
+Quaternion unpackQuaternion(const Vector4s& packed) {
+    const Vector4 unpacked = Math::unpack<Vector4>(packed);
+    return Quaternion{unpacked.xyz(), unpacked.w()}.normalized();
+}
+
+Quaternion slerpShortestPathPacked(const Vector4s& a, const Vector4s& b, const Float t) {
+    return Math::slerpShortestPath(unpackQuaternion(a), unpackQuaternion(b), t);
+}
+
+}}
@@ -0,0 +1,175 @@
+#ifndef Magnum_AnimationTools_Compress_h
+#define Magnum_AnimationTools_Compress_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::AnimationTools::reduceKeyframes(), @ref Magnum::AnimationTools::compress(), @ref Magnum::AnimationTools::packQuaternions(), @ref Magnum::AnimationTools::packQuaternionsInto(), @ref Magnum::AnimationTools::unpackQuaternion(), @ref Magnum::AnimationTools::slerpShortestPathPacked()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/AnimationTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace AnimationTools {
+
+/**
+@brief Reduce keyframes of a linearly interpolated track
+@param keys         Track keys
+@param values       Track values, with the second dimension being individual
+    components
+@param tolerance    Maximal allowed absolute difference in any component
+@m_since_latest
+
+Returns sorted indices of keyframes that need to be kept in order to have a
+linear interpolation between them differ from the linear interpolation of all
+@p keys by at most @p tolerance in any component. The first and the last
+keyframe is always kept. With @p tolerance set to @cpp 0.0f @ce, only
+keyframes that lie exactly on a line between their neighbors are removed.
+
+Keyframes are removed greedily from the start, extending each segment for as
+long as all keyframes it spans can be reconstructed within @p tolerance. As the
+difference between two linear interpolations is linear as well, checking the
+removed keyframes is enough to bound the difference for the whole segment.
+Segments spanning zero duration are never merged, so discontinuities formed
+by two keyframes with the same key are preserved as long as their values
+differ by more than @p tolerance. The result is thus a reduced keyframe set,
+but not necessarily the smallest possible one satisfying @p tolerance.
+
+The @p keys are expected to be sorted, @p values are expected to have the same
+size in the first dimension as @p keys and @p tolerance is expected to not be
+negative.
+@see @ref compress()
+*/
+MAGNUM_ANIMATIONTOOLS_EXPORT Containers::Array<UnsignedInt> reduceKeyframes(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView2D<const Float>& values, Float tolerance);
+
+/**
+@brief Compress an animation
+@param animation    Animation to compress
+@param tolerance    Maximal allowed absolute difference in any component of
+    the interpolated value
+@m_since_latest
+
+Returns a copy of @p animation with redundant keyframes removed from each
+track and all track data packed tightly together:
+
+-   Tracks with @ref Animation::Interpolation::Linear of
+    @ref Trade::AnimationTrackType::Float, @relativeref{Trade::AnimationTrackType,Vector2},
+    @relativeref{Trade::AnimationTrackType,Vector3},
+    @relativeref{Trade::AnimationTrackType,Vector4},
+    @relativeref{Trade::AnimationTrackType,Complex} and
+    @relativeref{Trade::AnimationTrackType,Quaternion} types have keyframes
+    removed similarly to @ref reduceKeyframes(), but with the difference
+    measured using the track's own interpolator. As quaternions @f$ q @f$ and
+    @f$ -q @f$ represent the same rotation, the smaller of the two differences
+    is used for them. Unlike with linear interpolation, the difference for
+    spherical interpolation is checked only at the removed keyframes. If the
+    track uses @ref Animation::Extrapolation::Extrapolated, the second or the
+    second-to-last keyframe is kept as well to not change the extrapolated
+    values.
+-   Tracks with @ref Animation::Interpolation::Constant of any type have all
+    keyframes that have the same value as the previous keyframe removed, except
+    for the last one. This is lossless, independently of @p tolerance.
+-   Other tracks, including the ones with a result type different from the
+    value type and with spline or @ref Animation::Interpolation::Custom
+    interpolation, are copied as-is.
+
+The first and the last keyframe of each track is always kept. Track types,
+targets, interpolators and extrapolation as well as the animation duration and
+importer state are preserved. The returned instance is owned and has a single
+data array with keys and values of each track in succession.
+
+Only the keyframe count is reduced, the values are stored in their original
+type and each track keeps explicit keys, as @ref Trade::AnimationData has no
+track type for quantized values. Use @ref packQuaternions() to quantize
+rotation tracks for playback through @ref Animation::TrackView or
+@ref Animation::Player.
+
+Expects that @p tolerance is not negative.
+@see @ref Trade::AnimationData::trackType(),
+    @ref Trade::AnimationData::track()
+*/
+MAGNUM_ANIMATIONTOOLS_EXPORT Trade::AnimationData compress(const Trade::AnimationData& animation, Float tolerance);
+
+/**
+@brief Quantize quaternions to 16-bit signed normalized components
+@param quaternions  Normalized quaternions
+@m_since_latest
+
+Packs the @ref Math::Quaternion::vector() and @ref Math::Quaternion::scalar()
+components into a @ref Vector4s using @ref Math::pack(), halving the memory
+needed for rotation tracks. The largest per-component error is
+@f$ \frac{1}{65534} @f$, which corresponds to a rotation error well below
+@f$ 0.01° @f$. The packed values are meant to be decoded on the fly during
+playback, with @ref slerpShortestPathPacked() used as an interpolator for a
+@ref Animation::TrackView:
+
+@snippet AnimationTools.cpp packQuaternions
+
+Expects that all @p quaternions are normalized.
+@see @ref reduceKeyframes(), @ref compress()
+*/
+MAGNUM_ANIMATIONTOOLS_EXPORT Containers::Array<Vector4s> packQuaternions(const Containers::StridedArrayView1D<const Quaternion>& quaternions);
+
+/**
+@brief Quantize quaternions to 16-bit signed normalized components into an existing location
+@param[in]  quaternions Normalized quaternions
+@param[out] destination Where to put the packed quaternions
+@m_since_latest
+
+A variant of @ref packQuaternions() that fills existing memory instead of
+allocating a new array. Expects that all @p quaternions are normalized and
+@p destination has the same size as @p quaternions.
+*/
+MAGNUM_ANIMATIONTOOLS_EXPORT void packQuaternionsInto(const Containers::StridedArrayView1D<const Quaternion>& quaternions, const Containers::StridedArrayView1D<Vector4s>& destination);
+
+/**
+@brief Unpack a quaternion quantized with @ref packQuaternions()
+@m_since_latest
+
+Unpacks the components using @ref Math::unpack() and renormalizes the result
+to make it usable with the interpolation functions that expect normalized
+quaternions.
+*/
+MAGNUM_ANIMATIONTOOLS_EXPORT Quaternion unpackQuaternion(const Vector4s& packed);
+
+/**
+@brief Spherical linear interpolation of quaternions quantized with @ref packQuaternions()
+@m_since_latest
+
+Equivalent to calling @ref Math::slerpShortestPath() on @p a and @p b
+unpacked with @ref unpackQuaternion(). Meant to be used as an interpolator for
+an @ref Animation::TrackView with @ref Vector4s values and a
+@ref Magnum::Quaternion "Quaternion" result.
+*/
+MAGNUM_ANIMATIONTOOLS_EXPORT Quaternion slerpShortestPathPacked(const Vector4s& a, const Vector4s& b, Float t);
+
+}}
+
+#endif
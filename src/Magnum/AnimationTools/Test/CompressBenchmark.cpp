@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/AnimationTools/Compress.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/AnimationData.h"
+
+namespace Magnum { namespace AnimationTools { namespace Test { namespace {
+
+struct CompressBenchmark: TestSuite::Tester {
+    explicit CompressBenchmark();
+
+    /* The size() benchmark relies on the case itself filling _size before
+       CORRADE_BENCHMARK() ends, the sizeBegin() / sizeEnd() then report it
+       relative to the uncompressed size */
+    void sizeBegin();
+    std::uint64_t sizeEnd();
+
+    void size();
+    void compress();
+    void decode();
+    void decodePacked();
+
+    private:
+        Trade::AnimationData _animation{nullptr, nullptr};
+        std::size_t _size;
+};
+
+/* Ten minutes of a mocap-like animation sampled at 60 FPS */
+constexpr std::size_t KeyframeCount = 10*60*60;
+
+const struct {
+    const char* name;
+    Float tolerance;
+} CompressData[]{
+    {"tolerance 0.00001", 1.0e-5f},
+    {"tolerance 0.0001", 1.0e-4f},
+    {"tolerance 0.001", 1.0e-3f},
+    {"tolerance 0.01", 1.0e-2f},
+};
+
+const struct {
+    const char* name;
+    Containers::Optional<Float> tolerance;
+} DecodeData[]{
+    {"uncompressed", {}},
+    {"tolerance 0.0001", 1.0e-4f},
+    {"tolerance 0.01", 1.0e-2f},
+};
+
+CompressBenchmark::CompressBenchmark() {
+    addCustomInstancedBenchmarks({&CompressBenchmark::size}, 1,
+        Containers::arraySize(CompressData),
+        &CompressBenchmark::sizeBegin,
+        &CompressBenchmark::sizeEnd,
+        BenchmarkUnits::PercentageThousandths);
+
+    addInstancedBenchmarks({&CompressBenchmark::compress}, 5,
+        Containers::arraySize(CompressData));
+
+    addInstancedBenchmarks({&CompressBenchmark::decode}, 10,
+        Containers::arraySize(DecodeData));
+
+    addBenchmarks({&CompressBenchmark::decodePacked}, 10);
+
+    /* A translation and a rotation track with smooth motion and a slight
+       high-frequency jitter, which makes the reduction depend on the
+       tolerance */
+    Containers::Array<char> data{NoInit, KeyframeCount*(sizeof(Float) + sizeof(Vector3) + sizeof(Quaternion))};
+    const Containers::StridedArrayView1D<Float> keys = Containers::arrayCast<Float>(data.prefix(KeyframeCount*sizeof(Float)));
+    const Containers::StridedArrayView1D<Vector3> translations = Containers::arrayCast<Vector3>(data.sliceSize(KeyframeCount*sizeof(Float), KeyframeCount*sizeof(Vector3)));
+    const Containers::StridedArrayView1D<Quaternion> rotations = Containers::arrayCast<Quaternion>(data.exceptPrefix(KeyframeCount*(sizeof(Float) + sizeof(Vector3))));
+    for(std::size_t i = 0; i != KeyframeCount; ++i) {
+        const Float t = i/60.0f;
+        const Float jitter = Math::sin(Rad(t*37.0f))*0.0005f;
+        keys[i] = t;
+        translations[i] = {
+            Math::sin(Rad(t*0.7f))*2.0f + jitter,
+            Math::cos(Rad(t*0.3f)),
+            t*0.05f - jitter
+        };
+        rotations[i] =
+            Quaternion::rotation(Rad(t*0.5f), Vector3::yAxis())*
+            Quaternion::rotation(Rad(Math::sin(Rad(t*1.3f))*0.2f + jitter), Vector3::xAxis());
+    }
+
+    _animation = Trade::AnimationData{Utility::move(data), {InPlaceInit, {
+        Trade::AnimationTrackData{Trade::AnimationTrackTarget::Translation3D, 0,
+            keys, translations, Animation::Interpolation::Linear},
+        Trade::AnimationTrackData{Trade::AnimationTrackTarget::Rotation3D, 0,
+            keys, rotations, Animation::Interpolation::Linear}
+    }}};
+}
+
+void CompressBenchmark::sizeBegin() {
+    setBenchmarkName("compressed size");
+    _size = 0;
+}
+
+std::uint64_t CompressBenchmark::sizeEnd() {
+    return _size*100000ull/_animation.data().size();
+}
+
+void CompressBenchmark::size() {
+    auto&& data = CompressData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::AnimationData compressed{nullptr, nullptr};
+    CORRADE_BENCHMARK(1)
+        _size = (compressed = AnimationTools::compress(_animation, data.tolerance)).data().size();
+
+    CORRADE_COMPARE(compressed.trackCount(), 2);
+    CORRADE_VERIFY(_size < _animation.data().size());
+}
+
+void CompressBenchmark::compress() {
+    auto&& data = CompressData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += AnimationTools::compress(_animation, data.tolerance).data().size();
+
+    CORRADE_VERIFY(size);
+}
+
+void CompressBenchmark::decode() {
+    auto&& data = DecodeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::AnimationData compressed{nullptr, nullptr};
+    if(data.tolerance)
+        compressed = AnimationTools::compress(_animation, *data.tolerance);
+    const Trade::AnimationData& animation = data.tolerance ? compressed : _animation;
+    const Animation::TrackView<const Float, const Vector3> translation = animation.track<Vector3>(0);
+    const Animation::TrackView<const Float, const Quaternion> rotation = animation.track<Quaternion>(1);
+
+    /* Play the whole animation forward at twice the sampling rate, which is
+       the common case where the hint makes the keyframe lookup cheap, and
+       the remaining cost is proportional to the keyframe count */
+    Vector3 translationSum;
+    Quaternion rotationSum{Math::ZeroInit};
+    CORRADE_BENCHMARK(1) {
+        std::size_t translationHint{}, rotationHint{};
+        for(std::size_t i = 0; i != KeyframeCount*2; ++i) {
+            const Float time = i/120.0f;
+            translationSum += translation.at(time, translationHint);
+            rotationSum += rotation.at(time, rotationHint);
+        }
+    }
+
+    CORRADE_VERIFY(!translationSum.isZero());
+    CORRADE_VERIFY(!rotationSum.vector().isZero());
+}
+
+void CompressBenchmark::decodePacked() {
+    /* The same as decode() with the uncompressed rotation track, but with the
+       values quantized and unpacked on the fly */
+    const Animation::TrackView<const Float, const Quaternion> original = _animation.track<Quaternion>(1);
+    const Containers::Array<Vector4s> packed = AnimationTools::packQuaternions(original.values());
+    const Animation::TrackView<const Float, const Vector4s, Quaternion> rotation{original.keys(), packed, AnimationTools::slerpShortestPathPacked};
+
+    Quaternion rotationSum{Math::ZeroInit};
+    CORRADE_BENCHMARK(1) {
+        std::size_t rotationHint{};
+        for(std::size_t i = 0; i != KeyframeCount*2; ++i)
+            rotationSum += rotation.at(i/120.0f, rotationHint);
+    }
+
+    CORRADE_VERIFY(!rotationSum.vector().isZero());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::AnimationTools::Test::CompressBenchmark)
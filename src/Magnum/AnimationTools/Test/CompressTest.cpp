@@ -0,0 +1,411 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/AnimationTools/Compress.h"
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/AnimationData.h"
+
+namespace Magnum { namespace AnimationTools { namespace Test { namespace {
+
+struct CompressTest: TestSuite::Tester {
+    explicit CompressTest();
+
+    void reduceKeyframes();
+    void reduceKeyframesDiscontinuity();
+    void reduceKeyframesEmpty();
+    void reduceKeyframesSingle();
+    void reduceKeyframesInvalid();
+
+    void compress();
+    void compressEmpty();
+    void compressInvalid();
+
+    void packQuaternions();
+    void packQuaternionsInvalid();
+    void slerpShortestPathPacked();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Float tolerance;
+    Containers::Array<UnsignedInt> expected;
+} ReduceKeyframesData[]{
+    {"zero tolerance", 0.0f, {InPlaceInit, {0, 2, 3, 4, 5}}},
+    {"small tolerance", 0.25f, {InPlaceInit, {0, 2, 3, 5}}},
+    {"large tolerance", 0.6f, {InPlaceInit, {0, 5}}},
+};
+
+CompressTest::CompressTest() {
+    addInstancedTests({&CompressTest::reduceKeyframes},
+        Containers::arraySize(ReduceKeyframesData));
+
+    addTests({&CompressTest::reduceKeyframesDiscontinuity,
+              &CompressTest::reduceKeyframesEmpty,
+              &CompressTest::reduceKeyframesSingle,
+              &CompressTest::reduceKeyframesInvalid,
+
+              &CompressTest::compress,
+              &CompressTest::compressEmpty,
+              &CompressTest::compressInvalid,
+
+              &CompressTest::packQuaternions,
+              &CompressTest::packQuaternionsInvalid,
+              &CompressTest::slerpShortestPathPacked});
+}
+
+void CompressTest::reduceKeyframes() {
+    auto&& data = ReduceKeyframesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The first component is on a line except for a bump at key 3, the second
+       is constant */
+    const Float keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    const Vector2 values[]{
+        {0.0f, 1.0f},
+        {1.0f, 1.0f},
+        {2.0f, 1.0f},
+        {3.5f, 1.0f},
+        {4.0f, 1.0f},
+        {5.0f, 1.0f}
+    };
+
+    CORRADE_COMPARE_AS(AnimationTools::reduceKeyframes(keys,
+        Containers::arrayCast<2, const Float>(Containers::stridedArrayView(values)),
+        data.tolerance),
+        data.expected,
+        TestSuite::Compare::Container);
+}
+
+void CompressTest::reduceKeyframesDiscontinuity() {
+    /* The value jumps at key 1, which should be preserved even though the
+       keyframes are on a line on either side */
+    const Float keys[]{0.0f, 1.0f, 1.0f, 2.0f};
+    const Float values[]{0.0f, 1.0f, 5.0f, 6.0f};
+
+    CORRADE_COMPARE_AS(AnimationTools::reduceKeyframes(keys,
+        Containers::arrayCast<2, const Float>(Containers::stridedArrayView(values)),
+        0.5f),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+void CompressTest::reduceKeyframesEmpty() {
+    CORRADE_COMPARE_AS(AnimationTools::reduceKeyframes(nullptr,
+        Containers::StridedArrayView2D<const Float>{Containers::ArrayView<const Float>{}, {0, 3}},
+        0.5f),
+        Containers::arrayView<UnsignedInt>({}),
+        TestSuite::Compare::Container);
+}
+
+void CompressTest::reduceKeyframesSingle() {
+    const Float keys[]{3.0f};
+    const Float values[]{1.0f};
+
+    CORRADE_COMPARE_AS(AnimationTools::reduceKeyframes(keys,
+        Containers::arrayCast<2, const Float>(Containers::stridedArrayView(values)),
+        0.5f),
+        Containers::arrayView<UnsignedInt>({0}),
+        TestSuite::Compare::Container);
+}
+
+void CompressTest::reduceKeyframesInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Float keys[3]{};
+    const Float values[2]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    AnimationTools::reduceKeyframes(keys,
+        Containers::arrayCast<2, const Float>(Containers::stridedArrayView(values)),
+        0.5f);
+    AnimationTools::reduceKeyframes(Containers::arrayView(keys).prefix(2),
+        Containers::arrayCast<2, const Float>(Containers::stridedArrayView(values)),
+        -0.5f);
+    CORRADE_COMPARE(out,
+        "AnimationTools::reduceKeyframes(): expected 3 values but got 2\n"
+        "AnimationTools::reduceKeyframes(): expected a non-negative tolerance but got -0.5\n");
+}
+
+void CompressTest::compress() {
+    const Float keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+
+    /* Linear with a bump at key 3, so keyframe 1 gets removed */
+    const Float floatValues[]{0.0f, 1.0f, 2.0f, 3.5f, 4.0f};
+
+    /* All keyframes on a line, but the second and second-to-last should be
+       kept because of extrapolation */
+    const Vector3 vectorValues[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 2.0f, 3.0f},
+        {2.0f, 4.0f, 6.0f},
+        {3.0f, 6.0f, 9.0f},
+        {4.0f, 8.0f, 12.0f}
+    };
+
+    /* Rotations by the same angle, one of them negated, which still
+       represents the same rotation so everything except the endpoints gets
+       removed */
+    const Quaternion quaternionValues[]{
+        Quaternion::rotation(0.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(10.0_degf, Vector3::yAxis()),
+        -Quaternion::rotation(20.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(30.0_degf, Vector3::yAxis())
+    };
+
+    /* Constant interpolation, only value changes should be kept */
+    const Int intValues[]{1, 1, 2, 2, 2};
+
+    /* Spline interpolation, copied as-is */
+    const CubicHermite1D splineValues[]{
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+
+    const int state = 5;
+    Trade::AnimationData animation{nullptr, {
+        Trade::AnimationTrackData{Trade::animationTrackTargetCustom(3), 17,
+            Containers::arrayView(keys),
+            Containers::arrayView(floatValues),
+            Animation::Interpolation::Linear},
+        Trade::AnimationTrackData{Trade::AnimationTrackTarget::Translation3D, 22,
+            Containers::arrayView(keys),
+            Containers::arrayView(vectorValues),
+            Animation::Interpolation::Linear,
+            Animation::Extrapolation::Extrapolated},
+        Trade::AnimationTrackData{Trade::AnimationTrackTarget::Rotation3D, 22,
+            Containers::arrayView(keys).prefix(4),
+            Containers::arrayView(quaternionValues),
+            Animation::Interpolation::Linear},
+        Trade::AnimationTrackData{Trade::animationTrackTargetCustom(1), 5,
+            Containers::arrayView(keys),
+            Containers::arrayView(intValues),
+            Animation::Interpolation::Constant,
+            Animation::Extrapolation::DefaultConstructed},
+        Trade::AnimationTrackData{Trade::AnimationTrackTarget::Scaling3D, 1,
+            Containers::arrayView(keys).prefix(3),
+            Containers::arrayView(splineValues),
+            Animation::Interpolation::Spline},
+    }, {-1.0f, 5.0f}, &state};
+
+    Trade::AnimationData compressed = AnimationTools::compress(animation, 0.25f);
+    CORRADE_COMPARE(compressed.dataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(compressed.duration(), (Range1D{-1.0f, 5.0f}));
+    CORRADE_COMPARE(compressed.importerState(), &state);
+    CORRADE_COMPARE(compressed.trackCount(), 5);
+    /* 4 + 4 + 2 + 3 + 3 keys, 4 floats, 4 vectors, 2 quaternions, 3 ints and 3
+       splines */
+    CORRADE_COMPARE(compressed.data().size(), 16*4 + 4*4 + 4*12 + 2*16 + 3*4 + 3*12);
+
+    {
+        CORRADE_ITERATION("float");
+        CORRADE_COMPARE(compressed.trackType(0), Trade::AnimationTrackType::Float);
+        CORRADE_COMPARE(compressed.trackResultType(0), Trade::AnimationTrackType::Float);
+        CORRADE_COMPARE(compressed.trackTargetName(0), Trade::animationTrackTargetCustom(3));
+        CORRADE_COMPARE(compressed.trackTarget(0), 17);
+
+        Animation::TrackView<const Float, const Float> track = compressed.track<Float>(0);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Linear);
+        CORRADE_VERIFY(track.interpolator() == animation.track<Float>(0).interpolator());
+        CORRADE_COMPARE(track.before(), Animation::Extrapolation::Constant);
+        CORRADE_COMPARE(track.after(), Animation::Extrapolation::Constant);
+        CORRADE_COMPARE_AS(track.keys(),
+            Containers::arrayView({0.0f, 2.0f, 3.0f, 4.0f}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(),
+            Containers::arrayView({0.0f, 2.0f, 3.5f, 4.0f}),
+            TestSuite::Compare::Container);
+    } {
+        CORRADE_ITERATION("vector");
+        CORRADE_COMPARE(compressed.trackType(1), Trade::AnimationTrackType::Vector3);
+        CORRADE_COMPARE(compressed.trackTargetName(1), Trade::AnimationTrackTarget::Translation3D);
+        CORRADE_COMPARE(compressed.trackTarget(1), 22);
+
+        Animation::TrackView<const Float, const Vector3> track = compressed.track<Vector3>(1);
+        CORRADE_COMPARE(track.before(), Animation::Extrapolation::Extrapolated);
+        CORRADE_COMPARE(track.after(), Animation::Extrapolation::Extrapolated);
+        CORRADE_COMPARE_AS(track.keys(),
+            Containers::arrayView({0.0f, 1.0f, 3.0f, 4.0f}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(), Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 2.0f, 3.0f},
+            {3.0f, 6.0f, 9.0f},
+            {4.0f, 8.0f, 12.0f}
+        }), TestSuite::Compare::Container);
+
+        /* Extrapolation gives the same result as before */
+        CORRADE_COMPARE(track.at(-1.0f), animation.track<Vector3>(1).at(-1.0f));
+        CORRADE_COMPARE(track.at(5.0f), animation.track<Vector3>(1).at(5.0f));
+    } {
+        CORRADE_ITERATION("quaternion");
+        CORRADE_COMPARE(compressed.trackType(2), Trade::AnimationTrackType::Quaternion);
+        CORRADE_COMPARE(compressed.trackTargetName(2), Trade::AnimationTrackTarget::Rotation3D);
+
+        Animation::TrackView<const Float, const Quaternion> track = compressed.track<Quaternion>(2);
+        CORRADE_COMPARE_AS(track.keys(),
+            Containers::arrayView({0.0f, 3.0f}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(), Containers::arrayView({
+            quaternionValues[0],
+            quaternionValues[3]
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE(track.at(1.5f), Quaternion::rotation(15.0_degf, Vector3::yAxis()));
+    } {
+        CORRADE_ITERATION("int");
+        CORRADE_COMPARE(compressed.trackType(3), Trade::AnimationTrackType::Int);
+
+        Animation::TrackView<const Float, const Int> track = compressed.track<Int>(3);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Constant);
+        CORRADE_COMPARE(track.before(), Animation::Extrapolation::DefaultConstructed);
+        CORRADE_COMPARE(track.after(), Animation::Extrapolation::DefaultConstructed);
+        CORRADE_COMPARE_AS(track.keys(),
+            Containers::arrayView({0.0f, 2.0f, 4.0f}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(),
+            Containers::arrayView({1, 2, 2}),
+            TestSuite::Compare::Container);
+    } {
+        CORRADE_ITERATION("spline");
+        CORRADE_COMPARE(compressed.trackType(4), Trade::AnimationTrackType::CubicHermite1D);
+        CORRADE_COMPARE(compressed.trackResultType(4), Trade::AnimationTrackType::Float);
+
+        Animation::TrackView<const Float, const CubicHermite1D> track = compressed.track<CubicHermite1D>(4);
+        CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Spline);
+        CORRADE_COMPARE_AS(track.keys(),
+            Containers::arrayView({0.0f, 1.0f, 2.0f}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(track.values(),
+            Containers::arrayView(splineValues),
+            TestSuite::Compare::Container);
+    }
+}
+
+void CompressTest::compressEmpty() {
+    Trade::AnimationData compressed = AnimationTools::compress(Trade::AnimationData{nullptr, nullptr, {1.0f, 2.0f}}, 0.5f);
+    CORRADE_COMPARE(compressed.trackCount(), 0);
+    CORRADE_COMPARE(compressed.data().size(), 0);
+    CORRADE_COMPARE(compressed.duration(), (Range1D{1.0f, 2.0f}));
+}
+
+void CompressTest::compressInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    AnimationTools::compress(Trade::AnimationData{nullptr, nullptr}, -0.5f);
+    CORRADE_COMPARE(out, "AnimationTools::compress(): expected a non-negative tolerance but got -0.5\n");
+}
+
+void CompressTest::packQuaternions() {
+    const Quaternion quaternions[]{
+        {},
+        Quaternion::rotation(35.0_degf, Vector3::xAxis()),
+        Quaternion::rotation(-120.0_degf, Vector3{1.0f, -1.0f, 1.0f}.normalized()),
+        -Quaternion::rotation(179.0_degf, Vector3::zAxis())
+    };
+
+    Containers::Array<Vector4s> packed = AnimationTools::packQuaternions(quaternions);
+    CORRADE_COMPARE(packed.size(), 4);
+    CORRADE_COMPARE(packed[0], (Vector4s{0, 0, 0, 32767}));
+    for(std::size_t i = 0; i != packed.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const Quaternion unpacked = AnimationTools::unpackQuaternion(packed[i]);
+        CORRADE_VERIFY(unpacked.isNormalized());
+        /* Half a step from the rounding, the renormalization can add about
+           the same */
+        CORRADE_COMPARE_AS(Math::abs(
+            Vector4{unpacked.vector(), unpacked.scalar()} -
+            Vector4{quaternions[i].vector(), quaternions[i].scalar()}).max(),
+            1.0f/32767.0f,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void CompressTest::packQuaternionsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Quaternion quaternions[]{
+        {},
+        Quaternion{{1.0f, 0.0f, 0.0f}, 1.0f}
+    };
+    Vector4s destination[2];
+    Vector4s destinationWrongSize[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    AnimationTools::packQuaternionsInto(quaternions, destination);
+    AnimationTools::packQuaternionsInto(Containers::arrayView(quaternions).prefix(1), destinationWrongSize);
+    CORRADE_COMPARE(out,
+        "AnimationTools::packQuaternionsInto(): quaternion 1 is not normalized: Quaternion({1, 0, 0}, 1)\n"
+        "AnimationTools::packQuaternionsInto(): expected 1 destination items but got 3\n");
+}
+
+void CompressTest::slerpShortestPathPacked() {
+    const Float keys[]{0.0f, 1.0f, 3.0f};
+    const Quaternion quaternions[]{
+        Quaternion::rotation(15.0_degf, Vector3::yAxis()),
+        Quaternion::rotation(75.0_degf, Vector3::yAxis()),
+        /* On the opposite hemisphere, the shortest path should be taken */
+        -Quaternion::rotation(135.0_degf, Vector3::yAxis())
+    };
+    Containers::Array<Vector4s> packed = AnimationTools::packQuaternions(quaternions);
+
+    /* Decoded on the fly with a TrackView, should give the same results as
+       the original track within the quantization error */
+    const Animation::TrackView<const Float, const Vector4s, Quaternion> track{keys, packed, AnimationTools::slerpShortestPathPacked};
+    const Quaternion a = track.at(0.5f);
+    const Quaternion expectedA = Quaternion::rotation(45.0_degf, Vector3::yAxis());
+    CORRADE_COMPARE_AS(Math::abs(
+        Vector4{a.vector(), a.scalar()} -
+        Vector4{expectedA.vector(), expectedA.scalar()}).max(),
+        1.0f/8192.0f,
+        TestSuite::Compare::LessOrEqual);
+
+    /* The first quaternion gets negated to go the shortest path */
+    const Quaternion b = track.at(2.0f);
+    const Quaternion expectedB = -Quaternion::rotation(105.0_degf, Vector3::yAxis());
+    CORRADE_COMPARE_AS(Math::abs(
+        Vector4{b.vector(), b.scalar()} -
+        Vector4{expectedB.vector(), expectedB.scalar()}).max(),
+        1.0f/8192.0f,
+        TestSuite::Compare::LessOrEqual);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::AnimationTools::Test::CompressTest)
@@ -38,6 +38,7 @@
 
 #include "Magnum/Math/Functions.h"
 #ifdef MAGNUM_TARGET_GL
+#include "Magnum/GL/Context.h"
 #include "Magnum/GL/TimeQuery.h"
 #ifndef MAGNUM_TARGET_GLES
 #include "Magnum/GL/PipelineStatisticsQuery.h"
@@ -440,8 +441,16 @@ struct FrameProfilerGL::State {
     UnsignedShort vertexFetchRatioIndex = 0xffff,
         primitiveClipRatioIndex = 0xffff;
     #endif
+    UnsignedShort drawCallsIndex = 0xffff,
+        programSwitchesIndex = 0xffff,
+        bindCallsIndex = 0xffff,
+        uniformUploadsIndex = 0xffff;
     UnsignedLong frameTimeStartFrame[2];
     UnsignedLong cpuDurationStartFrame;
+    UnsignedLong drawCallsStartFrame;
+    UnsignedLong programSwitchesStartFrame;
+    UnsignedLong bindCallsStartFrame;
+    UnsignedLong uniformUploadsStartFrame;
 
     enum: std::size_t { QueryCount = 3 };
     Containers::StaticArray<QueryCount, GL::TimeQuery> timeQueries{DirectInit, NoCreate};
@@ -453,6 +462,14 @@ struct FrameProfilerGL::State {
     #endif
 };
 
+namespace {
+
+UnsignedLong bindCalls(const GL::Context::Statistics& statistics) {
+    return statistics.bufferBinds + statistics.textureBinds + statistics.framebufferBinds + statistics.vaoBinds;
+}
+
+}
+
 FrameProfilerGL::FrameProfilerGL(): _state{InPlaceInit} {}
 
 FrameProfilerGL::FrameProfilerGL(const Values values, const UnsignedInt maxFrameCount): FrameProfilerGL{}
@@ -582,6 +599,55 @@ void FrameProfilerGL::setup(const Values values, const UnsignedInt maxFrameCount
         _state->primitiveClipRatioIndex = index++;
     }
     #endif
+    /* The counters are collected by the context only if explicitly enabled,
+       turn that on if any of them is requested. It's never turned off again
+       as other code (or another profiler instance) may rely on it as well. */
+    if(values & (Value::DrawCalls|Value::ProgramSwitches|Value::BindCalls|Value::UniformUploads))
+        GL::Context::current().setStatisticsEnabled(true);
+    if(values & Value::DrawCalls) {
+        arrayAppend(measurements, InPlaceInit,
+            "Draw calls"_s, Units::Count,
+            [](void* state) {
+                static_cast<State*>(state)->drawCallsStartFrame = GL::Context::current().statistics().drawCalls;
+            },
+            [](void* state) {
+                return GL::Context::current().statistics().drawCalls - static_cast<State*>(state)->drawCallsStartFrame;
+            }, _state.get());
+        _state->drawCallsIndex = index++;
+    }
+    if(values & Value::ProgramSwitches) {
+        arrayAppend(measurements, InPlaceInit,
+            "Program switches"_s, Units::Count,
+            [](void* state) {
+                static_cast<State*>(state)->programSwitchesStartFrame = GL::Context::current().statistics().programSwitches;
+            },
+            [](void* state) {
+                return GL::Context::current().statistics().programSwitches - static_cast<State*>(state)->programSwitchesStartFrame;
+            }, _state.get());
+        _state->programSwitchesIndex = index++;
+    }
+    if(values & Value::BindCalls) {
+        arrayAppend(measurements, InPlaceInit,
+            "Bind calls"_s, Units::Count,
+            [](void* state) {
+                static_cast<State*>(state)->bindCallsStartFrame = bindCalls(GL::Context::current().statistics());
+            },
+            [](void* state) {
+                return bindCalls(GL::Context::current().statistics()) - static_cast<State*>(state)->bindCallsStartFrame;
+            }, _state.get());
+        _state->bindCallsIndex = index++;
+    }
+    if(values & Value::UniformUploads) {
+        arrayAppend(measurements, InPlaceInit,
+            "Uniform uploads"_s, Units::Count,
+            [](void* state) {
+                static_cast<State*>(state)->uniformUploadsStartFrame = GL::Context::current().statistics().uniformUploads;
+            },
+            [](void* state) {
+                return GL::Context::current().statistics().uniformUploads - static_cast<State*>(state)->uniformUploadsStartFrame;
+            }, _state.get());
+        _state->uniformUploadsIndex = index++;
+    }
     setup(Utility::move(measurements), maxFrameCount);
 }
 
@@ -594,6 +660,10 @@ auto FrameProfilerGL::values() const -> Values {
     if(_state->vertexFetchRatioIndex != 0xffff) values |= Value::VertexFetchRatio;
     if(_state->primitiveClipRatioIndex != 0xffff) values |= Value::PrimitiveClipRatio;
     #endif
+    if(_state->drawCallsIndex != 0xffff) values |= Value::DrawCalls;
+    if(_state->programSwitchesIndex != 0xffff) values |= Value::ProgramSwitches;
+    if(_state->bindCallsIndex != 0xffff) values |= Value::BindCalls;
+    if(_state->uniformUploadsIndex != 0xffff) values |= Value::UniformUploads;
     return values;
 }
 
@@ -607,6 +677,10 @@ bool FrameProfilerGL::isMeasurementAvailable(const Value value) const {
         case Value::VertexFetchRatio: index = &_state->vertexFetchRatioIndex; break;
         case Value::PrimitiveClipRatio: index = &_state->primitiveClipRatioIndex; break;
         #endif
+        case Value::DrawCalls: index = &_state->drawCallsIndex; break;
+        case Value::ProgramSwitches: index = &_state->programSwitchesIndex; break;
+        case Value::BindCalls: index = &_state->bindCallsIndex; break;
+        case Value::UniformUploads: index = &_state->uniformUploadsIndex; break;
     }
     CORRADE_INTERNAL_ASSERT(index);
     CORRADE_ASSERT(*index < measurementCount(),
@@ -646,6 +720,30 @@ Double FrameProfilerGL::primitiveClipRatioMean() const {
 }
 #endif
 
+Double FrameProfilerGL::drawCallsMean() const {
+    CORRADE_ASSERT(_state->drawCallsIndex < measurementCount(),
+        "DebugTools::FrameProfilerGL::drawCallsMean(): not enabled", {});
+    return measurementMean(_state->drawCallsIndex);
+}
+
+Double FrameProfilerGL::programSwitchesMean() const {
+    CORRADE_ASSERT(_state->programSwitchesIndex < measurementCount(),
+        "DebugTools::FrameProfilerGL::programSwitchesMean(): not enabled", {});
+    return measurementMean(_state->programSwitchesIndex);
+}
+
+Double FrameProfilerGL::bindCallsMean() const {
+    CORRADE_ASSERT(_state->bindCallsIndex < measurementCount(),
+        "DebugTools::FrameProfilerGL::bindCallsMean(): not enabled", {});
+    return measurementMean(_state->bindCallsIndex);
+}
+
+Double FrameProfilerGL::uniformUploadsMean() const {
+    CORRADE_ASSERT(_state->uniformUploadsIndex < measurementCount(),
+        "DebugTools::FrameProfilerGL::uniformUploadsMean(): not enabled", {});
+    return measurementMean(_state->uniformUploadsIndex);
+}
+
 namespace {
 
 constexpr const char* FrameProfilerGLValueNames[] {
@@ -653,7 +751,11 @@ constexpr const char* FrameProfilerGLValueNames[] {
     "CpuDuration",
     "GpuDuration",
     "VertexFetchRatio",
-    "PrimitiveClipRatio"
+    "PrimitiveClipRatio",
+    "DrawCalls",
+    "ProgramSwitches",
+    "BindCalls",
+    "UniformUploads"
 };
 
 }
@@ -675,8 +777,12 @@ Debug& operator<<(Debug& debug, const FrameProfilerGL::Values value) {
         FrameProfilerGL::Value::GpuDuration,
         #ifndef MAGNUM_TARGET_GLES
         FrameProfilerGL::Value::VertexFetchRatio,
-        FrameProfilerGL::Value::PrimitiveClipRatio
+        FrameProfilerGL::Value::PrimitiveClipRatio,
         #endif
+        FrameProfilerGL::Value::DrawCalls,
+        FrameProfilerGL::Value::ProgramSwitches,
+        FrameProfilerGL::Value::BindCalls,
+        FrameProfilerGL::Value::UniformUploads
         });
 }
 #endif
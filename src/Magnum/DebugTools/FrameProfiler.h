@@ -522,9 +522,19 @@ in the @ref DebugTools-FrameProfiler-usage "FrameProfiler usage documentation":
 
 @snippet DebugTools-gl.cpp FrameProfilerGL-usage
 
-If none of @ref Value::GpuDuration, @ref Value::VertexFetchRatio and
-@ref Value::PrimitiveClipRatio is not enabled, the class can operate without an
-active OpenGL context.
+If none of @ref Value::GpuDuration, @ref Value::VertexFetchRatio,
+@ref Value::PrimitiveClipRatio, @ref Value::DrawCalls,
+@ref Value::ProgramSwitches, @ref Value::BindCalls and
+@ref Value::UniformUploads is enabled, the class can operate without an active
+OpenGL context.
+
+The @ref Value::DrawCalls, @ref Value::ProgramSwitches, @ref Value::BindCalls
+and @ref Value::UniformUploads values are taken from
+@ref GL::Context::statistics(), with the collection enabled in @ref setup().
+Together they can be used to spot redundant state changes in a renderer
+without having to use an external GL tracer:
+
+@snippet DebugTools-gl.cpp FrameProfilerGL-usage-statistics
 
 @experimental
 */
@@ -586,8 +596,47 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
              * value requires an active OpenGL context.
              * @requires_gl46 Extension @gl_extension{ARB,pipeline_statistics_query}
              */
-            PrimitiveClipRatio = 1 << 4
+            PrimitiveClipRatio = 1 << 4,
             #endif
+
+            /**
+             * Count of draw calls submitted during a frame. Reported in
+             * @ref Units::Count with no delay. This value requires an active
+             * OpenGL context.
+             * @see @ref GL::Context::Statistics::drawCalls
+             * @m_since_latest
+             */
+            DrawCalls = 1 << 5,
+
+            /**
+             * Count of shader program switches done during a frame. Reported
+             * in @ref Units::Count with no delay. This value requires an
+             * active OpenGL context.
+             * @see @ref GL::Context::Statistics::programSwitches
+             * @m_since_latest
+             */
+            ProgramSwitches = 1 << 6,
+
+            /**
+             * Count of buffer, texture, framebuffer and vertex array object
+             * binds done during a frame. Reported in @ref Units::Count with no
+             * delay. This value requires an active OpenGL context.
+             * @see @ref GL::Context::Statistics::bufferBinds,
+             *      @relativeref{GL::Context::Statistics,textureBinds},
+             *      @relativeref{GL::Context::Statistics,framebufferBinds},
+             *      @relativeref{GL::Context::Statistics,vaoBinds}
+             * @m_since_latest
+             */
+            BindCalls = 1 << 7,
+
+            /**
+             * Count of uniform uploads done during a frame. Reported in
+             * @ref Units::Count with no delay. This value requires an active
+             * OpenGL context.
+             * @see @ref GL::Context::Statistics::uniformUploads
+             * @m_since_latest
+             */
+            UniformUploads = 1 << 8
         };
 
         /**
@@ -710,6 +759,48 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
         Double primitiveClipRatioMean() const;
         #endif
 
+        /**
+         * @brief Mean draw call count
+         * @m_since_latest
+         *
+         * Expects that @ref Value::DrawCalls was enabled, and that measurement
+         * data is available. See the flag documentation for more information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double drawCallsMean() const;
+
+        /**
+         * @brief Mean shader program switch count
+         * @m_since_latest
+         *
+         * Expects that @ref Value::ProgramSwitches was enabled, and that
+         * measurement data is available. See the flag documentation for more
+         * information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double programSwitchesMean() const;
+
+        /**
+         * @brief Mean bind call count
+         * @m_since_latest
+         *
+         * Expects that @ref Value::BindCalls was enabled, and that measurement
+         * data is available. See the flag documentation for more information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double bindCallsMean() const;
+
+        /**
+         * @brief Mean uniform upload count
+         * @m_since_latest
+         *
+         * Expects that @ref Value::UniformUploads was enabled, and that
+         * measurement data is available. See the flag documentation for more
+         * information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double uniformUploadsMean() const;
+
     private:
         using FrameProfiler::setup;
 
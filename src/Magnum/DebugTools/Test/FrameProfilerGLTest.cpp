@@ -50,6 +50,7 @@ struct FrameProfilerGLTest: GL::OpenGLTester {
     explicit FrameProfilerGLTest();
 
     void test();
+    void stateStatistics();
     #ifndef MAGNUM_TARGET_GLES
     void vertexFetchRatioDivisionByZero();
     void primitiveClipRatioDivisionByZero();
@@ -76,6 +77,8 @@ FrameProfilerGLTest::FrameProfilerGLTest() {
     addInstancedTests({&FrameProfilerGLTest::test},
         Containers::arraySize(Data));
 
+    addTests({&FrameProfilerGLTest::stateStatistics});
+
     #ifndef MAGNUM_TARGET_GLES
     addTests({&FrameProfilerGLTest::vertexFetchRatioDivisionByZero,
               &FrameProfilerGLTest::primitiveClipRatioDivisionByZero,
@@ -198,6 +201,61 @@ void FrameProfilerGLTest::test() {
     #endif
 }
 
+void FrameProfilerGLTest::stateStatistics() {
+    /* Two framebuffers to have a deterministic count of binds each frame */
+    GL::Renderbuffer color;
+    color.setStorage(
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        GL::RenderbufferFormat::RGBA8,
+        #else
+        GL::RenderbufferFormat::RGBA4,
+        #endif
+        Vector2i{32});
+    GL::Framebuffer fbA{{{}, Vector2i{32}}};
+    GL::Framebuffer fbB{{{}, Vector2i{32}}};
+    fbA.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color);
+    fbB.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color);
+
+    GL::Mesh mesh = MeshTools::compile(Primitives::cubeSolid());
+    Shaders::FlatGL3D shaderA, shaderB;
+
+    FrameProfilerGL profiler{
+        FrameProfilerGL::Value::DrawCalls|
+        FrameProfilerGL::Value::ProgramSwitches|
+        FrameProfilerGL::Value::BindCalls|
+        FrameProfilerGL::Value::UniformUploads, 4};
+    CORRADE_VERIFY(GL::Context::current().isStatisticsEnabled());
+    CORRADE_VERIFY(!profiler.isMeasurementAvailable(FrameProfilerGL::Value::DrawCalls));
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        profiler.beginFrame();
+        fbA.bind();
+        shaderA
+            .setColor(0xff3366_rgbf)
+            .draw(mesh);
+        fbB.bind();
+        shaderB.draw(mesh);
+        /* Same program, the switch is filtered out by the state tracker but
+           the draw is counted */
+        shaderB.draw(mesh);
+        profiler.endFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Disable the collection again to not affect other tests */
+    GL::Context::current().setStatisticsEnabled(false);
+
+    CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerGL::Value::DrawCalls));
+    CORRADE_COMPARE(profiler.drawCallsMean(), 3.0);
+    CORRADE_COMPARE(profiler.programSwitchesMean(), 2.0);
+    CORRADE_COMPARE(profiler.uniformUploadsMean(), 1.0);
+    /* Two framebuffer binds, plus possibly VAO binds if the mesh VAO wasn't
+       bound at the time the first frame started */
+    CORRADE_COMPARE_AS(profiler.bindCallsMean(), 2.0,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void FrameProfilerGLTest::vertexFetchRatioDivisionByZero() {
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::pipeline_statistics_query>())
@@ -1191,8 +1191,8 @@ void FrameProfilerTest::debugGLValue() {
 void FrameProfilerTest::debugGLValues() {
     Containers::String out;
 
-    Debug{&out} << (FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::FrameTime) << FrameProfilerGL::Values{};
-    CORRADE_COMPARE(out, "DebugTools::FrameProfilerGL::Value::FrameTime|DebugTools::FrameProfilerGL::Value::CpuDuration DebugTools::FrameProfilerGL::Values{}\n");
+    Debug{&out} << (FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::FrameTime) << (FrameProfilerGL::Value::BindCalls|FrameProfilerGL::Value::DrawCalls) << FrameProfilerGL::Values{};
+    CORRADE_COMPARE(out, "DebugTools::FrameProfilerGL::Value::FrameTime|DebugTools::FrameProfilerGL::Value::CpuDuration DebugTools::FrameProfilerGL::Value::DrawCalls|DebugTools::FrameProfilerGL::Value::BindCalls DebugTools::FrameProfilerGL::Values{}\n");
 }
 
 void FrameProfilerTest::configurationGLValue() {
@@ -1202,6 +1202,10 @@ void FrameProfilerTest::configurationGLValue() {
     CORRADE_COMPARE(c.value("value"), "GpuDuration");
     CORRADE_COMPARE(c.value<FrameProfilerGL::Value>("value"), FrameProfilerGL::Value::GpuDuration);
 
+    c.setValue("last", FrameProfilerGL::Value::UniformUploads);
+    CORRADE_COMPARE(c.value("last"), "UniformUploads");
+    CORRADE_COMPARE(c.value<FrameProfilerGL::Value>("last"), FrameProfilerGL::Value::UniformUploads);
+
     c.setValue("zero", FrameProfilerGL::Value{});
     CORRADE_COMPARE(c.value("zero"), "");
     CORRADE_COMPARE(c.value<FrameProfilerGL::Value>("zero"), FrameProfilerGL::Value{});
@@ -1222,7 +1226,7 @@ void FrameProfilerTest::configurationGLValues() {
     CORRADE_COMPARE(c.value("empty"), "");
     CORRADE_COMPARE(c.value<FrameProfilerGL::Values>("empty"), FrameProfilerGL::Values{});
 
-    c.setValue("invalid", FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::GpuDuration|FrameProfilerGL::Value(0xff00));
+    c.setValue("invalid", FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::GpuDuration|FrameProfilerGL::Value(0xfe00));
     CORRADE_COMPARE(c.value("invalid"), "CpuDuration GpuDuration");
     CORRADE_COMPARE(c.value<FrameProfilerGL::Values>("invalid"), FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::GpuDuration);
 }
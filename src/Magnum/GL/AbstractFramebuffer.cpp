@@ -46,6 +46,7 @@
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/TextureArray.h"
 #endif
+#include "Magnum/GL/Implementation/ContextState.h"
 #include "Magnum/GL/Implementation/FramebufferState.h"
 #include "Magnum/GL/Implementation/RendererState.h"
 #include "Magnum/GL/Implementation/State.h"
@@ -140,6 +141,7 @@ void AbstractFramebuffer::bindImplementationSingle(AbstractFramebuffer& self, Fr
 
     /* Binding the framebuffer finally creates it */
     self._flags |= ObjectFlag::Created;
+    Context::current().state().context.count(&Context::Statistics::framebufferBinds);
     glBindFramebuffer(GL_FRAMEBUFFER, self._id);
 }
 #endif
@@ -160,6 +162,7 @@ void AbstractFramebuffer::bindImplementationDefault(AbstractFramebuffer& self, F
 
     /* Binding the framebuffer finally creates it */
     self._flags |= ObjectFlag::Created;
+    Context::current().state().context.count(&Context::Statistics::framebufferBinds);
     glBindFramebuffer(GLenum(target), self._id);
 }
 
@@ -184,6 +187,7 @@ FramebufferTarget AbstractFramebuffer::bindImplementationSingle(AbstractFramebuf
 
         /* Binding the framebuffer finally creates it */
         self._flags |= ObjectFlag::Created;
+        Context::current().state().context.count(&Context::Statistics::framebufferBinds);
         glBindFramebuffer(GL_FRAMEBUFFER, self._id);
     }
 
@@ -212,6 +216,7 @@ FramebufferTarget AbstractFramebuffer::bindImplementationDefault(AbstractFramebu
 
     /* Binding the framebuffer finally creates it */
     self._flags |= ObjectFlag::Created;
+    Context::current().state().context.count(&Context::Statistics::framebufferBinds);
     glBindFramebuffer(GLenum(FramebufferTarget::Read), self._id);
     return FramebufferTarget::Read;
 }
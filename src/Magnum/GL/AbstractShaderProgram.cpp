@@ -28,8 +28,13 @@
 
 #include "AbstractShaderProgram.h"
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <algorithm> /* std::sort() */
+#include <cstring>
+#endif
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <Corrade/Containers/Reference.h>
@@ -37,12 +42,17 @@
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+#endif
 
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/GL/MeshView.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -296,13 +306,61 @@ Int AbstractShaderProgram::maxTexelOffset() {
 }
 #endif
 
-AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram()) {
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Containers::StringView AbstractShaderProgram::binaryCacheDirectory() {
+    return Context::current().state().shaderProgram.binaryCacheDirectory;
+}
+
+bool AbstractShaderProgram::setBinaryCacheDirectory(const Containers::StringView directory) {
+    Containers::String& cacheDirectory = Context::current().state().shaderProgram.binaryCacheDirectory;
+    cacheDirectory = {};
+
+    /* Empty directory disables the cache */
+    if(directory.isEmpty()) return true;
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::get_program_binary>()) {
+        Warning{} << "GL::AbstractShaderProgram::setBinaryCacheDirectory():" << Extensions::ARB::get_program_binary::string() << "is not supported, cache disabled";
+        return false;
+    }
+    #endif
+
+    /* Drivers are allowed to not support any binary formats, in which case
+       glGetProgramBinary() would produce nothing */
+    GLint formatCount;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if(!formatCount) {
+        Warning{} << "GL::AbstractShaderProgram::setBinaryCacheDirectory(): no program binary formats supported, cache disabled";
+        return false;
+    }
+
+    /* Utility::Path::make() prints a message on its own */
+    if(!Utility::Path::make(directory)) return false;
+
+    cacheDirectory = Containers::String{directory};
+    return true;
+}
+#endif
+
+AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram())
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _linkStateHash{}, _binaryCacheKey{}, _linkedFromBinary{}
+    #endif
+{
     CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
 }
 
-AbstractShaderProgram::AbstractShaderProgram(NoCreateT) noexcept: _id{0} {}
+AbstractShaderProgram::AbstractShaderProgram(NoCreateT) noexcept: _id{0}
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _linkStateHash{}, _binaryCacheKey{}, _linkedFromBinary{}
+    #endif
+    {}
 
-AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id) {
+AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id)
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _linkStateHash{other._linkStateHash}, _binaryCacheKey{other._binaryCacheKey}, _linkedFromBinary{other._linkedFromBinary}
+    #endif
+{
     other._id = 0;
 }
 
@@ -319,6 +377,11 @@ AbstractShaderProgram::~AbstractShaderProgram() {
 AbstractShaderProgram& AbstractShaderProgram::operator=(AbstractShaderProgram&& other) noexcept {
     using Utility::swap;
     swap(_id, other._id);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_linkStateHash, other._linkStateHash);
+    swap(_binaryCacheKey, other._binaryCacheKey);
+    swap(_linkedFromBinary, other._linkedFromBinary);
+    #endif
     return *this;
 }
 
@@ -373,6 +436,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh) {
     if(!mesh._count || !mesh._instanceCount) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     #ifndef MAGNUM_TARGET_GLES2
     mesh.drawInternal(mesh._count, mesh._baseVertex, mesh._instanceCount, mesh._baseInstance, mesh._indexOffset, mesh._indexStart, mesh._indexEnd);
@@ -389,6 +453,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(MeshView& mesh) {
     if(!mesh._count || !mesh._instanceCount) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     #ifndef MAGNUM_TARGET_GLES2
     mesh._original->drawInternal(mesh._count, mesh._baseVertex, mesh._instanceCount, mesh._baseInstance, mesh._indexOffset, mesh._indexStart, mesh._indexEnd);
@@ -402,6 +467,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, const Containers:
     if(!counts.size()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     mesh.drawInternalStrided(counts, vertexOffsets, indexOffsets);
     return *this;
@@ -412,6 +478,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, const Containers:
     if(!counts.size()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     mesh.drawInternalStrided(counts, vertexOffsets, indexOffsets);
     return *this;
@@ -428,6 +495,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, const Containers:
     if(!counts.size()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     mesh.drawInternalStrided(counts, instanceCounts, vertexOffsets, indexOffsets, instanceOffsets);
     return *this;
@@ -438,6 +506,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, const Containers:
     if(!counts.size()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     mesh.drawInternalStrided(counts, instanceCounts, vertexOffsets, indexOffsets, instanceOffsets);
     return *this;
@@ -453,6 +522,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, const Containers:
     if(!counts.size()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     mesh.drawInternalStrided(counts, instanceCounts, vertexOffsets, indexOffsets
         #ifndef MAGNUM_TARGET_GLES2
@@ -467,6 +537,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, const Containers:
     if(!counts.size()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     mesh.drawInternalStrided(counts, instanceCounts, vertexOffsets, indexOffsets
         #ifndef MAGNUM_TARGET_GLES2
@@ -486,6 +557,7 @@ AbstractShaderProgram& AbstractShaderProgram::draw(const Containers::Iterable<Me
     if(meshes.isEmpty()) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
 
     #ifndef CORRADE_NO_ASSERT
     const Mesh* original = &*meshes.front()._original;
@@ -501,12 +573,43 @@ AbstractShaderProgram& AbstractShaderProgram::draw(const Containers::Iterable<Me
     return *this;
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+AbstractShaderProgram& AbstractShaderProgram::drawIndirect(Mesh& mesh, Buffer& commands, const GLintptr offset, const UnsignedInt count, const UnsignedInt stride) {
+    CORRADE_ASSERT(offset % 4 == 0 && stride % 4 == 0,
+        "GL::AbstractShaderProgram::drawIndirect(): expected offset and stride to be multiples of four, got" << offset << "and" << stride, *this);
+
+    /* Nothing to draw, exit without touching any state */
+    if(!count) return *this;
+
+    use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
+    mesh.drawInternalIndirect(commands, offset, count, stride);
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+AbstractShaderProgram& AbstractShaderProgram::drawIndirect(Mesh& mesh, Buffer& commands, const GLintptr offset, Buffer& countBuffer, const GLintptr countOffset, const UnsignedInt maxCount, const UnsignedInt stride) {
+    CORRADE_ASSERT(offset % 4 == 0 && countOffset % 4 == 0 && stride % 4 == 0,
+        "GL::AbstractShaderProgram::drawIndirect(): expected offset, count offset and stride to be multiples of four, got" << offset << Debug::nospace << "," << countOffset << "and" << stride, *this);
+
+    /* Nothing to draw, exit without touching any state */
+    if(!maxCount) return *this;
+
+    use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
+    mesh.drawInternalIndirect(commands, offset, countBuffer, countOffset, maxCount, stride);
+    return *this;
+}
+#endif
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 AbstractShaderProgram& AbstractShaderProgram::drawTransformFeedback(Mesh& mesh, TransformFeedback& xfb, UnsignedInt stream) {
     /* Nothing to draw, exit without touching any state */
     if(!mesh._instanceCount) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
     mesh.drawInternal(xfb, stream, mesh._instanceCount);
     return *this;
 }
@@ -516,6 +619,7 @@ AbstractShaderProgram& AbstractShaderProgram::drawTransformFeedback(MeshView& me
     if(mesh._instanceCount) return *this;
 
     use();
+    Context::current().state().context.count(&Context::Statistics::drawCalls);
     mesh._original->drawInternal(xfb, stream, mesh._instanceCount);
     return *this;
 }
@@ -534,8 +638,12 @@ AbstractShaderProgram& AbstractShaderProgram::dispatchCompute(const Vector3ui& w
 
 void AbstractShaderProgram::use(const GLuint id) {
     /* Use only if the program isn't already in use */
-    GLuint& current = Context::current().state().shaderProgram.current;
-    if(current != id) glUseProgram(current = id);
+    Implementation::State& state = Context::current().state();
+    GLuint& current = state.shaderProgram.current;
+    if(current != id) {
+        state.context.count(&Context::Statistics::programSwitches);
+        glUseProgram(current = id);
+    }
 }
 
 void AbstractShaderProgram::use() { use(_id); }
@@ -548,8 +656,39 @@ void AbstractShaderProgram::attachShaders(const Containers::Iterable<Shader>& sh
     for(Shader& s: shaders) attachShader(s);
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace {
+
+/* 64-bit FNV-1a */
+UnsignedLong hashString(UnsignedLong hash, const Containers::StringView string) {
+    for(const char c: string) {
+        hash ^= UnsignedByte(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr UnsignedLong HashOffsetBasis = 14695981039346656037ull;
+
+/* Used to mix state that affects the linked program but isn't a part of the
+   shader sources into the binary cache key. The name size is included so a
+   sequence of names doesn't hash the same as their concatenation. */
+UnsignedLong hashLinkState(UnsignedLong hash, const std::initializer_list<UnsignedInt> values, const Containers::StringView name) {
+    for(const UnsignedInt value: values)
+        hash = hashString(hash, {reinterpret_cast<const char*>(&value), sizeof(UnsignedInt)});
+    const std::size_t size = name.size();
+    hash = hashString(hash, {reinterpret_cast<const char*>(&size), sizeof(std::size_t)});
+    return hashString(hash, name);
+}
+
+}
+#endif
+
 void AbstractShaderProgram::bindAttributeLocation(const UnsignedInt location, const Containers::StringView name) {
     glBindAttribLocation(_id, location, Containers::String::nullTerminatedView(name).data());
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    _linkStateHash = hashLinkState(_linkStateHash, {0, location}, name);
+    #endif
 }
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -560,6 +699,7 @@ void AbstractShaderProgram::bindFragmentDataLocation(const UnsignedInt location,
     glBindFragDataLocationEXT
     #endif
         (_id, location, Containers::String::nullTerminatedView(name).data());
+    _linkStateHash = hashLinkState(_linkStateHash, {1, location}, name);
 }
 
 void AbstractShaderProgram::bindFragmentDataLocationIndexed(const UnsignedInt location, UnsignedInt index, const Containers::StringView name) {
@@ -569,12 +709,18 @@ void AbstractShaderProgram::bindFragmentDataLocationIndexed(const UnsignedInt lo
     glBindFragDataLocationIndexedEXT
     #endif
         (_id, location, index, Containers::String::nullTerminatedView(name).data());
+    _linkStateHash = hashLinkState(_linkStateHash, {2, location, index}, name);
 }
 #endif
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setTransformFeedbackOutputs(const Containers::StringIterable& outputs, const TransformFeedbackBufferMode bufferMode) {
     Context::current().state().shaderProgram.transformFeedbackVaryingsImplementation(*this, outputs, bufferMode);
+    #ifndef MAGNUM_TARGET_WEBGL
+    _linkStateHash = hashLinkState(_linkStateHash, {3, UnsignedInt(bufferMode), UnsignedInt(outputs.size())}, {});
+    for(std::size_t i = 0; i != outputs.size(); ++i)
+        _linkStateHash = hashLinkState(_linkStateHash, {}, outputs[i]);
+    #endif
 }
 
 void AbstractShaderProgram::transformFeedbackVaryingsImplementationDefault(AbstractShaderProgram& self, const Containers::StringIterable& outputs, const TransformFeedbackBufferMode bufferMode) {
@@ -624,11 +770,108 @@ bool AbstractShaderProgram::link() {
     return checkLink({});
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace {
+
+UnsignedLong binaryCacheKey(const Containers::ArrayView<const GLuint> shaders, const UnsignedLong linkStateHash) {
+    /* Hash each attached shader separately, together with its type. Those
+       are then sorted to not depend on the order in which the shaders were
+       attached. */
+    Containers::Array<UnsignedLong> shaderHashes{NoInit, shaders.size()};
+    for(std::size_t i = 0; i != shaders.size(); ++i) {
+        GLint type, sourceLength;
+        glGetShaderiv(shaders[i], GL_SHADER_TYPE, &type);
+        glGetShaderiv(shaders[i], GL_SHADER_SOURCE_LENGTH, &sourceLength);
+
+        /* The length is reported including the null terminator, same as
+           with the info log in checkLink() */
+        Containers::String source{NoInit, std::size_t(Math::max(sourceLength, 1)) - 1};
+        if(sourceLength > 1)
+            glGetShaderSource(shaders[i], sourceLength, nullptr, source.data());
+
+        shaderHashes[i] = hashString(hashString(HashOffsetBasis, {reinterpret_cast<const char*>(&type), sizeof(GLint)}), source);
+    }
+    std::sort(shaderHashes.begin(), shaderHashes.end());
+
+    /* The binary is valid only for the exact same driver, so include its
+       identification as well */
+    Context& context = Context::current();
+    UnsignedLong hash = HashOffsetBasis;
+    hash = hashString(hash, context.vendorString());
+    hash = hashString(hash, context.rendererString());
+    hash = hashString(hash, context.versionString());
+    for(const UnsignedLong shaderHash: shaderHashes)
+        hash = hashString(hash, {reinterpret_cast<const char*>(&shaderHash), sizeof(UnsignedLong)});
+    /* Attribute and fragment data locations and transform feedback outputs
+       affect the linked program as well */
+    return hashString(hash, {reinterpret_cast<const char*>(&linkStateHash), sizeof(UnsignedLong)});
+}
+
+Containers::String binaryCacheFilename(const Containers::StringView directory, const UnsignedLong key) {
+    return Utility::Path::join(directory, Utility::format("{:.16x}.bin", key));
+}
+
+}
+#endif
+
 void AbstractShaderProgram::submitLink() {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    _binaryCacheKey = 0;
+    _linkedFromBinary = false;
+
+    Implementation::ShaderProgramState& state = Context::current().state().shaderProgram;
+    const Containers::StringView cacheDirectory = state.binaryCacheDirectory;
+    if(!cacheDirectory.isEmpty()) {
+        GLint shaderCount;
+        glGetProgramiv(_id, GL_ATTACHED_SHADERS, &shaderCount);
+        Containers::Array<GLuint> shaders{NoInit, std::size_t(shaderCount)};
+        if(shaderCount)
+            glGetAttachedShaders(_id, shaderCount, nullptr, shaders.data());
+
+        /* If there's a cached binary, try to use it. The file contains the
+           binary format followed by the binary itself. If the driver refuses
+           it, for example because it got updated without the version string
+           changing, fall back to compiling and linking from source. */
+        const UnsignedLong key = binaryCacheKey(shaders, _linkStateHash);
+        const Containers::String filename = binaryCacheFilename(cacheDirectory, key);
+        if(Utility::Path::exists(filename)) {
+            const Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+            if(data && data->size() > sizeof(GLenum)) {
+                GLenum format;
+                std::memcpy(&format, data->data(), sizeof(GLenum));
+                glProgramBinary(_id, format, data->data() + sizeof(GLenum), data->size() - sizeof(GLenum));
+
+                GLint success;
+                glGetProgramiv(_id, GL_LINK_STATUS, &success);
+                if(success) {
+                    _linkedFromBinary = true;
+                    return;
+                }
+            }
+        }
+
+        /* Not in the cache, compile shaders that Shader::submitCompile()
+           deferred and remember the key to save the binary in checkLink().
+           Shaders compiled directly or by a previous link aren't in the list
+           and are left alone. */
+        for(const GLuint shader: shaders)
+            if(state.removeDeferredCompileShader(shader))
+                glCompileShader(shader);
+        glProgramParameteri(_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        _binaryCacheKey = key;
+    }
+    #endif
+
     glLinkProgram(_id);
 }
 
 bool AbstractShaderProgram::checkLink(const Containers::Iterable<Shader>& shaders) {
+    /* If the program was loaded from a binary cache, the shaders were never
+       compiled and there's nothing to check */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_linkedFromBinary) return true;
+    #endif
+
     /* If any compilation failed, abort without even checking the link status.
        The checkCompile() API is called always, to print also compilation
        warnings even in case everything still manages to link well. */
@@ -670,6 +913,26 @@ bool AbstractShaderProgram::checkLink(const Containers::Iterable<Shader>& shader
             << Debug::newline << messageTrimmed;
     }
 
+    /* Save the linked binary to the cache, if requested by submitLink() */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(success && _binaryCacheKey) {
+        GLint binaryLength;
+        glGetProgramiv(_id, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+        if(binaryLength) {
+            Containers::Array<char> data{NoInit, sizeof(GLenum) + binaryLength};
+            GLenum format;
+            glGetProgramBinary(_id, binaryLength, nullptr, &format, data.data() + sizeof(GLenum));
+            std::memcpy(data.data(), &format, sizeof(GLenum));
+
+            /* Utility::Path::write() prints a message on its own, a failure
+               to save the cache isn't fatal */
+            Utility::Path::write(binaryCacheFilename(Context::current().state().shaderProgram.binaryCacheDirectory, _binaryCacheKey), data);
+        }
+
+        _binaryCacheKey = 0;
+    }
+    #endif
+
     return success;
 }
 
@@ -723,6 +986,7 @@ UnsignedInt AbstractShaderProgram::uniformBlockIndex(const Containers::StringVie
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, Float value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1fImplementation
     #else
@@ -740,6 +1004,7 @@ void AbstractShaderProgram::uniform1fImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<2, Float>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform2fImplementation
     #else
@@ -757,6 +1022,7 @@ void AbstractShaderProgram::uniform2fImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<3, Float>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform3fImplementation
     #else
@@ -774,6 +1040,7 @@ void AbstractShaderProgram::uniform3fImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<4, Float>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform4fImplementation
     #else
@@ -791,6 +1058,7 @@ void AbstractShaderProgram::uniform4fImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, Int value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1iImplementation
     #else
@@ -808,6 +1076,7 @@ void AbstractShaderProgram::uniform1iImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<2, Int>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform2iImplementation
     #else
@@ -825,6 +1094,7 @@ void AbstractShaderProgram::uniform2iImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<3, Int>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform3iImplementation
     #else
@@ -842,6 +1112,7 @@ void AbstractShaderProgram::uniform3iImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<4, Int>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform4iImplementation
     #else
@@ -860,6 +1131,7 @@ void AbstractShaderProgram::uniform4iImplementationDefault(const GLuint id, cons
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, UnsignedInt value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1uiImplementation
     #else
@@ -877,6 +1149,7 @@ void AbstractShaderProgram::uniform1uiImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<2, UnsignedInt>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform2uiImplementation
     #else
@@ -894,6 +1167,7 @@ void AbstractShaderProgram::uniform2uiImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<3, UnsignedInt>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform3uiImplementation
     #else
@@ -911,6 +1185,7 @@ void AbstractShaderProgram::uniform3uiImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<4, UnsignedInt>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform4uiImplementation
     #else
@@ -930,6 +1205,7 @@ void AbstractShaderProgram::uniform4uiImplementationDefault(const GLuint id, con
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, Double value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1dImplementation
     #else
@@ -944,6 +1220,7 @@ void AbstractShaderProgram::uniform1dImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<2, Double>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform2dImplementation(_id, location, value[0], value[1]);
 }
 
@@ -953,6 +1230,7 @@ void AbstractShaderProgram::uniform2dImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<3, Double>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform3dImplementation(_id, location, value[0], value[1], value[2]);
 }
 
@@ -962,6 +1240,7 @@ void AbstractShaderProgram::uniform3dImplementationDefault(const GLuint id, cons
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Math::Vector<4, Double>& value) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform4dImplementation(_id, location, value[0], value[1], value[2], value[3]);
 }
 
@@ -972,6 +1251,7 @@ void AbstractShaderProgram::uniform4dImplementationDefault(const GLuint id, cons
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Float> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1fvImplementation
     #else
@@ -989,6 +1269,7 @@ void AbstractShaderProgram::uniform1fvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location,  const Containers::ArrayView<const Math::Vector<2, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform2fvImplementation
     #else
@@ -1006,6 +1287,7 @@ void AbstractShaderProgram::uniform2fvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform3fvImplementation
     #else
@@ -1023,6 +1305,7 @@ void AbstractShaderProgram::uniform3fvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform4fvImplementation
     #else
@@ -1040,6 +1323,7 @@ void AbstractShaderProgram::uniform4fvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Int> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1ivImplementation
     #else
@@ -1057,6 +1341,7 @@ void AbstractShaderProgram::uniform1ivImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<2, Int>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform2ivImplementation
     #else
@@ -1074,6 +1359,7 @@ void AbstractShaderProgram::uniform2ivImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, Int>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform3ivImplementation
     #else
@@ -1091,6 +1377,7 @@ void AbstractShaderProgram::uniform3ivImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, Int>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform4ivImplementation
     #else
@@ -1109,6 +1396,7 @@ void AbstractShaderProgram::uniform4ivImplementationDefault(const GLuint id, con
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const UnsignedInt> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform1uivImplementation
     #else
@@ -1126,6 +1414,7 @@ void AbstractShaderProgram::uniform1uivImplementationDefault(const GLuint id, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<2, UnsignedInt>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform2uivImplementation
     #else
@@ -1143,6 +1432,7 @@ void AbstractShaderProgram::uniform2uivImplementationDefault(const GLuint id, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, UnsignedInt>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform3uivImplementation
     #else
@@ -1160,6 +1450,7 @@ void AbstractShaderProgram::uniform3uivImplementationDefault(const GLuint id, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, UnsignedInt>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniform4uivImplementation
     #else
@@ -1179,6 +1470,7 @@ void AbstractShaderProgram::uniform4uivImplementationDefault(const GLuint id, co
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Double> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform1dvImplementation(_id, location, values.size(), values.data());
 }
 
@@ -1188,6 +1480,7 @@ void AbstractShaderProgram::uniform1dvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<2, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform2dvImplementation(_id, location, values.size(), values.data()->data());
 }
 
@@ -1197,6 +1490,7 @@ void AbstractShaderProgram::uniform2dvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform3dvImplementation(_id, location, values.size(), values.data()->data());
 }
 
@@ -1206,6 +1500,7 @@ void AbstractShaderProgram::uniform3dvImplementationDefault(const GLuint id, con
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniform4dvImplementation(_id, location, values.size(), values.data()->data());
 }
 
@@ -1216,6 +1511,7 @@ void AbstractShaderProgram::uniform4dvImplementationDefault(const GLuint id, con
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 2, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix2fvImplementation
     #else
@@ -1233,6 +1529,7 @@ void AbstractShaderProgram::uniformMatrix2fvImplementationDefault(const GLuint i
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 3, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix3fvImplementation
     #else
@@ -1250,6 +1547,7 @@ void AbstractShaderProgram::uniformMatrix3fvImplementationDefault(const GLuint i
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 4, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix4fvImplementation
     #else
@@ -1268,6 +1566,7 @@ void AbstractShaderProgram::uniformMatrix4fvImplementationDefault(const GLuint i
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 3, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix2x3fvImplementation
     #else
@@ -1285,6 +1584,7 @@ void AbstractShaderProgram::uniformMatrix2x3fvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 2, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix3x2fvImplementation
     #else
@@ -1302,6 +1602,7 @@ void AbstractShaderProgram::uniformMatrix3x2fvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 4, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix2x4fvImplementation
     #else
@@ -1319,6 +1620,7 @@ void AbstractShaderProgram::uniformMatrix2x4fvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 2, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix4x2fvImplementation
     #else
@@ -1336,6 +1638,7 @@ void AbstractShaderProgram::uniformMatrix4x2fvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 4, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix3x4fvImplementation
     #else
@@ -1353,6 +1656,7 @@ void AbstractShaderProgram::uniformMatrix3x4fvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 3, Float>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     #ifndef MAGNUM_TARGET_WEBGL
     Context::current().state().shaderProgram.uniformMatrix4x3fvImplementation
     #else
@@ -1372,6 +1676,7 @@ void AbstractShaderProgram::uniformMatrix4x3fvImplementationDefault(const GLuint
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 2, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix2dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1381,6 +1686,7 @@ void AbstractShaderProgram::uniformMatrix2dvImplementationDefault(const GLuint i
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 3, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix3dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1390,6 +1696,7 @@ void AbstractShaderProgram::uniformMatrix3dvImplementationDefault(const GLuint i
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 4, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix4dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1399,6 +1706,7 @@ void AbstractShaderProgram::uniformMatrix4dvImplementationDefault(const GLuint i
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 3, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix2x3dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1408,6 +1716,7 @@ void AbstractShaderProgram::uniformMatrix2x3dvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 2, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix3x2dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1417,6 +1726,7 @@ void AbstractShaderProgram::uniformMatrix3x2dvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 4, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix2x4dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1426,6 +1736,7 @@ void AbstractShaderProgram::uniformMatrix2x4dvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 2, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix4x2dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1435,6 +1746,7 @@ void AbstractShaderProgram::uniformMatrix4x2dvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 4, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix3x4dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -1444,6 +1756,7 @@ void AbstractShaderProgram::uniformMatrix3x4dvImplementationDefault(const GLuint
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 3, Double>> values) {
+    Context::current().state().context.count(&Context::Statistics::uniformUploads);
     Context::current().state().shaderProgram.uniformMatrix4x3dvImplementation(_id, location, values.size(), GL_FALSE, values.data()->data());
 }
 
@@ -507,6 +507,38 @@ was done the usual way.
 
 @snippet GL.cpp AbstractShaderProgram-async-usage
 
+For many shaders at once, such as all shader variants needed by a scene, the
+@ref ShaderCompileQueue class can be used to poll all of them every frame
+and finish those that are done linking.
+
+@section GL-AbstractShaderProgram-binary-cache Program binary cache
+
+Even with async compilation, compiling hundreds of shader variants on every
+application start can take a long time. If a cache directory is set with
+@ref setBinaryCacheDirectory(), binaries of linked programs are saved there and
+loaded on the next run, skipping the compilation altogether:
+
+@snippet GL.cpp AbstractShaderProgram-binary-cache
+
+With the cache enabled, @ref Shader::submitCompile() only uploads the shader
+sources and the compilation is deferred to @ref submitLink(). That function
+calculates a key from sources and types of all attached shaders together with
+@ref Context::vendorString(), @relativeref{Context,rendererString()} and
+@relativeref{Context,versionString()} and looks for a file named after it in
+the cache directory. If found and accepted by the driver, the program is
+created from it with @fn_gl_keyword{ProgramBinary} and @ref checkLink() then
+doesn't check the shader compilation status at all. Otherwise the shaders are
+compiled and linked as usual and @ref checkLink() saves the result of
+@fn_gl_keyword{GetProgramBinary} to the cache on success.
+
+Besides the sources, the key includes also all @ref bindAttributeLocation(),
+@ref bindFragmentDataLocation(), @ref bindFragmentDataLocationIndexed() and
+@ref setTransformFeedbackOutputs() calls made on the program so far, in the
+order they were made. Two programs that end up with the same state through a
+different sequence of calls thus don't share a cache entry, but a program
+never gets a binary linked with different locations or outputs. The cache is
+never pruned, stale entries are left in the directory.
+
 @section GL-AbstractShaderProgram-performance-optimization Performance optimizations
 
 The engine tracks currently used shader program to avoid unnecessary calls to
@@ -711,6 +743,45 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         static Int maxUniformBlockSize();
 
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Program binary cache directory
+         * @m_since_latest
+         *
+         * Empty if the cache is disabled, which is the default.
+         * @see @ref setBinaryCacheDirectory()
+         * @requires_gles30 Binary program representations are not available
+         *      in OpenGL ES 2.0.
+         * @requires_gles Binary program representations are not available in
+         *      WebGL.
+         */
+        static Containers::StringView binaryCacheDirectory();
+
+        /**
+         * @brief Set program binary cache directory
+         * @m_since_latest
+         *
+         * If @p directory is non-empty, it's created if it doesn't exist yet
+         * and all programs linked with @ref submitLink() or @ref link() in
+         * the current context afterwards go through a cache of program
+         * binaries in it. See @ref GL-AbstractShaderProgram-binary-cache for
+         * details. Passing an empty @p directory disables the cache.
+         *
+         * If @gl_extension{ARB,get_program_binary} (part of OpenGL 4.1) is
+         * not supported, the driver doesn't support any binary formats or
+         * the directory can't be created, prints a message, leaves the cache
+         * disabled and returns @cpp false @ce. Otherwise returns
+         * @cpp true @ce.
+         * @see @ref binaryCacheDirectory(), @fn_gl{Get} with
+         *      @def_gl_keyword{NUM_PROGRAM_BINARY_FORMATS}
+         * @requires_gles30 Binary program representations are not available
+         *      in OpenGL ES 2.0.
+         * @requires_gles Binary program representations are not available in
+         *      WebGL.
+         */
+        static bool setBinaryCacheDirectory(Containers::StringView directory);
+        #endif
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @brief Max supported explicit uniform location count
@@ -1267,6 +1338,106 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         AbstractShaderProgram& draw(const Containers::Iterable<MeshView>& meshes);
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Draw a mesh with parameters coming from a buffer
+         * @param mesh      Mesh to draw
+         * @param commands  Buffer with draw commands
+         * @param offset    Byte offset of the first command in @p commands
+         * @param count     Command count
+         * @param stride    Byte stride between the commands. If @cpp 0 @ce,
+         *      the commands are assumed to be tightly packed.
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @p mesh is compatible with this shader, has its vertex
+         * buffers and an index buffer, if any, set up, and that @p commands
+         * contains @p count @ref DrawArraysIndirectCommand instances if the
+         * mesh is non-indexed or @ref DrawElementsIndirectCommand if it's
+         * indexed. Expects that the index buffer, if any, is set with a zero
+         * offset, and that @p offset and @p stride are multiples of four.
+         * Everything set by @ref Mesh::setCount(),
+         * @ref Mesh::setBaseVertex(), @ref Mesh::setInstanceCount(),
+         * @ref Mesh::setBaseInstance() and @ref Mesh::setIndexOffset() is
+         * ignored, the values are taken from the commands instead. If
+         * @p count is @cpp 0 @ce, no draw commands are issued.
+         *
+         * If @p count is @cpp 1 @ce, a single @fn_gl{DrawArraysIndirect} /
+         * @fn_gl{DrawElementsIndirect} is issued. Otherwise, if
+         * @gl_extension{ARB,multi_draw_indirect} (part of OpenGL 4.3) is
+         * available, all commands are submitted at once, with
+         * @glsl gl_DrawID @ce in shaders using
+         * @gl_extension{ARB,shader_draw_parameters} being the command index.
+         * If not, and on OpenGL ES, the commands are submitted one by one
+         * and @glsl gl_DrawID @ce is @cpp 0 @ce in all of them, which means
+         * shaders relying on it to pick per-draw data, such as
+         * @ref Shaders::FlatGL::Flag::MultiDraw, need
+         * @gl_extension{ARB,multi_draw_indirect} for @p count larger than
+         * @cpp 1 @ce.
+         * See @ref GL-Mesh-rendering-indirect for an example.
+         * @see @fn_gl_keyword{UseProgram}, @fn_gl{BindBuffer} with
+         *      @def_gl{DRAW_INDIRECT_BUFFER}, @fn_gl_keyword{BindVertexArray},
+         *      @fn_gl_keyword{DrawArraysIndirect}/@fn_gl_keyword{MultiDrawArraysIndirect}
+         *      or @fn_gl_keyword{DrawElementsIndirect}/@fn_gl_keyword{MultiDrawElementsIndirect}
+         * @requires_gl40 Extension @gl_extension{ARB,draw_indirect}
+         * @requires_gles31 Indirect drawing is not available in OpenGL ES
+         *      3.0 and older.
+         * @requires_gles Indirect drawing is not available in WebGL.
+         */
+        AbstractShaderProgram& drawIndirect(Mesh& mesh, Buffer& commands, GLintptr offset = 0, UnsignedInt count = 1, UnsignedInt stride = 0);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        AbstractShaderProgram& drawIndirect(Mesh&& mesh, Buffer& commands, GLintptr offset = 0, UnsignedInt count = 1, UnsignedInt stride = 0) {
+            return drawIndirect(mesh, commands, offset, count, stride);
+        }
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Draw a mesh with parameters and command count coming from a buffer
+         * @param mesh          Mesh to draw
+         * @param commands      Buffer with draw commands
+         * @param offset        Byte offset of the first command in
+         *      @p commands
+         * @param countBuffer   Buffer containing the command count
+         * @param countOffset   Byte offset of an @relativeref{Magnum,UnsignedInt}
+         *      command count in @p countBuffer
+         * @param maxCount      Max command count
+         * @param stride        Byte stride between the commands. If
+         *      @cpp 0 @ce, the commands are assumed to be tightly packed.
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Compared to @ref drawIndirect(Mesh&, Buffer&, GLintptr, UnsignedInt, UnsignedInt)
+         * the command count is taken from @p countBuffer as well, clamped to
+         * @p maxCount. This allows a compute shader to both generate the
+         * commands and decide how many of them get drawn, without any
+         * round trip to the CPU. Expects that @p offset, @p countOffset and
+         * @p stride are multiples of four. If @p maxCount is @cpp 0 @ce, no
+         * draw commands are issued.
+         * @see @fn_gl_keyword{UseProgram}, @fn_gl{BindBuffer} with
+         *      @def_gl{DRAW_INDIRECT_BUFFER} and @def_gl{PARAMETER_BUFFER},
+         *      @fn_gl_keyword{BindVertexArray},
+         *      @fn_gl_keyword{MultiDrawArraysIndirectCount} or
+         *      @fn_gl_keyword{MultiDrawElementsIndirectCount}
+         * @requires_gl46 Extension @gl_extension{ARB,indirect_parameters}
+         * @requires_gl Indirect draw count is not available in OpenGL ES or
+         *      WebGL.
+         */
+        AbstractShaderProgram& drawIndirect(Mesh& mesh, Buffer& commands, GLintptr offset, Buffer& countBuffer, GLintptr countOffset, UnsignedInt maxCount, UnsignedInt stride = 0);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        AbstractShaderProgram& drawIndirect(Mesh&& mesh, Buffer& commands, GLintptr offset, Buffer& countBuffer, GLintptr countOffset, UnsignedInt maxCount, UnsignedInt stride = 0) {
+            return drawIndirect(mesh, commands, offset, countBuffer, countOffset, maxCount, stride);
+        }
+        #endif
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Draw a mesh with vertices coming out of transform feedback
@@ -1550,7 +1721,14 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          * with @ref Shader::submitCompile() or @ref Shader::compile() before
          * linking. Call @ref isLinkFinished() or @ref checkLink() after, see
          * @ref GL-AbstractShaderProgram-async for more information.
-         * @see @fn_gl_keyword{LinkProgram}
+         *
+         * If a program binary cache is enabled with
+         * @ref setBinaryCacheDirectory() and the program is found in it, it's
+         * loaded from there instead, otherwise attached shaders for which
+         * @ref Shader::submitCompile() deferred the compilation are compiled
+         * first. See @ref GL-AbstractShaderProgram-binary-cache for
+         * more information.
+         * @see @fn_gl_keyword{LinkProgram}, @fn_gl_keyword{ProgramBinary}
          */
         void submitLink();
 
@@ -1982,6 +2160,17 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
 
         GLuint _id;
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Updated by bindAttributeLocation(), bindFragmentDataLocation*()
+           and setTransformFeedbackOutputs(), included in the binary cache
+           key */
+        UnsignedLong _linkStateHash;
+        /* Set by submitLink() if the binary cache is enabled. The key is
+           non-zero if the binary should be saved in checkLink(). */
+        UnsignedLong _binaryCacheKey;
+        bool _linkedFromBinary;
+        #endif
+
         #if defined(CORRADE_TARGET_WINDOWS) && !defined(MAGNUM_TARGET_GLES2)
         /* Needed for the nv-windows-dangling-transform-feedback-varying-names
            workaround */
@@ -41,6 +41,7 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/PixelFormat.h"
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -124,6 +125,7 @@ void AbstractTexture::unbind(const Int textureUnit) {
     if(textureState.bindings[textureUnit].second() == 0) return;
 
     /* Unbind the texture, reset state tracker */
+    Context::current().state().context.count(&Context::Statistics::textureBinds);
     Context::current().state().texture.unbindImplementation(textureUnit);
     textureState.bindings[textureUnit] = {};
 }
@@ -193,7 +195,10 @@ void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, cons
     }
 
     /* Avoid doing the binding if there is nothing different */
-    if(different) glBindTextures(firstTextureUnit, textures.size(), ids);
+    if(different) {
+        Context::current().state().context.count(&Context::Statistics::textureBinds);
+        glBindTextures(firstTextureUnit, textures.size(), ids);
+    }
 }
 #endif
 
@@ -346,9 +351,29 @@ void AbstractTexture::bind(Int textureUnit) {
 
     /* Update state tracker, bind the texture to the unit */
     textureState.bindings[textureUnit] = {_target, _id};
+    Context::current().state().context.count(&Context::Statistics::textureBinds);
     textureState.bindImplementation(*this, textureUnit);
 }
 
+#ifndef MAGNUM_TARGET_GLES
+UnsignedLong AbstractTexture::handle() {
+    createIfNotAlready();
+    return glGetTextureHandleARB(_id);
+}
+
+void AbstractTexture::makeHandleResident() {
+    glMakeTextureHandleResidentARB(handle());
+}
+
+void AbstractTexture::makeHandleNonResident() {
+    glMakeTextureHandleNonResidentARB(handle());
+}
+
+bool AbstractTexture::isHandleResident() {
+    return glIsTextureHandleResidentARB(handle());
+}
+#endif
+
 void AbstractTexture::bindImplementationDefault(AbstractTexture& self, GLint textureUnit) {
     Implementation::TextureState& textureState = Context::current().state().texture;
 
@@ -563,6 +588,7 @@ void AbstractTexture::bindInternal() {
        glBindTexture() in order to create it and have ObjectFlag::Created set
        (which is then asserted in createIfNotAlready()) */
     textureState.bindings[internalTextureUnit] = {_target, _id};
+    Context::current().state().context.count(&Context::Statistics::textureBinds);
     textureState.bindInternalImplementation(*this, internalTextureUnit);
 }
 
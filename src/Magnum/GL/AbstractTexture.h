@@ -75,6 +75,22 @@ subclasses, see @ref Texture, @ref TextureArray, @ref CubeMapTexture,
 submitted to @ref Texture::setSubImage() "*Texture::setSubImage()", see its
 documentation for details.
 
+@section GL-AbstractTexture-bindless Bindless textures
+
+On desktop OpenGL with @gl_extension{ARB,bindless_texture} it's possible to
+query a 64-bit @ref handle() for a texture and pass it to a shader through a
+uniform or a uniform buffer instead of binding the texture to a texture unit.
+This allows drawing meshes with different textures in a single multi-draw
+call. The handle has to be made resident with @ref makeHandleResident() before
+it's used by a shader. Getting the handle makes both the texture storage and
+its sampling state immutable, so the texture should be fully set up before:
+
+@snippet GL.cpp AbstractTexture-bindless
+
+The handle is made non-resident and deleted implicitly when the texture is
+destroyed. See also @ref Shaders::FlatGL::Flag::BindlessTextures and
+@ref Shaders::PhongGL::Flag::BindlessTextures for builtin shader support.
+
 @section GL-AbstractTexture-performance-optimization Performance optimizations and security
 
 The engine tracks currently bound textures and images in all available texture
@@ -408,6 +424,68 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
          */
         void bind(Int textureUnit);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bindless texture handle
+         * @m_since_latest
+         *
+         * The returned handle references the texture together with its
+         * sampling state at the time of the first call. After that, calling
+         * any function that modifies the texture storage or sampling state is
+         * an error. The handle is the same for every call. Before it can be
+         * used by a shader it has to be made resident with
+         * @ref makeHandleResident(). If the texture is not created yet, it's
+         * created first. See @ref GL-AbstractTexture-bindless for more
+         * information.
+         * @see @fn_gl_extension_keyword{GetTextureHandle,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        UnsignedLong handle();
+
+        /**
+         * @brief Make the bindless texture handle resident
+         * @m_since_latest
+         *
+         * Makes the @ref handle() accessible from shaders. Making an already
+         * resident handle resident again is an error.
+         * @see @ref makeHandleNonResident(), @ref isHandleResident(),
+         *      @fn_gl_extension_keyword{MakeTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        void makeHandleResident();
+
+        /**
+         * @brief Make the bindless texture handle non-resident
+         * @m_since_latest
+         *
+         * Makes the @ref handle() no longer accessible from shaders. Making a
+         * handle that isn't resident non-resident is an error. It's not
+         * needed to call this function before the texture is destroyed.
+         * @see @ref makeHandleResident(), @ref isHandleResident(),
+         *      @fn_gl_extension_keyword{MakeTextureHandleNonResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        void makeHandleNonResident();
+
+        /**
+         * @brief Whether the bindless texture handle is resident
+         * @m_since_latest
+         *
+         * @see @ref makeHandleResident(), @ref makeHandleNonResident(),
+         *      @fn_gl_extension_keyword{IsTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        bool isHandleResident();
+        #endif
+
     #if !defined(MAGNUM_BUILD_DEPRECATED) || defined(DOXYGEN_GENERATING_OUTPUT)
     protected: /* Destructor was public before */
     #endif
@@ -39,6 +39,7 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Implementation/State.h"
 #include "Magnum/GL/Implementation/BufferState.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -154,6 +155,7 @@ void Buffer::unbind(const Target target, const UnsignedInt index) {
            no expensive translation is necessary */
         TargetHint(UnsignedInt(target)))] = 0;
 
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBufferBase(GLenum(target), index, 0);
 }
 
@@ -273,6 +275,7 @@ void Buffer::bindInternal(const TargetHint target, Buffer* const buffer) {
     /* Bind the buffer otherwise, which will also finally create it */
     bound = id;
     if(buffer) buffer->_flags |= ObjectFlag::Created;
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBuffer(GLenum(target), id);
 }
 
@@ -305,6 +308,7 @@ auto Buffer::bindSomewhereInternal(const TargetHint hint) -> TargetHint {
     /* Bind the buffer to hint target otherwise */
     hintBinding = _id;
     _flags |= ObjectFlag::Created;
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBuffer(GLenum(hint), _id);
     return hint;
 }
@@ -336,6 +340,7 @@ Buffer& Buffer::bind(const Target target, const UnsignedInt index, const GLintpt
        flag set. */
     _flags |= ObjectFlag::Created;
 
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBufferRange(GLenum(target), index, _id, offset, size);
     return *this;
 }
@@ -349,6 +354,7 @@ Buffer& Buffer::bind(const Target target, const UnsignedInt index) {
     /* Ditto */
     _flags |= ObjectFlag::Created;
 
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBufferBase(GLenum(target), index, _id);
     return *this;
 }
@@ -451,6 +457,7 @@ void Buffer::bindImplementationMulti(const Target target, const GLuint firstInde
        binding points:
         https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBindBuffersBase.xhtml
        See the comment in that function for details. */
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBuffersBase(GLenum(target), firstIndex, buffers.size(), ids);
 }
 #endif
@@ -482,6 +489,7 @@ void Buffer::bindImplementationMulti(const Target target, const GLuint firstInde
         }
     }
 
+    Context::current().state().context.count(&Context::Statistics::bufferBinds);
     glBindBuffersRange(GLenum(target), firstIndex, buffers.size(), ids, offsetsSizes, offsetsSizes + buffers.size());
 }
 #endif
@@ -1283,6 +1283,24 @@ void Context::resetState(const States states) {
     #endif
 }
 
+bool Context::isStatisticsEnabled() const {
+    return _state->context.statisticsEnabled;
+}
+
+Context& Context::setStatisticsEnabled(const bool enabled) {
+    _state->context.statisticsEnabled = enabled;
+    return *this;
+}
+
+Context::Statistics Context::statistics() const {
+    return _state->context.statistics;
+}
+
+Context& Context::resetStatistics() {
+    _state->context.statistics = {};
+    return *this;
+}
+
 Context::Configuration::Configuration() = default;
 
 Context::Configuration::Configuration(const Configuration& other): _flags{other._flags} {
@@ -223,6 +223,20 @@ the underlying GL context current:
 
 @snippet GL-application.cpp Context-makeCurrent
 
+@section GL-Context-statistics State change statistics
+
+To help finding redundant state changes in a renderer, the context can
+optionally count binds, shader program switches, uniform uploads and draw
+calls that got past the internal state tracker. The collection is disabled by
+default as it adds a small overhead to every such call, enable it with
+@ref setStatisticsEnabled() and then read the counters via @ref statistics(),
+for example once a frame:
+
+@snippet GL.cpp Context-statistics
+
+The same counters are available as measurements in
+@ref DebugTools::FrameProfilerGL, which enables the collection on its own.
+
 @section GL-Context-multithreading Thread safety
 
 If Corrade is compiled with @ref CORRADE_BUILD_MULTITHREADED (the default), the
@@ -234,6 +248,7 @@ Magnum context, build Corrade with the option disabled.
 class MAGNUM_GL_EXPORT Context {
     public:
         class Configuration;
+        struct Statistics;
 
         #ifndef MAGNUM_TARGET_WEBGL
         /**
@@ -866,6 +881,48 @@ class MAGNUM_GL_EXPORT Context {
          */
         DetectedDrivers detectedDriver();
 
+        /**
+         * @brief Whether state change statistics are collected
+         * @m_since_latest
+         *
+         * Disabled by default.
+         * @see @ref setStatisticsEnabled(), @ref statistics(),
+         *      @ref GL-Context-statistics
+         */
+        bool isStatisticsEnabled() const;
+
+        /**
+         * @brief Enable or disable collection of state change statistics
+         * @m_since_latest
+         *
+         * When enabled, the engine counts the OpenGL calls that weren't
+         * filtered out by the internal state tracker, retrievable through
+         * @ref statistics(). Disabling doesn't reset the counters, use
+         * @ref resetStatistics() for that.
+         * @see @ref isStatisticsEnabled(), @ref GL-Context-statistics
+         */
+        Context& setStatisticsEnabled(bool enabled);
+
+        /**
+         * @brief State change statistics
+         * @m_since_latest
+         *
+         * Returns counts accumulated since the context creation or since the
+         * last @ref resetStatistics() call. If statistics collection was never
+         * enabled, all counters are zero.
+         * @see @ref setStatisticsEnabled(), @ref GL-Context-statistics
+         */
+        Statistics statistics() const;
+
+        /**
+         * @brief Reset state change statistics
+         * @m_since_latest
+         *
+         * Sets all counters returned by @ref statistics() to zero. Doesn't
+         * affect whether the statistics are collected.
+         */
+        Context& resetStatistics();
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
@@ -956,6 +1013,64 @@ MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Context::DetectedDriver value);
 /** @debugoperatorclassenum{Context,Context::DetectedDrivers} */
 MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Context::DetectedDrivers value);
 
+/**
+@brief State change statistics
+@m_since_latest
+
+Counts of OpenGL calls that were actually made after the internal state tracker
+filtered out redundant ones. See @ref GL-Context-statistics for more
+information.
+@see @ref Context::statistics()
+*/
+struct Context::Statistics {
+    /**
+     * @brief Draw calls
+     *
+     * Each @ref AbstractShaderProgram::draw(),
+     * @relativeref{AbstractShaderProgram,drawTransformFeedback()} and
+     * @relativeref{AbstractShaderProgram,drawIndirect()} call that didn't exit
+     * early due to there being nothing to draw is counted once, including
+     * multi-draw calls.
+     */
+    UnsignedLong drawCalls;
+
+    /** @brief Shader program switches done with @fn_gl{UseProgram} */
+    UnsignedLong programSwitches;
+
+    /**
+     * @brief Vertex array object binds
+     *
+     * Done with @fn_gl{BindVertexArray}. Stays at zero if VAOs aren't used.
+     */
+    UnsignedLong vaoBinds;
+
+    /**
+     * @brief Buffer binds
+     *
+     * Both regular and indexed binds, a multi-bind is counted once.
+     */
+    UnsignedLong bufferBinds;
+
+    /**
+     * @brief Texture binds
+     *
+     * Including binds done internally for texture upload and queries on
+     * platforms without DSA, a multi-bind is counted once.
+     */
+    UnsignedLong textureBinds;
+
+    /** @brief Framebuffer binds done with @fn_gl{BindFramebuffer} */
+    UnsignedLong framebufferBinds;
+
+    /**
+     * @brief Uniform uploads
+     *
+     * Each @ref AbstractShaderProgram::setUniform() call is counted once,
+     * independently of the array size.
+     */
+    UnsignedLong uniformUploads;
+};
+
 /**
 @brief Configuration
 @m_since_latest
@@ -107,6 +107,10 @@ enum class ImageAccess: GLenum;
 
 enum class MeshPrimitive: GLenum;
 enum class MeshIndexType: GLenum;
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+struct DrawArraysIndirectCommand;
+struct DrawElementsIndirectCommand;
+#endif
 
 class Mesh;
 class MeshView;
@@ -155,6 +159,8 @@ enum class SamplerDepthStencilMode: GLenum;
 
 class Sampler;
 class Shader;
+template<class> class ShaderCompileQueue;
+class StreamingBuffer;
 
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
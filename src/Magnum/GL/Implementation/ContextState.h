@@ -27,7 +27,7 @@
 */
 
 #include "Magnum/Magnum.h"
-#include "Magnum/GL/GL.h"
+#include "Magnum/GL/Context.h"
 
 namespace Magnum { namespace GL { namespace Implementation {
 
@@ -43,6 +43,15 @@ struct ContextState {
 
     bool(*isCoreProfileImplementation)(Context&);
     #endif
+
+    /* Increments given Context::statistics() counter if the collection is
+       enabled. Called from places where a GL call passed the state tracker. */
+    void count(UnsignedLong Context::Statistics::*counter) {
+        if(statisticsEnabled) ++(statistics.*counter);
+    }
+
+    Context::Statistics statistics{};
+    bool statisticsEnabled{};
 };
 
 }}}
@@ -433,6 +433,41 @@ MeshState::MeshState(Context& context, ContextState& contextState, Containers::S
     }
     #endif
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Indirect multi-draw. If not available, the commands are submitted one
+       by one with glDraw*Indirect(), which is still better than reading the
+       buffer back. There's no multi-draw indirect in ES 3.2. */
+    #ifndef MAGNUM_TARGET_GLES
+    if(context.isExtensionSupported<Extensions::ARB::multi_draw_indirect>()) {
+        extensions[Extensions::ARB::multi_draw_indirect::Index] =
+                   Extensions::ARB::multi_draw_indirect::string();
+
+        multiDrawArraysIndirectImplementation = glMultiDrawArraysIndirect;
+        multiDrawElementsIndirectImplementation = glMultiDrawElementsIndirect;
+    } else
+    #endif
+    {
+        multiDrawArraysIndirectImplementation = Mesh::multiDrawArraysIndirectImplementationFallback;
+        multiDrawElementsIndirectImplementation = Mesh::multiDrawElementsIndirectImplementationFallback;
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Indirect multi-draw with the count taken from a buffer. Drivers that
+       have just the extension and not GL 4.6 expose only the ARB-suffixed
+       entry points. */
+    if(context.isVersionSupported(Version::GL460)) {
+        multiDrawArraysIndirectCountImplementation = glMultiDrawArraysIndirectCount;
+        multiDrawElementsIndirectCountImplementation = glMultiDrawElementsIndirectCount;
+    } else {
+        /* Not adding the extension to the extension list as this is not any
+           optional feature -- it can be only used when the extension is
+           present, and if it's not, the pointers are null */
+        multiDrawArraysIndirectCountImplementation = glMultiDrawArraysIndirectCountARB;
+        multiDrawElementsIndirectCountImplementation = glMultiDrawElementsIndirectCountARB;
+    }
+    #endif
+
     #ifdef MAGNUM_TARGET_GLES2
     /* Instanced draw ímplementation on ES2 */
     if(context.isExtensionSupported<Extensions::ANGLE::instanced_arrays>()) {
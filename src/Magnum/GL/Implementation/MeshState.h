@@ -92,6 +92,15 @@ struct MeshState {
     #endif
     #endif
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void(APIENTRY *multiDrawArraysIndirectImplementation)(GLenum, const void*, GLsizei, GLsizei);
+    void(APIENTRY *multiDrawElementsIndirectImplementation)(GLenum, GLenum, const void*, GLsizei, GLsizei);
+    #ifndef MAGNUM_TARGET_GLES
+    void(APIENTRY *multiDrawArraysIndirectCountImplementation)(GLenum, const void*, GLintptr, GLsizei, GLsizei);
+    void(APIENTRY *multiDrawElementsIndirectCountImplementation)(GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei);
+    #endif
+    #endif
+
     void(*bindVAOImplementation)(GLuint);
 
     #ifndef MAGNUM_TARGET_GLES
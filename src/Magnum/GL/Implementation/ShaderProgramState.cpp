@@ -28,6 +28,7 @@
 
 #include "ShaderProgramState.h"
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/StringView.h>
 
 #include "Magnum/GL/AbstractShaderProgram.h"
@@ -278,4 +279,19 @@ void ShaderProgramState::reset() {
     current = State::DisengagedBinding;
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+bool ShaderProgramState::removeDeferredCompileShader(const GLuint id) {
+    /* The order doesn't matter, so swap the found item with the last one and
+       drop it */
+    for(GLuint& i: deferredCompileShaders) {
+        if(i != id) continue;
+        i = deferredCompileShaders.back();
+        arrayRemoveSuffix(deferredCompileShaders, 1);
+        return true;
+    }
+
+    return false;
+}
+#endif
+
 }}}
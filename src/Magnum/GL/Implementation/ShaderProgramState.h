@@ -28,6 +28,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/String.h>
+
 #include "Magnum/Magnum.h"
 #include "Magnum/GL/GL.h"
 #include "Magnum/GL/OpenGL.h"
@@ -44,6 +47,12 @@ struct ShaderProgramState {
 
     void reset();
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Removes the shader from deferredCompileShaders, returns false if it
+       wasn't there */
+    bool removeDeferredCompileShader(GLuint id);
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES2
     void(*transformFeedbackVaryingsImplementation)(AbstractShaderProgram&, const Containers::StringIterable&, AbstractShaderProgram::TransformFeedbackBufferMode);
     #endif
@@ -117,6 +126,16 @@ struct ShaderProgramState {
     /* Currently used program */
     GLuint current;
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Program binary cache location, empty if disabled */
+    Containers::String binaryCacheDirectory;
+    /* IDs of shaders for which Shader::submitCompile() deferred the
+       compilation and which weren't compiled yet. Tracked here because
+       querying GL_COMPILE_STATUS to find that out would stall on shaders
+       that are being compiled in parallel. */
+    Containers::Array<GLuint> deferredCompileShaders;
+    #endif
+
     GLint maxVertexAttributes;
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_WEBGL
@@ -42,6 +42,7 @@
 #include "Magnum/GL/TransformFeedback.h"
 #endif
 #include "Magnum/GL/Implementation/BufferState.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -1041,6 +1042,63 @@ void Mesh::drawInternal(TransformFeedback& xfb, const UnsignedInt stream, const
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void Mesh::drawInternalIndirect(Buffer& commands, const GLintptr offset, const UnsignedInt count, const UnsignedInt stride) {
+    /* The commands specify the first index relative to the start of the
+       index buffer, so there's no way to apply the byte offset */
+    CORRADE_ASSERT(!_indexBufferOffset,
+        "GL::AbstractShaderProgram::drawIndirect(): can't draw a mesh with a non-zero index buffer offset, got" << _indexBufferOffset, );
+
+    const Implementation::MeshState& state = Context::current().state().mesh;
+
+    state.bindImplementation(*this);
+    commands.bindInternal(Buffer::TargetHint::DrawIndirect);
+
+    const void* const indirect = reinterpret_cast<const void*>(offset);
+
+    /* Non-indexed mesh */
+    if(!_indexBuffer.id()) {
+        if(count == 1) glDrawArraysIndirect(GLenum(_primitive), indirect);
+        else state.multiDrawArraysIndirectImplementation(GLenum(_primitive), indirect, count, stride);
+
+    /* Indexed mesh */
+    } else {
+        if(count == 1) glDrawElementsIndirect(GLenum(_primitive), GLenum(_indexType), indirect);
+        else state.multiDrawElementsIndirectImplementation(GLenum(_primitive), GLenum(_indexType), indirect, count, stride);
+    }
+
+    state.unbindImplementation(*this);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void Mesh::drawInternalIndirect(Buffer& commands, const GLintptr offset, Buffer& countBuffer, const GLintptr countOffset, const UnsignedInt maxCount, const UnsignedInt stride) {
+    CORRADE_ASSERT(!_indexBufferOffset,
+        "GL::AbstractShaderProgram::drawIndirect(): can't draw a mesh with a non-zero index buffer offset, got" << _indexBufferOffset, );
+
+    const Implementation::MeshState& state = Context::current().state().mesh;
+
+    state.bindImplementation(*this);
+    commands.bindInternal(Buffer::TargetHint::DrawIndirect);
+    /* The parameter buffer binding isn't tracked as nothing else uses it,
+       so bind it directly. GL_PARAMETER_BUFFER has the same value as the
+       ARB-suffixed enum. */
+    glBindBuffer(GL_PARAMETER_BUFFER, countBuffer.id());
+
+    const void* const indirect = reinterpret_cast<const void*>(offset);
+
+    /* Non-indexed mesh */
+    if(!_indexBuffer.id())
+        state.multiDrawArraysIndirectCountImplementation(GLenum(_primitive), indirect, countOffset, maxCount, stride);
+
+    /* Indexed mesh */
+    else
+        state.multiDrawElementsIndirectCountImplementation(GLenum(_primitive), GLenum(_indexType), indirect, countOffset, maxCount, stride);
+
+    state.unbindImplementation(*this);
+}
+#endif
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 Mesh& Mesh::draw(AbstractShaderProgram& shader) {
     shader.draw(*this);
@@ -1068,6 +1126,7 @@ Mesh& Mesh::draw(AbstractShaderProgram&& shader, TransformFeedback& xfb, Unsigne
 void Mesh::bindVAOImplementationDefault(GLuint) {}
 
 void Mesh::bindVAOImplementationVAO(const GLuint id) {
+    Context::current().state().context.count(&Context::Statistics::vaoBinds);
     #ifndef MAGNUM_TARGET_GLES2
     glBindVertexArray
     #else
@@ -1402,6 +1461,22 @@ void Mesh::drawElementsInstancedBaseVertexImplementationAssert(GLenum, GLsizei,
 #endif
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void APIENTRY Mesh::multiDrawArraysIndirectImplementationFallback(const GLenum mode, const void* const indirect, const GLsizei drawCount, const GLsizei stride) {
+    /* Zero stride means the commands are tightly packed */
+    const std::size_t actualStride = stride ? stride : sizeof(DrawArraysIndirectCommand);
+    for(GLsizei i = 0; i != drawCount; ++i)
+        glDrawArraysIndirect(mode, static_cast<const char*>(indirect) + i*actualStride);
+}
+
+void APIENTRY Mesh::multiDrawElementsIndirectImplementationFallback(const GLenum mode, const GLenum type, const void* const indirect, const GLsizei drawCount, const GLsizei stride) {
+    /* Zero stride means the commands are tightly packed */
+    const std::size_t actualStride = stride ? stride : sizeof(DrawElementsIndirectCommand);
+    for(GLsizei i = 0; i != drawCount; ++i)
+        glDrawElementsIndirect(mode, type, static_cast<const char*>(indirect) + i*actualStride);
+}
+#endif
+
 #ifdef MAGNUM_TARGET_GLES
 #if !defined(MAGNUM_TARGET_GLES2) && (!defined(MAGNUM_TARGET_WEBGL) || __EMSCRIPTEN_major__*10000 + __EMSCRIPTEN_minor__*100 + __EMSCRIPTEN_tiny__ >= 20005)
 void Mesh::multiDrawElementsBaseVertexImplementationANGLE(const GLenum mode, const GLsizei* const count, const GLenum type, const void* const* const indices, const GLsizei drawCount, const GLint* const baseVertex) {
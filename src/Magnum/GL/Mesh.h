@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::GL::Mesh, enum @ref Magnum::GL::MeshPrimitive, @ref Magnum::GL::MeshIndexType, function @ref Magnum::GL::meshPrimitive(), @ref Magnum::GL::meshIndexType(), @ref Magnum::GL::meshIndexTypeSize()
+ * @brief Class @ref Magnum::GL::Mesh, struct @ref Magnum::GL::DrawArraysIndirectCommand, @ref Magnum::GL::DrawElementsIndirectCommand, enum @ref Magnum::GL::MeshPrimitive, @ref Magnum::GL::MeshIndexType, function @ref Magnum::GL::meshPrimitive(), @ref Magnum::GL::meshIndexType(), @ref Magnum::GL::meshIndexTypeSize()
  */
 
 #include <Corrade/Containers/Array.h>
@@ -231,6 +231,75 @@ MAGNUM_GL_EXPORT MeshIndexType meshIndexType(Magnum::MeshIndexType type);
 */
 MAGNUM_GL_EXPORT UnsignedInt meshIndexTypeSize(MeshIndexType type);
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/**
+@brief Indirect draw command for a non-indexed mesh
+@m_since_latest
+
+Layout of a single command in a buffer passed to
+@ref AbstractShaderProgram::drawIndirect() for a mesh without an index buffer.
+Matches the `DrawArraysIndirectCommand` structure from the GL specification.
+@see @ref DrawElementsIndirectCommand
+@requires_gl40 Extension @gl_extension{ARB,draw_indirect}
+@requires_gl42 Extension @gl_extension{ARB,base_instance} if
+    @ref baseInstance is not @cpp 0 @ce
+@requires_gles31 Indirect drawing is not available in OpenGL ES 3.0 and older.
+@requires_gles Indirect drawing is not available in WebGL.
+*/
+struct DrawArraysIndirectCommand {
+    /** @brief Vertex count */
+    UnsignedInt count;
+
+    /** @brief Instance count */
+    UnsignedInt instanceCount;
+
+    /** @brief Offset of the first vertex */
+    UnsignedInt first;
+
+    /**
+     * @brief Offset of the first instance
+     *
+     * Reserved and has to be @cpp 0 @ce on OpenGL ES.
+     */
+    UnsignedInt baseInstance;
+};
+
+/**
+@brief Indirect draw command for an indexed mesh
+@m_since_latest
+
+Layout of a single command in a buffer passed to
+@ref AbstractShaderProgram::drawIndirect() for a mesh with an index buffer.
+Matches the `DrawElementsIndirectCommand` structure from the GL specification.
+@see @ref DrawArraysIndirectCommand
+@requires_gl40 Extension @gl_extension{ARB,draw_indirect}
+@requires_gl42 Extension @gl_extension{ARB,base_instance} if
+    @ref baseInstance is not @cpp 0 @ce
+@requires_gles31 Indirect drawing is not available in OpenGL ES 3.0 and older.
+@requires_gles Indirect drawing is not available in WebGL.
+*/
+struct DrawElementsIndirectCommand {
+    /** @brief Index count */
+    UnsignedInt count;
+
+    /** @brief Instance count */
+    UnsignedInt instanceCount;
+
+    /** @brief Offset of the first index, in indices */
+    UnsignedInt firstIndex;
+
+    /** @brief Value added to each index */
+    Int baseVertex;
+
+    /**
+     * @brief Offset of the first instance
+     *
+     * Reserved and has to be @cpp 0 @ce on OpenGL ES.
+     */
+    UnsignedInt baseInstance;
+};
+#endif
+
 namespace Implementation {
 
 struct MeshState;
@@ -404,6 +473,18 @@ calling @ref AbstractShaderProgram::draw():
 
 @snippet GL.cpp Mesh-draw
 
+@subsection GL-Mesh-rendering-indirect Indirect rendering
+
+On OpenGL 4.0 and OpenGL ES 3.1 the draw parameters can come from a buffer
+instead, which allows them to be generated on the GPU, for example by a
+culling compute shader. Fill the buffer with @ref DrawArraysIndirectCommand or
+@ref DrawElementsIndirectCommand instances, depending on whether the mesh is
+indexed, and pass it to @ref AbstractShaderProgram::drawIndirect(). Everything
+set by @ref setCount(), @ref setBaseVertex(), @ref setInstanceCount(),
+@ref setBaseInstance() and @ref setIndexOffset() is ignored in that case:
+
+@snippet GL.cpp Mesh-draw-indirect
+
 @section GL-Mesh-webgl-restrictions WebGL restrictions
 
 @ref MAGNUM_TARGET_WEBGL "WebGL" puts some restrictions on vertex buffer
@@ -1318,6 +1399,13 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         MAGNUM_GL_LOCAL void drawInternal(TransformFeedback& xfb, UnsignedInt stream, Int instanceCount);
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        MAGNUM_GL_LOCAL void drawInternalIndirect(Buffer& commands, GLintptr offset, UnsignedInt count, UnsignedInt stride);
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_GL_LOCAL void drawInternalIndirect(Buffer& commands, GLintptr offset, Buffer& countBuffer, GLintptr countOffset, UnsignedInt maxCount, UnsignedInt stride);
+        #endif
+        #endif
+
         static void MAGNUM_GL_LOCAL createImplementationDefault(Mesh& self);
         static void MAGNUM_GL_LOCAL createImplementationVAO(Mesh& self);
         #ifndef MAGNUM_TARGET_GLES
@@ -1400,6 +1488,11 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         #endif
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        MAGNUM_GL_LOCAL static void APIENTRY multiDrawArraysIndirectImplementationFallback(GLenum mode, const void* indirect, GLsizei drawCount, GLsizei stride);
+        MAGNUM_GL_LOCAL static void APIENTRY multiDrawElementsIndirectImplementationFallback(GLenum mode, GLenum type, const void* indirect, GLsizei drawCount, GLsizei stride);
+        #endif
+
         #ifdef MAGNUM_TARGET_GLES
         #if !defined(MAGNUM_TARGET_GLES2) && (!defined(MAGNUM_TARGET_WEBGL) || __EMSCRIPTEN_major__*10000 + __EMSCRIPTEN_minor__*100 + __EMSCRIPTEN_tiny__ >= 20005)
         static MAGNUM_GL_LOCAL void multiDrawElementsBaseVertexImplementationANGLE(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawCount, const GLint* baseVertex);
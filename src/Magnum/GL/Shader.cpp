@@ -46,6 +46,9 @@
 #endif
 #include "Magnum/GL/Implementation/State.h"
 #include "Magnum/GL/Implementation/ShaderState.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/Implementation/ShaderProgramState.h"
+#endif
 #include "Magnum/Math/Functions.h"
 
 /* libgles-omap3-dev_4.03.00.02-r15.6 on BeagleBoard/Ångström linux 2011.3 doesn't have GLchar */
@@ -753,6 +756,9 @@ Shader::Shader(const Type type, const GLuint id, ObjectFlags flags) noexcept: _t
     _offsetLineByOneOnOldGlsl{},
     #endif
     _fileIndexOffset{}
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _compileDeferred{}
+    #endif
     {}
 
 Shader::Shader(NoCreateT) noexcept: _type{}, _id{0} {}
@@ -762,6 +768,9 @@ Shader::Shader(Shader&& other) noexcept: _type{other._type}, _id{other._id}, _fl
     _offsetLineByOneOnOldGlsl{other._flags},
     #endif
     _fileIndexOffset{other._fileIndexOffset},
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    _compileDeferred{other._compileDeferred},
+    #endif
     _sources{Utility::move(other._sources)}
 {
     other._id = 0;
@@ -771,6 +780,13 @@ Shader::~Shader() {
     /* Moved out or not deleting on destruction, nothing to do */
     if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
 
+    /* The ID may get reused by a new shader, so it shouldn't stay in the list
+       of shaders pending compilation */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_compileDeferred)
+        Context::current().state().shaderProgram.removeDeferredCompileShader(_id);
+    #endif
+
     glDeleteShader(_id);
 }
 
@@ -783,6 +799,9 @@ Shader& Shader::operator=(Shader&& other) noexcept {
     swap(_offsetLineByOneOnOldGlsl, other._offsetLineByOneOnOldGlsl);
     #endif
     swap(_fileIndexOffset, other._fileIndexOffset);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_compileDeferred, other._compileDeferred);
+    #endif
     swap(_sources, other._sources);
     return *this;
 }
@@ -893,10 +912,35 @@ void Shader::submitCompile() {
     }
 
     glShaderSource(_id, _sources.size(), pointers, sizes);
+
+    /* With a program binary cache enabled, the compilation is done only in
+       AbstractShaderProgram::submitLink() if the program isn't found in the
+       cache. If the shader is submitted again before that happens, it's
+       removed first to not be in the list twice. */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    Implementation::ShaderProgramState& state = Context::current().state().shaderProgram;
+    if(!state.binaryCacheDirectory.isEmpty()) {
+        if(_compileDeferred) state.removeDeferredCompileShader(_id);
+        arrayAppend(state.deferredCompileShaders, _id);
+        _compileDeferred = true;
+        return;
+    }
+    #endif
+
     glCompileShader(_id);
 }
 
 bool Shader::checkCompile() {
+    /* If the compilation was deferred and the shader wasn't compiled by
+       AbstractShaderProgram::submitLink() yet, do it now */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_compileDeferred) {
+        _compileDeferred = false;
+        if(Context::current().state().shaderProgram.removeDeferredCompileShader(_id))
+            glCompileShader(_id);
+    }
+    #endif
+
     GLint success, logLength;
     glGetShaderiv(_id, GL_COMPILE_STATUS, &success);
     glGetShaderiv(_id, GL_INFO_LOG_LENGTH, &logLength);
@@ -948,6 +992,15 @@ bool Shader::compile(std::initializer_list<Containers::Reference<Shader>> shader
 #endif
 
 bool Shader::isCompileFinished() {
+    /* A deferred compilation that wasn't submitted by
+       AbstractShaderProgram::submitLink() yet isn't running, so there's
+       nothing to wait for */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_compileDeferred)
+        for(const GLuint id: Context::current().state().shaderProgram.deferredCompileShaders)
+            if(id == _id) return true;
+    #endif
+
     GLint success;
     Context::current().state().shader.completionStatusImplementation(_id, GL_COMPLETION_STATUS_KHR, &success);
     return success == GL_TRUE;
@@ -755,6 +755,14 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
          * @relativeref{AbstractShaderProgram,checkLink()} will print the
          * compilation error if linking failed due to that. See
          * @ref GL-AbstractShaderProgram-async for more information.
+         *
+         * If a program binary cache is enabled with
+         * @ref AbstractShaderProgram::setBinaryCacheDirectory(), only the
+         * sources are uploaded and the compilation is deferred to
+         * @relativeref{AbstractShaderProgram,submitLink()} or
+         * @ref checkCompile(), whichever comes first. In that case
+         * @ref isCompileFinished() returns @cpp true @ce until then. See
+         * @ref GL-AbstractShaderProgram-binary-cache for more information.
          * @see @fn_gl_keyword{ShaderSource}, @fn_gl_keyword{CompileShader}
          */
         void submitCompile();
@@ -834,6 +842,13 @@ class MAGNUM_GL_EXPORT Shader: public AbstractObject {
         bool _offsetLineByOneOnOldGlsl;
         #endif
         UnsignedByte _fileIndexOffset;
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Set by submitCompile() if the program binary cache is enabled and
+           actual compilation is left to AbstractShaderProgram::submitLink().
+           Until the shader gets compiled, its ID is also listed in
+           ShaderProgramState::deferredCompileShaders. */
+        bool _compileDeferred;
+        #endif
 
         Containers::Array<Containers::String> _sources;
 };
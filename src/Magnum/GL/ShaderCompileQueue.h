@@ -0,0 +1,201 @@
+#ifndef Magnum_GL_ShaderCompileQueue_h
+#define Magnum_GL_ShaderCompileQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::GL::ShaderCompileQueue
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Queue for asynchronous shader compilation
+@m_since_latest
+
+Collects @cpp CompileState @ce instances of a shader class implementing the
+workflow described in @ref GL-AbstractShaderProgram-async and finishes their
+construction once the driver is done with them, without ever stalling on a
+link operation that's still in progress. Useful for applications that need to
+compile many shader variants, such as all @ref Shaders::PhongGL permutations
+needed by a scene, while keeping the main loop running:
+
+@snippet GL.cpp ShaderCompileQueue-usage
+
+Every @ref poll() call goes through all pending entries and for each of
+those whose @ref AbstractShaderProgram::isLinkFinished() returns
+@cpp true @ce constructs the final shader from its @cpp CompileState @ce. Once
+@ref isFinished() returns @cpp true @ce for given entry, the shader is
+available through @ref shader(). Use @ref finish() to wait for all remaining
+entries, for example when a loading screen is done. If
+@gl_extension{KHR,parallel_shader_compile} isn't available, all entries are
+reported as finished and the first @ref poll() call effectively waits for all
+of them.
+
+Combined with @ref AbstractShaderProgram::setBinaryCacheDirectory(), shaders
+that were already compiled in a previous run of the application are loaded
+from a program binary cache instead, skipping the compilation altogether.
+
+The @p T type is expected to have a @cpp T::CompileState @ce type that's
+movable and has an @cpp isLinkFinished() @ce member function, a
+@cpp T(T::CompileState&&) @ce constructor and a @cpp T(NoCreateT) @ce
+constructor, which all builtin @ref Shaders have.
+*/
+template<class T> class ShaderCompileQueue {
+    public:
+        /** @brief Constructor */
+        explicit ShaderCompileQueue() = default;
+
+        /** @brief Copying is not allowed */
+        ShaderCompileQueue(const ShaderCompileQueue<T>&) = delete;
+
+        /** @brief Move constructor */
+        ShaderCompileQueue(ShaderCompileQueue<T>&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        ShaderCompileQueue<T>& operator=(const ShaderCompileQueue<T>&) = delete;
+
+        /** @brief Move assignment */
+        ShaderCompileQueue<T>& operator=(ShaderCompileQueue<T>&&) noexcept = default;
+
+        /** @brief Count of all entries added to the queue */
+        std::size_t size() const { return _entries.size(); }
+
+        /**
+         * @brief Count of entries that didn't finish yet
+         *
+         * @see @ref isFinished()
+         */
+        std::size_t pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Add a shader to the queue
+         * @return ID of the entry, to be used with @ref isFinished() and
+         *      @ref shader()
+         *
+         * The @p state is expected to be a result of a @cpp T::compile() @ce
+         * call. IDs are assigned sequentially, starting from @cpp 0 @ce.
+         */
+        std::size_t add(typename T::CompileState&& state) {
+            Entry& entry = arrayAppend(_entries, InPlaceInit);
+            entry.state.emplace(Utility::move(state));
+            ++_pendingCount;
+            return _entries.size() - 1;
+        }
+
+        /**
+         * @brief Finish entries that are done linking
+         * @return Count of entries finished by this call
+         *
+         * Doesn't block on entries that are still being compiled or linked,
+         * meant to be called for example once every frame until
+         * @ref pendingCount() becomes zero.
+         */
+        std::size_t poll() {
+            std::size_t count = 0;
+            for(Entry& entry: _entries) {
+                if(!entry.state || !entry.state->isLinkFinished()) continue;
+                finishEntry(entry);
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Finish all remaining entries
+         *
+         * Blocks until all entries are compiled and linked. After calling
+         * this function, @ref pendingCount() is @cpp 0 @ce.
+         */
+        void finish() {
+            for(Entry& entry: _entries)
+                if(entry.state) finishEntry(entry);
+        }
+
+        /**
+         * @brief Whether given entry is finished
+         *
+         * Expects that @p id is less than @ref size().
+         */
+        bool isFinished(std::size_t id) const {
+            CORRADE_ASSERT(id < _entries.size(),
+                "GL::ShaderCompileQueue::isFinished(): index" << id << "out of range for" << _entries.size() << "entries", {});
+            return !!_entries[id].shader;
+        }
+
+        /**
+         * @brief Finished shader
+         *
+         * Expects that @p id is less than @ref size() and the entry is
+         * finished. The returned reference is valid only until the next
+         * @ref add() call, which may reallocate the internal storage. Either
+         * query the shader again using its ID afterwards, or move it out of
+         * the queue if it's meant to outlive it.
+         * @see @ref isFinished()
+         */
+        T& shader(std::size_t id) {
+            CORRADE_ASSERT(id < _entries.size(),
+                "GL::ShaderCompileQueue::shader(): index" << id << "out of range for" << _entries.size() << "entries", invalidShader());
+            CORRADE_ASSERT(_entries[id].shader,
+                "GL::ShaderCompileQueue::shader(): entry" << id << "isn't finished yet", invalidShader());
+            return *_entries[id].shader;
+        }
+
+    private:
+        struct Entry {
+            Containers::Optional<typename T::CompileState> state;
+            Containers::Optional<T> shader;
+        };
+
+        /* Returned from shader() on a graceful assert */
+        static T& invalidShader() {
+            static T shader{NoCreate};
+            return shader;
+        }
+
+        void finishEntry(Entry& entry) {
+            entry.shader.emplace(Utility::move(*entry.state));
+            entry.state = Containers::NullOpt;
+            --_pendingCount;
+        }
+
+        Containers::Array<Entry> _entries;
+        std::size_t _pendingCount{};
+};
+
+}}
+
+#endif
@@ -0,0 +1,220 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "StreamingBuffer.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace GL {
+
+StreamingBuffer::StreamingBuffer(const std::size_t size, const Buffer::TargetHint targetHint): _buffer{targetHint}, _size{size}, _persistent{}, _memory{},
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    _firstFence{},
+    #endif
+    _writePosition{}, _flushedPosition{}, _releasedPosition{}
+{
+    CORRADE_ASSERT(size,
+        "GL::StreamingBuffer: expected a non-zero size", );
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>() && Context::current().isExtensionSupported<Extensions::ARB::sync>())
+    #else
+    if(Context::current().isExtensionSupported<Extensions::EXT::buffer_storage>())
+    #endif
+    {
+        _buffer.setStorage(size, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent);
+        _memory = _buffer.map(0, size, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::FlushExplicit).data();
+        _persistent = _memory;
+
+        /* The storage is immutable, so if the mapping failed, a new buffer
+           is needed for the fallback */
+        if(!_persistent) _buffer = Buffer{targetHint};
+    }
+    #endif
+
+    /* Fallback if the extensions aren't available or the mapping failed */
+    if(!_persistent) {
+        _buffer.setData({nullptr, size}, BufferUsage::StreamDraw);
+        _staging = Containers::Array<char>{NoInit, size};
+        _memory = _staging.data();
+    }
+}
+
+StreamingBuffer::StreamingBuffer(NoCreateT) noexcept: _buffer{NoCreate}, _size{}, _persistent{}, _memory{},
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    _firstFence{},
+    #endif
+    _writePosition{}, _flushedPosition{}, _releasedPosition{} {}
+
+StreamingBuffer::StreamingBuffer(StreamingBuffer&&) noexcept = default;
+
+StreamingBuffer::~StreamingBuffer() {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    for(std::size_t i = _firstFence; i < _fences.size(); ++i)
+        glDeleteSync(_fences[i].sync);
+    #endif
+}
+
+StreamingBuffer& StreamingBuffer::operator=(StreamingBuffer&& other) noexcept {
+    using std::swap;
+    swap(_buffer, other._buffer);
+    swap(_size, other._size);
+    swap(_persistent, other._persistent);
+    swap(_memory, other._memory);
+    swap(_staging, other._staging);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_fences, other._fences);
+    swap(_firstFence, other._firstFence);
+    #endif
+    swap(_writePosition, other._writePosition);
+    swap(_flushedPosition, other._flushedPosition);
+    swap(_releasedPosition, other._releasedPosition);
+    return *this;
+}
+
+Containers::Pair<GLintptr, Containers::ArrayView<char>> StreamingBuffer::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)),
+        "GL::StreamingBuffer::allocate(): expected alignment to be a power of two, got" << alignment, {});
+    CORRADE_ASSERT(size <= _size,
+        "GL::StreamingBuffer::allocate(): can't allocate" << size << "bytes in a buffer of" << _size << "bytes", {});
+
+    /* Align the offset. If the allocation doesn't fit before the end of the
+       buffer, wrap around to its start, treating the remaining space as
+       allocated as well. */
+    const std::size_t offset = _writePosition % _size;
+    std::size_t alignedOffset = (offset + alignment - 1) & ~(alignment - 1);
+    UnsignedLong begin = _writePosition + (alignedOffset - offset);
+    if(alignedOffset + size > _size) {
+        begin = _writePosition + (_size - offset);
+        alignedOffset = 0;
+    }
+    const UnsignedLong end = begin + size;
+
+    /* If the allocation overlaps memory that may still be used by the GPU,
+       first check for fences that got signaled in the meantime and only then
+       wait for the oldest ones */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_persistent && end - _releasedPosition > _size) {
+        releaseFences(false);
+        while(end - _releasedPosition > _size && releaseFences(true)) {}
+    }
+    #endif
+
+    CORRADE_ASSERT(end - _releasedPosition <= _size,
+        "GL::StreamingBuffer::allocate(): not enough space for" << size << "bytes, call" << (_persistent ? "flush() and fence()" : "flush()") << "before allocating more", {});
+
+    _writePosition = end;
+    return {GLintptr(alignedOffset), {_memory + alignedOffset, size}};
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+bool StreamingBuffer::releaseFences(const bool wait) {
+    bool released = false;
+    while(_firstFence != _fences.size()) {
+        const Fence& fence = _fences[_firstFence];
+
+        /* If waiting, flush the commands so the fence is guaranteed to get
+           signaled eventually and wait until it is. Wait only for the first
+           fence, the subsequent ones are just polled. glClientWaitSync()
+           doesn't accept an infinite timeout, so it's called in a loop. */
+        GLenum result;
+        if(wait && !released) do {
+            result = glClientWaitSync(fence.sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+        } while(result == GL_TIMEOUT_EXPIRED);
+        else result = glClientWaitSync(fence.sync, 0, 0);
+        if(result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED)
+            break;
+
+        glDeleteSync(fence.sync);
+        _releasedPosition = fence.position;
+        ++_firstFence;
+        released = true;
+    }
+
+    return released;
+}
+#endif
+
+StreamingBuffer& StreamingBuffer::flush() {
+    const UnsignedLong length = _writePosition - _flushedPosition;
+    if(!length) return *this;
+
+    /* The range may wrap around the end of the buffer, in which case it's
+       split in two */
+    const std::size_t offset = _flushedPosition % _size;
+    const std::size_t firstLength = Math::min(std::size_t(length), _size - offset);
+    const std::size_t secondLength = std::size_t(length) - firstLength;
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_persistent) {
+        _buffer.flushMappedRange(offset, firstLength);
+        if(secondLength) _buffer.flushMappedRange(0, secondLength);
+    } else
+    #endif
+    {
+        _buffer.setSubData(offset, _staging.sliceSize(offset, firstLength));
+        if(secondLength) _buffer.setSubData(0, _staging.prefix(secondLength));
+
+        /* The data are copied by the driver, so the memory can be reused
+           right away */
+        _releasedPosition = _writePosition;
+    }
+
+    _flushedPosition = _writePosition;
+    return *this;
+}
+
+StreamingBuffer& StreamingBuffer::fence() {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!_persistent) return *this;
+
+    /* Nothing new allocated since the last fence, nothing to do */
+    if(_firstFence != _fences.size() ? _fences.back().position == _writePosition : _releasedPosition == _writePosition)
+        return *this;
+
+    /* Remove fences that were already signaled before adding a new one */
+    if(_firstFence) {
+        const std::size_t count = _fences.size() - _firstFence;
+        std::memmove(_fences.data(), _fences.data() + _firstFence, count*sizeof(Fence));
+        arrayResize(_fences, count);
+        _firstFence = 0;
+    }
+
+    arrayAppend(_fences, InPlaceInit, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), _writePosition);
+    #endif
+
+    return *this;
+}
+
+}}
@@ -0,0 +1,227 @@
+#ifndef Magnum_GL_StreamingBuffer_h
+#define Magnum_GL_StreamingBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::StreamingBuffer
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/GL/Buffer.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Ring buffer for streaming data uploads
+@m_since_latest
+
+Meant for data that change every frame, such as per-draw uniforms or
+dynamically generated vertices. Instead of re-specifying a whole buffer with
+@ref Buffer::setData() or uploading to it with @ref Buffer::setSubData() every
+frame, which forces the driver to either orphan the buffer or synchronize with
+the GPU, the data are written directly into a ring of client memory carved out
+of a single buffer.
+
+@section GL-StreamingBuffer-usage Usage
+
+Each piece of data is allocated with @ref allocate(), which returns an offset
+into @ref buffer() and a view to write the data to. Once all data for given
+batch of draws are written, call @ref flush() to make them visible to the GL,
+submit the draws referencing @ref buffer() at the returned offsets and then
+call @ref fence() to mark the point after which the memory can be reused:
+
+@snippet GL.cpp StreamingBuffer-usage
+
+When the allocations reach the end of the buffer, they wrap around to its
+beginning. If the memory there is still in use by commands submitted before a
+@ref fence(), @ref allocate() waits until the GPU finishes them. Thus the
+buffer should be large enough to contain data for two or three frames to avoid
+stalls.
+
+@section GL-StreamingBuffer-implementation Implementation
+
+If @gl_extension{ARB,buffer_storage} (part of OpenGL 4.4) together with
+@gl_extension{ARB,sync} (part of OpenGL 3.2) or @gl_extension{EXT,buffer_storage}
+on OpenGL ES 3.1 is available, the buffer is allocated with
+@ref Buffer::setStorage() and persistently mapped with
+@ref Buffer::MapFlag::Persistent and @relativeref{Buffer,MapFlag::FlushExplicit}.
+@ref allocate() then returns views directly to the mapped memory,
+@ref flush() calls @ref Buffer::flushMappedRange() and @ref fence() inserts a
+fence with @fn_gl_keyword{FenceSync}, which is then waited on with
+@fn_gl_keyword{ClientWaitSync} when the memory is about to be reused. Use
+@ref isPersistent() to check whether this path is used.
+
+Otherwise, and on OpenGL ES 2.0 and WebGL, @ref allocate() returns views to a
+client-side copy of the buffer contents, @ref flush() uploads the written
+ranges with @ref Buffer::setSubData() and @ref fence() is a no-op, as the
+upload copies the data and the memory can be reused right away. The fallback
+can be forced on drivers that support persistent mapping by disabling the
+@gl_extension{ARB,buffer_storage} / @gl_extension{EXT,buffer_storage}
+extension, for example with `--magnum-disable-extensions`.
+*/
+class MAGNUM_GL_EXPORT StreamingBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param size          Buffer size in bytes
+         * @param targetHint    Target hint, see @ref Buffer::setTargetHint()
+         *
+         * Creates a new OpenGL buffer of @p size bytes and, if persistent
+         * mapping is supported, maps it. The @p size is expected to be
+         * non-zero.
+         */
+        explicit StreamingBuffer(std::size_t size, Buffer::TargetHint targetHint = Buffer::TargetHint::Array);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit StreamingBuffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        StreamingBuffer(const StreamingBuffer&) = delete;
+
+        /** @brief Move constructor */
+        StreamingBuffer(StreamingBuffer&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all pending fences and the OpenGL buffer, which implicitly
+         * unmaps it.
+         */
+        ~StreamingBuffer();
+
+        /** @brief Copying is not allowed */
+        StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+        /** @brief Move assignment */
+        StreamingBuffer& operator=(StreamingBuffer&&) noexcept;
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+        const Buffer& buffer() const { return _buffer; } /**< @overload */
+
+        /** @brief Buffer size in bytes */
+        std::size_t size() const { return _size; }
+
+        /**
+         * @brief Whether the buffer is persistently mapped
+         *
+         * See @ref GL-StreamingBuffer-implementation for more information.
+         */
+        bool isPersistent() const { return _persistent; }
+
+        /**
+         * @brief Allocate memory
+         * @param size          Size in bytes
+         * @param alignment     Alignment of the returned offset, expected to
+         *      be a power of two
+         * @return Offset into @ref buffer() and a view to write the data to
+         *
+         * The returned view stays valid until the memory gets reused after a
+         * subsequent @ref fence(). The data written to it become visible to
+         * the GL only after calling @ref flush(). If there isn't enough free
+         * memory, waits on fences inserted by @ref fence() until the oldest
+         * allocations get released. Expects that @p size fits into the buffer
+         * and that there's enough memory left after waiting on all fences,
+         * i.e. that allocations made since the last @ref fence() (or since
+         * the last @ref flush() if the buffer isn't persistent) don't occupy
+         * the whole buffer.
+         *
+         * For uniform data the @p alignment should be at least
+         * @ref Buffer::uniformOffsetAlignment(), for vertex data it should
+         * match the alignment of the vertex type.
+         */
+        Containers::Pair<GLintptr, Containers::ArrayView<char>> allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Make written data visible to the GL
+         * @return Reference to self (for method chaining)
+         *
+         * Flushes all memory allocated since the previous call with
+         * @ref Buffer::flushMappedRange() if the buffer is persistent or
+         * uploads it with @ref Buffer::setSubData() otherwise. Call before
+         * submitting commands that use the data.
+         */
+        StreamingBuffer& flush();
+
+        /**
+         * @brief Fence previous allocations
+         * @return Reference to self (for method chaining)
+         *
+         * Call after submitting all commands that use data allocated since
+         * the previous call. Once the GPU finishes executing them, the memory
+         * can be reused by @ref allocate(). If the buffer isn't persistent,
+         * this function does nothing.
+         * @see @fn_gl_keyword{FenceSync}
+         */
+        StreamingBuffer& fence();
+
+    private:
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        struct Fence {
+            GLsync sync;
+            UnsignedLong position;
+        };
+
+        MAGNUM_GL_LOCAL bool releaseFences(bool wait);
+        #endif
+
+        Buffer _buffer;
+        std::size_t _size;
+        bool _persistent;
+        /* Either the persistently mapped memory or _staging */
+        char* _memory;
+        Containers::Array<char> _staging;
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Fences before _firstFence are already signaled and deleted, the
+           array is compacted when new fences get added */
+        Containers::Array<Fence> _fences;
+        std::size_t _firstFence;
+        #endif
+        /* Monotonically increasing byte positions, the offset into the buffer
+           is the position modulo _size. Everything before _releasedPosition
+           can be overwritten, everything before _flushedPosition is visible
+           to the GL. */
+        UnsignedLong _writePosition, _flushedPosition, _releasedPosition;
+};
+
+}}
+
+#endif
@@ -28,10 +28,12 @@
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/Resource.h>
 #include <Corrade/Utility/System.h>
 
@@ -61,6 +63,12 @@
 #include <Corrade/Containers/String.h>
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Containers/Optional.h>
+
+#include "configure.h"
+#endif
+
 namespace Magnum { namespace GL { namespace Test { namespace {
 
 struct AbstractShaderProgramGLTest: OpenGLTester {
@@ -79,6 +87,9 @@ struct AbstractShaderProgramGLTest: OpenGLTester {
     void createMultipleOutputsIndexed();
     #endif
     void createAsync();
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void createBinaryCache();
+    #endif
 
     void linkFailure();
     void linkFailureAsync();
@@ -173,7 +184,11 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
     addInstancedTests({&AbstractShaderProgramGLTest::create},
         Containers::arraySize(CreateData));
 
-    addTests({&AbstractShaderProgramGLTest::createAsync});
+    addTests({&AbstractShaderProgramGLTest::createAsync,
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &AbstractShaderProgramGLTest::createBinaryCache,
+              #endif
+              });
 
     addInstancedTests({
         &AbstractShaderProgramGLTest::createMultipleOutputs,
@@ -446,6 +461,117 @@ void AbstractShaderProgramGLTest::createAsync() {
     CORRADE_VERIFY(additionsUniform >= 0);
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void AbstractShaderProgramGLTest::createBinaryCache() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::get_program_binary>())
+        CORRADE_SKIP(Extensions::ARB::get_program_binary::string() << "is not supported.");
+    #endif
+
+    GLint formatCount;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if(!formatCount)
+        CORRADE_SKIP("No program binary formats supported.");
+
+    /* Start with an empty cache */
+    const Containers::String directory = Utility::Path::join(ABSTRACTSHADERPROGRAMGLTEST_SAVE_DIR, "binaryCache");
+    if(Utility::Path::exists(directory)) {
+        Containers::Optional<Containers::Array<Containers::String>> files = Utility::Path::list(directory, Utility::Path::ListFlag::SkipDirectories|Utility::Path::ListFlag::SkipDotAndDotDot);
+        CORRADE_VERIFY(files);
+        for(const Containers::String& file: *files)
+            CORRADE_VERIFY(Utility::Path::remove(Utility::Path::join(directory, file)));
+    }
+
+    CORRADE_VERIFY(AbstractShaderProgram::setBinaryCacheDirectory(directory));
+    CORRADE_COMPARE(AbstractShaderProgram::binaryCacheDirectory(), directory);
+
+    /* Disable the cache again at the end to not affect other tests */
+    Containers::ScopeGuard disableCache{[]() {
+        AbstractShaderProgram::setBinaryCacheDirectory({});
+    }};
+
+    Utility::Resource rs("AbstractShaderProgramGLTest");
+
+    /* The last iteration binds a different attribute location, which should
+       not reuse the binary from the first two */
+    const struct {
+        bool fromCache;
+        UnsignedInt positionLocation;
+        std::size_t fileCount;
+    } iterations[]{
+        {false, 0, 1},
+        {true, 0, 1},
+        {false, 1, 2}
+    };
+    for(const auto& iteration: iterations) {
+        CORRADE_ITERATION(iteration.fromCache << iteration.positionLocation);
+        const bool fromCache = iteration.fromCache;
+
+        Shader vert{
+            #ifndef MAGNUM_TARGET_GLES
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            #else
+            Version::GLES200
+            #endif
+            , Shader::Type::Vertex};
+        vert.addSource(rs.getString("MyShader.vert"));
+        vert.submitCompile();
+
+        Shader frag{
+            #ifndef MAGNUM_TARGET_GLES
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            #else
+            Version::GLES200
+            #endif
+            , Shader::Type::Fragment};
+        frag.addSource(rs.getString("MyShader.frag"));
+        frag.submitCompile();
+
+        /* The compilation is deferred to the link */
+        CORRADE_VERIFY(vert.isCompileFinished());
+        CORRADE_VERIFY(frag.isCompileFinished());
+
+        MyPublicShader program;
+        program.attachShaders({vert, frag});
+        program.bindAttributeLocation(iteration.positionLocation, "position");
+        program.submitLink();
+
+        while(!program.isLinkFinished())
+            Utility::System::sleep(100);
+
+        CORRADE_VERIFY(program.checkLink({vert, frag}));
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        /* If the program was taken from the cache, the shaders didn't get
+           compiled at all */
+        GLint vertCompiled, fragCompiled;
+        glGetShaderiv(vert.id(), GL_COMPILE_STATUS, &vertCompiled);
+        glGetShaderiv(frag.id(), GL_COMPILE_STATUS, &fragCompiled);
+        CORRADE_COMPARE(vertCompiled, fromCache ? GL_FALSE : GL_TRUE);
+        CORRADE_COMPARE(fragCompiled, fromCache ? GL_FALSE : GL_TRUE);
+
+        /* A cached binary is added only if the program wasn't taken from the
+           cache */
+        Containers::Optional<Containers::Array<Containers::String>> files = Utility::Path::list(directory, Utility::Path::ListFlag::SkipDirectories|Utility::Path::ListFlag::SkipDotAndDotDot);
+        CORRADE_VERIFY(files);
+        CORRADE_COMPARE(files->size(), iteration.fileCount);
+
+        /* The program is usable in all cases */
+        CORRADE_VERIFY(program.uniformLocation("matrix") >= 0);
+        CORRADE_VERIFY(program.uniformLocation("additions") >= 0);
+        MAGNUM_VERIFY_NO_GL_ERROR();
+    }
+}
+#endif
+
 void AbstractShaderProgramGLTest::createMultipleOutputs() {
     auto&& data = CreateMultipleOutputsData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
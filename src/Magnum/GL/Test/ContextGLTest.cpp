@@ -35,6 +35,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
 #include "Magnum/Platform/GLContext.h"
 
 #ifndef CORRADE_TARGET_EMSCRIPTEN
@@ -65,6 +66,8 @@ struct ContextGLTest: OpenGLTester {
     void supportedVersion();
     void isExtensionSupported();
     void isExtensionDisabled();
+
+    void statistics();
 };
 
 using namespace Containers::Literals;
@@ -205,7 +208,9 @@ ContextGLTest::ContextGLTest() {
         #endif
         &ContextGLTest::supportedVersion,
         &ContextGLTest::isExtensionSupported,
-        &ContextGLTest::isExtensionDisabled});
+        &ContextGLTest::isExtensionDisabled,
+
+        &ContextGLTest::statistics});
 }
 
 void ContextGLTest::stringFlags() {
@@ -525,6 +530,46 @@ void ContextGLTest::isExtensionDisabled() {
     #endif
 }
 
+void ContextGLTest::statistics() {
+    Context& context = Context::current();
+    CORRADE_VERIFY(!context.isStatisticsEnabled());
+
+    Texture2D a, b;
+
+    /* Make sure the texture binding state is known so the binds below aren't
+       affected by what other tests did */
+    a.bind(0);
+    a.bind(1);
+
+    /* Nothing gets counted by default */
+    context.resetStatistics();
+    b.bind(0);
+    CORRADE_COMPARE(context.statistics().textureBinds, 0);
+
+    context.setStatisticsEnabled(true);
+    CORRADE_VERIFY(context.isStatisticsEnabled());
+
+    /* Already bound, filtered out by the state tracker and thus not counted */
+    b.bind(0);
+    CORRADE_COMPARE(context.statistics().textureBinds, 0);
+
+    a.bind(0);
+    b.bind(1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(context.statistics().textureBinds, 2);
+    CORRADE_COMPARE(context.statistics().drawCalls, 0);
+    CORRADE_COMPARE(context.statistics().programSwitches, 0);
+
+    /* Disabling keeps the counters */
+    context.setStatisticsEnabled(false);
+    CORRADE_VERIFY(!context.isStatisticsEnabled());
+    a.bind(1);
+    CORRADE_COMPARE(context.statistics().textureBinds, 2);
+
+    context.resetStatistics();
+    CORRADE_COMPARE(context.statistics().textureBinds, 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::ContextGLTest)
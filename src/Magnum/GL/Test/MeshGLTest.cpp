@@ -25,11 +25,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/Utility/Format.h>
 
 #include "Magnum/Image.h"
@@ -235,6 +237,17 @@ struct MeshGLTest: OpenGLTester {
     void multiDrawInstancedBaseInstanceNoExtensionAvailable();
     #endif
     #endif
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void drawIndirect();
+    void drawIndirectIndexed();
+    #ifndef MAGNUM_TARGET_GLES
+    void drawIndirectCount();
+    #endif
+    void drawIndirectZeroCount();
+    void drawIndirectInvalidAlignment();
+    void drawIndirectIndexBufferOffset();
+    #endif
 };
 
 const struct {
@@ -559,6 +572,25 @@ const struct {
 
 using namespace Math::Literals;
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+const struct {
+    const char* name;
+    UnsignedInt count;
+    GLintptr offset;
+    UnsignedInt stride;
+    Vector4 expected;
+} DrawIndirectData[]{
+    {"single command", 1, 0, 0,
+        {0.25f, 0.0f, 0.0f, 0.0f}},
+    {"two commands", 2, 0, 0,
+        {0.25f, 0.0f, 0.75f, 1.0f}},
+    {"two commands, offset", 2, 8, 0,
+        {0.25f, 0.0f, 0.75f, 1.0f}},
+    {"two commands, stride", 2, 0, 28,
+        {0.25f, 0.0f, 0.75f, 1.0f}},
+};
+#endif
+
 MeshGLTest::MeshGLTest() {
     addTests({&MeshGLTest::construct,
               &MeshGLTest::constructMove,
@@ -768,6 +800,20 @@ MeshGLTest::MeshGLTest() {
     });
     #endif
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    addInstancedTests({&MeshGLTest::drawIndirect,
+                       &MeshGLTest::drawIndirectIndexed},
+        Containers::arraySize(DrawIndirectData));
+
+    addTests({
+        #ifndef MAGNUM_TARGET_GLES
+        &MeshGLTest::drawIndirectCount,
+        #endif
+        &MeshGLTest::drawIndirectZeroCount,
+        &MeshGLTest::drawIndirectInvalidAlignment,
+        &MeshGLTest::drawIndirectIndexBufferOffset});
+    #endif
+
     /* Reset clear color to something trivial first */
     Renderer::setClearColor(0x000000_rgbf);
 }
@@ -5383,6 +5429,197 @@ void MeshGLTest::multiDrawInstancedBaseInstanceNoExtensionAvailable() {
 #endif
 #endif
 
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+template<class T> Buffer indirectCommandBuffer(const Containers::ArrayView<const T> commands, const GLintptr offset, const UnsignedInt stride) {
+    /* Place the commands at given offset with given stride, the rest is
+       zero-filled */
+    const std::size_t actualStride = stride ? stride : sizeof(T);
+    Containers::Array<char> data{ValueInit, std::size_t(offset) + actualStride*commands.size()};
+    for(std::size_t i = 0; i != commands.size(); ++i)
+        std::memcpy(data.data() + offset + i*actualStride, &commands[i], sizeof(T));
+    return Buffer{Buffer::TargetHint::DrawIndirect, data};
+}
+
+const struct {
+    Vector2 position;
+    Vector4 value;
+} DrawIndirectVertexData[] {
+    {}, /* initial offset */
+    {{-1.0f/3.0f, -1.0f/3.0f}, {0.25f, 0.0f, 0.0f, 0.0f}},
+    {{ 1.0f/3.0f, -1.0f/3.0f}, {0.5f, 0.0f, 0.0f, 0.0f}},
+    {{-1.0f/3.0f,  1.0f/3.0f}, {0.75f, 0.0f, 0.0f, 0.0f}},
+    {{ 1.0f/3.0f,  1.0f/3.0f}, {1.0f, 0.0f, 0.0f, 0.0f}},
+};
+
+void MeshGLTest::drawIndirect() {
+    auto&& data = DrawIndirectData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::draw_indirect::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBuffer(Buffer{DrawIndirectVertexData}, sizeof(DrawIndirectVertexData[0]), MultiDrawShader::Position{}, MultiDrawShader::Value{});
+
+    /* Vertex 1, then vertices 3 and 4, the second command is used only if
+       count is 2 */
+    const DrawArraysIndirectCommand commands[]{
+        {1, 1, 1, 0},
+        {2, 1, 3, 0}
+    };
+    Buffer commandBuffer = indirectCommandBuffer(Containers::arrayView(commands), data.offset, data.stride);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    MultiDrawChecker checker;
+    MultiDrawShader{}.drawIndirect(mesh, commandBuffer, data.offset, data.count, data.stride);
+    Vector4 value = checker.get();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(value, data.expected,
+        TestSuite::Compare::around(Vector4{1.0f/255.0f}));
+}
+
+void MeshGLTest::drawIndirectIndexed() {
+    auto&& data = DrawIndirectData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::draw_indirect::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBuffer(Buffer{DrawIndirectVertexData}, sizeof(DrawIndirectVertexData[0]), MultiDrawShader::Position{}, MultiDrawShader::Value{})
+        .setIndexBuffer(Buffer{Buffer::TargetHint::ElementArray, {0u, 2u, 1u, 4u, 3u}}, 0, MeshIndexType::UnsignedInt);
+
+    /* Index 0 with base vertex 1, then indices 4 and 3, the second command is
+       used only if count is 2 */
+    const DrawElementsIndirectCommand commands[]{
+        {1, 1, 0, 1, 0},
+        {2, 1, 3, 0, 0}
+    };
+    Buffer commandBuffer = indirectCommandBuffer(Containers::arrayView(commands), data.offset, data.stride);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    MultiDrawChecker checker;
+    MultiDrawShader{}.drawIndirect(mesh, commandBuffer, data.offset, data.count, data.stride);
+    Vector4 value = checker.get();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(value, data.expected,
+        TestSuite::Compare::around(Vector4{1.0f/255.0f}));
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void MeshGLTest::drawIndirectCount() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::indirect_parameters>())
+        CORRADE_SKIP(Extensions::ARB::indirect_parameters::string() << "is not supported.");
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBuffer(Buffer{DrawIndirectVertexData}, sizeof(DrawIndirectVertexData[0]), MultiDrawShader::Position{}, MultiDrawShader::Value{});
+
+    const DrawArraysIndirectCommand commands[]{
+        {1, 1, 1, 0},
+        {2, 1, 3, 0},
+        {1, 1, 2, 0}
+    };
+    Buffer commandBuffer{Buffer::TargetHint::DrawIndirect, commands};
+
+    /* The count is at offset 4, and is clamped by the max count to just
+       two */
+    Buffer countBuffer{Buffer::TargetHint::Array, {0u, 3u}};
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    MultiDrawChecker checker;
+    MultiDrawShader{}.drawIndirect(mesh, commandBuffer, 0, countBuffer, 4, 2);
+    Vector4 value = checker.get();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(value, (Vector4{0.25f, 0.0f, 0.75f, 1.0f}),
+        TestSuite::Compare::around(Vector4{1.0f/255.0f}));
+}
+#endif
+
+void MeshGLTest::drawIndirectZeroCount() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::draw_indirect::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    /* The buffer is empty, so if anything got drawn, it'd be a GL error */
+    Mesh mesh{MeshPrimitive::Points};
+    Buffer commandBuffer{Buffer::TargetHint::DrawIndirect};
+
+    MultiDrawShader{}.drawIndirect(mesh, commandBuffer, 0, 0);
+    #ifndef MAGNUM_TARGET_GLES
+    Buffer countBuffer;
+    MultiDrawShader{}.drawIndirect(mesh, commandBuffer, 0, countBuffer, 0, 0);
+    #endif
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void MeshGLTest::drawIndirectInvalidAlignment() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Mesh mesh;
+    Buffer commandBuffer{NoCreate};
+    MultiDrawShader shader;
+
+    Containers::String out;
+    Error redirectError{&out};
+    shader.drawIndirect(mesh, commandBuffer, 6, 2, 20);
+    shader.drawIndirect(mesh, commandBuffer, 8, 2, 18);
+    #ifndef MAGNUM_TARGET_GLES
+    shader.drawIndirect(mesh, commandBuffer, 8, commandBuffer, 2, 2);
+    #endif
+    CORRADE_COMPARE_AS(out,
+        "GL::AbstractShaderProgram::drawIndirect(): expected offset and stride to be multiples of four, got 6 and 20\n"
+        "GL::AbstractShaderProgram::drawIndirect(): expected offset and stride to be multiples of four, got 8 and 18\n"
+        #ifndef MAGNUM_TARGET_GLES
+        "GL::AbstractShaderProgram::drawIndirect(): expected offset, count offset and stride to be multiples of four, got 8, 2 and 0\n"
+        #endif
+        , TestSuite::Compare::String);
+}
+
+void MeshGLTest::drawIndirectIndexBufferOffset() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::draw_indirect::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    Mesh mesh;
+    mesh.setIndexBuffer(Buffer{Buffer::TargetHint::ElementArray, {0u, 2u, 1u}}, 4, MeshIndexType::UnsignedInt);
+    Buffer commandBuffer{Buffer::TargetHint::DrawIndirect};
+    MultiDrawShader shader;
+
+    Containers::String out;
+    Error redirectError{&out};
+    shader.drawIndirect(mesh, commandBuffer);
+    CORRADE_COMPARE(out, "GL::AbstractShaderProgram::drawIndirect(): can't draw a mesh with a non-zero index buffer offset, got 4\n");
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::MeshGLTest)
@@ -0,0 +1,263 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <type_traits>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Resource.h>
+#include <Corrade/Utility/System.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderCompileQueue.h"
+#include "Magnum/GL/Version.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct ShaderCompileQueueGLTest: OpenGLTester {
+    explicit ShaderCompileQueueGLTest();
+
+    void construct();
+    void constructMove();
+
+    void poll();
+    void finish();
+
+    void isFinishedOutOfRange();
+    void shaderOutOfRange();
+    void shaderNotFinished();
+};
+
+ShaderCompileQueueGLTest::ShaderCompileQueueGLTest() {
+    addTests({&ShaderCompileQueueGLTest::construct,
+              &ShaderCompileQueueGLTest::constructMove,
+
+              &ShaderCompileQueueGLTest::poll,
+              &ShaderCompileQueueGLTest::finish,
+
+              &ShaderCompileQueueGLTest::isFinishedOutOfRange,
+              &ShaderCompileQueueGLTest::shaderOutOfRange,
+              &ShaderCompileQueueGLTest::shaderNotFinished});
+}
+
+/* A minimal shader implementing the async workflow described in the
+   AbstractShaderProgram docs */
+struct MyShader: AbstractShaderProgram {
+    class CompileState;
+
+    static CompileState compile();
+
+    explicit MyShader(CompileState&& state);
+
+    explicit MyShader(NoInitT) {}
+
+    explicit MyShader(NoCreateT): AbstractShaderProgram{NoCreate} {}
+
+    using AbstractShaderProgram::uniformLocation;
+};
+
+class MyShader::CompileState: public MyShader {
+    friend MyShader;
+
+    explicit CompileState(MyShader&& shader, Shader&& vert, Shader&& frag): MyShader{Utility::move(shader)}, _vert{Utility::move(vert)}, _frag{Utility::move(frag)} {}
+
+    Shader _vert, _frag;
+};
+
+MyShader::CompileState MyShader::compile() {
+    Utility::Resource rs{"AbstractShaderProgramGLTest"};
+
+    const Version version =
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        ;
+
+    Shader vert{version, Shader::Type::Vertex};
+    vert.addSource(rs.getString("MyShader.vert"))
+        .submitCompile();
+
+    Shader frag{version, Shader::Type::Fragment};
+    frag.addSource(rs.getString("MyShader.frag"))
+        .submitCompile();
+
+    MyShader out{NoInit};
+    out.attachShaders({vert, frag});
+    out.bindAttributeLocation(0, "position");
+    out.submitLink();
+
+    return CompileState{Utility::move(out), Utility::move(vert), Utility::move(frag)};
+}
+
+MyShader::MyShader(CompileState&& state): MyShader{static_cast<MyShader&&>(Utility::move(state))} {
+    CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink({state._vert, state._frag}));
+}
+
+void ShaderCompileQueueGLTest::construct() {
+    ShaderCompileQueue<MyShader> queue;
+    CORRADE_COMPARE(queue.size(), 0);
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+
+    /* Polling or finishing an empty queue does nothing */
+    CORRADE_COMPARE(queue.poll(), 0);
+    queue.finish();
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+}
+
+void ShaderCompileQueueGLTest::constructMove() {
+    ShaderCompileQueue<MyShader> a;
+    a.add(MyShader::compile());
+    CORRADE_COMPARE(a.size(), 1);
+
+    ShaderCompileQueue<MyShader> b{Utility::move(a)};
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.pendingCount(), 1);
+
+    ShaderCompileQueue<MyShader> c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.pendingCount(), 1);
+
+    c.finish();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(c.isFinished(0));
+    CORRADE_VERIFY(c.shader(0).id());
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ShaderCompileQueue<MyShader>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ShaderCompileQueue<MyShader>>::value);
+}
+
+void ShaderCompileQueueGLTest::poll() {
+    ShaderCompileQueue<MyShader> queue;
+    CORRADE_COMPARE(queue.add(MyShader::compile()), 0);
+    CORRADE_COMPARE(queue.add(MyShader::compile()), 1);
+    CORRADE_COMPARE(queue.add(MyShader::compile()), 2);
+    CORRADE_COMPARE(queue.size(), 3);
+    CORRADE_COMPARE(queue.pendingCount(), 3);
+
+    /* The count returned from poll() should sum up to all entries */
+    std::size_t finished = 0;
+    while(queue.pendingCount()) {
+        finished += queue.poll();
+        if(queue.pendingCount()) Utility::System::sleep(100);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(finished, 3);
+    CORRADE_COMPARE(queue.size(), 3);
+
+    /* Polling again does nothing */
+    CORRADE_COMPARE(queue.poll(), 0);
+
+    for(std::size_t i: {0, 1, 2}) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(queue.isFinished(i));
+        CORRADE_VERIFY(queue.shader(i).id());
+        CORRADE_VERIFY(queue.shader(i).uniformLocation("matrix") >= 0);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCompileQueueGLTest::finish() {
+    ShaderCompileQueue<MyShader> queue;
+    queue.add(MyShader::compile());
+    queue.add(MyShader::compile());
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+
+    queue.finish();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_VERIFY(queue.isFinished(0));
+    CORRADE_VERIFY(queue.isFinished(1));
+    CORRADE_VERIFY(queue.shader(0).uniformLocation("matrix") >= 0);
+    CORRADE_VERIFY(queue.shader(1).uniformLocation("matrix") >= 0);
+
+    /* Adding more after finishing works too */
+    CORRADE_COMPARE(queue.add(MyShader::compile()), 2);
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    CORRADE_VERIFY(!queue.isFinished(2));
+
+    queue.finish();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_VERIFY(queue.isFinished(2));
+}
+
+void ShaderCompileQueueGLTest::isFinishedOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ShaderCompileQueue<MyShader> queue;
+    queue.add(MyShader::compile());
+
+    Containers::String out;
+    Error redirectError{&out};
+    queue.isFinished(1);
+    CORRADE_COMPARE(out, "GL::ShaderCompileQueue::isFinished(): index 1 out of range for 1 entries\n");
+}
+
+void ShaderCompileQueueGLTest::shaderOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ShaderCompileQueue<MyShader> queue;
+    queue.add(MyShader::compile());
+    queue.finish();
+
+    Containers::String out;
+    Error redirectError{&out};
+    /* A NoCreate'd instance is returned in that case */
+    CORRADE_COMPARE(queue.shader(1).id(), 0);
+    CORRADE_COMPARE(out, "GL::ShaderCompileQueue::shader(): index 1 out of range for 1 entries\n");
+}
+
+void ShaderCompileQueueGLTest::shaderNotFinished() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ShaderCompileQueue<MyShader> queue;
+    queue.add(MyShader::compile());
+
+    /* Not polled, so it's not finished even if the driver may be done with
+       it already */
+    Containers::String out;
+    Error redirectError{&out};
+    /* A NoCreate'd instance is returned in that case */
+    CORRADE_COMPARE(queue.shader(0).id(), 0);
+    CORRADE_COMPARE(out, "GL::ShaderCompileQueue::shader(): entry 0 isn't finished yet\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::ShaderCompileQueueGLTest)
@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/StreamingBuffer.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct StreamingBufferGLTest: OpenGLTester {
+    explicit StreamingBufferGLTest();
+
+    void construct();
+    void constructZeroSize();
+    void constructMove();
+
+    void allocate();
+    void allocateWrapAround();
+    void allocateReuse();
+    void allocateInvalidAlignment();
+    void allocateTooLarge();
+    void allocateNoSpace();
+
+    void flush();
+};
+
+StreamingBufferGLTest::StreamingBufferGLTest() {
+    addTests({&StreamingBufferGLTest::construct,
+              &StreamingBufferGLTest::constructZeroSize,
+              &StreamingBufferGLTest::constructMove,
+
+              &StreamingBufferGLTest::allocate,
+              &StreamingBufferGLTest::allocateWrapAround,
+              &StreamingBufferGLTest::allocateReuse,
+              &StreamingBufferGLTest::allocateInvalidAlignment,
+              &StreamingBufferGLTest::allocateTooLarge,
+              &StreamingBufferGLTest::allocateNoSpace,
+
+              &StreamingBufferGLTest::flush});
+}
+
+using namespace Containers::Literals;
+
+bool expectPersistent() {
+    #if defined(MAGNUM_TARGET_GLES2) || defined(MAGNUM_TARGET_WEBGL)
+    return false;
+    #elif !defined(MAGNUM_TARGET_GLES)
+    return Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>() && Context::current().isExtensionSupported<Extensions::ARB::sync>();
+    #else
+    return Context::current().isExtensionSupported<Extensions::EXT::buffer_storage>();
+    #endif
+}
+
+void StreamingBufferGLTest::construct() {
+    {
+        StreamingBuffer buffer{1024, Buffer::TargetHint::Uniform};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_VERIFY(buffer.buffer().id() > 0);
+        CORRADE_COMPARE(buffer.buffer().targetHint(), Buffer::TargetHint::Uniform);
+        CORRADE_COMPARE(buffer.buffer().size(), 1024);
+        CORRADE_COMPARE(buffer.size(), 1024);
+        CORRADE_COMPARE(buffer.isPersistent(), expectPersistent());
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::constructZeroSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    StreamingBuffer{0};
+    CORRADE_COMPARE(out, "GL::StreamingBuffer: expected a non-zero size\n");
+}
+
+void StreamingBufferGLTest::constructMove() {
+    StreamingBuffer a{1024};
+    const GLuint id = a.buffer().id();
+    a.allocate(16, 4);
+    a.flush().fence();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    StreamingBuffer b{Utility::move(a)};
+    CORRADE_COMPARE(a.buffer().id(), 0);
+    CORRADE_COMPARE(b.buffer().id(), id);
+    CORRADE_COMPARE(b.size(), 1024);
+
+    StreamingBuffer c{128};
+    const GLuint cId = c.buffer().id();
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.buffer().id(), cId);
+    CORRADE_COMPARE(b.size(), 128);
+    CORRADE_COMPARE(c.buffer().id(), id);
+    CORRADE_COMPARE(c.size(), 1024);
+
+    /* The moved instance is still usable */
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> allocation = c.allocate(16, 16);
+    CORRADE_COMPARE(allocation.first(), 16);
+    CORRADE_COMPARE(allocation.second().size(), 16);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<StreamingBuffer>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<StreamingBuffer>::value);
+}
+
+void StreamingBufferGLTest::allocate() {
+    StreamingBuffer buffer{1024};
+
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> a = buffer.allocate(12, 4);
+    CORRADE_COMPARE(a.first(), 0);
+    CORRADE_COMPARE(a.second().size(), 12);
+
+    /* Aligned to 16 bytes */
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> b = buffer.allocate(20, 16);
+    CORRADE_COMPARE(b.first(), 16);
+    CORRADE_COMPARE(b.second().size(), 20);
+    CORRADE_COMPARE(b.second().data(), a.second().data() + 16);
+
+    /* Already aligned, right after */
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> c = buffer.allocate(8, 4);
+    CORRADE_COMPARE(c.first(), 36);
+    CORRADE_COMPARE(c.second().size(), 8);
+
+    buffer.flush().fence();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::allocateWrapAround() {
+    StreamingBuffer buffer{100};
+
+    CORRADE_COMPARE(buffer.allocate(60, 4).first(), 0);
+    buffer.flush().fence();
+
+    /* Doesn't fit before the end, wraps around. The first allocation is
+       fenced, so this waits for it. */
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> a = buffer.allocate(48, 4);
+    CORRADE_COMPARE(a.first(), 0);
+    CORRADE_COMPARE(a.second().size(), 48);
+
+    /* Continues right after, the space is no longer used by the first
+       allocation */
+    CORRADE_COMPARE(buffer.allocate(8, 8).first(), 48);
+    buffer.flush().fence();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::allocateReuse() {
+    StreamingBuffer buffer{64};
+
+    /* Filling the whole buffer repeatedly should always succeed as each
+       round is fenced */
+    for(std::size_t i = 0; i != 10; ++i) {
+        CORRADE_ITERATION(i);
+
+        Containers::Pair<GLintptr, Containers::ArrayView<char>> a = buffer.allocate(32, 4);
+        Containers::Pair<GLintptr, Containers::ArrayView<char>> b = buffer.allocate(32, 4);
+        CORRADE_COMPARE(a.first(), 0);
+        CORRADE_COMPARE(b.first(), 32);
+        buffer.flush().fence();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::allocateInvalidAlignment() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{64};
+
+    Containers::String out;
+    Error redirectError{&out};
+    buffer.allocate(16, 0);
+    buffer.allocate(16, 12);
+    CORRADE_COMPARE_AS(out,
+        "GL::StreamingBuffer::allocate(): expected alignment to be a power of two, got 0\n"
+        "GL::StreamingBuffer::allocate(): expected alignment to be a power of two, got 12\n",
+        TestSuite::Compare::String);
+}
+
+void StreamingBufferGLTest::allocateTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{64};
+
+    Containers::String out;
+    Error redirectError{&out};
+    buffer.allocate(65, 4);
+    CORRADE_COMPARE(out, "GL::StreamingBuffer::allocate(): can't allocate 65 bytes in a buffer of 64 bytes\n");
+}
+
+void StreamingBufferGLTest::allocateNoSpace() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{64};
+    buffer.allocate(48, 4);
+
+    Containers::String out;
+    Error redirectError{&out};
+    buffer.allocate(32, 4);
+    if(buffer.isPersistent())
+        CORRADE_COMPARE(out, "GL::StreamingBuffer::allocate(): not enough space for 32 bytes, call flush() and fence() before allocating more\n");
+    else
+        CORRADE_COMPARE(out, "GL::StreamingBuffer::allocate(): not enough space for 32 bytes, call flush() before allocating more\n");
+}
+
+void StreamingBufferGLTest::flush() {
+    StreamingBuffer buffer{16};
+
+    /* Allocate twelve bytes, then another eight that wrap around to the
+       start, so the flush is split in two ranges */
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> a = buffer.allocate(12, 4);
+    Utility::copy("hello world!"_s, a.second());
+    buffer.flush().fence();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> b = buffer.allocate(4, 4);
+    Containers::Pair<GLintptr, Containers::ArrayView<char>> c = buffer.allocate(8, 4);
+    CORRADE_COMPARE(b.first(), 12);
+    CORRADE_COMPARE(c.first(), 0);
+    Utility::copy("ABCD"_s, b.second());
+    Utility::copy("magnum!!"_s, c.second());
+    buffer.flush().fence();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* A persistently mapped buffer can be read from with glGetBufferSubData()
+       as well, but the GPU has to finish writing first */
+    Renderer::finish();
+    Containers::Array<char> data = buffer.buffer().data();
+    CORRADE_COMPARE_AS(Containers::StringView{data},
+        "magnum!!rld!ABCD"_s,
+        TestSuite::Compare::String);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    #endif
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::StreamingBufferGLTest)
@@ -106,6 +106,10 @@ struct TextureGLTest: OpenGLTester {
     void bindImage3D();
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    void bindlessHandle();
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES
     template<class T> void sampling1D();
     #endif
@@ -511,6 +515,10 @@ TextureGLTest::TextureGLTest() {
         &TextureGLTest::bindImage3D,
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        &TextureGLTest::bindlessHandle,
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         &TextureGLTest::sampling1D<GenericSampler>,
         &TextureGLTest::sampling1D<GLSampler>,
@@ -1089,6 +1097,32 @@ void TextureGLTest::bindImage3D() {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void TextureGLTest::bindlessHandle() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::ARB::bindless_texture::string() << "is not supported.");
+
+    Texture2D texture;
+    texture.setMinificationFilter(SamplerFilter::Linear)
+        .setStorage(1, TextureFormat::RGBA8, {32, 32});
+
+    UnsignedLong handle = texture.handle();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(handle);
+    /* The handle stays the same */
+    CORRADE_COMPARE(texture.handle(), handle);
+    CORRADE_VERIFY(!texture.isHandleResident());
+
+    texture.makeHandleResident();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(texture.isHandleResident());
+
+    texture.makeHandleNonResident();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(!texture.isHandleResident());
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 template<class T> void TextureGLTest::sampling1D() {
     setTestCaseTemplateName(std::is_same<T, GenericSampler>::value ?
@@ -28,3 +28,4 @@
 #cmakedefine TGAIMPORTER_PLUGIN_FILENAME "${TGAIMPORTER_PLUGIN_FILENAME}"
 #define SHADERGLTEST_FILES_DIR "${SHADERGLTEST_FILES_DIR}"
 #define RENDERERGLTEST_FILES_DIR "${RENDERERGLTEST_FILES_DIR}"
+#define ABSTRACTSHADERPROGRAMGLTEST_SAVE_DIR "${ABSTRACTSHADERPROGRAMGLTEST_SAVE_DIR}"
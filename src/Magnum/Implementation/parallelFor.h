@@ -0,0 +1,92 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+
+/* Threads are used only if Corrade is built with CORRADE_BUILD_MULTITHREADED,
+   as that's also the condition under which the libraries link to
+   Threads::Threads. Emscripten additionally has std::thread only if built
+   with -pthread. Otherwise everything is executed serially. */
+#if defined(CORRADE_BUILD_MULTITHREADED) && (!defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__))
+#define MAGNUM_IMPLEMENTATION_PARALLEL_FOR_THREADS
+#include <thread>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+/* Used by algorithms that take a user-supplied thread count. Zero means all
+   hardware threads, if threads aren't available at all the result is always
+   1. */
+inline UnsignedInt parallelForThreadCount(UnsignedInt threadCount) {
+    #ifdef MAGNUM_IMPLEMENTATION_PARALLEL_FOR_THREADS
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    return Math::max(threadCount, 1u);
+    #else
+    static_cast<void>(threadCount);
+    return 1;
+    #endif
+}
+
+/* Splits the [0, count) range into `chunkCount` contiguous chunks and calls
+   `function(chunk, begin, end)` for each, with all chunks except the first
+   executed on a newly spawned thread. Returns once all chunks are done. The
+   chunk boundaries depend only on `chunkCount` and `count`, so when called
+   several times with the same values, a chunk always covers the same range.
+   If threads aren't available, the chunks are executed serially in order,
+   which gives the same result if the function doesn't depend on the
+   execution order of the chunks. */
+template<class F> void parallelFor(const std::size_t chunkCount, const std::size_t count, F&& function) {
+    /* Not using count*i/chunkCount directly as that could overflow on 32-bit
+       platforms */
+    auto chunkBegin = [chunkCount, count](std::size_t chunk) {
+        return std::size_t(UnsignedLong(count)*chunk/chunkCount);
+    };
+
+    #ifdef MAGNUM_IMPLEMENTATION_PARALLEL_FOR_THREADS
+    if(chunkCount > 1) {
+        Containers::Array<std::thread> threads{chunkCount - 1};
+        for(std::size_t i = 1; i != chunkCount; ++i)
+            threads[i - 1] = std::thread{[&function, &chunkBegin, i]{
+                function(i, chunkBegin(i), chunkBegin(i + 1));
+            }};
+        function(std::size_t{}, std::size_t{}, chunkBegin(1));
+        for(std::thread& thread: threads) thread.join();
+        return;
+    }
+    #endif
+
+    for(std::size_t i = 0; i != chunkCount; ++i)
+        function(i, chunkBegin(i), chunkBegin(i + 1));
+}
+
+}}
+
+#endif
@@ -0,0 +1,228 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IntersectionBatch.h"
+
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Intersection.h"
+
+#if defined(CORRADE_TARGET_SSE2)
+#include <emmintrin.h>
+#elif defined(CORRADE_TARGET_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+namespace {
+
+/* Minimal four-wide float abstraction so the kernels below can be written just
+   once for both SSE2 and NEON. The operations are deliberately done in the
+   same order as in the scalar functions in Intersection.h, so the results are
+   the same bit-for-bit -- no FMA, no reciprocals. */
+#if defined(CORRADE_TARGET_SSE2)
+typedef __m128 Float4;
+typedef __m128 Mask4;
+
+inline Float4 set4(const Float a, const Float b, const Float c, const Float d) {
+    return _mm_set_ps(d, c, b, a);
+}
+inline Float4 splat4(const Float a) { return _mm_set1_ps(a); }
+inline Float4 add4(const Float4 a, const Float4 b) { return _mm_add_ps(a, b); }
+inline Float4 sub4(const Float4 a, const Float4 b) { return _mm_sub_ps(a, b); }
+inline Float4 mul4(const Float4 a, const Float4 b) { return _mm_mul_ps(a, b); }
+inline Mask4 none4() { return _mm_setzero_ps(); }
+inline Mask4 orLess4(const Mask4 mask, const Float4 a, const Float4 b) {
+    return _mm_or_ps(mask, _mm_cmplt_ps(a, b));
+}
+inline UnsignedInt bits4(const Mask4 mask) { return _mm_movemask_ps(mask); }
+#elif defined(CORRADE_TARGET_NEON)
+typedef float32x4_t Float4;
+typedef uint32x4_t Mask4;
+
+inline Float4 set4(const Float a, const Float b, const Float c, const Float d) {
+    const Float data[]{a, b, c, d};
+    return vld1q_f32(data);
+}
+inline Float4 splat4(const Float a) { return vdupq_n_f32(a); }
+inline Float4 add4(const Float4 a, const Float4 b) { return vaddq_f32(a, b); }
+inline Float4 sub4(const Float4 a, const Float4 b) { return vsubq_f32(a, b); }
+inline Float4 mul4(const Float4 a, const Float4 b) { return vmulq_f32(a, b); }
+inline Mask4 none4() { return vdupq_n_u32(0); }
+inline Mask4 orLess4(const Mask4 mask, const Float4 a, const Float4 b) {
+    return vorrq_u32(mask, vcltq_f32(a, b));
+}
+inline UnsignedInt bits4(const Mask4 mask) {
+    return (vgetq_lane_u32(mask, 0) & 1)|
+           (vgetq_lane_u32(mask, 1) & 2)|
+           (vgetq_lane_u32(mask, 2) & 4)|
+           (vgetq_lane_u32(mask, 3) & 8);
+}
+#endif
+
+#if defined(CORRADE_TARGET_SSE2) || defined(CORRADE_TARGET_NEON)
+/* Frustum planes transposed to four-wide registers, calculated just once for
+   the whole batch */
+struct Planes4 {
+    explicit Planes4(const Frustum<Float>& frustum) {
+        for(std::size_t i = 0; i != 6; ++i) {
+            const Vector4<Float>& plane = frustum[i];
+            x[i] = splat4(plane.x());
+            y[i] = splat4(plane.y());
+            z[i] = splat4(plane.z());
+            w[i] = splat4(plane.w());
+            absX[i] = splat4(Math::abs(plane.x()));
+            absY[i] = splat4(Math::abs(plane.y()));
+            absZ[i] = splat4(Math::abs(plane.z()));
+        }
+    }
+
+    Float4 x[6], y[6], z[6], w[6], absX[6], absY[6], absZ[6];
+};
+
+inline void gather4(const Vector3<Float>& a, const Vector3<Float>& b, const Vector3<Float>& c, const Vector3<Float>& d, Float4(&out)[3]) {
+    for(std::size_t i = 0; i != 3; ++i)
+        out[i] = set4(a[i], b[i], c[i], d[i]);
+}
+
+/* Writes four bits at once instead of going through set() / reset() for each,
+   which would otherwise take majority of the time. The bit range can span two
+   bytes if the view isn't aligned, but never goes past the view end as only
+   whole groups of four get written here. */
+inline void scatter4(const Containers::MutableBitArrayView& visible, const std::size_t i, const UnsignedInt culled) {
+    const std::size_t bit = visible.offset() + i;
+    UnsignedByte* const data = reinterpret_cast<UnsignedByte*>(visible.data()) + (bit >> 3);
+    const UnsignedInt shift = bit & 7;
+    const UnsignedInt mask = 0xf << shift;
+    const UnsignedInt bits = (~culled & 0xf) << shift;
+    data[0] = (data[0] & ~mask) | bits;
+    if(shift > 4) data[1] = (data[1] & ~(mask >> 8)) | (bits >> 8);
+}
+
+/* Common for rangeFrustumInto() and aabbFrustumInto(), returns a mask of
+   boxes that are fully outside of any plane */
+inline UnsignedInt boxFrustum4(const Planes4& planes, const Float4(&center)[3], const Float4(&extent)[3], const Float4 wScale) {
+    Mask4 culled = none4();
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Float4 d = add4(add4(mul4(center[0], planes.x[i]), mul4(center[1], planes.y[i])), mul4(center[2], planes.z[i]));
+        const Float4 r = add4(add4(mul4(extent[0], planes.absX[i]), mul4(extent[1], planes.absY[i])), mul4(extent[2], planes.absZ[i]));
+        culled = orLess4(culled, add4(d, r), mul4(wScale, planes.w[i]));
+    }
+    return bits4(culled);
+}
+#endif
+
+}
+
+void rangeFrustumInto(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Containers::MutableBitArrayView visible) {
+    CORRADE_ASSERT(ranges.size() == visible.size(),
+        "Math::Intersection::rangeFrustumInto(): expected ranges and visible views to have the same size, got" << ranges.size() << "and" << visible.size(), );
+
+    std::size_t i = 0;
+    #if defined(CORRADE_TARGET_SSE2) || defined(CORRADE_TARGET_NEON)
+    const Planes4 planes{frustum};
+    /* Same as in rangeFrustum(), converting to center/extent without dividing
+       by 2 and comparing to -2*plane.w() instead */
+    const Float4 wScale = splat4(-2.0f);
+    for(const std::size_t iMax = ranges.size() & ~std::size_t{3}; i != iMax; i += 4) {
+        Float4 min[3], max[3];
+        gather4(ranges[i].min(), ranges[i + 1].min(), ranges[i + 2].min(), ranges[i + 3].min(), min);
+        gather4(ranges[i].max(), ranges[i + 1].max(), ranges[i + 2].max(), ranges[i + 3].max(), max);
+        const Float4 center[]{add4(min[0], max[0]),
+                              add4(min[1], max[1]),
+                              add4(min[2], max[2])};
+        const Float4 extent[]{sub4(max[0], min[0]),
+                              sub4(max[1], min[1]),
+                              sub4(max[2], min[2])};
+        scatter4(visible, i, boxFrustum4(planes, center, extent, wScale));
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    for(const std::size_t iMax = ranges.size(); i != iMax; ++i) {
+        if(rangeFrustum(ranges[i], frustum)) visible.set(i);
+        else visible.reset(i);
+    }
+}
+
+void aabbFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Containers::MutableBitArrayView visible) {
+    CORRADE_ASSERT(aabbCenters.size() == aabbExtents.size() && aabbCenters.size() == visible.size(),
+        "Math::Intersection::aabbFrustumInto(): expected center, extent and visible views to have the same size, got" << aabbCenters.size() << Debug::nospace << "," << aabbExtents.size() << "and" << visible.size(), );
+
+    std::size_t i = 0;
+    #if defined(CORRADE_TARGET_SSE2) || defined(CORRADE_TARGET_NEON)
+    const Planes4 planes{frustum};
+    const Float4 wScale = splat4(-1.0f);
+    for(const std::size_t iMax = aabbCenters.size() & ~std::size_t{3}; i != iMax; i += 4) {
+        Float4 center[3], extent[3];
+        gather4(aabbCenters[i], aabbCenters[i + 1], aabbCenters[i + 2], aabbCenters[i + 3], center);
+        gather4(aabbExtents[i], aabbExtents[i + 1], aabbExtents[i + 2], aabbExtents[i + 3], extent);
+        scatter4(visible, i, boxFrustum4(planes, center, extent, wScale));
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    for(const std::size_t iMax = aabbCenters.size(); i != iMax; ++i) {
+        if(aabbFrustum(aabbCenters[i], aabbExtents[i], frustum)) visible.set(i);
+        else visible.reset(i);
+    }
+}
+
+void sphereFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Containers::MutableBitArrayView visible) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size() && sphereCenters.size() == visible.size(),
+        "Math::Intersection::sphereFrustumInto(): expected center, radius and visible views to have the same size, got" << sphereCenters.size() << Debug::nospace << "," << sphereRadii.size() << "and" << visible.size(), );
+
+    std::size_t i = 0;
+    #if defined(CORRADE_TARGET_SSE2) || defined(CORRADE_TARGET_NEON)
+    const Planes4 planes{frustum};
+    const Float4 zero = splat4(0.0f);
+    for(const std::size_t iMax = sphereCenters.size() & ~std::size_t{3}; i != iMax; i += 4) {
+        Float4 center[3];
+        gather4(sphereCenters[i], sphereCenters[i + 1], sphereCenters[i + 2], sphereCenters[i + 3], center);
+        const Float4 radius = set4(sphereRadii[i], sphereRadii[i + 1], sphereRadii[i + 2], sphereRadii[i + 3]);
+        const Float4 negativeRadiusSquared = sub4(zero, mul4(radius, radius));
+
+        /* Same as in sphereFrustum(), i.e. Distance::pointPlaneScaled() */
+        Mask4 culled = none4();
+        for(std::size_t j = 0; j != 6; ++j) {
+            const Float4 d = add4(add4(add4(mul4(center[0], planes.x[j]), mul4(center[1], planes.y[j])), mul4(center[2], planes.z[j])), planes.w[j]);
+            culled = orLess4(culled, d, negativeRadiusSquared);
+        }
+        scatter4(visible, i, bits4(culled));
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    for(const std::size_t iMax = sphereCenters.size(); i != iMax; ++i) {
+        if(sphereFrustum(sphereCenters[i], sphereRadii[i], frustum)) visible.set(i);
+        else visible.reset(i);
+    }
+}
+
+}}}
@@ -35,39 +35,126 @@
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace {
 
-template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.template isContiguous<1>(),
-        "Math::unpackInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.isContiguous<1>(),
-        "Math::unpackInto(): second destination view dimension is not contiguous", );
-
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+/* Calls given row function on each row of the views. The second dimension is
+   contiguous in both, and if the first dimension is as well, the whole data
+   get processed as a single row, giving the SIMD code paths the most room. */
+template<class T, class U, void(*rowFunction)(const T*, U*, std::size_t)> void forEachRow(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst) {
+    if(src.isContiguous() && dst.isContiguous()) {
+        rowFunction(static_cast<const T*>(src.data()), static_cast<U*>(dst.data()), src.size()[0]*src.size()[1]);
+        return;
+    }
 
-    /* Caching values to avoid inline function calls in ebug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
+    /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
     const std::size_t maxJ = src.size()[1];
     for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = *srcPtrI++/bitMax;
+        rowFunction(reinterpret_cast<const T*>(srcPtr), reinterpret_cast<U*>(dstPtr), maxJ);
 
         srcPtr += srcStride;
         dstPtr += dstStride;
     }
 }
 
+#ifdef CORRADE_TARGET_SSE2
+/* Loads eight 8- or 16-bit values and extends them to two vectors of four
+   32-bit integers */
+inline void widen8(const UnsignedByte* src, __m128i& a, __m128i& b) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), zero);
+    a = _mm_unpacklo_epi16(v, zero);
+    b = _mm_unpackhi_epi16(v, zero);
+}
+inline void widen8(const Byte* src, __m128i& a, __m128i& b) {
+    const __m128i v8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    const __m128i v = _mm_srai_epi16(_mm_unpacklo_epi8(v8, v8), 8);
+    a = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    b = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+}
+inline void widen8(const UnsignedShort* src, __m128i& a, __m128i& b) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    a = _mm_unpacklo_epi16(v, zero);
+    b = _mm_unpackhi_epi16(v, zero);
+}
+inline void widen8(const Short* src, __m128i& a, __m128i& b) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    a = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    b = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+}
+
+/* Inverse of the above, saturating values that don't fit. SSE2 has no
+   unsigned 32-to-16-bit pack so it's done by biasing to a signed range and
+   back. */
+inline void narrow8(const __m128i a, const __m128i b, UnsignedByte* dst) {
+    const __m128i v = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(v, v));
+}
+inline void narrow8(const __m128i a, const __m128i b, Byte* dst) {
+    const __m128i v = _mm_packs_epi32(a, b);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(v, v));
+}
+inline void narrow8(const __m128i a, const __m128i b, UnsignedShort* dst) {
+    const __m128i bias = _mm_set1_epi32(0x8000);
+    const __m128i v = _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_xor_si128(v, _mm_set1_epi16(-0x8000)));
+}
+inline void narrow8(const __m128i a, const __m128i b, Short* dst) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(a, b));
+}
+
+/* Converts to an integer with halfway cases rounded away from zero, like
+   std::round() does, as opposed to _mm_cvtps_epi32() that rounds to even */
+inline __m128i roundToInt(const __m128 value) {
+    const __m128i truncated = _mm_cvttps_epi32(value);
+    const __m128 fraction = _mm_sub_ps(value, _mm_cvtepi32_ps(truncated));
+    const __m128 absFraction = _mm_and_ps(fraction, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+    /* -1 for negative values, +1 for positive */
+    const __m128i sign = _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(value), 31), _mm_set1_epi32(1));
+    const __m128i roundAway = _mm_castps_si128(_mm_cmpge_ps(absFraction, _mm_set1_ps(0.5f)));
+    return _mm_add_epi32(truncated, _mm_and_si128(sign, roundAway));
+}
+#endif
+
+template<class T> void unpackUnsignedRow(const T* src, Float* dst, const std::size_t size) {
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    const __m128 bitMax4 = _mm_set1_ps(Implementation::bitMax<T>());
+    for(; i + 8 <= size; i += 8) {
+        __m128i a, b;
+        widen8(src + i, a, b);
+        _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(a), bitMax4));
+        _mm_storeu_ps(dst + i + 4, _mm_div_ps(_mm_cvtepi32_ps(b), bitMax4));
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(; i != size; ++i)
+        dst[i] = src[i]/bitMax;
+}
+
+template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.template isContiguous<1>(),
+        "Math::unpackInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::unpackInto(): second destination view dimension is not contiguous", );
+
+    forEachRow<T, Float, unpackUnsignedRow<T>>(src, dst);
+}
+
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
@@ -80,6 +167,28 @@ void unpackInto(const Containers::StridedArrayView2D<const UnsignedShort>& src,
 
 namespace {
 
+template<class T> void unpackSignedRow(const T* src, Float* dst, const std::size_t size) {
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    const __m128 bitMax4 = _mm_set1_ps(Implementation::bitMax<T>());
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    for(; i + 8 <= size; i += 8) {
+        __m128i a, b;
+        widen8(src + i, a, b);
+        _mm_storeu_ps(dst + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(a), bitMax4), minusOne));
+        _mm_storeu_ps(dst + i + 4, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(b), bitMax4), minusOne));
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(; i != size; ++i) {
+        const Float value = src[i]/bitMax;
+        /* Avoiding a max() call in Debug */
+        dst[i] = value < -1.0f ? -1.0f : value;
+    }
+}
+
 template<class T> inline void unpackSignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -88,28 +197,7 @@ template<class T> inline void unpackSignedIntoImplementation(const Containers::S
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
-    /* Caching values to avoid inline function calls in debug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const Float value = *srcPtrI++/bitMax;
-            /* Avoiding a max() call in Debug */
-            *dstPtrI++ = value < -1.0f ? -1.0f : value;
-        }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    forEachRow<T, Float, unpackSignedRow<T>>(src, dst);
 }
 
 }
@@ -124,6 +212,24 @@ void unpackInto(const Containers::StridedArrayView2D<const Short>& src, const Co
 
 namespace {
 
+template<class T> void packRow(const Float* src, T* dst, const std::size_t size) {
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    const __m128 bitMax4 = _mm_set1_ps(Implementation::bitMax<T>());
+    for(; i + 8 <= size; i += 8) {
+        narrow8(roundToInt(_mm_mul_ps(_mm_loadu_ps(src + i), bitMax4)),
+                roundToInt(_mm_mul_ps(_mm_loadu_ps(src + i + 4), bitMax4)),
+                dst + i);
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(; i != size; ++i)
+        /** @todo provide a version that doesn't do rounding */
+        dst[i] = std::round(src[i]*bitMax);
+}
+
 template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::packInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -132,26 +238,7 @@ template<class T> inline void packIntoImplementation(const Containers::StridedAr
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::packInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
-    /* Caching values to avoid inline function calls in debug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
-        T* dstPtrI = reinterpret_cast<T*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            /** @todo provide a version that doesn't do rounding */
-            *dstPtrI++ = std::round(*srcPtrI++*bitMax);
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    forEachRow<Float, T, packRow<T>>(src, dst);
 }
 
 }
@@ -477,6 +564,50 @@ static_assert(sizeof(HalfMantissaTable) + sizeof(HalfOffsetTable) + sizeof(HalfE
 static_assert(sizeof(HalfBaseTable) + sizeof(HalfShiftTable) == 1536,
     "improper size of float->half conversion tables");
 
+namespace {
+
+void unpackHalfRow(const UnsignedShort* src, Float* dst, const std::size_t size) {
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    /* Same as the scalar unpackHalf(), which gives the same results as the
+       tables, just without any branches */
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i shiftedExp = _mm_set1_epi32(0x7c00 << 13);
+    const __m128i expAdjust = _mm_set1_epi32((127 - 15) << 23);
+    const __m128i infNanExpAdjust = _mm_set1_epi32((128 - 16) << 23);
+    const __m128i denormExpAdjust = _mm_set1_epi32(1 << 23);
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+    const __m128i exponentMantissaMask = _mm_set1_epi32(0x7fff);
+    const __m128i signMask = _mm_set1_epi32(0x8000);
+    for(; i + 8 <= size; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i h[]{_mm_unpacklo_epi16(v, zero),
+                          _mm_unpackhi_epi16(v, zero)};
+        for(std::size_t j = 0; j != 2; ++j) {
+            const __m128i o = _mm_slli_epi32(_mm_and_si128(h[j], exponentMantissaMask), 13);
+            const __m128i exp = _mm_and_si128(o, shiftedExp);
+            const __m128i infNan = _mm_cmpeq_epi32(exp, shiftedExp);
+            const __m128i denorm = _mm_cmpeq_epi32(exp, zero);
+            const __m128i normal = _mm_add_epi32(_mm_add_epi32(o, expAdjust), _mm_and_si128(infNan, infNanExpAdjust));
+            const __m128i renormalized = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(normal, denormExpAdjust)), magic));
+            const __m128i out = _mm_or_si128(
+                _mm_or_si128(_mm_and_si128(denorm, renormalized), _mm_andnot_si128(denorm, normal)),
+                _mm_slli_epi32(_mm_and_si128(h[j], signMask), 16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + j*4), out);
+        }
+    }
+    #endif
+
+    /* Remaining items, or everything if there's no SIMD implementation */
+    UnsignedInt* dstInt = reinterpret_cast<UnsignedInt*>(dst);
+    for(; i != size; ++i) {
+        const UnsignedShort h = src[i];
+        dstInt[i] = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+    }
+}
+
+}
+
 void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -485,25 +616,62 @@ void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& s
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackHalfInto(): second destination view dimension is not contiguous", );
 
-    /* Caching values to avoid inline function calls in debug builds */
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedShort* srcPtrI = reinterpret_cast<const UnsignedShort*>(srcPtr);
-        UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedShort h = *srcPtrI++;
-            *dstPtrI++ = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+    forEachRow<UnsignedShort, Float, unpackHalfRow>(src, dst);
+}
+
+namespace {
+
+void packHalfRow(const Float* src, UnsignedShort* dst, const std::size_t size) {
+    std::size_t i = 0;
+    #ifdef CORRADE_TARGET_SSE2
+    /* Unlike the scalar packHalf(), the tables truncate the mantissa instead
+       of rounding to nearest, and this does the same to be consistent. Normal
+       numbers are just a shift and exponent rebias, denormals are the value
+       scaled by 2^24 and truncated, and everything above the half range is an
+       infinity, or a NaN with the mantissa truncated. All integer compares
+       are signed as the values are without the sign bit. */
+    const __m128i absMask = _mm_set1_epi32(0x7fffffff);
+    const __m128i mantissaMask = _mm_set1_epi32(0x007fffff);
+    const __m128i floatInfinity = _mm_set1_epi32(0x7f800000);
+    const __m128i halfInfinity = _mm_set1_epi32(0x7c00);
+    const __m128i minNormal = _mm_set1_epi32(113 << 23);
+    const __m128i minOverflow = _mm_set1_epi32(143 << 23);
+    const __m128i expAdjust = _mm_set1_epi32(112 << 10);
+    const __m128 denormScale = _mm_set1_ps(16777216.0f);
+    const __m128i signMask = _mm_set1_epi32(0x8000);
+    for(; i + 8 <= size; i += 8) {
+        __m128i h[2];
+        for(std::size_t j = 0; j != 2; ++j) {
+            const __m128i f = _mm_castps_si128(_mm_loadu_ps(src + i + j*4));
+            const __m128i abs = _mm_and_si128(f, absMask);
+            const __m128i normal = _mm_sub_epi32(_mm_srli_epi32(abs, 13), expAdjust);
+            const __m128i denorm = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(abs), denormScale));
+            const __m128i nan = _mm_cmpgt_epi32(abs, floatInfinity);
+            const __m128i infNan = _mm_add_epi32(halfInfinity, _mm_and_si128(nan, _mm_srli_epi32(_mm_and_si128(abs, mantissaMask), 13)));
+            const __m128i isDenorm = _mm_cmplt_epi32(abs, minNormal);
+            const __m128i isNormal = _mm_andnot_si128(isDenorm, _mm_cmplt_epi32(abs, minOverflow));
+            const __m128i isInfNan = _mm_cmpeq_epi32(_mm_or_si128(isDenorm, isNormal), _mm_setzero_si128());
+            const __m128i out = _mm_or_si128(
+                _mm_or_si128(_mm_and_si128(isDenorm, denorm), _mm_and_si128(isNormal, normal)),
+                _mm_and_si128(isInfNan, infNan));
+            /* Sign-extend from 16 bits so the saturating pack below doesn't
+               clamp the values with the sign bit set */
+            h[j] = _mm_srai_epi32(_mm_slli_epi32(_mm_or_si128(out, _mm_and_si128(_mm_srli_epi32(f, 16), signMask)), 16), 16);
         }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(h[0], h[1]));
+    }
+    #endif
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
+    /* Remaining items, or everything if there's no SIMD implementation */
+    const UnsignedInt* srcInt = reinterpret_cast<const UnsignedInt*>(src);
+    for(; i != size; ++i) {
+        const UnsignedInt f = srcInt[i];
+        dst[i] = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
     }
 }
 
+}
+
 void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::packHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
@@ -512,23 +680,7 @@ void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::packHalfInto(): second destination view dimension is not contiguous", );
 
-    /* Caching values to avoid inline function calls in debug builds */
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedInt* srcPtrI = reinterpret_cast<const UnsignedInt*>(srcPtr);
-        UnsignedShort* dstPtrI = reinterpret_cast<UnsignedShort*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedInt f = *srcPtrI++;
-            *dstPtrI++ = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
-        }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    forEachRow<Float, UnsignedShort, packHalfRow>(src, dst);
 }
 
 }}
@@ -43,6 +43,14 @@ namespace Magnum { namespace Math {
 
 These functions process an ubounded range of values, as opposed to single
 vectors or scalars.
+
+On platforms with SSE2, the @ref packInto(), @ref unpackInto(),
+@ref packHalfInto() and @ref unpackHalfInto() functions process eight values
+at a time, giving the same results as the scalar code. For best performance
+make both views contiguous, in which case all data are processed in a single
+run. Otherwise each row is processed separately, which is only beneficial if
+the rows are long enough --- such as image rows, but not three-component
+vertex attributes.
 */
 
 /**
@@ -0,0 +1,209 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct IntersectionBatchTest: TestSuite::Tester {
+    explicit IntersectionBatchTest();
+
+    void rangeFrustum();
+    void aabbFrustum();
+    void sphereFrustum();
+
+    void invalidSize();
+};
+
+using Magnum::Vector3;
+using Magnum::Frustum;
+using Magnum::Range3D;
+
+const Frustum TestFrustum{
+    {1.0f, 0.0f, 0.0f, 0.0f},
+    {-1.0f, 0.0f, 0.0f, 10.0f},
+    {0.0f, 1.0f, 0.0f, 0.0f},
+    {0.0f, -1.0f, 0.0f, 10.0f},
+    {0.0f, 0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, -1.0f, 10.0f}};
+
+/* 15 items, i.e. three groups of four for the SIMD implementation and a
+   remainder of three, going from outside of the frustum on one side, through
+   its interior to the outside on the other side */
+constexpr std::size_t TestCount = 15;
+const struct TestItem {
+    Vector3 center;
+    Vector3 extent;
+} TestData[]{
+    {{-4.0f, 5.0f, 5.0f}, {1.0f, 1.0f, 1.0f}},
+    {{-2.5f, 5.0f, 5.0f}, {3.0f, 0.5f, 0.5f}},
+    {{-1.0f, 4.0f, 6.0f}, {0.5f, 1.0f, 1.0f}},
+    {{0.0f, -1.0f, 5.0f}, {0.5f, 0.5f, 0.5f}},
+    {{1.5f, 5.0f, -0.5f}, {1.0f, 1.0f, 1.0f}},
+    {{3.0f, 5.0f, 5.0f}, {0.1f, 0.1f, 0.1f}},
+    {{5.0f, 5.0f, 5.0f}, {1.0f, 2.0f, 3.0f}},
+    {{6.5f, 12.0f, 5.0f}, {1.0f, 1.0f, 1.0f}},
+    {{7.0f, 5.0f, 5.0f}, {0.5f, 0.5f, 0.5f}},
+    {{8.5f, 10.5f, 5.0f}, {1.0f, 1.0f, 1.0f}},
+    {{10.0f, 5.0f, 5.0f}, {0.5f, 0.5f, 0.5f}},
+    {{11.5f, 5.0f, 5.0f}, {1.0f, 1.0f, 1.0f}},
+    {{12.0f, 5.0f, 5.0f}, {3.0f, 1.0f, 1.0f}},
+    {{5.0f, 5.0f, 10.5f}, {0.1f, 0.1f, 1.0f}},
+    {{5.0f, 5.0f, -20.0f}, {1.0f, 1.0f, 1.0f}},
+};
+
+IntersectionBatchTest::IntersectionBatchTest() {
+    addTests({&IntersectionBatchTest::rangeFrustum,
+              &IntersectionBatchTest::aabbFrustum,
+              &IntersectionBatchTest::sphereFrustum,
+
+              &IntersectionBatchTest::invalidSize});
+}
+
+void IntersectionBatchTest::rangeFrustum() {
+    Range3D ranges[TestCount];
+    for(std::size_t i = 0; i != TestCount; ++i)
+        ranges[i] = Range3D::fromCenter(TestData[i].center, TestData[i].extent);
+
+    /* Using an offset view to verify the bits get put at correct places and
+       the bits around stay untouched */
+    Containers::BitArray storage{DirectInit, TestCount + 6, true};
+    Containers::MutableBitArrayView visible = storage.sliceSize(3, TestCount);
+    Intersection::rangeFrustumInto(ranges, TestFrustum, visible);
+
+    CORRADE_VERIFY(storage[0]);
+    CORRADE_VERIFY(storage[1]);
+    CORRADE_VERIFY(storage[2]);
+    for(std::size_t i = 0; i != TestCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible[i], Intersection::rangeFrustum(ranges[i], TestFrustum));
+    }
+    CORRADE_VERIFY(storage[TestCount + 3]);
+    CORRADE_VERIFY(storage[TestCount + 4]);
+    CORRADE_VERIFY(storage[TestCount + 5]);
+
+    /* Spot-check a few values so the test doesn't pass just because both the
+       scalar and the batch variant are broken */
+    CORRADE_VERIFY(!visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(visible[6]);
+    CORRADE_VERIFY(!visible[7]);
+    CORRADE_VERIFY(!visible[14]);
+}
+
+void IntersectionBatchTest::aabbFrustum() {
+    Containers::BitArray storage{DirectInit, TestCount + 6, false};
+    Containers::MutableBitArrayView visible = storage.sliceSize(3, TestCount);
+    Intersection::aabbFrustumInto(
+        Containers::stridedArrayView(TestData).slice(&TestItem::center),
+        Containers::stridedArrayView(TestData).slice(&TestItem::extent),
+        TestFrustum, visible);
+
+    CORRADE_VERIFY(!storage[0]);
+    CORRADE_VERIFY(!storage[1]);
+    CORRADE_VERIFY(!storage[2]);
+    for(std::size_t i = 0; i != TestCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible[i], Intersection::aabbFrustum(TestData[i].center, TestData[i].extent, TestFrustum));
+    }
+    CORRADE_VERIFY(!storage[TestCount + 3]);
+    CORRADE_VERIFY(!storage[TestCount + 4]);
+    CORRADE_VERIFY(!storage[TestCount + 5]);
+
+    CORRADE_VERIFY(!visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(visible[6]);
+    CORRADE_VERIFY(!visible[7]);
+    CORRADE_VERIFY(!visible[14]);
+}
+
+void IntersectionBatchTest::sphereFrustum() {
+    Vector3 centers[TestCount];
+    Float radii[TestCount];
+    for(std::size_t i = 0; i != TestCount; ++i) {
+        centers[i] = TestData[i].center;
+        radii[i] = TestData[i].extent.x();
+    }
+
+    Containers::BitArray storage{DirectInit, TestCount + 6, true};
+    Containers::MutableBitArrayView visible = storage.sliceSize(3, TestCount);
+    Intersection::sphereFrustumInto(centers, radii, TestFrustum, visible);
+
+    CORRADE_VERIFY(storage[0]);
+    CORRADE_VERIFY(storage[1]);
+    CORRADE_VERIFY(storage[2]);
+    for(std::size_t i = 0; i != TestCount; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible[i], Intersection::sphereFrustum(centers[i], radii[i], TestFrustum));
+    }
+    CORRADE_VERIFY(storage[TestCount + 3]);
+    CORRADE_VERIFY(storage[TestCount + 4]);
+    CORRADE_VERIFY(storage[TestCount + 5]);
+
+    CORRADE_VERIFY(!visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(visible[6]);
+    CORRADE_VERIFY(!visible[7]);
+    CORRADE_VERIFY(!visible[14]);
+}
+
+void IntersectionBatchTest::invalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Range3D ranges[3];
+    Vector3 centers[3];
+    Vector3 extents[3];
+    Vector3 extentsWrongSize[2];
+    Float radii[3];
+    Float radiiWrongSize[2];
+    Containers::BitArray visible{ValueInit, 3};
+    Containers::BitArray visibleWrongSize{ValueInit, 2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Intersection::rangeFrustumInto(ranges, TestFrustum, visibleWrongSize);
+    Intersection::aabbFrustumInto(centers, extentsWrongSize, TestFrustum, visible);
+    Intersection::aabbFrustumInto(centers, extents, TestFrustum, visibleWrongSize);
+    Intersection::sphereFrustumInto(centers, radiiWrongSize, TestFrustum, visible);
+    Intersection::sphereFrustumInto(centers, radii, TestFrustum, visibleWrongSize);
+    CORRADE_COMPARE(out,
+        "Math::Intersection::rangeFrustumInto(): expected ranges and visible views to have the same size, got 3 and 2\n"
+        "Math::Intersection::aabbFrustumInto(): expected center, extent and visible views to have the same size, got 3, 2 and 3\n"
+        "Math::Intersection::aabbFrustumInto(): expected center, extent and visible views to have the same size, got 3, 3 and 2\n"
+        "Math::Intersection::sphereFrustumInto(): expected center, radius and visible views to have the same size, got 3, 2 and 3\n"
+        "Math::Intersection::sphereFrustumInto(): expected center, radius and visible views to have the same size, got 3, 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBatchTest)
@@ -26,10 +26,15 @@
 */
 
 #include <random>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayViewStl.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -102,10 +107,15 @@ struct IntersectionBenchmark: TestSuite::Tester {
 
     void rangeFrustumNaive();
     void rangeFrustum();
+    void rangeFrustumBatch();
+
+    void aabbFrustum();
+    void aabbFrustumBatch();
 
     void rangeCone();
 
     void sphereFrustum();
+    void sphereFrustumBatch();
 
     void sphereConeNaive();
     void sphereCone();
@@ -121,15 +131,26 @@ struct IntersectionBenchmark: TestSuite::Tester {
 
     std::vector<Range3D> _boxes;
     std::vector<Vector4> _spheres;
+
+    /* Separate center, extent and radius views for the batch variants */
+    Containers::Array<Vector3> _centers;
+    Containers::Array<Vector3> _extents;
+    Containers::Array<Float> _radii;
+    Containers::BitArray _visible;
 };
 
 IntersectionBenchmark::IntersectionBenchmark() {
     addBenchmarks({&IntersectionBenchmark::rangeFrustumNaive,
                    &IntersectionBenchmark::rangeFrustum,
+                   &IntersectionBenchmark::rangeFrustumBatch,
+
+                   &IntersectionBenchmark::aabbFrustum,
+                   &IntersectionBenchmark::aabbFrustumBatch,
 
                    &IntersectionBenchmark::rangeCone,
 
                    &IntersectionBenchmark::sphereFrustum,
+                   &IntersectionBenchmark::sphereFrustumBatch,
 
                    &IntersectionBenchmark::sphereConeNaive,
                    &IntersectionBenchmark::sphereCone,
@@ -151,11 +172,18 @@ IntersectionBenchmark::IntersectionBenchmark() {
 
     _boxes.reserve(512);
     _spheres.reserve(512);
+    _centers = Containers::Array<Vector3>{NoInit, 512};
+    _extents = Containers::Array<Vector3>{NoInit, 512};
+    _radii = Containers::Array<Float>{NoInit, 512};
+    _visible = Containers::BitArray{NoInit, 512};
     for(int i = 0; i < 512; ++i) {
         Vector3 center{pd(g), pd(g), pd(g)};
         Vector3 extents{pd(g), pd(g), pd(g)};
         _boxes.emplace_back(center - extents, center + extents);
         _spheres.emplace_back(center, extents.length());
+        _centers[i] = center;
+        _extents[i] = Math::abs(extents);
+        _radii[i] = extents.length();
     }
 }
 
@@ -173,6 +201,25 @@ void IntersectionBenchmark::rangeFrustum() {
     }
 }
 
+void IntersectionBenchmark::rangeFrustumBatch() {
+    CORRADE_BENCHMARK(50) {
+        Intersection::rangeFrustumInto(_boxes, _frustum, _visible);
+    }
+}
+
+void IntersectionBenchmark::aabbFrustum() {
+    volatile bool b = false;
+    CORRADE_BENCHMARK(50) for(std::size_t i = 0; i != _centers.size(); ++i) {
+        b = b ^ Intersection::aabbFrustum(_centers[i], _extents[i], _frustum);
+    }
+}
+
+void IntersectionBenchmark::aabbFrustumBatch() {
+    CORRADE_BENCHMARK(50) {
+        Intersection::aabbFrustumInto(_centers, _extents, _frustum, _visible);
+    }
+}
+
 void IntersectionBenchmark::rangeCone() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
@@ -191,6 +238,12 @@ void IntersectionBenchmark::sphereFrustum() {
     }
 }
 
+void IntersectionBenchmark::sphereFrustumBatch() {
+    CORRADE_BENCHMARK(50) {
+        Intersection::sphereFrustumInto(_centers, _radii, _frustum, _visible);
+    }
+}
+
 void IntersectionBenchmark::sphereConeNaive() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) for(auto& sphere: _spheres) {
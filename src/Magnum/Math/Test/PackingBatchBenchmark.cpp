@@ -0,0 +1,204 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+/* Each benchmark processes Count values, i.e. 1 MB of floats on one side. To
+   get a GB/s figure, divide the sum of source and destination size by the
+   measured time. The Interleaved variants operate on three-component
+   attributes that are spread over a larger struct, which is the typical case
+   of a vertex buffer and can't be processed in one contiguous run. */
+enum: std::size_t { Count = 256*1024 };
+
+struct PackingBatchBenchmark: TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    template<class T> void unpack();
+    template<class T> void unpackInterleaved();
+    template<class T> void pack();
+    template<class T> void packInterleaved();
+    void unpackHalf();
+    void unpackHalfInterleaved();
+    void packHalf();
+    void packHalfInterleaved();
+};
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addBenchmarks({
+        &PackingBatchBenchmark::unpack<UnsignedByte>,
+        &PackingBatchBenchmark::unpack<UnsignedShort>,
+        &PackingBatchBenchmark::unpack<Byte>,
+        &PackingBatchBenchmark::unpack<Short>,
+        &PackingBatchBenchmark::unpackInterleaved<UnsignedByte>,
+        &PackingBatchBenchmark::unpackInterleaved<UnsignedShort>,
+        &PackingBatchBenchmark::unpackInterleaved<Byte>,
+        &PackingBatchBenchmark::unpackInterleaved<Short>,
+        &PackingBatchBenchmark::pack<UnsignedByte>,
+        &PackingBatchBenchmark::pack<UnsignedShort>,
+        &PackingBatchBenchmark::pack<Byte>,
+        &PackingBatchBenchmark::pack<Short>,
+        &PackingBatchBenchmark::packInterleaved<UnsignedByte>,
+        &PackingBatchBenchmark::packInterleaved<UnsignedShort>,
+        &PackingBatchBenchmark::packInterleaved<Byte>,
+        &PackingBatchBenchmark::packInterleaved<Short>,
+        &PackingBatchBenchmark::unpackHalf,
+        &PackingBatchBenchmark::unpackHalfInterleaved,
+        &PackingBatchBenchmark::packHalf,
+        &PackingBatchBenchmark::packHalfInterleaved}, 10);
+}
+
+using Magnum::Vector3;
+
+template<class T> struct Vertex {
+    Math::Vector3<T> value;
+    Vector3 normal;
+    Vector3 other;
+};
+
+template<class T> void PackingBatchBenchmark::unpack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<T> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = T(i*0x9e3779b1u);
+    Containers::Array<Float> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(10)
+        unpackInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+
+    CORRADE_COMPARE(dst[Count - 1], Math::unpack<Float>(src[Count - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::unpackInterleaved() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Vertex<T>> src{ValueInit, Count/3};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i].value = Math::Vector3<T>{T(i*0x9e3779b1u)};
+    Containers::Array<Vertex<Float>> dst{ValueInit, Count/3};
+
+    CORRADE_BENCHMARK(10)
+        unpackInto(
+            Containers::stridedArrayView(src).slice(&Vertex<T>::value).slice(&Math::Vector3<T>::data),
+            Containers::stridedArrayView(dst).slice(&Vertex<Float>::value).slice(&Vector3::data));
+
+    CORRADE_COMPARE(dst.back().value, Math::unpack<Vector3>(src.back().value));
+}
+
+template<class T> void PackingBatchBenchmark::pack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Float> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = Float(i % 1000)/1000.0f;
+    Containers::Array<T> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(10)
+        packInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+
+    CORRADE_COMPARE(dst[Count - 1], Math::pack<T>(src[Count - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::packInterleaved() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Vertex<Float>> src{ValueInit, Count/3};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i].value = Vector3{Float(i % 1000)/1000.0f};
+    Containers::Array<Vertex<T>> dst{ValueInit, Count/3};
+
+    CORRADE_BENCHMARK(10)
+        packInto(
+            Containers::stridedArrayView(src).slice(&Vertex<Float>::value).slice(&Vector3::data),
+            Containers::stridedArrayView(dst).slice(&Vertex<T>::value).slice(&Math::Vector3<T>::data));
+
+    CORRADE_COMPARE(dst.back().value, Math::pack<Math::Vector3<T>>(src.back().value));
+}
+
+void PackingBatchBenchmark::unpackHalf() {
+    Containers::Array<UnsignedShort> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = UnsignedShort(i*0x9e3779b1u);
+    Containers::Array<Float> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(10)
+        unpackHalfInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+
+    CORRADE_COMPARE(dst[Count - 1], Math::unpackHalf(src[Count - 1]));
+}
+
+void PackingBatchBenchmark::unpackHalfInterleaved() {
+    Containers::Array<Vertex<UnsignedShort>> src{ValueInit, Count/3};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i].value = Vector3us{UnsignedShort(0x3c00 + i % 1000)};
+    Containers::Array<Vertex<Float>> dst{ValueInit, Count/3};
+
+    CORRADE_BENCHMARK(10)
+        unpackHalfInto(
+            Containers::stridedArrayView(src).slice(&Vertex<UnsignedShort>::value).slice(&Vector3us::data),
+            Containers::stridedArrayView(dst).slice(&Vertex<Float>::value).slice(&Vector3::data));
+
+    CORRADE_COMPARE(dst.back().value, Math::unpackHalf(src.back().value));
+}
+
+void PackingBatchBenchmark::packHalf() {
+    Containers::Array<Float> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = Float(i % 1000)/1000.0f;
+    Containers::Array<UnsignedShort> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(10)
+        packHalfInto(Containers::stridedArrayView(src), Containers::stridedArrayView(dst));
+
+    /* The batch API truncates the mantissa instead of rounding, so the result
+       isn't compared to Math::packHalf() */
+    CORRADE_COMPARE(dst[Count - 1], UnsignedShort(0x3093));
+}
+
+void PackingBatchBenchmark::packHalfInterleaved() {
+    Containers::Array<Vertex<Float>> src{ValueInit, Count/3};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i].value = Vector3{Float(i % 1000)/1000.0f};
+    Containers::Array<Vertex<UnsignedShort>> dst{ValueInit, Count/3};
+
+    CORRADE_BENCHMARK(10)
+        packHalfInto(
+            Containers::stridedArrayView(src).slice(&Vertex<Float>::value).slice(&Vector3::data),
+            Containers::stridedArrayView(dst).slice(&Vertex<UnsignedShort>::value).slice(&Vector3us::data));
+
+    CORRADE_COMPARE(dst.back().value, Vector3us{0x3614});
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
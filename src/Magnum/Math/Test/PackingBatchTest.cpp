@@ -51,6 +51,11 @@ struct PackingBatchTest: TestSuite::Tester {
     void unpackHalf();
     void packHalf();
 
+    template<class T> void unpackContiguous();
+    template<class T> void packContiguous();
+    void unpackHalfContiguous();
+    void packHalfContiguous();
+
     template<class FloatingPoint, class Integral> void castUnsignedFloatingPoint();
     template<class FloatingPoint, class Integral> void castSignedFloatingPoint();
 
@@ -76,6 +81,17 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
 
+              &PackingBatchTest::unpackContiguous<UnsignedByte>,
+              &PackingBatchTest::unpackContiguous<UnsignedShort>,
+              &PackingBatchTest::unpackContiguous<Byte>,
+              &PackingBatchTest::unpackContiguous<Short>,
+              &PackingBatchTest::packContiguous<UnsignedByte>,
+              &PackingBatchTest::packContiguous<UnsignedShort>,
+              &PackingBatchTest::packContiguous<Byte>,
+              &PackingBatchTest::packContiguous<Short>,
+              &PackingBatchTest::unpackHalfContiguous,
+              &PackingBatchTest::packHalfContiguous,
+
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedByte>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedShort>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedInt>,
@@ -484,6 +500,117 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+/* The contiguous tests use 19 items, which is two groups of eight for the SIMD
+   code paths plus a remainder. The results are compared to the same data
+   processed with every second item skipped, which goes one item at a time and
+   thus never hits the SIMD code. */
+
+template<class T> void PackingBatchTest::unpackContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    T src[19];
+    T srcStrided[19*2]{};
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        src[i] = srcStrided[i*2] = T((i*0x9e3779b1u) >> 16);
+
+    Float dst[19];
+    Float dstStrided[19*2];
+    unpackInto(Containers::stridedArrayView(src),
+               Containers::stridedArrayView(dst));
+    unpackInto(Containers::stridedArrayView(srcStrided).every(2),
+               Containers::stridedArrayView(dstStrided).every(2));
+
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], dstStrided[i*2]);
+        CORRADE_COMPARE(dst[i], Math::unpack<Float>(src[i]));
+    }
+}
+
+template<class T> void PackingBatchTest::packContiguous() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* Values in the [-1, 1] or [0, 1] range, including cases exactly halfway
+       between two integers that are rounded away from zero */
+    const Float min = std::is_signed<T>::value ? -1.0f : 0.0f;
+    Float src[19];
+    Float srcStrided[19*2]{};
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        src[i] = srcStrided[i*2] = i % 3 == 0 ?
+            (Float(i*Implementation::bitMax<T>()/19) + 0.5f)/Implementation::bitMax<T>() :
+            min + (1.0f - min)*i/18.0f;
+
+    T dst[19];
+    T dstStrided[19*2];
+    packInto(Containers::stridedArrayView(src),
+             Containers::stridedArrayView(dst));
+    packInto(Containers::stridedArrayView(srcStrided).every(2),
+             Containers::stridedArrayView(dstStrided).every(2));
+
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], dstStrided[i*2]);
+        CORRADE_COMPARE(dst[i], Math::pack<T>(src[i]));
+    }
+}
+
+void PackingBatchTest::unpackHalfContiguous() {
+    /* Zeros, denormals, normals, infinities and NaNs of both signs */
+    const UnsignedShort src[]{
+        0x0000, 0x8000, 0x0001, 0x83ff, 0x0400, 0x3c00, 0x7bff, 0xfbff,
+        0x7c00, 0xfc00, 0x7e00, 0xfc01, 0x3555, 0xc000, 0x57bc, 0x8dc2,
+        0x03ff, 0x4200, 0x1234
+    };
+    UnsignedShort srcStrided[19*2]{};
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        srcStrided[i*2] = src[i];
+
+    Float dst[19];
+    Float dstStrided[19*2];
+    unpackHalfInto(Containers::stridedArrayView(src),
+                   Containers::stridedArrayView(dst));
+    unpackHalfInto(Containers::stridedArrayView(srcStrided).every(2),
+                   Containers::stridedArrayView(dstStrided).every(2));
+
+    /* Comparing bit patterns so NaNs are checked as well */
+    Float expected[19];
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        expected[i] = Math::unpackHalf(src[i]);
+    CORRADE_COMPARE_AS(
+        Containers::arrayCast<const UnsignedInt>(Containers::stridedArrayView(dst)),
+        Containers::arrayCast<const UnsignedInt>(Containers::stridedArrayView(dstStrided).every(2)),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(
+        Containers::arrayCast<const UnsignedInt>(Containers::stridedArrayView(dst)),
+        Containers::arrayCast<const UnsignedInt>(Containers::stridedArrayView(expected)),
+        TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::packHalfContiguous() {
+    /* Zeros, denormals, normals, values that overflow, infinities and NaNs
+       of both signs */
+    const Float src[]{
+        0.0f, -0.0f, 1.0f, -2.0f, 65504.0f, 65520.0f, 1.0e6f, -1.0e6f,
+        Constants::inf(), -Constants::inf(), Constants::nan(), 5.96e-8f,
+        1.0e-8f, 6.1e-5f, 0.1f, 123.75f, -0.000351512f, 3.0e-5f, 1.0f/3.0f
+    };
+    Float srcStrided[19*2]{};
+    for(std::size_t i = 0; i != Containers::arraySize(src); ++i)
+        srcStrided[i*2] = src[i];
+
+    UnsignedShort dst[19];
+    UnsignedShort dstStrided[19*2];
+    packHalfInto(Containers::stridedArrayView(src),
+                 Containers::stridedArrayView(dst));
+    packHalfInto(Containers::stridedArrayView(srcStrided).every(2),
+                 Containers::stridedArrayView(dstStrided).every(2));
+
+    CORRADE_COMPARE_AS(
+        Containers::stridedArrayView(dst),
+        Containers::stridedArrayView(dstStrided).every(2),
+        TestSuite::Compare::Container);
+}
+
 template<class FloatingPoint, class Integral> void PackingBatchTest::castUnsignedFloatingPoint() {
     setTestCaseTemplateName({TypeTraits<FloatingPoint>::name(), TypeTraits<Integral>::name()});
 
@@ -30,6 +30,7 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 
@@ -63,57 +64,12 @@ namespace {
 using namespace Math::Literals;
 #endif
 
-template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    CORRADE_ASSERT(indices.size() % 3 == 0,
-        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
-    CORRADE_ASSERT(normals.size() == positions.size(),
-        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
-
-    if(indices.isEmpty()) return;
-
-    /* Gather count of triangles for every vertex. This abuses the output
-       storage to avoid extra allocations, zero-initialize it first to avoid
-       random memory getting used. */
-    Containers::StridedArrayView1D<UnsignedInt> triangleCount =
-        Containers::arrayCast<UnsignedInt>(normals);
-    for(UnsignedInt& i: triangleCount) i = 0;
-    for(const T index: indices) {
-        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of range for" << positions.size() << "elements", );
-        ++triangleCount[index];
-    }
-
-    /* Turn that into a running offset array:
-       triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
-       triangleOffset[i] is offset into an triangle ID array for vertex i */
-    Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
-    triangleOffset[0] = 0;
-    for(std::size_t i = 0; i != triangleCount.size(); ++i)
-        triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i];
-
-    CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
-
-    /* Gather triangle IDs for every vertex. For vertex i,
-       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
-       contains IDs of triangles that contain it. */
-    Containers::Array<T> triangleIds{NoInit, indices.size()};
-    for(std::size_t i = 0; i != indices.size(); ++i) {
-        const T triangleId = i/3;
-        const T vertexId = indices[i];
-
-        /* How many triangle IDs is still left to be written, which also means
-           the offset where we put the ID. Decrement that for the next run. */
-        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
-        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
-    }
-
-    /* Now, triangleCount should be all zeros, we don't need it anymore and the
-       underlying `normals` array is ready to get filled with real output. */
-
-    /* Precalculate cross product and interior angles of each face --- the loop
-       below would otherwise calculate it for every vertex, which is at least
-       3x as much work */
-    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
+/* Precalculates cross product and interior angles of faces in the
+   [begin, end) range --- the per-vertex loop in accumulateSmoothNormals()
+   would otherwise calculate it for every vertex, which is at least 3x as much
+   work */
+template<class T> void calculateCrossAngles(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
         const Vector3 v0 = positions[indices[i*3 + 0]];
         const Vector3 v1 = positions[indices[i*3 + 1]];
         const Vector3 v2 = positions[indices[i*3 + 2]];
@@ -147,16 +103,20 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
         crossAngles[i].second()[2] = Rad(180.0_degf)
             - crossAngles[i].second()[0] - crossAngles[i].second()[1];
     }
+}
 
-    /* For every vertex v, calculate normals from all faces it belongs to and
-       average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
+/* For every vertex v in the [begin, end) range, calculate normals from all
+   faces it belongs to and average them. Each vertex only gathers from the
+   adjacency and writes its own output, so disjoint ranges can be processed in
+   parallel. */
+template<class T> void accumulateSmoothNormals(const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<const UnsignedInt> triangleOffset, const Containers::ArrayView<const UnsignedInt> triangleIds, const Containers::ArrayView<const Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles, const Containers::StridedArrayView1D<Vector3>& normals, const std::size_t begin, const std::size_t end) {
+    for(std::size_t v = begin; v != end; ++v) {
         /* normals are an external memory, ensure we accumulate from zero */
         normals[v] = Vector3{Math::ZeroInit};
 
         /* Go through all triangles sharing this vertex */
         for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
+            const std::size_t baseIndex = std::size_t(triangleIds[t])*3;
             const T v0i = indices[baseIndex + 0];
             const T v1i = indices[baseIndex + 1];
             const T v2i = indices[baseIndex + 2];
@@ -189,38 +149,226 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
     }
 }
 
+template<class T> void generateSmoothNormalsIntoImplementationSerial(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+    /* Gather count of triangles for every vertex. This abuses the output
+       storage to avoid extra allocations, zero-initialize it first to avoid
+       random memory getting used. */
+    Containers::StridedArrayView1D<UnsignedInt> triangleCount =
+        Containers::arrayCast<UnsignedInt>(normals);
+    for(UnsignedInt& i: triangleCount) i = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of range for" << positions.size() << "elements", );
+        ++triangleCount[index];
+    }
+
+    /* Turn that into a running offset array:
+       triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
+       triangleOffset[i] is offset into an triangle ID array for vertex i */
+    Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
+    triangleOffset[0] = 0;
+    for(std::size_t i = 0; i != triangleCount.size(); ++i)
+        triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i];
+
+    CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
+
+    /* Gather triangle IDs for every vertex. For vertex i,
+       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
+       contains IDs of triangles that contain it. The IDs are always 32-bit,
+       as with 8- and 16-bit indices the triangle count can be larger than
+       what the index type can represent. */
+    Containers::Array<UnsignedInt> triangleIds{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt triangleId = i/3;
+        const T vertexId = indices[i];
+
+        /* How many triangle IDs is still left to be written, which also means
+           the offset where we put the ID. Decrement that for the next run. */
+        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
+        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
+    }
+
+    /* Now, triangleCount should be all zeros, we don't need it anymore and the
+       underlying `normals` array is ready to get filled with real output. */
+
+    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
+    calculateCrossAngles(indices, positions, crossAngles, 0, crossAngles.size());
+    accumulateSmoothNormals(indices, triangleOffset, triangleIds, crossAngles, normals, 0, positions.size());
+}
+
+/* Builds the same vertex -> triangle adjacency as the serial variant, i.e.
+   with triangle IDs for each vertex in ascending order, so the accumulation
+   happens in the same order and the output is bit-identical. Index chunks
+   first distribute (vertex, triangle) pairs into per-thread vertex ranges,
+   preserving their order, and each vertex range is then turned into its part
+   of the adjacency with a counting sort. */
+template<class T> void generateSmoothNormalsIntoImplementationParallel(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const std::size_t threadCount) {
+    const std::size_t indexCount = indices.size();
+    const std::size_t vertexCount = positions.size();
+
+    /* Find the first out-of-range index in each chunk to be able to report
+       the same index as the serial variant */
+    #ifndef CORRADE_NO_ASSERT
+    {
+        Containers::Array<std::size_t> outOfRange{DirectInit, threadCount, ~std::size_t{}};
+        Magnum::Implementation::parallelFor(threadCount, indexCount, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) if(indices[i] >= vertexCount) {
+                outOfRange[chunk] = i;
+                break;
+            }
+        });
+        for(const std::size_t i: outOfRange)
+            CORRADE_ASSERT(i == ~std::size_t{}, "MeshTools::generateSmoothNormalsInto(): index" << indices[i] << "out of range for" << vertexCount << "elements", );
+    }
+    #endif
+
+    /* Vertex range assigned to each thread. A vertex v belongs to range
+       v*threadCount/vertexCount, which means range r starts at the first v
+       for which that's r. */
+    const auto vertexRange = [threadCount, vertexCount](const std::size_t v) {
+        return std::size_t(UnsignedLong(v)*threadCount/vertexCount);
+    };
+    const auto vertexRangeBegin = [threadCount, vertexCount](const std::size_t range) {
+        return std::size_t((UnsignedLong(range)*vertexCount + threadCount - 1)/threadCount);
+    };
+
+    /* Count how many indices in each chunk fall into each vertex range, then
+       turn that into offsets ordered by range first and chunk second */
+    Containers::Array<std::size_t> offsets{ValueInit, threadCount*threadCount};
+    Magnum::Implementation::parallelFor(threadCount, indexCount, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        std::size_t* const chunkOffsets = offsets.data() + chunk*threadCount;
+        for(std::size_t i = begin; i != end; ++i)
+            ++chunkOffsets[vertexRange(indices[i])];
+    });
+    Containers::Array<std::size_t> rangeOffsets{NoInit, threadCount + 1};
+    {
+        std::size_t offset = 0;
+        for(std::size_t range = 0; range != threadCount; ++range) {
+            rangeOffsets[range] = offset;
+            for(std::size_t chunk = 0; chunk != threadCount; ++chunk) {
+                std::size_t& count = offsets[chunk*threadCount + range];
+                const std::size_t next = offset + count;
+                count = offset;
+                offset = next;
+            }
+        }
+        rangeOffsets[threadCount] = offset;
+        CORRADE_INTERNAL_ASSERT(offset == indexCount);
+    }
+
+    /* Distribute the (vertex, triangle) pairs into the ranges */
+    Containers::Array<UnsignedInt> pairVertices{NoInit, indexCount};
+    Containers::Array<UnsignedInt> pairTriangles{NoInit, indexCount};
+    Magnum::Implementation::parallelFor(threadCount, indexCount, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        std::size_t* const chunkOffsets = offsets.data() + chunk*threadCount;
+        for(std::size_t i = begin; i != end; ++i) {
+            const std::size_t offset = chunkOffsets[vertexRange(indices[i])]++;
+            pairVertices[offset] = UnsignedInt(indices[i]);
+            pairTriangles[offset] = UnsignedInt(i/3);
+        }
+    });
+
+    /* Counting sort of each range into the final adjacency. Same as in the
+       serial variant, the output storage is abused for per-vertex counts and
+       then write cursors, each thread touches only its own vertex range.
+       Thread for range r fills triangleOffset[v + 1] for all v in the range,
+       so there's no overlap between threads. */
+    Containers::Array<UnsignedInt> triangleOffset{NoInit, vertexCount + 1};
+    triangleOffset[0] = 0;
+    Containers::Array<UnsignedInt> triangleIds{NoInit, indexCount};
+    const Containers::StridedArrayView1D<UnsignedInt> cursors =
+        Containers::arrayCast<UnsignedInt>(normals);
+    Magnum::Implementation::parallelFor(threadCount, threadCount, [&](const std::size_t range, std::size_t, std::size_t) {
+        const std::size_t vertexBegin = vertexRangeBegin(range);
+        const std::size_t vertexEnd = vertexRangeBegin(range + 1);
+        const std::size_t pairBegin = rangeOffsets[range];
+        const std::size_t pairEnd = rangeOffsets[range + 1];
+
+        for(std::size_t v = vertexBegin; v != vertexEnd; ++v)
+            cursors[v] = 0;
+        for(std::size_t i = pairBegin; i != pairEnd; ++i)
+            ++cursors[pairVertices[i]];
+
+        UnsignedInt offset = UnsignedInt(pairBegin);
+        for(std::size_t v = vertexBegin; v != vertexEnd; ++v) {
+            triangleOffset[v + 1] = offset + cursors[v];
+            cursors[v] = offset;
+            offset = triangleOffset[v + 1];
+        }
+
+        for(std::size_t i = pairBegin; i != pairEnd; ++i)
+            triangleIds[cursors[pairVertices[i]]++] = pairTriangles[i];
+    });
+
+    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indexCount/3};
+    Magnum::Implementation::parallelFor(threadCount, crossAngles.size(), [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        calculateCrossAngles(indices, positions, crossAngles, begin, end);
+    });
+    Magnum::Implementation::parallelFor(threadCount, vertexCount, [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        accumulateSmoothNormals(indices, triangleOffset, triangleIds, crossAngles, normals, begin, end);
+    });
+}
+
+template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, UnsignedInt threadCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+
+    if(indices.isEmpty()) return;
+
+    threadCount = Magnum::Implementation::parallelForThreadCount(threadCount);
+    if(threadCount == 1)
+        generateSmoothNormalsIntoImplementationSerial(indices, positions, normals);
+    else
+        generateSmoothNormalsIntoImplementationParallel(indices, positions, normals, threadCount);
+}
+
 }
 
 /* If not done this way but with templates instead, C++ wouldn't be able to
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, 1);
 }
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, 1);
 }
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, 1);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, threadCount);
 }
 
 void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+    generateSmoothNormalsInto(indices, positions, normals, 1);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const UnsignedInt threadCount) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateSmoothNormalsInto(): second index view dimension is not contiguous", );
     if(indices.size()[1] == 4)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, threadCount);
     else if(indices.size()[1] == 2)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, threadCount);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, threadCount);
     }
 }
 
 namespace {
 
-template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
     Containers::Array<Vector3> out{NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, threadCount);
     return out;
 }
 
@@ -230,18 +378,32 @@ template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImpleme
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, 1);
 }
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, 1);
 }
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, 1);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    return generateSmoothNormalsImplementation(indices, positions, threadCount);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    return generateSmoothNormalsImplementation(indices, positions, threadCount);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
+    return generateSmoothNormalsImplementation(indices, positions, threadCount);
 }
 
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    return generateSmoothNormals(indices, positions, 1);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt threadCount) {
     Containers::Array<Vector3> out{NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, threadCount);
     return out;
 }
 
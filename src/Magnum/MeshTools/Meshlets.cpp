@@ -0,0 +1,277 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Meshlets.h"
+
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Bounding sphere and normal cone, as described in the documentation of
+   Meshlet and isMeshletBackfacing(). Cone calculation taken from
+   meshoptimizer. */
+void calculateBounds(Meshlet& meshlet, const Containers::ArrayView<const UnsignedInt> vertices, const Containers::ArrayView<const UnsignedByte> triangles, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<Vector3> positionScratch, const Containers::ArrayView<Vector3> normalScratch) {
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        positionScratch[i] = positions[vertices[i]];
+    const Containers::Pair<Vector3, Float> sphere = boundingSphereBouncingBubble(positionScratch.prefix(vertices.size()));
+    meshlet.center = sphere.first();
+    meshlet.radius = sphere.second();
+
+    std::size_t normalCount = 0;
+    Vector3 axis;
+    for(std::size_t i = 0; i != triangles.size(); i += 3) {
+        const Vector3 a = positionScratch[triangles[i + 0]];
+        const Vector3 b = positionScratch[triangles[i + 1]];
+        const Vector3 c = positionScratch[triangles[i + 2]];
+        const Vector3 cross = Math::cross(b - a, c - a);
+        const Float length = cross.length();
+        /* Triangles with zero area don't face anywhere */
+        if(!length) continue;
+        const Vector3 normal = cross/length;
+        normalScratch[normalCount++] = normal;
+        axis += normal;
+    }
+
+    const Float axisLength = axis.length();
+    Float minDot = 1.0f;
+    if(axisLength) {
+        axis /= axisLength;
+        for(std::size_t i = 0; i != normalCount; ++i)
+            minDot = Math::min(minDot, Math::dot(axis, normalScratch[i]));
+    } else minDot = 0.0f;
+
+    meshlet.coneAxis = axis;
+    /* If the normals span a hemisphere or more, the meshlet can be seen from
+       any direction. With the cutoff being 1 the test in
+       isMeshletBackfacing() never passes. */
+    meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : Math::sqrt(1.0f - minDot*minDot);
+}
+
+template<class T> Meshlets buildMeshletsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::buildMeshlets(): index count not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256,
+        "MeshTools::buildMeshlets(): expected max vertex count to be in range [3, 256], got" << maxVertexCount, {});
+    CORRADE_ASSERT(maxTriangleCount >= 1,
+        "MeshTools::buildMeshlets(): expected non-zero max triangle count", {});
+    const UnsignedInt vertexCount = positions.size();
+    const std::size_t triangleCount = indices.size()/3;
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < vertexCount,
+            "MeshTools::buildMeshlets(): index" << indices[i] << "out of range for" << vertexCount << "vertices", {});
+    #endif
+
+    /* Triangles referencing each vertex, to find candidates for growing the
+       current meshlet */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Degenerate triangles are marked as used right away */
+    Containers::BitArray used{ValueInit, triangleCount};
+    for(std::size_t t = 0; t != triangleCount; ++t) {
+        const UnsignedInt a = indices[t*3 + 0];
+        const UnsignedInt b = indices[t*3 + 1];
+        const UnsignedInt c = indices[t*3 + 2];
+        if(a == b || b == c || c == a) {
+            used.set(t);
+            --liveTriangleCount[a];
+            --liveTriangleCount[b];
+            --liveTriangleCount[c];
+        }
+    }
+
+    /* Index of each vertex in the current meshlet, ~UnsignedInt{} if not in
+       the meshlet */
+    Containers::Array<UnsignedInt> localVertex{DirectInit, vertexCount, ~UnsignedInt{}};
+
+    Meshlets out;
+    Containers::Array<UnsignedInt> candidates;
+    Containers::Array<Vector3> positionScratch{NoInit, maxVertexCount};
+    Containers::Array<Vector3> normalScratch{NoInit, maxTriangleCount};
+    Meshlet meshlet{};
+    std::size_t nextUnused = 0;
+
+    /* Finishes the current meshlet and starts a new one */
+    const auto flush = [&]() {
+        const Containers::ArrayView<const UnsignedInt> vertices = out.vertices.exceptPrefix(meshlet.vertexOffset);
+        calculateBounds(meshlet, vertices, out.triangles.exceptPrefix(meshlet.triangleOffset*3), positions, positionScratch, normalScratch);
+        for(const UnsignedInt v: vertices)
+            localVertex[v] = ~UnsignedInt{};
+        arrayAppend(out.meshlets, meshlet);
+        meshlet = {};
+        meshlet.vertexOffset = out.vertices.size();
+        meshlet.triangleOffset = out.triangles.size()/3;
+    };
+
+    for(;;) {
+        /* Pick a candidate adding the least new vertices. If there's a tie,
+           prefer triangles whose vertices have the least remaining triangles
+           left, to not leave isolated triangles behind. Used candidates are
+           removed along the way. */
+        std::size_t best = ~std::size_t{};
+        UnsignedInt bestNewVertexCount = ~UnsignedInt{};
+        UnsignedInt bestLiveTriangleCount = ~UnsignedInt{};
+        std::size_t candidateCount = 0;
+        for(const UnsignedInt t: candidates) {
+            if(used[t]) continue;
+            candidates[candidateCount++] = t;
+
+            UnsignedInt newVertexCount = 0;
+            UnsignedInt triangleLiveTriangleCount = 0;
+            for(std::size_t i = 0; i != 3; ++i) {
+                const UnsignedInt v = indices[t*3 + i];
+                if(localVertex[v] == ~UnsignedInt{}) ++newVertexCount;
+                triangleLiveTriangleCount += liveTriangleCount[v];
+            }
+            if(newVertexCount < bestNewVertexCount || (newVertexCount == bestNewVertexCount && triangleLiveTriangleCount < bestLiveTriangleCount)) {
+                best = t;
+                bestNewVertexCount = newVertexCount;
+                bestLiveTriangleCount = triangleLiveTriangleCount;
+            }
+        }
+        arrayResize(candidates, candidateCount);
+
+        /* If the meshlet is full or the best candidate doesn't fit, finish
+           the meshlet */
+        if(meshlet.triangleCount && (meshlet.triangleCount == maxTriangleCount || (best != ~std::size_t{} && meshlet.vertexCount + bestNewVertexCount > maxVertexCount))) {
+            flush();
+            /* Adjacent candidates are all a valid seed for the next meshlet
+               but everything in them is a new vertex now. Recalculate the
+               scores in the next iteration. */
+            continue;
+        }
+
+        /* If there's no adjacent candidate (e.g. the mesh has disconnected
+           pieces), continue with the first unused triangle. If the meshlet
+           isn't empty and the triangle doesn't fit, finish the meshlet
+           first. */
+        if(best == ~std::size_t{}) {
+            while(nextUnused != triangleCount && used[nextUnused])
+                ++nextUnused;
+            if(nextUnused == triangleCount) break;
+
+            UnsignedInt newVertexCount = 0;
+            for(std::size_t i = 0; i != 3; ++i)
+                if(localVertex[indices[nextUnused*3 + i]] == ~UnsignedInt{})
+                    ++newVertexCount;
+            if(meshlet.vertexCount + newVertexCount > maxVertexCount) {
+                flush();
+                continue;
+            }
+
+            best = nextUnused;
+        }
+
+        /* Candidates left over from the previous meshlet served only for
+           picking the seed, drop them to keep the list bounded */
+        if(!meshlet.triangleCount) arrayClear(candidates);
+
+        /* Add the triangle to the meshlet */
+        used.set(best);
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[best*3 + i];
+            --liveTriangleCount[v];
+            if(localVertex[v] == ~UnsignedInt{}) {
+                localVertex[v] = meshlet.vertexCount++;
+                arrayAppend(out.vertices, v);
+                /* Triangles around a newly added vertex are candidates for
+                   growing the meshlet further */
+                for(const UnsignedInt t: neighbors.slice(neighborOffset[v], neighborOffset[v + 1]))
+                    if(!used[t]) arrayAppend(candidates, t);
+            }
+            arrayAppend(out.triangles, UnsignedByte(localVertex[v]));
+        }
+        ++meshlet.triangleCount;
+    }
+
+    /* Finish the last meshlet, if there's any */
+    if(meshlet.triangleCount) flush();
+
+    /* Convert the growable arrays back to ones with a default deleter */
+    arrayShrink(out.meshlets, DefaultInit);
+    arrayShrink(out.vertices, DefaultInit);
+    arrayShrink(out.triangles, DefaultInit);
+    return out;
+}
+
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return buildMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return buildMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    return buildMeshletsImplementation(indices, positions, maxVertexCount, maxTriangleCount);
+}
+
+Meshlets buildMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::buildMeshlets(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return buildMeshletsImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, maxVertexCount, maxTriangleCount);
+    else if(indices.size()[1] == 2)
+        return buildMeshletsImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, maxVertexCount, maxTriangleCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::buildMeshlets(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return buildMeshletsImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, maxVertexCount, maxTriangleCount);
+    }
+}
+
+Meshlets buildMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::buildMeshlets(): mesh data not indexed", {});
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::buildMeshlets(): expected a MeshPrimitive::Triangles mesh but got" << mesh.primitive(), {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::buildMeshlets(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::buildMeshlets(): the mesh has no positions", {});
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    return buildMeshlets(mesh.indices(), positions, maxVertexCount, maxTriangleCount);
+}
+
+bool isMeshletBackfacing(const Meshlet& meshlet, const Vector3& viewPosition) {
+    const Vector3 direction = meshlet.center - viewPosition;
+    return Math::dot(direction, meshlet.coneAxis) >= meshlet.coneCutoff*direction.length() + meshlet.radius;
+}
+
+}}
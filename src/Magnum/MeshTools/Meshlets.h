@@ -0,0 +1,220 @@
+#ifndef Magnum_MeshTools_Meshlets_h
+#define Magnum_MeshTools_Meshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, @ref Magnum::MeshTools::Meshlets, function @ref Magnum::MeshTools::buildMeshlets(), @ref Magnum::MeshTools::isMeshletBackfacing()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+@m_since_latest
+
+A cluster of triangles produced by @ref buildMeshlets(), together with its
+bounding sphere and a normal cone. Layout of the structure is meant to be
+directly usable for GPU-side culling as well.
+@see @ref Meshlets
+*/
+struct Meshlet {
+    /**
+     * @brief Vertex offset
+     *
+     * Offset of the first vertex of this meshlet in @ref Meshlets::vertices.
+     */
+    UnsignedInt vertexOffset;
+
+    /**
+     * @brief Vertex count
+     *
+     * At most the @p maxVertexCount passed to @ref buildMeshlets().
+     */
+    UnsignedInt vertexCount;
+
+    /**
+     * @brief Triangle offset
+     *
+     * Offset of the first triangle of this meshlet in
+     * @ref Meshlets::triangles, in triangles, not indices.
+     */
+    UnsignedInt triangleOffset;
+
+    /**
+     * @brief Triangle count
+     *
+     * At most the @p maxTriangleCount passed to @ref buildMeshlets().
+     */
+    UnsignedInt triangleCount;
+
+    /**
+     * @brief Bounding sphere center
+     *
+     * Calculated using @ref boundingSphereBouncingBubble() from the meshlet
+     * vertex positions.
+     */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average of all meshlet triangle normals. Zero if the normals
+     * cancel each other out.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the largest angle between @ref coneAxis and a triangle normal,
+     * or @cpp 1.0f @ce if the normals span more than a hemisphere, in which
+     * case the meshlet is never considered backfacing. See
+     * @ref isMeshletBackfacing() for how it's used.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Meshlets
+@m_since_latest
+
+Returned by @ref buildMeshlets(). The original index of vertex @cpp j @ce of
+triangle @cpp i @ce of meshlet @cpp m @ce is
+@cpp vertices[m.vertexOffset + triangles[(m.triangleOffset + i)*3 + j]] @ce.
+*/
+struct Meshlets {
+    /** @brief Meshlets with their bounds */
+    Containers::Array<Meshlet> meshlets;
+
+    /**
+     * @brief Vertex remap
+     *
+     * For each meshlet a contiguous range of indices into the original
+     * vertex data, referenced by the meshlet-local @ref triangles.
+     */
+    Containers::Array<UnsignedInt> vertices;
+
+    /**
+     * @brief Meshlet-local triangle indices
+     *
+     * Three 8-bit indices per triangle, relative to
+     * @ref Meshlet::vertexOffset of given meshlet.
+     */
+    Containers::Array<UnsignedByte> triangles;
+};
+
+/**
+@brief Split a triangle mesh into meshlets
+@param indices          Triangle index buffer
+@param positions        Vertex positions
+@param maxVertexCount   Max count of unique vertices in a meshlet
+@param maxTriangleCount Max count of triangles in a meshlet
+@m_since_latest
+
+Greedily grows each meshlet from a seed triangle, preferring connected
+triangles that add the least new vertices, until either of the limits is
+reached. Once a meshlet is full, the next one is seeded from a triangle
+adjacent to it, so consecutive meshlets are spatially close as well. If there
+are no connected triangles left, for example in a mesh made of disconnected
+pieces, the meshlet continues with the first unused triangle as long as it
+fits, so small pieces don't each end up in a meshlet of their own. The
+defaults of @cpp 64 @ce vertices and @cpp 124 @ce triangles match the
+recommended limits of the NV_mesh_shader and EXT_mesh_shader extensions.
+
+Each meshlet gets a bounding sphere for frustum culling, for example with
+@ref Math::Intersection::sphereFrustum(), and a normal cone for backface
+culling with @ref isMeshletBackfacing():
+
+@snippet MeshTools.cpp buildMeshlets
+
+Degenerate triangles are skipped. Expects that the index count is divisible by
+@cpp 3 @ce, all indices are less than @p positions size, @p maxVertexCount is
+in range @f$ [3, 256] @f$ and @p maxTriangleCount is at least @cpp 1 @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Split a triangle mesh with a type-erased index buffer into meshlets
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref buildMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Split a triangle mesh into meshlets
+@m_since_latest
+
+Expects that the mesh is indexed with a non-implementation-specific index type,
+is a @ref MeshPrimitive::Triangles and has a
+@ref Trade::MeshAttribute::Position. Delegates to
+@ref buildMeshlets(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt)
+with positions taken from @ref Trade::MeshData::positions3DAsArray().
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets buildMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Whether a meshlet is backfacing
+@m_since_latest
+
+Returns @cpp true @ce if all triangles of @p meshlet are guaranteed to face
+away from @p viewPosition, based on its bounding sphere and normal cone. The
+test is conservative, i.e. it can return @cpp false @ce even if all triangles
+face away. The @p viewPosition is expected to be in the same coordinate
+system as the mesh.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool isMeshletBackfacing(const Meshlet& meshlet, const Vector3& viewPosition);
+
+}}
+
+#endif
@@ -0,0 +1,613 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Optimize.h"
+
+#include <algorithm> /* std::sort() */
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Implementation/remapAttributeData.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Size of the LRU cache simulated by the vertex cache optimizer and of the
+   FIFO cache used for splitting clusters in the overdraw optimizer. The
+   scoring isn't tuned to any particular hardware cache size so it's not
+   exposed. */
+constexpr UnsignedInt OptimizerCacheSize = 16;
+
+/* Vertices referenced by more triangles than this get the same valence
+   score */
+constexpr UnsignedInt OptimizerMaxValence = 32;
+
+template<class T> VertexCacheStatistics analyzeVertexCacheImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3", {});
+
+    /* A vertex is in the FIFO cache if less than cacheSize vertices were
+       inserted after it. Starting the global time at cacheSize + 1 makes all
+       vertices initially not present, same as in tipsifyInPlace(). */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, vertexCount};
+    Containers::BitArray referenced{ValueInit, vertexCount};
+    UnsignedInt time = cacheSize + 1;
+    UnsignedInt transformedVertexCount = 0;
+    UnsignedInt referencedVertexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::analyzeVertexCache(): index" << v << "out of range for" << vertexCount << "vertices", {});
+
+        if(!referenced[v]) {
+            referenced.set(v);
+            ++referencedVertexCount;
+        }
+
+        if(time - timestamp[v] > cacheSize) {
+            timestamp[v] = time++;
+            ++transformedVertexCount;
+        }
+    }
+
+    const std::size_t triangleCount = indices.size()/3;
+    return VertexCacheStatistics{transformedVertexCount,
+        triangleCount ? Float(transformedVertexCount)/triangleCount : 0.0f,
+        referencedVertexCount ? Float(transformedVertexCount)/referencedVertexCount : 0.0f};
+}
+
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::analyzeVertexCache(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), vertexCount, cacheSize);
+    else if(indices.size()[1] == 2)
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), vertexCount, cacheSize);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::analyzeVertexCache(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return analyzeVertexCacheImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), vertexCount, cacheSize);
+    }
+}
+
+VertexCacheStatistics analyzeVertexCache(const Trade::MeshData& mesh, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::analyzeVertexCache(): mesh data not indexed", {});
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::analyzeVertexCache(): expected a MeshPrimitive::Triangles mesh but got" << mesh.primitive(), {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::analyzeVertexCache(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+
+    return analyzeVertexCache(mesh.indices(), mesh.vertexCount(), cacheSize);
+}
+
+namespace {
+
+template<class T> void optimizeVertexCacheInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < vertexCount,
+            "MeshTools::optimizeVertexCacheInPlace(): index" << indices[i] << "out of range for" << vertexCount << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Scores for a vertex based on its position in the LRU cache (with the
+       first item being for vertices not in the cache) and based on how many
+       not-yet-emitted triangles reference it. The three most recent vertices
+       get a fixed score as they were just used by the last triangle, the
+       rest decays with the position. Vertices with few remaining triangles
+       are preferred to avoid leaving lone triangles behind. */
+    Float cacheScore[OptimizerCacheSize + 1];
+    cacheScore[0] = 0.0f;
+    for(UnsignedInt i = 0; i != OptimizerCacheSize; ++i)
+        cacheScore[i + 1] = i < 3 ? 0.75f : std::pow(1.0f - Float(i - 3)/(OptimizerCacheSize - 3), 1.5f);
+    Float valenceScore[OptimizerMaxValence + 1];
+    valenceScore[0] = 0.0f;
+    for(UnsignedInt i = 1; i != OptimizerMaxValence + 1; ++i)
+        valenceScore[i] = 2.0f/std::sqrt(Float(i));
+
+    /* Neighboring triangles for each vertex. The first liveTriangleCount[v]
+       items starting at neighbors[neighborOffset[v]] are the triangles that
+       weren't emitted yet. */
+    Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency<T>(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initially all vertices are outside of the cache. Vertices that never
+       get to the cache don't have their live triangle count changed either,
+       so only scores of vertices in the cache need to be updated later. */
+    Containers::Array<Float> vertexScore{NoInit, vertexCount};
+    for(UnsignedInt v = 0; v != vertexCount; ++v)
+        vertexScore[v] = valenceScore[Math::min(liveTriangleCount[v], OptimizerMaxValence)];
+
+    /* Start with a triangle with the best score. With an empty cache it's the
+       one with the least connected vertices, i.e. likely on a border. */
+    UnsignedInt current = 0;
+    {
+        Float bestScore = -1.0f;
+        for(std::size_t t = 0; t != triangleCount; ++t) {
+            const Float score = vertexScore[indices[t*3 + 0]] +
+                                vertexScore[indices[t*3 + 1]] +
+                                vertexScore[indices[t*3 + 2]];
+            if(score > bestScore) {
+                current = t;
+                bestScore = score;
+            }
+        }
+    }
+
+    Containers::BitArray emitted{ValueInit, triangleCount};
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    /* The cache after emitting a triangle can temporarily have up to three
+       more items than the cache size */
+    UnsignedInt cache[OptimizerCacheSize + 3];
+    UnsignedInt newCache[OptimizerCacheSize + 3];
+    std::size_t cacheCount = 0;
+    /* Position from which to look for a not-yet-emitted triangle on a dead
+       end */
+    std::size_t deadEndCursor = 0;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        emitted.set(current);
+
+        /* Write the triangle to the output and remove it from live triangles
+           of its vertices. Degenerate triangles are listed once for every
+           occurence of given vertex, so they get removed the same number of
+           times. */
+        std::size_t newCacheCount = 0;
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt v = indices[current*3 + j];
+            outputIndices[i*3 + j] = v;
+
+            UnsignedInt* const live = neighbors + neighborOffset[v];
+            const UnsignedInt liveCount = liveTriangleCount[v];
+            for(UnsignedInt k = 0; k != liveCount; ++k) if(live[k] == current) {
+                live[k] = live[liveCount - 1];
+                break;
+            }
+            --liveTriangleCount[v];
+
+            /* Put the vertex at the front of the new cache, if not there
+               already */
+            bool present = false;
+            for(std::size_t k = 0; k != newCacheCount; ++k) if(newCache[k] == v) {
+                present = true;
+                break;
+            }
+            if(!present) newCache[newCacheCount++] = v;
+        }
+
+        /* Add the rest of the previous cache after the triangle vertices */
+        for(std::size_t j = 0; j != cacheCount; ++j) {
+            const UnsignedInt v = cache[j];
+            if(v != newCache[0] && (newCacheCount < 2 || v != newCache[1]) && (newCacheCount < 3 || v != newCache[2]))
+                newCache[newCacheCount++] = v;
+        }
+
+        /* Update scores of all vertices that were in the cache, including
+           ones that just got evicted */
+        for(std::size_t j = 0; j != newCacheCount; ++j) {
+            const UnsignedInt v = newCache[j];
+            const UnsignedInt position = j < OptimizerCacheSize ? j + 1 : 0;
+            vertexScore[v] = cacheScore[position] + valenceScore[Math::min(liveTriangleCount[v], OptimizerMaxValence)];
+        }
+
+        /* Pick the best-scoring live triangle referencing any vertex in the
+           cache. Scores of triangles outside of the cache didn't change and
+           are lower than of ones in the cache so there's no need to look at
+           them. */
+        UnsignedInt best = ~UnsignedInt{};
+        Float bestScore = -1.0f;
+        cacheCount = Math::min(newCacheCount, std::size_t(OptimizerCacheSize));
+        for(std::size_t j = 0; j != cacheCount; ++j) {
+            const UnsignedInt v = newCache[j];
+            cache[j] = v;
+
+            const UnsignedInt* const live = neighbors + neighborOffset[v];
+            for(UnsignedInt k = 0; k != liveTriangleCount[v]; ++k) {
+                const UnsignedInt t = live[k];
+                const Float score = vertexScore[indices[t*3 + 0]] +
+                                    vertexScore[indices[t*3 + 1]] +
+                                    vertexScore[indices[t*3 + 2]];
+                if(score > bestScore) {
+                    best = t;
+                    bestScore = score;
+                }
+            }
+        }
+
+        /* On a dead end continue with the next triangle that wasn't emitted
+           yet */
+        if(best == ~UnsignedInt{}) {
+            while(deadEndCursor != triangleCount && emitted[deadEndCursor])
+                ++deadEndCursor;
+            best = deadEndCursor;
+        }
+
+        current = best;
+    }
+
+    Utility::copy(outputIndices, indices);
+}
+
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount) {
+    optimizeVertexCacheInPlaceImplementation(indices, vertexCount);
+}
+
+void optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), vertexCount);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), vertexCount);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), vertexCount);
+    }
+}
+
+Trade::MeshData optimizeVertexCache(const Trade::MeshData& mesh) {
+    return optimizeVertexCache(copy(mesh));
+}
+
+Trade::MeshData optimizeVertexCache(Trade::MeshData&& mesh) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeVertexCache(): mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::optimizeVertexCache(): expected a MeshPrimitive::Triangles mesh but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeVertexCache(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    Trade::MeshData out = copy(Utility::move(mesh));
+    optimizeVertexCacheInPlace(out.mutableIndices(), out.vertexCount());
+    return out;
+}
+
+namespace {
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3", );
+    CORRADE_ASSERT(threshold >= 1.0f,
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1, got" << threshold, );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        CORRADE_ASSERT(indices[i] < positions.size(),
+            "MeshTools::optimizeOverdrawInPlace(): index" << indices[i] << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* FIFO cache simulation, same as in analyzeVertexCache(). Advancing the
+       time by the cache size flushes it. */
+    Containers::Array<UnsignedInt> timestamp{ValueInit, positions.size()};
+    UnsignedInt time = OptimizerCacheSize + 1;
+    const auto cacheMisses = [&](const std::size_t triangle) {
+        UnsignedInt misses = 0;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[triangle*3 + i];
+            if(time - timestamp[v] > OptimizerCacheSize) {
+                timestamp[v] = time++;
+                ++misses;
+            }
+        }
+        return misses;
+    };
+
+    /* Split the index buffer into clusters at triangles where all vertices
+       are cache misses, i.e. where the cache optimizer most likely continued
+       from a dead end. Reordering those doesn't make the cache efficiency
+       any worse. */
+    Containers::Array<UnsignedByte> triangleMisses{NoInit, triangleCount};
+    Containers::Array<UnsignedInt> hardClusters;
+    for(std::size_t t = 0; t != triangleCount; ++t) {
+        triangleMisses[t] = cacheMisses(t);
+        if(t == 0 || triangleMisses[t] == 3)
+            arrayAppend(hardClusters, UnsignedInt(t));
+    }
+    arrayAppend(hardClusters, UnsignedInt(triangleCount));
+
+    /* Split each of those further as long as the cache miss ratio of the
+       smaller cluster starting with a flushed cache stays within the
+       threshold of the original cluster ratio */
+    Containers::Array<UnsignedInt> clusters;
+    for(std::size_t i = 0; i + 1 != hardClusters.size(); ++i) {
+        const UnsignedInt begin = hardClusters[i];
+        const UnsignedInt end = hardClusters[i + 1];
+        UnsignedInt clusterMisses = 0;
+        for(UnsignedInt t = begin; t != end; ++t)
+            clusterMisses += triangleMisses[t];
+        const Float maxMissRatio = threshold*clusterMisses/(end - begin);
+
+        arrayAppend(clusters, begin);
+        time += OptimizerCacheSize + 1;
+        UnsignedInt clusterBegin = begin;
+        UnsignedInt misses = 0;
+        for(UnsignedInt t = begin; t != end; ++t) {
+            misses += cacheMisses(t);
+            if(t + 1 != end && misses <= maxMissRatio*(t + 1 - clusterBegin)) {
+                clusterBegin = t + 1;
+                misses = 0;
+                time += OptimizerCacheSize + 1;
+                arrayAppend(clusters, clusterBegin);
+            }
+        }
+    }
+    arrayAppend(clusters, UnsignedInt(triangleCount));
+    const std::size_t clusterCount = clusters.size() - 1;
+
+    /* Area-weighted centroid and normal of each cluster and of the whole
+       mesh. The cross product length is twice the triangle area, the scale
+       doesn't matter. Zero-area clusters get an unweighted centroid. */
+    Containers::Array<Vector3> clusterCentroid{NoInit, clusterCount};
+    Containers::Array<Vector3> clusterNormal{NoInit, clusterCount};
+    Vector3 meshCentroid;
+    Vector3 meshCentroidUnweighted;
+    Float meshArea = 0.0f;
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        Vector3 centroid;
+        Vector3 centroidUnweighted;
+        Vector3 normal;
+        Float area = 0.0f;
+        for(UnsignedInt t = clusters[i]; t != clusters[i + 1]; ++t) {
+            const Vector3 a = positions[indices[t*3 + 0]];
+            const Vector3 b = positions[indices[t*3 + 1]];
+            const Vector3 c = positions[indices[t*3 + 2]];
+            const Vector3 n = Math::cross(b - a, c - a);
+            const Float triangleArea = n.length();
+            centroid += (a + b + c)*triangleArea;
+            centroidUnweighted += a + b + c;
+            normal += n;
+            area += triangleArea;
+        }
+
+        meshCentroid += centroid;
+        meshCentroidUnweighted += centroidUnweighted;
+        meshArea += area;
+        clusterCentroid[i] = area ? centroid/(3.0f*area) :
+            centroidUnweighted/(3.0f*(clusters[i + 1] - clusters[i]));
+        clusterNormal[i] = normal;
+    }
+    meshCentroid = meshArea ? meshCentroid/(3.0f*meshArea) :
+        meshCentroidUnweighted/(3.0f*triangleCount);
+
+    /* Sort the clusters so the ones facing outwards the most get drawn
+       first. Ties are resolved by the original order to make the result
+       deterministic. */
+    Containers::Array<Containers::Pair<Float, UnsignedInt>> order{NoInit, clusterCount};
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        const Float normalLength = clusterNormal[i].length();
+        const Float key = normalLength ? Math::dot(clusterCentroid[i] - meshCentroid, clusterNormal[i]/normalLength) : 0.0f;
+        /* NaN positions would break the sort */
+        order[i] = {key == key ? key : 0.0f, UnsignedInt(i)};
+    }
+    std::sort(order.begin(), order.end(), [](const Containers::Pair<Float, UnsignedInt>& a, const Containers::Pair<Float, UnsignedInt>& b) {
+        return a.first() > b.first() || (a.first() == b.first() && a.second() < b.second());
+    });
+
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    std::size_t outputIndex = 0;
+    for(const Containers::Pair<Float, UnsignedInt>& i: order) {
+        for(std::size_t j = clusters[i.second()]*3, end = clusters[i.second() + 1]*3; j != end; ++j)
+            outputIndices[outputIndex++] = indices[j];
+    }
+    CORRADE_INTERNAL_ASSERT(outputIndex == indices.size());
+
+    Utility::copy(outputIndices, indices);
+}
+
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Float threshold) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeOverdrawInPlace(): second index view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        return optimizeOverdrawInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), positions, threshold);
+    else if(indices.size()[1] == 2)
+        return optimizeOverdrawInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), positions, threshold);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeOverdrawInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeOverdrawInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), positions, threshold);
+    }
+}
+
+Trade::MeshData optimizeOverdraw(const Trade::MeshData& mesh, const Float threshold) {
+    return optimizeOverdraw(copy(mesh), threshold);
+}
+
+Trade::MeshData optimizeOverdraw(Trade::MeshData&& mesh, const Float threshold) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeOverdraw(): mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::optimizeOverdraw(): expected a MeshPrimitive::Triangles mesh but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeOverdraw(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::optimizeOverdraw(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    Trade::MeshData out = copy(Utility::move(mesh));
+    const Containers::Array<Vector3> positions = out.positions3DAsArray();
+    optimizeOverdrawInPlace(out.mutableIndices(), positions, threshold);
+    return out;
+}
+
+namespace {
+
+template<class T> std::size_t optimizeVertexFetchInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView2D<char>& data) {
+    /* Assign new vertex IDs in order of first use */
+    Containers::Array<UnsignedInt> mapping{DirectInit, data.size()[0], ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> order{NoInit, data.size()[0]};
+    UnsignedInt count = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < data.size()[0],
+            "MeshTools::optimizeVertexFetchInPlace(): index" << v << "out of range for" << data.size()[0] << "vertices", {});
+        if(mapping[v] == ~UnsignedInt{}) {
+            order[count] = v;
+            mapping[v] = count++;
+        }
+        indices[i] = mapping[v];
+    }
+
+    /* Gather the vertices to a temporary location and copy them back */
+    Containers::Array<char> reordered{NoInit, count*data.size()[1]};
+    const Containers::StridedArrayView2D<char> reorderedView{reordered, {count, data.size()[1]}};
+    for(UnsignedInt i = 0; i != count; ++i)
+        Utility::copy(data[order[i]], reorderedView[i]);
+    Utility::copy(reorderedView, data.prefix(count));
+
+    return count;
+}
+
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), data);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), data);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), data);
+    }
+}
+
+Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(mesh.attributeCount(),
+        "MeshTools::optimizeVertexFetch(): can't optimize an attributeless mesh",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::optimizeVertexFetch(): mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::optimizeVertexFetch(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    }
+    #endif
+
+    /* Same as in removeDuplicates(), make the mesh owned, interleaved and
+       tightly packed so the vertex data span the whole stride and can be
+       reordered as a whole */
+    Trade::MeshData ownedInterleaved = copy(interleave(mesh, {}, InterleaveFlags{}));
+    const Containers::StridedArrayView2D<char> vertexData = interleavedMutableData(ownedInterleaved);
+    CORRADE_INTERNAL_ASSERT(vertexData.size()[1] == std::size_t(ownedInterleaved.attributeStride(0)));
+
+    const UnsignedInt vertexCount = optimizeVertexFetchInPlace(ownedInterleaved.mutableIndices(), vertexData);
+
+    /* Copy the prefix to a new vertex data without the unreferenced vertices,
+       same as in removeDuplicates() */
+    Containers::Array<char> uniqueVertexData{NoInit, vertexCount*vertexData.size()[1]};
+    Utility::copy(vertexData.prefix(vertexCount),
+        Containers::StridedArrayView2D<char>{uniqueVertexData, {vertexCount, vertexData.size()[1]}});
+
+    /* Route all attributes to the new vertex data */
+    Containers::Array<Trade::MeshAttributeData> attributeData{ownedInterleaved.attributeCount()};
+    for(UnsignedInt i = 0; i != ownedInterleaved.attributeCount(); ++i)
+        attributeData[i] = Implementation::remapAttributeData(ownedInterleaved.attributeData(i), vertexCount, ownedInterleaved.vertexData(), uniqueVertexData);
+
+    const MeshIndexType indexType = ownedInterleaved.indexType();
+    Containers::Array<char> indexData = ownedInterleaved.releaseIndexData();
+    Trade::MeshIndexData indices{indexType, indexData};
+    return Trade::MeshData{ownedInterleaved.primitive(),
+        Utility::move(indexData), indices,
+        Utility::move(uniqueVertexData), Utility::move(attributeData),
+        vertexCount};
+}
+
+}}
@@ -0,0 +1,336 @@
+#ifndef Magnum_MeshTools_Optimize_h
+#define Magnum_MeshTools_Optimize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCache(), @ref Magnum::MeshTools::optimizeVertexCacheInPlace(), @ref Magnum::MeshTools::optimizeOverdraw(), @ref Magnum::MeshTools::optimizeOverdrawInPlace(), @ref Magnum::MeshTools::optimizeVertexFetch(), @ref Magnum::MeshTools::optimizeVertexFetchInPlace(), @ref Magnum::MeshTools::analyzeVertexCache(), struct @ref Magnum::MeshTools::VertexCacheStatistics
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Vertex cache statistics
+@m_since_latest
+
+Returned by @ref analyzeVertexCache().
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Transformed vertex count
+     *
+     * Count of simulated post-transform vertex cache misses, i.e. how many
+     * times the vertex shader would be executed for given index buffer.
+     */
+    UnsignedInt transformedVertexCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Also known as ACMR. @ref transformedVertexCount divided by triangle
+     * count. The worst possible value is @cpp 3.0f @ce, large regular grid
+     * meshes can theoretically get to @cpp 0.5f @ce. @cpp 0.0f @ce for an
+     * empty mesh.
+     */
+    Float averageCacheMissRatio;
+
+    /**
+     * @brief Average transformed to vertex ratio
+     *
+     * Also known as ATVR. @ref transformedVertexCount divided by count of
+     * vertices referenced by the index buffer. The best possible value is
+     * @cpp 1.0f @ce, meaning each vertex got transformed just once.
+     * @cpp 0.0f @ce for an empty mesh.
+     */
+    Float averageTransformedToVertexRatio;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency
+@param indices      Triangle index buffer
+@param vertexCount  Vertex count
+@param cacheSize    Simulated cache size
+@m_since_latest
+
+Simulates a FIFO post-transform vertex cache of @p cacheSize entries and counts
+the misses. Useful for measuring effects of @ref optimizeVertexCacheInPlace(),
+@ref optimizeOverdrawInPlace() or @ref tipsifyInPlace(). Expects that the
+index count is divisible by @cpp 3 @ce and all indices are less than
+@p vertexCount.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+@brief Analyze post-transform vertex cache efficiency for a type-erased index buffer
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>&, UnsignedInt, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize);
+
+/**
+@brief Analyze post-transform vertex cache efficiency of a mesh
+@m_since_latest
+
+Expects that the mesh is indexed with a non-implementation-specific index type
+and is a @ref MeshPrimitive::Triangles. Delegates to
+@ref analyzeVertexCache(const Containers::StridedArrayView2D<const char>&, UnsignedInt, UnsignedInt)
+with @ref Trade::MeshData::vertexCount() passed as the vertex count.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Trade::MeshData& mesh, UnsignedInt cacheSize);
+
+/**
+@brief Optimize a mesh for post-transform vertex cache in-place
+@param[in,out] indices  Triangle index buffer
+@param[in] vertexCount  Vertex count
+@m_since_latest
+
+Reorders triangles in the index buffer for a better post-transform vertex cache
+utilization. Unlike @ref tipsifyInPlace() the algorithm doesn't need to know
+the actual cache size, the triangles are greedily picked based on a score
+derived from a position of their vertices in a simulated LRU cache and from
+count of not-yet-emitted triangles referencing each vertex:
+
+-   *Tom Forsyth --- Linear-Speed Vertex Cache Optimisation, 2006,
+    https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*
+
+Vertex order in each triangle is preserved, so is the face winding. Expects
+that the index count is divisible by @cpp 3 @ce and all indices are less than
+@p vertexCount.
+@see @ref analyzeVertexCache(), @ref optimizeOverdrawInPlace(),
+    @ref optimizeVertexFetchInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Optimize a type-erased index buffer for post-transform vertex cache in-place
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, UnsignedInt)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount);
+
+/**
+@brief Optimize a mesh for post-transform vertex cache
+@m_since_latest
+
+Makes the index data owned and mutable using @ref copy() and then calls
+@ref optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>&, UnsignedInt)
+on them. Vertex data and all other properties are passed through unchanged.
+Expects that the mesh is indexed with a non-implementation-specific index type
+and is a @ref MeshPrimitive::Triangles.
+@see @ref optimizeVertexCache(Trade::MeshData&&)
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexCache(const Trade::MeshData& mesh);
+
+/**
+@brief Optimize a mesh for post-transform vertex cache
+@m_since_latest
+
+Compared to @ref optimizeVertexCache(const Trade::MeshData&) this function can
+transfer ownership of @p mesh index and vertex data (if they are owned and
+mutable) to the returned instance instead of making copies of them.
+@see @ref Trade::MeshData::indexDataFlags(),
+    @ref Trade::MeshData::vertexDataFlags()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexCache(Trade::MeshData&& mesh);
+
+/**
+@brief Optimize a mesh for reduced overdraw in-place
+@param[in,out] indices  Triangle index buffer
+@param[in] positions    Vertex positions
+@param[in] threshold    How much can the average cache miss ratio get worse
+@m_since_latest
+
+Expects that the index buffer is already optimized for post-transform vertex
+cache, for example with @ref optimizeVertexCacheInPlace(). Splits it into
+clusters at points where the cache gets flushed and then further into smaller
+clusters as long as the average cache miss ratio of each stays within
+@p threshold times the original. The clusters are then sorted so the ones
+facing away from the mesh center get drawn first, increasing the chance that
+triangles drawn later will get rejected by the depth test:
+
+-   *Pedro V. Sander, Diego Nehab, and Joshua Barczak --- Fast Triangle
+    Reordering for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
+    https://gfx.cs.princeton.edu/pubs/Sander_2007_%3eTR/tipsy.pdf*
+
+The default @p threshold allows the average cache miss ratio to get 5% worse,
+@cpp 1.0f @ce will only split at cache flushes. Triangle contents are
+preserved, so is the face winding. Expects that the index count is divisible by
+@cpp 3 @ce, all indices are less than @p positions size and @p threshold is at
+least @cpp 1.0f @ce.
+@see @ref analyzeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+@brief Optimize a type-erased index buffer for reduced overdraw in-place
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, Float)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, Float threshold = 1.05f);
+
+/**
+@brief Optimize a mesh for reduced overdraw
+@m_since_latest
+
+Makes the index data owned and mutable using @ref copy() and then calls
+@ref optimizeOverdrawInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, Float)
+on them, with positions taken from
+@ref Trade::MeshData::positions3DAsArray(). Vertex data and all other
+properties are passed through unchanged. Expects that the mesh is indexed with
+a non-implementation-specific index type, is a @ref MeshPrimitive::Triangles
+and has a @ref Trade::MeshAttribute::Position.
+
+As with the index buffer variant, the mesh is expected to be already optimized
+for post-transform vertex cache. A typical sequence is thus
+@ref optimizeVertexCache(), @ref optimizeOverdraw() and finally
+@ref optimizeVertexFetch().
+@see @ref optimizeOverdraw(Trade::MeshData&&, Float)
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeOverdraw(const Trade::MeshData& mesh, Float threshold = 1.05f);
+
+/**
+@brief Optimize a mesh for reduced overdraw
+@m_since_latest
+
+Compared to @ref optimizeOverdraw(const Trade::MeshData&, Float) this function
+can transfer ownership of @p mesh index and vertex data (if they are owned and
+mutable) to the returned instance instead of making copies of them.
+@see @ref Trade::MeshData::indexDataFlags(),
+    @ref Trade::MeshData::vertexDataFlags()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeOverdraw(Trade::MeshData&& mesh, Float threshold = 1.05f);
+
+/**
+@brief Optimize vertex data for pre-transform vertex fetch in-place
+@param[in,out] indices  Index buffer
+@param[in,out] data     Vertex data
+@return Count of vertices referenced by @p indices
+@m_since_latest
+
+Reorders vertices in @p data in the order they're first referenced by
+@p indices and updates @p indices to match, improving memory locality of
+vertex fetch. Vertices not referenced by any index are dropped, the first
+@p data items up to the returned count contain the reordered vertices and the
+rest is left in an unspecified state. Should be done as the last step, after
+all optimizations that reorder the index buffer. Works with any primitive
+type. Expects that all indices are less than @p data size.
+@see @ref removeDuplicatesIndexedInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Optimize vertex data for pre-transform vertex fetch in-place with a type-erased index buffer
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<char>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Optimize a mesh for pre-transform vertex fetch
+@m_since_latest
+
+Makes the mesh interleaved and tightly packed using @ref interleave(), calls
+@ref optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView2D<char>&)
+on it and returns a copy with unreferenced vertices dropped. Expects that the
+mesh has at least one attribute, none of the attributes has an
+implementation-specific format and that it's indexed with a
+non-implementation-specific index type. Works with any primitive type, the
+index type is preserved.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh);
+
+}}
+
+#endif
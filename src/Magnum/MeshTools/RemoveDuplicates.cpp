@@ -28,13 +28,13 @@
 
 #include <cstring>
 #include <limits>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/MurmurHash2.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Copy.h"
@@ -45,25 +45,197 @@
 
 namespace Magnum { namespace MeshTools {
 
-struct ArrayEqual {
-    explicit ArrayEqual(std::size_t size): _size{size} {}
+namespace {
 
-    bool operator()(const void* a, const void* b) const {
-        return std::memcmp(a, b, _size) == 0;
-    }
+std::size_t hashKey(const char* const key, const std::size_t size) {
+    return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(key, size).byteArray());
+}
+
+/* Flat open-addressing hash table with linear probing, used by all
+   removeDuplicates*() variants. Compared to a std::unordered_map it doesn't
+   allocate a node for every unique item, and instead of storing the keys it
+   stores only indices into the `keys` view, with the key for index `i` being
+   `keys[i]`. Each slot additionally stores the lower 32 bits of the hash to
+   avoid a memcmp() on the key data for the majority of collisions. The
+   table is sized upfront to be at most 2/3 full if all items are unique, so
+   it never needs to rehash. */
+class HashTable {
+    public:
+        explicit HashTable(const Containers::StridedArrayView2D<const char>& keys): HashTable{keys, keys.size()[0]} {}
+
+        /* Sized for `count` unique keys instead of all of `keys` being
+           unique */
+        explicit HashTable(const Containers::StridedArrayView2D<const char>& keys, const std::size_t count): _keys{keys} {
+            std::size_t capacity = 16;
+            while(capacity < count + count/2) capacity *= 2;
+            _mask = capacity - 1;
+            _slots = Containers::Array<Slot>{NoInit, capacity};
+            clear();
+        }
+
+        std::size_t size() const { return _size; }
+
+        /* Looks up the key at `keys[index]`. If the same key is already
+           present, returns the index it was inserted with, otherwise inserts
+           `index` and returns it. */
+        UnsignedInt insert(const UnsignedInt index) {
+            return insert(index, hashKey(key(index), _keys.size()[1]));
+        }
+
+        /* Same as above but with the hash calculated upfront using
+           hashKey() */
+        UnsignedInt insert(const UnsignedInt index, const std::size_t hash) {
+            const char* const key = this->key(index);
+            for(std::size_t i = hash & _mask; ; i = (i + 1) & _mask) {
+                Slot& slot = _slots[i];
+                if(slot.index == Empty) {
+                    slot.hash = UnsignedInt(hash);
+                    slot.index = index;
+                    ++_size;
+                    return index;
+                }
+
+                if(slot.hash == UnsignedInt(hash) && std::memcmp(this->key(slot.index), key, _keys.size()[1]) == 0)
+                    return slot.index;
+            }
+        }
+
+        void clear() {
+            for(Slot& slot: _slots) slot.index = Empty;
+            _size = 0;
+        }
+
+    private:
+        enum: UnsignedInt { Empty = ~UnsignedInt{} };
 
-    private: std::size_t _size;
+        struct Slot {
+            UnsignedInt hash;
+            UnsignedInt index;
+        };
+
+        const char* key(const UnsignedInt index) const {
+            return static_cast<const char*>(_keys.data()) + std::ptrdiff_t(index)*_keys.stride()[0];
+        }
+
+        Containers::StridedArrayView2D<const char> _keys;
+        Containers::Array<Slot> _slots;
+        std::size_t _mask;
+        std::size_t _size;
 };
 
-struct ArrayHash {
-    explicit ArrayHash(std::size_t size): _size{size} {}
+/* Parallel variant of removeDuplicatesInPlaceInto() used by the MeshData
+   overloads. Doesn't modify the data, instead `indices` is filled with the
+   same values the serial variant would produce and `firstOccurrences` with an
+   index of the first occurrence of each item in `data`, which is equal to the
+   item index for unique items. The data is split into `threadCount`
+   partitions based on the topmost hash bits -- as equal items have equal
+   hashes, they always end up in the same partition and so each partition can
+   be deduplicated independently. The partitions are then merged together in
+   order to produce output identical to the serial variant. */
+std::size_t removeDuplicatesParallelInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::ArrayView<UnsignedInt> firstOccurrences, const UnsignedInt threadCount) {
+    CORRADE_INTERNAL_ASSERT(data.isEmpty()[0] || data.isContiguous<1>());
+    const std::size_t dataSize = data.size()[0];
+    CORRADE_INTERNAL_ASSERT(indices.size() == dataSize && firstOccurrences.size() == dataSize);
+
+    /* Calculate hashes of all items upfront */
+    Containers::Array<std::size_t> hashes{NoInit, dataSize};
+    Magnum::Implementation::parallelFor(threadCount, dataSize, [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            hashes[i] = hashKey(static_cast<const char*>(data[i].data()), data.size()[1]);
+    });
+
+    /* Scatter indices of all items into per-partition buckets, so each
+       partition then goes only through its own items. First count items of
+       each partition in each chunk, laid out partition-major so the prefix
+       sum gives each chunk a range in each bucket, with the items in a bucket
+       being in their original order. Every chunk writes to its own
+       counters, so there's no need for any synchronization. */
+    auto partition = [threadCount](const std::size_t hash) {
+        return std::size_t(((hash >> (sizeof(std::size_t)*8 - 16))*threadCount) >> 16);
+    };
+    Containers::Array<std::size_t> bucketOffsets{ValueInit, std::size_t(threadCount)*threadCount + 1};
+    Magnum::Implementation::parallelFor(threadCount, dataSize, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            ++bucketOffsets[partition(hashes[i])*threadCount + chunk + 1];
+    });
+    for(std::size_t i = 0; i != std::size_t(threadCount)*threadCount; ++i)
+        bucketOffsets[i + 1] += bucketOffsets[i];
+    Containers::Array<std::size_t> partitionOffsets{NoInit, std::size_t(threadCount) + 1};
+    for(std::size_t p = 0; p <= threadCount; ++p)
+        partitionOffsets[p] = bucketOffsets[p*threadCount];
+    Containers::Array<UnsignedInt> buckets{NoInit, dataSize};
+    Magnum::Implementation::parallelFor(threadCount, dataSize, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            buckets[bucketOffsets[partition(hashes[i])*threadCount + chunk]++] = UnsignedInt(i);
+    });
+
+    /* Deduplicate each partition. Going through the items in order means
+       the first occurrence is what gets stored in the table, same as in the
+       serial case. */
+    Magnum::Implementation::parallelFor(threadCount, threadCount, [&](const std::size_t p, std::size_t, std::size_t) {
+        const Containers::ArrayView<const UnsignedInt> bucket = buckets.slice(partitionOffsets[p], partitionOffsets[p + 1]);
+        HashTable table{data, bucket.size()};
+        for(const UnsignedInt i: bucket)
+            firstOccurrences[i] = table.insert(i, hashes[i]);
+    });
+
+    /* Count unique items in each chunk and convert that to offsets */
+    Containers::Array<std::size_t> offsets{ValueInit, std::size_t(threadCount) + 1};
+    Magnum::Implementation::parallelFor(threadCount, dataSize, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        std::size_t count = 0;
+        for(std::size_t i = begin; i != end; ++i)
+            if(firstOccurrences[i] == i) ++count;
+        offsets[chunk + 1] = count;
+    });
+    for(std::size_t i = 0; i != threadCount; ++i)
+        offsets[i + 1] += offsets[i];
+
+    /* Assign consecutive IDs to unique items in each chunk, and then once
+       all unique items have their ID assigned, point the duplicates to the
+       IDs of their first occurrence */
+    Magnum::Implementation::parallelFor(threadCount, dataSize, [&](const std::size_t chunk, const std::size_t begin, const std::size_t end) {
+        UnsignedInt id = offsets[chunk];
+        for(std::size_t i = begin; i != end; ++i)
+            if(firstOccurrences[i] == i) indices[i] = id++;
+    });
+    Magnum::Implementation::parallelFor(threadCount, dataSize, [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            if(firstOccurrences[i] != i) indices[i] = indices[firstOccurrences[i]];
+    });
+
+    return offsets[threadCount];
+}
+
+/* Copies unique items to the output based on the output of
+   removeDuplicatesParallelInto() */
+void copyUniqueParallel(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::ArrayView<const UnsignedInt> firstOccurrences, const Containers::StridedArrayView2D<char>& out, const UnsignedInt threadCount) {
+    Magnum::Implementation::parallelFor(threadCount, data.size()[0], [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            if(firstOccurrences[i] == i)
+                Utility::copy(data[i], out[indices[i]]);
+    });
+}
+
+template<class T> void remapIndicesParallel(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const UnsignedInt>& mapping, const UnsignedInt threadCount) {
+    Magnum::Implementation::parallelFor(threadCount, indices.size(), [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            indices[i] = mapping[indices[i]];
+    });
+}
 
-    std::size_t operator()(const void* a) const {
-        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), _size).byteArray());
+void remapIndicesParallel(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const UnsignedInt>& mapping, const UnsignedInt threadCount) {
+    CORRADE_INTERNAL_ASSERT(indices.isContiguous<1>());
+    if(indices.size()[1] == 4)
+        remapIndicesParallel(Containers::arrayCast<1, UnsignedInt>(indices), mapping, threadCount);
+    else if(indices.size()[1] == 2)
+        remapIndicesParallel(Containers::arrayCast<1, UnsignedShort>(indices), mapping, threadCount);
+    else {
+        CORRADE_INTERNAL_ASSERT(indices.size()[1] == 1);
+        remapIndicesParallel(Containers::arrayCast<1, UnsignedByte>(indices), mapping, threadCount);
     }
+}
 
-    private: std::size_t _size;
-};
+}
 
 std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
     /* Assuming the second dimension is contiguous so we can calculate the
@@ -75,25 +247,14 @@ std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    /* Table containing index of first occurrence for each unique entry */
+    HashTable table{data};
 
-    /* Go through all entries */
-    for(std::size_t i = 0; i != dataSize; ++i) {
-        /* Try to insert new entry into the table. The inserted index points
-           into the original unchanged data array. */
-        const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
-
-        /* Put the (either new or already existing) index into the output
-           index array */
-        indices[i] = result.first->second;
-    }
+    /* Go through all entries. Try to insert each into the table, the inserted
+       index points into the original unchanged data array. Put the (either
+       new or already existing) index into the output index array. */
+    for(std::size_t i = 0; i != dataSize; ++i)
+        indices[i] = table.insert(i);
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
     return table.size();
@@ -115,19 +276,13 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
     CORRADE_ASSERT(indices.size() == dataSize,
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
-    /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
-       unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
-
-    /* Go through all entries and insert them into the table. Because the keys
-       have runtime size, the table doesn't store a copy of the keys, only a
-       reference. The reference is to the original data that we mutate
-       in-place, so extra care needs to be taken to prevent already-inserted
-       keys from getting modified. */
+    /* Table containing index of first occurrence for each unique entry */
+    HashTable table{data};
+
+    /* Go through all entries and insert them into the table. The table
+       doesn't store a copy of the keys, only an index into the original data
+       that we mutate in-place, so extra care needs to be taken to prevent
+       already-inserted keys from getting modified. */
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* First copy the key data to a potentially final no-longer-mutable
            place (except if the source and target location is the same). Data
@@ -137,20 +292,17 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
            it fails the location isn't used as a key anywhere and so it can be
            reused next time for a different key.
 
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
+           Alternatively we could first do a lookup and only then conditionally
+           do a copy() and an insert, but that means the hash & search would be
            performed twice, which is never faster than a plain memory copy. */
-        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
-        if(i != table.size())
-            Utility::copy(data[i].asContiguous(), dst);
-
-        /* Insert the new entry into the table. If it succeeds, dst is
-           guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
-
-        /* Put the (either new or already existing) index into the output index
-           array */
-        indices[i] = result.first->second;
+        const std::size_t size = table.size();
+        if(i != size)
+            Utility::copy(data[i].asContiguous(), data[size].asContiguous());
+
+        /* Insert the new entry into the table. If it succeeds, data[size] is
+           guaranteed to not change anymore. Put the (either new or already
+           existing) index into the output index array. */
+        indices[i] = table.insert(size);
     }
 
     CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
@@ -240,19 +392,16 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
        bounds. */
     epsilon = Math::max(epsilon, range/T(~std::size_t{}));
 
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::size_t dataSize = data.size()[0];
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]*sizeof(std::size_t)},
-        ArrayEqual{data.size()[1]*sizeof(std::size_t)}};
-
     /* Index array that'll be filled in each pass and then used for remapping
-       the `indices`; discretized storage for all map keys. */
+       the `indices`; discretized storage for all table keys. */
+    std::size_t dataSize = data.size()[0];
     Containers::Array<UnsignedInt> remapping{NoInit, dataSize};
     Containers::Array<std::size_t> discretized{NoInit, dataSize*vectorSize};
+    const Containers::StridedArrayView2D<std::size_t> discretizedEntries{discretized, {dataSize, vectorSize}};
+
+    /* Table containing unique vector index for each discretized vector. The
+       key for unique vector `i` is stored in `discretizedEntries[i]`. */
+    HashTable table{Containers::arrayCast<2, char>(discretizedEntries)};
 
     /* First go with original coordinates, then move them by epsilon/2 in each
        dimension. */
@@ -261,9 +410,12 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
         for(std::size_t i = 0; i != dataSize; ++i) {
             /* Take the original vector and discretize it -- append the move
                amount to given dimension, subtract the minmal offset and divide
-               by epsilon. */
+               by epsilon. The discretized key is put right after the
+               already-inserted keys, if it's not unique it gets overwritten
+               by the next one. */
+            const std::size_t size = table.size();
             const Containers::StridedArrayView1D<T> entry = data[i];
-            const Containers::ArrayView<std::size_t> discretizedEntry = discretized.slice(i*vectorSize, (i + 1)*vectorSize);
+            const Containers::StridedArrayView1D<std::size_t> discretizedEntry = discretizedEntries[size];
             for(std::size_t vi = 0; vi != vectorSize; ++vi) {
                 T c = entry[vi];
                 /* In iteration `0` we're not moving in any dimension, in
@@ -278,17 +430,17 @@ template<class IndexType, class T> std::size_t removeDuplicatesFuzzyIndexedInPla
                This is a similar workflow to removeDuplicatesInPlaceInto() with
                the only difference that we're remapping an existing index array
                several times over instead of creating a new one */
-            const auto result = table.emplace(discretizedEntry, table.size());
+            const UnsignedInt index = table.insert(size);
 
             /* Add the (either new or already existing) index into the array */
-            remapping[i] = result.first->second;
+            remapping[i] = index;
 
             /* If this is a new combination, copy the data to new (earlier)
-               position in the array. Data in [table.size()-1, i) are already
-               present in the [0, table.size()-1) range from previous
-               iterations so we aren't overwriting anything. */
-            if(result.second && i != table.size() - 1)
-                Utility::copy(entry, data[table.size() - 1]);
+               position in the array. Data in [size, i) are already present in
+               the [0, size) range from previous iterations so we aren't
+               overwriting anything. */
+            if(index == size && i != size)
+                Utility::copy(entry, data[size]);
         }
 
         /* Remap the resulting index array */
@@ -399,6 +551,10 @@ std::size_t removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayVi
 }
 
 Trade::MeshData removeDuplicates(const Trade::MeshData& mesh) {
+    return removeDuplicates(mesh, 1);
+}
+
+Trade::MeshData removeDuplicates(const Trade::MeshData& mesh, UnsignedInt threadCount) {
     CORRADE_ASSERT(mesh.attributeCount(),
         "MeshTools::removeDuplicates(): can't remove duplicates in an attributeless mesh",
         (Trade::MeshData{MeshPrimitive::Points, 0}));
@@ -435,25 +591,52 @@ Trade::MeshData removeDuplicates(const Trade::MeshData& mesh) {
     UnsignedInt uniqueVertexCount;
     Containers::Array<char> indexData;
     MeshIndexType indexType;
-    if(ownedInterleaved.isIndexed()) {
-        uniqueVertexCount = removeDuplicatesIndexedInPlace(ownedInterleaved.mutableIndices(), vertexData);
-        indexData = ownedInterleaved.releaseIndexData();
-        indexType = ownedInterleaved.indexType();
+    Containers::Array<char> uniqueVertexData;
+    threadCount = Magnum::Implementation::parallelForThreadCount(threadCount);
+    if(threadCount == 1) {
+        if(ownedInterleaved.isIndexed()) {
+            uniqueVertexCount = removeDuplicatesIndexedInPlace(ownedInterleaved.mutableIndices(), vertexData);
+            indexData = ownedInterleaved.releaseIndexData();
+            indexType = ownedInterleaved.indexType();
+        } else {
+            indexData = Containers::Array<char>{NoInit, ownedInterleaved.vertexCount()*sizeof(UnsignedInt)};
+            uniqueVertexCount = removeDuplicatesInPlaceInto(vertexData, Containers::arrayCast<UnsignedInt>(indexData));
+            indexType = MeshIndexType::UnsignedInt;
+        }
+
+        /* Allocate a new, shorter vertex data and copy the prefix */
+        /** @todo better idea? even if we would use growable arrays in
+            duplicate() or interleave() above, arrayResize() wouldn't release
+            the excessive memory in any way. This is basically equivalent to
+            STL's shrink_to_fit(), which also copies */
+        uniqueVertexData = Containers::Array<char>{NoInit, uniqueVertexCount*vertexData.size()[1]};
+        Utility::copy(vertexData.prefix(uniqueVertexCount),
+            Containers::StridedArrayView2D<char>{uniqueVertexData, {uniqueVertexCount, vertexData.size()[1]}});
+
+    /* The parallel variant doesn't compact the data in-place but copies the
+       unique vertices directly to the new vertex data, producing the same
+       output */
     } else {
-        indexData = Containers::Array<char>{NoInit, ownedInterleaved.vertexCount()*sizeof(UnsignedInt)};
-        uniqueVertexCount = removeDuplicatesInPlaceInto(vertexData, Containers::arrayCast<UnsignedInt>(indexData));
-        indexType = MeshIndexType::UnsignedInt;
+        Containers::Array<char> mappingStorage{NoInit, ownedInterleaved.vertexCount()*sizeof(UnsignedInt)};
+        const Containers::ArrayView<UnsignedInt> mapping = Containers::arrayCast<UnsignedInt>(mappingStorage);
+        Containers::Array<UnsignedInt> firstOccurrences{NoInit, ownedInterleaved.vertexCount()};
+        uniqueVertexCount = removeDuplicatesParallelInto(vertexData, mapping, firstOccurrences, threadCount);
+
+        uniqueVertexData = Containers::Array<char>{NoInit, uniqueVertexCount*vertexData.size()[1]};
+        copyUniqueParallel(vertexData, mapping, firstOccurrences,
+            Containers::StridedArrayView2D<char>{uniqueVertexData, {uniqueVertexCount, vertexData.size()[1]}},
+            threadCount);
+
+        if(ownedInterleaved.isIndexed()) {
+            remapIndicesParallel(ownedInterleaved.mutableIndices(), mapping, threadCount);
+            indexData = ownedInterleaved.releaseIndexData();
+            indexType = ownedInterleaved.indexType();
+        } else {
+            indexData = Utility::move(mappingStorage);
+            indexType = MeshIndexType::UnsignedInt;
+        }
     }
 
-    /* Allocate a new, shorter vertex data and copy the prefix */
-    /** @todo better idea? even if we would use growable arrays in duplicate()
-        or interleave() above, arrayResize() wouldn't release the excessive
-        memory in any way. This is basically equivalent to STL's
-        shrink_to_fit(), which also copies */
-    Containers::Array<char> uniqueVertexData{NoInit, uniqueVertexCount*vertexData.size()[1]};
-    Utility::copy(vertexData.prefix(uniqueVertexCount),
-        Containers::StridedArrayView2D<char>{uniqueVertexData, {uniqueVertexCount, vertexData.size()[1]}});
-
     /* Route all attributes to the new vertex data */
     Containers::Array<Trade::MeshAttributeData> attributeData{ownedInterleaved.attributeCount()};
     for(UnsignedInt i = 0; i != ownedInterleaved.attributeCount(); ++i)
@@ -467,6 +650,10 @@ Trade::MeshData removeDuplicates(const Trade::MeshData& mesh) {
 }
 
 Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float floatEpsilon, const Double doubleEpsilon) {
+    return removeDuplicatesFuzzy(mesh, floatEpsilon, doubleEpsilon, 1);
+}
+
+Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float floatEpsilon, const Double doubleEpsilon, UnsignedInt threadCount) {
     CORRADE_ASSERT(mesh.attributeCount(),
         "MeshTools::removeDuplicatesFuzzy(): can't remove duplicates in an attributeless mesh",
         (Trade::MeshData{MeshPrimitive::Points, 0}));
@@ -483,104 +670,144 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float f
     Containers::Array<UnsignedInt> combinedIndexStorage = Containers::Array<UnsignedInt>{NoInit, owned.vertexCount()*owned.attributeCount()};
     const Containers::StridedArrayView2D<UnsignedInt> combinedIndices = Containers::StridedArrayView2D<UnsignedInt>{combinedIndexStorage, {owned.vertexCount(), owned.attributeCount()}};
 
-    /* For each attribute decide if it needs to be fuzzy-deduplicated or not,
-       calculate the epsilon size and call the appropriate API */
-    const Containers::StridedArrayView2D<UnsignedInt> perAttributeIndices = combinedIndices.transposed<0, 1>();
+    #ifndef CORRADE_NO_ASSERT
     for(UnsignedInt i = 0; i != owned.attributeCount(); ++i) {
         const VertexFormat format = owned.attributeFormat(i);
         CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
             "MeshTools::removeDuplicatesFuzzy(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
             (Trade::MeshData{MeshPrimitive::Points, 0}));
+    }
+    #endif
 
-        /* Floats, with special attribute-dependent handling */
-        const VertexFormat componentFormat = vertexFormatComponentFormat(format);
-        if(componentFormat == VertexFormat::Float) {
-            const Containers::StridedArrayView2D<Float> attribute = Containers::arrayCast<2, Float>(owned.mutableAttribute(i));
-
-            /* Calculate scaled epsilon */
-            Float attributeEpsilon = 0.0f;
-            switch(owned.attributeName(i)) {
-                /* These are usually in [0, 1] (color can be HDR but we
-                   definitely don't want the epsilon to be higher there,
-                   texture coords can be higher and repeat but the same
-                   applies), use epsilon as-is */
-                case Trade::MeshAttribute::TextureCoordinates:
-                case Trade::MeshAttribute::Color:
-                case Trade::MeshAttribute::Weights:
-                    attributeEpsilon = floatEpsilon;
-                    break;
-
-                /* Those are all [-1, 1], scale the epsilon 2x */
-                case Trade::MeshAttribute::Normal:
-                case Trade::MeshAttribute::Tangent:
-                case Trade::MeshAttribute::Bitangent:
-                    attributeEpsilon = 2.0f*floatEpsilon;
-                    break;
-
-                /* These have unbounded range. Do nothing but enumerate all
-                   these here to silence warnings about unused enum values. */
-                case Trade::MeshAttribute::Position:
-                    break;
-
-                /* These shouldn't be floating point */
-                /* LCOV_EXCL_START */
-                case Trade::MeshAttribute::ObjectId:
-                case Trade::MeshAttribute::JointIds:
-                    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
-                /* LCOV_EXCL_STOP */
-            }
-
-            /* For unbounded and custom attributes scale the epsilon by data
-               range */
-            if(attributeEpsilon == 0.0f) {
-                Float range = 0.0f;
-                for(Containers::StridedArrayView1D<const Float> component: attribute.transposed<0, 1>())
-                    range = Math::max(Range1D{Math::minmax(component)}.size(), range);
-                attributeEpsilon = floatEpsilon*range;
+    /* For each attribute decide if it needs to be fuzzy-deduplicated or not,
+       calculate the epsilon size and call the appropriate API. Each attribute
+       touches only its own data and its own column of the combined index
+       array, so with more than one thread the attributes are processed in
+       parallel. */
+    threadCount = Magnum::Implementation::parallelForThreadCount(threadCount);
+    const Containers::StridedArrayView2D<UnsignedInt> perAttributeIndices = combinedIndices.transposed<0, 1>();
+    Magnum::Implementation::parallelFor(Math::min(threadCount, owned.attributeCount()), owned.attributeCount(), [&](std::size_t, const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const VertexFormat format = owned.attributeFormat(i);
+
+            /* Floats, with special attribute-dependent handling */
+            const VertexFormat componentFormat = vertexFormatComponentFormat(format);
+            if(componentFormat == VertexFormat::Float) {
+                const Containers::StridedArrayView2D<Float> attribute = Containers::arrayCast<2, Float>(owned.mutableAttribute(i));
+
+                /* Calculate scaled epsilon */
+                Float attributeEpsilon = 0.0f;
+                switch(owned.attributeName(i)) {
+                    /* These are usually in [0, 1] (color can be HDR but we
+                       definitely don't want the epsilon to be higher there,
+                       texture coords can be higher and repeat but the same
+                       applies), use epsilon as-is */
+                    case Trade::MeshAttribute::TextureCoordinates:
+                    case Trade::MeshAttribute::Color:
+                    case Trade::MeshAttribute::Weights:
+                        attributeEpsilon = floatEpsilon;
+                        break;
+
+                    /* Those are all [-1, 1], scale the epsilon 2x */
+                    case Trade::MeshAttribute::Normal:
+                    case Trade::MeshAttribute::Tangent:
+                    case Trade::MeshAttribute::Bitangent:
+                        attributeEpsilon = 2.0f*floatEpsilon;
+                        break;
+
+                    /* These have unbounded range. Do nothing but enumerate all
+                       these here to silence warnings about unused enum values. */
+                    case Trade::MeshAttribute::Position:
+                        break;
+
+                    /* These shouldn't be floating point */
+                    /* LCOV_EXCL_START */
+                    case Trade::MeshAttribute::ObjectId:
+                    case Trade::MeshAttribute::JointIds:
+                        CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+                    /* LCOV_EXCL_STOP */
+                }
+
+                /* For unbounded and custom attributes scale the epsilon by data
+                   range */
+                if(attributeEpsilon == 0.0f) {
+                    Float range = 0.0f;
+                    for(Containers::StridedArrayView1D<const Float> component: attribute.transposed<0, 1>())
+                        range = Math::max(Range1D{Math::minmax(component)}.size(), range);
+                    attributeEpsilon = floatEpsilon*range;
+                }
+
+                removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], attributeEpsilon);
+
+            /* Doubles. No builtin attributes support those at the moment, so
+               there's just the epsilon scaling based on attribute value range */
+            } else if(componentFormat == VertexFormat::Double) {
+                const Containers::StridedArrayView2D<Double> attribute = Containers::arrayCast<2, Double>(owned.mutableAttribute(i));
+
+                Double range = 0.0;
+                for(Containers::StridedArrayView1D<const Double> component: attribute.transposed<0, 1>())
+                    range = Math::max(Range1Dd{Math::minmax(component)}.size(), range);
+
+                removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], doubleEpsilon*range);
+
+            /* Other attributes (integer, packed, half floats). No fuzzy
+               comparison */
+            } else {
+                const Containers::StridedArrayView2D<char> attribute = owned.mutableAttribute(i);
+
+                removeDuplicatesInPlaceInto(attribute, perAttributeIndices[i]);
             }
-
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], attributeEpsilon);
-
-        /* Doubles. No builtin attributes support those at the moment, so
-           there's just the epsilon scaling based on attribute value range */
-        } else if(componentFormat == VertexFormat::Double) {
-            const Containers::StridedArrayView2D<Double> attribute = Containers::arrayCast<2, Double>(owned.mutableAttribute(i));
-
-            Double range = 0.0;
-            for(Containers::StridedArrayView1D<const Double> component: attribute.transposed<0, 1>())
-                range = Math::max(Range1Dd{Math::minmax(component)}.size(), range);
-
-            removeDuplicatesFuzzyInPlaceIntoImplementation(attribute, perAttributeIndices[i], doubleEpsilon*range);
-
-        /* Other attributes (integer, packed, half floats). No fuzzy
-           comparison */
-        } else {
-            const Containers::StridedArrayView2D<char> attribute = owned.mutableAttribute(i);
-
-            removeDuplicatesInPlaceInto(attribute, perAttributeIndices[i]);
         }
-    }
+    });
 
     /* Make the combined index array unique */
     Containers::Array<char> indexData;
     UnsignedInt vertexCount;
     MeshIndexType indexType;
+    CORRADE_ASSERT(!owned.isIndexed() || !isMeshIndexTypeImplementationSpecific(owned.indexType()),
+        "MeshTools::removeDuplicatesFuzzy(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(owned.indexType()),
+        (Trade::MeshData{MeshPrimitive{}, 0}));
+
+    /* Unique combinations of per-attribute indices, either a prefix of the
+       original array in the serial case or a newly allocated array in the
+       parallel case */
+    Containers::StridedArrayView2D<UnsignedInt> uniqueCombinedIndices;
+    Containers::Array<UnsignedInt> uniqueCombinedIndexStorage;
+    if(threadCount == 1) {
+        if(!owned.isIndexed()) {
+            indexData = Containers::Array<char>{NoInit, combinedIndices.size()[0]*sizeof(UnsignedInt)};
+            vertexCount = removeDuplicatesInPlaceInto(
+                Containers::arrayCast<2, char>(combinedIndices),
+                Containers::arrayCast<UnsignedInt>(indexData));
+            indexType = MeshIndexType::UnsignedInt;
+        } else {
+            vertexCount = removeDuplicatesIndexedInPlace(
+                owned.mutableIndices(),
+                Containers::arrayCast<2, char>(combinedIndices));
+            indexData = owned.releaseIndexData();
+            indexType = owned.indexType();
+        }
+
+        uniqueCombinedIndices = combinedIndices.prefix(vertexCount);
 
-    if(!owned.isIndexed()) {
-        indexData = Containers::Array<char>{NoInit, combinedIndices.size()[0]*sizeof(UnsignedInt)};
-        vertexCount = removeDuplicatesInPlaceInto(
-            Containers::arrayCast<2, char>(combinedIndices),
-            Containers::arrayCast<UnsignedInt>(indexData));
-        indexType = MeshIndexType::UnsignedInt;
     } else {
-        CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(owned.indexType()),
-            "MeshTools::removeDuplicatesFuzzy(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(owned.indexType()),
-            (Trade::MeshData{MeshPrimitive{}, 0}));
-        vertexCount = removeDuplicatesIndexedInPlace(
-            owned.mutableIndices(),
-            Containers::arrayCast<2, char>(combinedIndices));
-        indexData = owned.releaseIndexData();
-        indexType = owned.indexType();
+        Containers::Array<char> mappingStorage{NoInit, combinedIndices.size()[0]*sizeof(UnsignedInt)};
+        const Containers::ArrayView<UnsignedInt> mapping = Containers::arrayCast<UnsignedInt>(mappingStorage);
+        Containers::Array<UnsignedInt> firstOccurrences{NoInit, combinedIndices.size()[0]};
+        vertexCount = removeDuplicatesParallelInto(Containers::arrayCast<2, char>(combinedIndices), mapping, firstOccurrences, threadCount);
+
+        uniqueCombinedIndexStorage = Containers::Array<UnsignedInt>{NoInit, vertexCount*combinedIndices.size()[1]};
+        uniqueCombinedIndices = Containers::StridedArrayView2D<UnsignedInt>{uniqueCombinedIndexStorage, {vertexCount, combinedIndices.size()[1]}};
+        copyUniqueParallel(Containers::arrayCast<2, char>(combinedIndices), mapping, firstOccurrences, Containers::arrayCast<2, char>(uniqueCombinedIndices), threadCount);
+
+        if(!owned.isIndexed()) {
+            indexData = Utility::move(mappingStorage);
+            indexType = MeshIndexType::UnsignedInt;
+        } else {
+            remapIndicesParallel(owned.mutableIndices(), mapping, threadCount);
+            indexData = owned.releaseIndexData();
+            indexType = owned.indexType();
+        }
     }
 
     Trade::MeshData layout = interleavedLayout(owned, vertexCount);
@@ -591,7 +818,7 @@ Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, const Float f
 
     /* Trim the views to only the unique combinations, duplicate the attributes
        according to the combined index buffer */
-    const Containers::StridedArrayView2D<UnsignedInt> uniquePerAttributeIndices = combinedIndices.prefix(vertexCount).transposed<0, 1>();
+    const Containers::StridedArrayView2D<UnsignedInt> uniquePerAttributeIndices = uniqueCombinedIndices.transposed<0, 1>();
     for(UnsignedInt i = 0; i != owned.attributeCount(); ++i)
         duplicateInto(uniquePerAttributeIndices[i].prefix(vertexCount), owned.attribute(i), out.mutableAttribute(i));
 
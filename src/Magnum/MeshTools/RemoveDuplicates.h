@@ -376,6 +376,23 @@ copies and interleaves the input vertex and index data.
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(const Trade::MeshData& mesh);
 
+/**
+@brief Remove mesh data duplicates using multiple threads
+@m_since_latest
+
+Same as @ref removeDuplicates(const Trade::MeshData&), but with the hashing and
+deduplication spread across @p threadCount threads. Vertices are partitioned
+based on their hash and each partition is deduplicated independently, with
+the partitions merged together afterwards. The output is bit-identical to
+the single-threaded variant. If @p threadCount is @cpp 0 @ce, all hardware
+threads are used, @cpp 1 @ce is equivalent to calling the single-threaded
+variant. If Corrade isn't built with @ref CORRADE_BUILD_MULTITHREADED or
+threads aren't available on given platform, such as on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" without the `-pthread` option, all
+work is done on the calling thread.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicates(const Trade::MeshData& mesh, UnsignedInt threadCount);
+
 /**
 @brief Remove mesh data duplicates with fuzzy comparison for floating-point attributes
 @m_since{2020,06}
@@ -390,6 +407,20 @@ otherwise it's scaled to calculated value range.
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, Float floatEpsilon = Math::TypeTraits<Float>::epsilon(), Double doubleEpsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+@brief Remove mesh data duplicates with fuzzy comparison using multiple threads
+@m_since_latest
+
+Same as @ref removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double), but
+with individual attributes processed in parallel and the final deduplication
+of combined attribute indices done as described in
+@ref removeDuplicates(const Trade::MeshData&, UnsignedInt). The output is
+bit-identical to the single-threaded variant. If @p threadCount is
+@cpp 0 @ce, all hardware threads are used, @cpp 1 @ce is equivalent to calling
+the single-threaded variant.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData removeDuplicatesFuzzy(const Trade::MeshData& mesh, Float floatEpsilon, Double doubleEpsilon, UnsignedInt threadCount);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon) {
     /* A trivial index array that'll be remapped and returned after */
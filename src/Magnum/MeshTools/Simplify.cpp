@@ -0,0 +1,462 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm> /* std::sort() */
+#include <new>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Implementation/Tipsify.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Sum of squared distances to a set of planes, weighted by area of the
+   triangles the planes come from. For a point p the error is
+   pᵀAp + 2bᵀp + c, with A being a symmetric 3x3 matrix. */
+struct Quadric {
+    Double a00, a01, a02, a11, a12, a22;
+    Double b0, b1, b2;
+    Double c;
+    Double weight;
+};
+
+void addPlane(Quadric& q, const Vector3d& normal, const Double distance, const Double weight) {
+    q.a00 += weight*normal.x()*normal.x();
+    q.a01 += weight*normal.x()*normal.y();
+    q.a02 += weight*normal.x()*normal.z();
+    q.a11 += weight*normal.y()*normal.y();
+    q.a12 += weight*normal.y()*normal.z();
+    q.a22 += weight*normal.z()*normal.z();
+    q.b0 += weight*normal.x()*distance;
+    q.b1 += weight*normal.y()*distance;
+    q.b2 += weight*normal.z()*distance;
+    q.c += weight*distance*distance;
+    q.weight += weight;
+}
+
+void addQuadric(Quadric& q, const Quadric& other) {
+    q.a00 += other.a00;
+    q.a01 += other.a01;
+    q.a02 += other.a02;
+    q.a11 += other.a11;
+    q.a12 += other.a12;
+    q.a22 += other.a22;
+    q.b0 += other.b0;
+    q.b1 += other.b1;
+    q.b2 += other.b2;
+    q.c += other.c;
+    q.weight += other.weight;
+}
+
+/* Average squared distance of a point to the planes of two quadrics */
+Double quadricError(const Quadric& a, const Quadric& b, const Vector3d& p) {
+    const Double x = p.x(), y = p.y(), z = p.z();
+    const Double error =
+        (a.a00 + b.a00)*x*x + (a.a11 + b.a11)*y*y + (a.a22 + b.a22)*z*z +
+        2.0*((a.a01 + b.a01)*x*y + (a.a02 + b.a02)*x*z + (a.a12 + b.a12)*y*z) +
+        2.0*((a.b0 + b.b0)*x + (a.b1 + b.b1)*y + (a.b2 + b.b2)*z) +
+        (a.c + b.c);
+    const Double weight = a.weight + b.weight;
+    /* The error can get slightly negative due to precision */
+    return weight ? Math::max(error, 0.0)/weight : 0.0;
+}
+
+struct Collapse {
+    Float error;
+    UnsignedInt from, to;
+};
+
+template<class T> std::size_t simplifyInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3", {});
+    CORRADE_ASSERT(maxError >= 0.0f,
+        "MeshTools::simplifyInPlace(): expected a non-negative max error, got" << maxError, {});
+    const UnsignedInt vertexCount = positions.size();
+
+    /* Work on a 32-bit copy of the triangles, dropping the degenerate ones
+       right away */
+    Containers::Array<UnsignedInt> triangles{NoInit, indices.size()};
+    std::size_t indexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i + 0];
+        const UnsignedInt b = indices[i + 1];
+        const UnsignedInt c = indices[i + 2];
+        CORRADE_ASSERT(a < vertexCount && b < vertexCount && c < vertexCount,
+            "MeshTools::simplifyInPlace(): index" << Math::max({a, b, c}) << "out of range for" << vertexCount << "vertices", {});
+        if(a == b || b == c || c == a) continue;
+
+        triangles[indexCount++] = a;
+        triangles[indexCount++] = b;
+        triangles[indexCount++] = c;
+    }
+
+    if(indexCount > targetIndexCount) {
+        /* Vertices that are at the same position as other referenced vertices
+           are on an attribute seam. Moving them would tear the seam apart, so
+           they're locked. */
+        Containers::BitArray referenced{ValueInit, vertexCount};
+        for(std::size_t i = 0; i != indexCount; ++i)
+            referenced.set(triangles[i]);
+        Containers::Array<UnsignedInt> uniquePosition{NoInit, vertexCount};
+        const std::size_t uniquePositionCount = removeDuplicatesInto(Containers::arrayCast<2, const char>(positions), uniquePosition);
+        Containers::Array<UnsignedInt> uniquePositionUseCount{ValueInit, uniquePositionCount};
+        for(UnsignedInt v = 0; v != vertexCount; ++v)
+            if(referenced[v]) ++uniquePositionUseCount[uniquePosition[v]];
+        Containers::BitArray locked{ValueInit, vertexCount};
+        for(UnsignedInt v = 0; v != vertexCount; ++v)
+            if(uniquePositionUseCount[uniquePosition[v]] > 1) locked.set(v);
+
+        /* Vertices on borders and non-manifold edges are locked as well. An
+           interior edge is present exactly once in each direction, so put all
+           edges into a list with the smaller vertex ID first, remembering
+           which were reversed, sort it and check that each edge is there
+           exactly twice, once in each direction. */
+        {
+            struct Edge {
+                UnsignedLong vertices;
+                bool reversed;
+            };
+            Containers::Array<Edge> edges{NoInit, indexCount};
+            for(std::size_t i = 0; i != indexCount; ++i) {
+                const UnsignedInt a = triangles[i];
+                const UnsignedInt b = triangles[i % 3 == 2 ? i - 2 : i + 1];
+                edges[i] = a < b ?
+                    Edge{UnsignedLong(a) << 32 | b, false} :
+                    Edge{UnsignedLong(b) << 32 | a, true};
+            }
+            std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+                if(a.vertices != b.vertices) return a.vertices < b.vertices;
+                return a.reversed < b.reversed;
+            });
+            for(std::size_t i = 0; i != edges.size(); ) {
+                std::size_t end = i + 1;
+                while(end != edges.size() && edges[end].vertices == edges[i].vertices)
+                    ++end;
+                if(end - i != 2 || edges[i].reversed || !edges[i + 1].reversed) {
+                    locked.set(edges[i].vertices >> 32);
+                    locked.set(edges[i].vertices & 0xffffffffu);
+                }
+                i = end;
+            }
+        }
+
+        /* Initial vertex quadrics from planes of all adjacent triangles, and
+           the mesh size to which the error is relative */
+        Containers::Array<Quadric> quadrics{ValueInit, vertexCount};
+        Vector3 min{Constants::inf()};
+        Vector3 max{-Constants::inf()};
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            const Vector3d a{positions[triangles[i + 0]]};
+            const Vector3d b{positions[triangles[i + 1]]};
+            const Vector3d c{positions[triangles[i + 2]]};
+            const Vector3d cross = Math::cross(b - a, c - a);
+            const Double area = cross.length();
+            if(!area) continue;
+            const Vector3d normal = cross/area;
+            const Double distance = -Math::dot(normal, a);
+            for(std::size_t j = 0; j != 3; ++j) {
+                addPlane(quadrics[triangles[i + j]], normal, distance, area);
+                min = Math::min(min, positions[triangles[i + j]]);
+                max = Math::max(max, positions[triangles[i + j]]);
+            }
+        }
+        const Double maxErrorSquared = Math::pow<2>(Double(maxError)*(max - min).max());
+
+        /* Collapse edges in passes. In each pass every vertex is affected by at
+           most one collapse, which means the flip and topology checks done
+           for a collapse stay valid until all collapses are applied at the
+           end of the pass. */
+        Containers::Array<Collapse> collapses;
+        Containers::Array<UnsignedInt> remap{NoInit, vertexCount};
+        Containers::BitArray touched{NoInit, vertexCount};
+        while(indexCount > targetIndexCount) {
+            Containers::Array<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+            Implementation::buildAdjacency<UnsignedInt>(triangles.prefix(indexCount), vertexCount, liveTriangleCount, neighborOffset, neighbors);
+            const auto trianglesAround = [&](const UnsignedInt v) {
+                return Containers::arrayView(neighbors).slice(neighborOffset[v], neighborOffset[v + 1]);
+            };
+
+            /* Gather all possible collapses of edges with at least one
+               unlocked vertex. Each interior edge is in two triangles, take
+               it just from one of them. */
+            arrayClear(collapses);
+            for(std::size_t i = 0; i != indexCount; i += 3) {
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt a = triangles[i + j];
+                    const UnsignedInt b = triangles[i + (j + 1) % 3];
+                    if(a > b) continue;
+                    const Vector3d pa{positions[a]};
+                    const Vector3d pb{positions[b]};
+                    if(!locked[a]) {
+                        const Double error = quadricError(quadrics[a], quadrics[b], pb);
+                        if(error <= maxErrorSquared)
+                            arrayAppend(collapses, InPlaceInit, Float(error), a, b);
+                    }
+                    if(!locked[b]) {
+                        const Double error = quadricError(quadrics[a], quadrics[b], pa);
+                        if(error <= maxErrorSquared)
+                            arrayAppend(collapses, InPlaceInit, Float(error), b, a);
+                    }
+                }
+            }
+
+            /* Cheapest collapses first, ties resolved by vertex IDs to have
+               the result deterministic */
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+                if(a.error != b.error) return a.error < b.error;
+                if(a.from != b.from) return a.from < b.from;
+                return a.to < b.to;
+            });
+
+            for(UnsignedInt v = 0; v != vertexCount; ++v)
+                remap[v] = v;
+            touched.resetAll();
+            std::size_t remainingIndexCount = indexCount;
+            bool collapsed = false;
+            for(const Collapse& collapse: collapses) {
+                if(remainingIndexCount <= targetIndexCount) break;
+
+                const UnsignedInt from = collapse.from;
+                const UnsignedInt to = collapse.to;
+                if(touched[from] || touched[to]) continue;
+
+                /* The collapse would create a non-manifold edge if the two
+                   vertices have other common neighbors than the two opposite
+                   vertices of the triangles sharing the edge */
+                UnsignedInt commonNeighborCount = 0;
+                UnsignedInt sharedTriangleCount = 0;
+                for(const UnsignedInt t: trianglesAround(from)) {
+                    for(std::size_t i = 0; i != 3; ++i) {
+                        const UnsignedInt w = triangles[t*3 + i];
+                        if(w == to) ++sharedTriangleCount;
+                        /* Each neighbor is in two triangles around an
+                           interior vertex, count it just once by looking
+                           only at the vertex following it */
+                        if(w == from || w == to || triangles[t*3 + (i + 2) % 3] != from) continue;
+                        for(const UnsignedInt u: trianglesAround(to)) {
+                            if(triangles[u*3 + 0] == w || triangles[u*3 + 1] == w || triangles[u*3 + 2] == w) {
+                                ++commonNeighborCount;
+                                break;
+                            }
+                        }
+                    }
+                }
+                if(commonNeighborCount != 2) continue;
+
+                /* The collapse shouldn't flip any of the remaining triangles
+                   around the moved vertex, nor rotate their normal by more
+                   than ~75 degrees, as that produces folds and slivers */
+                bool flips = false;
+                for(const UnsignedInt t: trianglesAround(from)) {
+                    const UnsignedInt a = triangles[t*3 + 0];
+                    const UnsignedInt b = triangles[t*3 + 1];
+                    const UnsignedInt c = triangles[t*3 + 2];
+                    if(a == to || b == to || c == to) continue;
+                    const Vector3 pa = positions[a];
+                    const Vector3 pb = positions[b];
+                    const Vector3 pc = positions[c];
+                    const Vector3 before = Math::cross(pb - pa, pc - pa);
+                    const Vector3 qa = a == from ? positions[to] : pa;
+                    const Vector3 qb = b == from ? positions[to] : pb;
+                    const Vector3 qc = c == from ? positions[to] : pc;
+                    const Vector3 after = Math::cross(qb - qa, qc - qa);
+                    if(Math::dot(before, after) <= 0.25f*before.length()*after.length()) {
+                        flips = true;
+                        break;
+                    }
+                }
+                if(flips) continue;
+
+                /* Lock the whole neighborhood of the moved vertex for the rest
+                   of the pass */
+                for(const UnsignedInt t: trianglesAround(from)) {
+                    touched.set(triangles[t*3 + 0]);
+                    touched.set(triangles[t*3 + 1]);
+                    touched.set(triangles[t*3 + 2]);
+                }
+
+                remap[from] = to;
+                addQuadric(quadrics[to], quadrics[from]);
+                remainingIndexCount -= sharedTriangleCount*3;
+                collapsed = true;
+            }
+
+            if(!collapsed) break;
+
+            /* Apply the collapses, removing triangles that became
+               degenerate */
+            std::size_t newIndexCount = 0;
+            for(std::size_t i = 0; i != indexCount; i += 3) {
+                const UnsignedInt a = remap[triangles[i + 0]];
+                const UnsignedInt b = remap[triangles[i + 1]];
+                const UnsignedInt c = remap[triangles[i + 2]];
+                if(a == b || b == c || c == a) continue;
+
+                triangles[newIndexCount++] = a;
+                triangles[newIndexCount++] = b;
+                triangles[newIndexCount++] = c;
+            }
+            CORRADE_INTERNAL_ASSERT(newIndexCount == remainingIndexCount);
+            indexCount = newIndexCount;
+        }
+    }
+
+    for(std::size_t i = 0; i != indexCount; ++i)
+        indices[i] = triangles[i];
+    return indexCount;
+}
+
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, maxError);
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, maxError);
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    return simplifyInPlaceImplementation(indices, positions, targetIndexCount, maxError);
+}
+
+std::size_t simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::simplifyInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), positions, targetIndexCount, maxError);
+    else if(indices.size()[1] == 2)
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), positions, targetIndexCount, maxError);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return simplifyInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), positions, targetIndexCount, maxError);
+    }
+}
+
+namespace {
+
+/* Simplifies indices of `mesh` and returns them as a new owned array
+   together with the index count */
+Containers::Array<char> simplifyIndices(const Trade::MeshData& mesh, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t targetIndexCount, const Float maxError, std::size_t& indexCount) {
+    const UnsignedInt indexTypeSize = meshIndexTypeSize(mesh.indexType());
+    Containers::Array<char> indexData{NoInit, mesh.indexCount()*indexTypeSize};
+    const Containers::StridedArrayView2D<char> indices{indexData, {mesh.indexCount(), indexTypeSize}};
+    Utility::copy(mesh.indices(), indices);
+    indexCount = simplifyInPlace(indices, positions, targetIndexCount, maxError);
+
+    /* Copy the prefix to a new array to not waste memory, same as in
+       removeDuplicates() */
+    Containers::Array<char> out{NoInit, indexCount*indexTypeSize};
+    Utility::copy(indexData.prefix(out.size()), out);
+    return out;
+}
+
+}
+
+Trade::MeshData simplify(const Trade::MeshData& mesh, const std::size_t targetIndexCount, const Float maxError) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::simplify(): mesh data not indexed",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::simplify(): expected a MeshPrimitive::Triangles mesh but got" << mesh.primitive(),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::simplify(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::simplify(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    std::size_t indexCount;
+    Containers::Array<char> indexData = simplifyIndices(mesh, positions, targetIndexCount, maxError, indexCount);
+
+    /* Make an owned copy of the vertex data and attributes */
+    Trade::MeshData owned = copy(Trade::MeshData{mesh.primitive(),
+        {}, mesh.vertexData(), Trade::meshAttributeDataNonOwningArray(mesh.attributeData()),
+        mesh.vertexCount()});
+
+    const Trade::MeshIndexData indices{mesh.indexType(), indexData};
+    return Trade::MeshData{mesh.primitive(),
+        Utility::move(indexData), indices,
+        owned.releaseVertexData(), owned.releaseAttributeData(),
+        mesh.vertexCount()};
+}
+
+Containers::Array<Trade::MeshData> generateLods(const Trade::MeshData& mesh, const Containers::ArrayView<const Float> ratios, const Float maxError) {
+    CORRADE_ASSERT(mesh.isIndexed(),
+        "MeshTools::generateLods(): mesh data not indexed", {});
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateLods(): expected a MeshPrimitive::Triangles mesh but got" << mesh.primitive(), {});
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::generateLods(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::generateLods(): the mesh has no positions", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != ratios.size(); ++i)
+        CORRADE_ASSERT(ratios[i] >= 0.0f && ratios[i] <= (i ? ratios[i - 1] : 1.0f),
+            "MeshTools::generateLods(): expected ratio" << i << "to be in range [0," << (i ? ratios[i - 1] : 1.0f) << Debug::nospace << "], got" << ratios[i], {});
+    #endif
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+
+    /* Each level is constructed in-place as Trade::MeshData isn't default
+       constructible */
+    Containers::Array<Trade::MeshData> out{NoInit, ratios.size() + 1};
+    new(&out[0]) Trade::MeshData{copy(mesh)};
+    for(std::size_t i = 0; i != ratios.size(); ++i) {
+        const Trade::MeshData& previous = out[i];
+        /* Round the target index count down to whole triangles */
+        const std::size_t targetIndexCount = std::size_t(mesh.indexCount()/3*ratios[i])*3;
+        std::size_t indexCount;
+        Containers::Array<char> indexData = simplifyIndices(previous, positions, targetIndexCount, maxError, indexCount);
+
+        const Trade::MeshIndexData indices{mesh.indexType(), indexData};
+        new(&out[i + 1]) Trade::MeshData{mesh.primitive(),
+            Utility::move(indexData), indices,
+            {}, out[0].vertexData(), Trade::meshAttributeDataNonOwningArray(out[0].attributeData()),
+            out[0].vertexCount()};
+    }
+
+    return out;
+}
+
+Containers::Array<Trade::MeshData> generateLods(const Trade::MeshData& mesh, const std::initializer_list<Float> ratios, const Float maxError) {
+    return generateLods(mesh, Containers::arrayView(ratios), maxError);
+}
+
+}}
@@ -0,0 +1,155 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::simplifyInPlace(), @ref Magnum::MeshTools::generateLods()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify a triangle mesh in-place
+@param[in,out] indices      Triangle index buffer
+@param[in] positions        Vertex positions
+@param[in] targetIndexCount Index count to reduce the mesh to
+@param[in] maxError         Max error relative to the mesh size
+@return Resulting index count
+@m_since_latest
+
+Repeatedly collapses mesh edges with the smallest quadric error, moving one
+vertex of the edge onto the other, until the index count is at most
+@p targetIndexCount or no edge can be collapsed without the error exceeding
+@p maxError times the largest dimension of the mesh bounding box. The default
+of @cpp 1.0f @ce effectively means the error isn't limited. Algorithm used:
+
+-   *Michael Garland and Paul S. Heckbert --- Surface Simplification Using
+    Quadric Error Metrics, SIGGRAPH 1997,
+    https://www.cs.cmu.edu/~garland/Papers/quadrics.pdf*
+
+As vertices are only ever moved onto other existing vertices, the vertex data
+can stay unchanged and shared among several simplified index buffers, which is
+what @ref generateLods() relies on. Vertices that share a position with
+another vertex, i.e. vertices on seams of texture coordinates, normals or other
+attributes, vertices on open mesh borders and vertices on non-manifold edges
+are never moved, so seams and borders are preserved. Edge collapses that would
+flip a triangle or create non-manifold topology are skipped. Degenerate
+triangles are removed.
+
+The first returned count of items in @p indices contains the simplified index
+buffer, the rest is left in an unspecified state. Expects that the index count
+is divisible by @cpp 3 @ce and all indices are less than @p positions size.
+@see @ref simplify(), @ref optimizeVertexFetchInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float maxError = 1.0f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float maxError = 1.0f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float maxError = 1.0f);
+
+/**
+@brief Simplify a triangle mesh with a type-erased index buffer in-place
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref simplifyInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t simplifyInPlace(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t targetIndexCount, Float maxError = 1.0f);
+
+/**
+@brief Simplify a triangle mesh
+@param mesh             Input mesh
+@param targetIndexCount Index count to reduce the mesh to
+@param maxError         Max error relative to the mesh size
+@m_since_latest
+
+Calls @ref simplifyInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+on a copy of the index buffer, with positions taken from
+@ref Trade::MeshData::positions3DAsArray(). The index type is preserved, vertex
+data are copied as-is, including vertices that are no longer referenced ---
+pass the result to @ref optimizeVertexFetch() to remove them. Expects that the
+mesh is indexed with a non-implementation-specific index type, is a
+@ref MeshPrimitive::Triangles and has a @ref Trade::MeshAttribute::Position.
+@see @ref generateLods()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(const Trade::MeshData& mesh, std::size_t targetIndexCount, Float maxError = 1.0f);
+
+/**
+@brief Generate a chain of levels of detail
+@param mesh     Input mesh
+@param ratios   Target index count ratios for each level
+@param maxError Max error relative to the mesh size
+@m_since_latest
+
+Returns @cpp ratios.size() + 1 @ce meshes. The first is an owned copy of
+@p mesh made with @ref copy(), each following is created by simplifying the
+previous level with
+@ref simplifyInPlace(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<const Vector3>&, std::size_t, Float)
+to the corresponding ratio of the original index count. If a level can't be
+simplified further within @p maxError, it's the same as the previous one.
+
+All levels share the vertex data of the first level --- the remaining levels
+own only their index data and have @ref Trade::MeshData::vertexDataFlags()
+empty, referencing @ref Trade::MeshData::vertexData() and attributes of the
+first level. The first level thus has to stay alive for as long as the other
+levels are used. The levels can be passed directly to
+@ref Trade::AbstractSceneConverter::add(const Containers::Iterable<const Trade::MeshData>&, Containers::StringView)
+for converters supporting @ref Trade::SceneConverterFeature::MeshLevels, or
+uploaded to the GPU as a single vertex buffer with one index buffer per level.
+
+Expects the same as @ref simplify(), and additionally that each ratio is in the
+@f$ [0, 1] @f$ range and not larger than the previous ratio.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Trade::MeshData> generateLods(const Trade::MeshData& mesh, Containers::ArrayView<const Float> ratios, Float maxError = 1.0f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<Trade::MeshData> generateLods(const Trade::MeshData& mesh, std::initializer_list<Float> ratios, Float maxError = 1.0f);
+
+}}
+
+#endif
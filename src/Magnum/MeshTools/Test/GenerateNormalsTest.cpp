@@ -24,18 +24,21 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/GenerateNormals.h"
 #include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Primitives/UVSphere.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
@@ -56,6 +59,10 @@ struct GenerateNormalsTest: TestSuite::Tester {
     void smoothWrongCount();
     void smoothOutOfRange();
     void smoothIntoWrongSize();
+    void smoothManyTrianglesSmallIndexType();
+
+    void smoothMultithreaded();
+    void smoothMultithreadedOutOfRange();
 
     template<class T> void smoothErased();
     void smoothErasedNonContiguous();
@@ -63,6 +70,24 @@ struct GenerateNormalsTest: TestSuite::Tester {
 
     void benchmarkFlat();
     void benchmarkSmooth();
+    void benchmarkSmoothLarge();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} SmoothMultithreadedData[]{
+    {"2 threads", 2},
+    {"5 threads", 5},
+    {"all threads", 0}
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BenchmarkSmoothLargeData[]{
+    {"", 1},
+    {"all threads", 0}
 };
 
 GenerateNormalsTest::GenerateNormalsTest() {
@@ -81,6 +106,7 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothWrongCount,
               &GenerateNormalsTest::smoothOutOfRange,
               &GenerateNormalsTest::smoothIntoWrongSize,
+              &GenerateNormalsTest::smoothManyTrianglesSmallIndexType,
 
               &GenerateNormalsTest::smoothErased<UnsignedByte>,
               &GenerateNormalsTest::smoothErased<UnsignedShort>,
@@ -88,8 +114,16 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothErasedNonContiguous,
               &GenerateNormalsTest::smoothErasedWrongIndexSize});
 
+    addInstancedTests({&GenerateNormalsTest::smoothMultithreaded},
+        Containers::arraySize(SmoothMultithreadedData));
+
+    addTests({&GenerateNormalsTest::smoothMultithreadedOutOfRange});
+
     addBenchmarks({&GenerateNormalsTest::benchmarkFlat,
                    &GenerateNormalsTest::benchmarkSmooth}, 150);
+
+    addInstancedBenchmarks({&GenerateNormalsTest::benchmarkSmoothLarge}, 10,
+        Containers::arraySize(BenchmarkSmoothLargeData));
 }
 
 /* Two vertices connected by one edge, each wound in another direction */
@@ -389,6 +423,86 @@ void GenerateNormalsTest::smoothIntoWrongSize() {
     CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): bad output size, expected 3 but got 4\n");
 }
 
+void GenerateNormalsTest::smoothManyTrianglesSmallIndexType() {
+    /* Two triangles facing opposite directions, with the second referenced
+       only by triangles with IDs larger than 255. If triangle IDs were stored
+       in the index type, these would wrap around and point to the first
+       triangle, which doesn't contain the second triangle vertices. */
+    Containers::Array<UnsignedByte> indices{NoInit, 300*3};
+    for(std::size_t i = 0; i != 256; ++i) {
+        indices[i*3 + 0] = 0;
+        indices[i*3 + 1] = 1;
+        indices[i*3 + 2] = 2;
+    }
+    for(std::size_t i = 256; i != 300; ++i) {
+        indices[i*3 + 0] = 3;
+        indices[i*3 + 1] = 4;
+        indices[i*3 + 2] = 5;
+    }
+
+    CORRADE_COMPARE_AS(generateSmoothNormals(indices, TwoTriangles),
+        Containers::arrayView<Vector3>({
+            Vector3::zAxis(),
+            Vector3::zAxis(),
+            Vector3::zAxis(),
+            -Vector3::zAxis(),
+            -Vector3::zAxis(),
+            -Vector3::zAxis()
+        }), TestSuite::Compare::Container);
+}
+
+void GenerateNormalsTest::smoothMultithreaded() {
+    auto&& data = SmoothMultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A sphere has vertices shared by a varying number of triangles, and the
+       poles and the seam make the adjacency irregular enough. Append the
+       beveled cube to have also hard edges and a few vertices that aren't
+       referenced at all. */
+    const Trade::MeshData sphere = Primitives::uvSphereSolid(40, 60);
+    Containers::Array<Vector3> positions;
+    Containers::Array<UnsignedInt> indices;
+    {
+        const Containers::StridedArrayView1D<const Vector3> spherePositions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+        const Containers::Array<UnsignedInt> sphereIndices = sphere.indicesAsArray();
+        positions = Containers::Array<Vector3>{NoInit, spherePositions.size() + Containers::arraySize(BeveledCubePositions) + 3};
+        indices = Containers::Array<UnsignedInt>{NoInit, sphereIndices.size() + Containers::arraySize(BeveledCubeIndices)};
+        Utility::copy(spherePositions, positions.prefix(spherePositions.size()));
+        Utility::copy(BeveledCubePositions, positions.sliceSize(spherePositions.size(), Containers::arraySize(BeveledCubePositions)));
+        for(Vector3& i: positions.exceptPrefix(positions.size() - 3)) i = Vector3{5.0f};
+        Utility::copy(sphereIndices, indices.prefix(sphereIndices.size()));
+        for(std::size_t i = 0; i != Containers::arraySize(BeveledCubeIndices); ++i)
+            indices[sphereIndices.size() + i] = BeveledCubeIndices[i] + spherePositions.size();
+    }
+
+    const Containers::Array<Vector3> expected = generateSmoothNormals(indices, positions);
+    const Containers::Array<Vector3> normals = generateSmoothNormals(indices, positions, data.threadCount);
+
+    /* The accumulation order is the same, so the output should be
+       bit-identical, including the NaNs for unreferenced vertices */
+    CORRADE_COMPARE(normals.size(), expected.size());
+    CORRADE_VERIFY(std::memcmp(normals.data(), expected.data(), normals.size()*sizeof(Vector3)) == 0);
+
+    /* The type-erased variant should give the same result */
+    const Containers::Array<Vector3> normalsErased = generateSmoothNormals(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), positions, data.threadCount);
+    CORRADE_COMPARE(normalsErased.size(), expected.size());
+    CORRADE_VERIFY(std::memcmp(normalsErased.data(), expected.data(), normalsErased.size()*sizeof(Vector3)) == 0);
+}
+
+void GenerateNormalsTest::smoothMultithreadedOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    /* The first out-of-range index should be reported, even if it's not in
+       the first chunk */
+    const Vector3 positions[4];
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 2, 3, 5, 2, 0, 7, 2};
+    generateSmoothNormals(indices, positions, 3);
+    CORRADE_COMPARE(out, "MeshTools::generateSmoothNormalsInto(): index 5 out of range for 4 elements\n");
+}
+
 void GenerateNormalsTest::benchmarkFlat() {
     Containers::Array<Vector3> positions = duplicate(
         Containers::stridedArrayView(BeveledCubeIndices),
@@ -411,6 +525,23 @@ void GenerateNormalsTest::benchmarkSmooth() {
     CORRADE_COMPARE(Math::min(normals), (Vector3{-0.996072f, -0.997808f, -0.996072f}));
 }
 
+void GenerateNormalsTest::benchmarkSmoothLarge() {
+    auto&& data = BenchmarkSmoothLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* About a million triangles */
+    const Trade::MeshData sphere = Primitives::uvSphereSolid(512, 1024);
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Containers::Array<Vector3> normals{NoInit, positions.size()};
+    CORRADE_BENCHMARK(1) {
+        generateSmoothNormalsInto(sphere.indices(), positions, normals, data.threadCount);
+    }
+
+    /* The first vertex is the bottom pole, surrounded by a symmetric fan */
+    CORRADE_COMPARE(normals[0], -Vector3::yAxis());
+}
+
 template<class T> void GenerateNormalsTest::smoothErased() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
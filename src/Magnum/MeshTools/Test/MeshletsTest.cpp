@@ -0,0 +1,396 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm> /* std::sort() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Meshlets.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct MeshletsTest: TestSuite::Tester {
+    explicit MeshletsTest();
+
+    template<class T> void buildMeshlets();
+    void buildMeshletsLimits();
+    void buildMeshletsDegenerateTriangles();
+    void buildMeshletsDisconnected();
+    void buildMeshletsErased();
+    void buildMeshletsErasedNonContiguous();
+    void buildMeshletsErasedWrongIndexSize();
+    void buildMeshletsMeshData();
+    void buildMeshletsEmpty();
+    void buildMeshletsInvalid();
+
+    void backfacing();
+    void backfacingSphere();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt maxVertexCount, maxTriangleCount;
+    UnsignedInt expectedMeshletCount;
+} LimitsData[]{
+    /* Each triangle is a meshlet */
+    {"one triangle", 3, 1, 242},
+    /* Each triangle is a meshlet, as there's no other triangle with just
+       one new vertex */
+    {"three vertices", 3, 124, 242},
+    /* Each quad is a meshlet */
+    {"two triangles", 4, 2, 121},
+    /* Everything fits into a single meshlet */
+    {"everything", 256, 256, 1},
+};
+
+MeshletsTest::MeshletsTest() {
+    addTests({&MeshletsTest::buildMeshlets<UnsignedInt>,
+              &MeshletsTest::buildMeshlets<UnsignedShort>,
+              &MeshletsTest::buildMeshlets<UnsignedByte>});
+
+    addInstancedTests({&MeshletsTest::buildMeshletsLimits},
+        Containers::arraySize(LimitsData));
+
+    addTests({&MeshletsTest::buildMeshletsDegenerateTriangles,
+              &MeshletsTest::buildMeshletsDisconnected,
+              &MeshletsTest::buildMeshletsErased,
+              &MeshletsTest::buildMeshletsErasedNonContiguous,
+              &MeshletsTest::buildMeshletsErasedWrongIndexSize,
+              &MeshletsTest::buildMeshletsMeshData,
+              &MeshletsTest::buildMeshletsEmpty,
+              &MeshletsTest::buildMeshletsInvalid,
+
+              &MeshletsTest::backfacing,
+              &MeshletsTest::backfacingSphere});
+}
+
+/* Original triangles sorted, to compare with meshlet contents regardless of
+   their order */
+Containers::Array<Vector3ui> sortedTriangles(const Containers::StridedArrayView1D<const UnsignedInt>& indices) {
+    Containers::Array<Vector3ui> out{NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = {indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        return std::lexicographical_compare(a.data(), a.data() + 3, b.data(), b.data() + 3);
+    });
+    return out;
+}
+
+Containers::Array<UnsignedInt> meshletIndices(const Meshlets& meshlets) {
+    Containers::Array<UnsignedInt> out{NoInit, meshlets.triangles.size()};
+    std::size_t i = 0;
+    for(const Meshlet& meshlet: meshlets.meshlets)
+        for(std::size_t j = 0; j != meshlet.triangleCount*3; ++j)
+            out[i++] = meshlets.vertices[meshlet.vertexOffset + meshlets.triangles[meshlet.triangleOffset*3 + j]];
+    CORRADE_INTERNAL_ASSERT(i == out.size());
+    return out;
+}
+
+/* Verifies that the meshlets are within limits, are contiguous and the bounding
+   sphere contains all their vertices */
+void verifyMeshlets(const Meshlets& meshlets, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    UnsignedInt vertexOffset = 0, triangleOffset = 0;
+    for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+        const Meshlet& meshlet = meshlets.meshlets[i];
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(meshlet.vertexOffset, vertexOffset);
+        CORRADE_COMPARE(meshlet.triangleOffset, triangleOffset);
+        CORRADE_COMPARE_AS(meshlet.vertexCount, maxVertexCount, TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(meshlet.triangleCount, maxTriangleCount, TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(meshlet.triangleCount, 0, TestSuite::Compare::Greater);
+        for(std::size_t j = 0; j != meshlet.vertexCount; ++j)
+            CORRADE_COMPARE_AS((positions[meshlets.vertices[meshlet.vertexOffset + j]] - meshlet.center).length(), meshlet.radius*1.0001f, TestSuite::Compare::LessOrEqual);
+        for(std::size_t j = 0; j != meshlet.triangleCount*3; ++j)
+            CORRADE_COMPARE_AS(meshlets.triangles[meshlet.triangleOffset*3 + j], meshlet.vertexCount, TestSuite::Compare::Less);
+        vertexOffset += meshlet.vertexCount;
+        triangleOffset += meshlet.triangleCount;
+    }
+    CORRADE_COMPARE(meshlets.vertices.size(), vertexOffset);
+    CORRADE_COMPARE(meshlets.triangles.size(), triangleOffset*3);
+}
+
+template<class T> void MeshletsTest::buildMeshlets() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* A 12x12 vertex grid, which fits into 8-bit indices as well */
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<T> indices{NoInit, grid.indexCount()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = grid.indices<UnsignedInt>()[i];
+
+    Meshlets meshlets = MeshTools::buildMeshlets(Containers::stridedArrayView(indices), positions, 64, 124);
+    /* 242 triangles and 144 vertices won't fit into less than three */
+    CORRADE_COMPARE_AS(meshlets.meshlets.size(), 3, TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(meshlets.meshlets.size(), 8, TestSuite::Compare::LessOrEqual);
+    verifyMeshlets(meshlets, positions, 64, 124);
+
+    /* All triangles are there, with the original winding */
+    CORRADE_COMPARE_AS(sortedTriangles(meshletIndices(meshlets)),
+        sortedTriangles(grid.indices<UnsignedInt>()),
+        TestSuite::Compare::Container);
+
+    /* All triangles face +Z, so the cone is infinitely narrow */
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        CORRADE_COMPARE(meshlet.center.z(), 0.0f);
+        CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+    }
+}
+
+void MeshletsTest::buildMeshletsLimits() {
+    auto&& data = LimitsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Meshlets meshlets = MeshTools::buildMeshlets(grid.indices<UnsignedInt>(), positions, data.maxVertexCount, data.maxTriangleCount);
+    CORRADE_COMPARE(meshlets.meshlets.size(), data.expectedMeshletCount);
+    verifyMeshlets(meshlets, positions, data.maxVertexCount, data.maxTriangleCount);
+    CORRADE_COMPARE_AS(sortedTriangles(meshletIndices(meshlets)),
+        sortedTriangles(grid.indices<UnsignedInt>()),
+        TestSuite::Compare::Container);
+}
+
+void MeshletsTest::buildMeshletsDegenerateTriangles() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+    };
+    const UnsignedInt indices[]{
+        0, 1, 1,
+        0, 1, 2,
+        3, 3, 3,
+        2, 1, 3
+    };
+
+    Meshlets meshlets = MeshTools::buildMeshlets(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].vertexCount, 4);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleCount, 2);
+    CORRADE_COMPARE_AS(meshletIndices(meshlets), Containers::arrayView<UnsignedInt>({
+        0, 1, 2,
+        2, 1, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(meshlets.meshlets[0].coneAxis, Vector3::zAxis());
+}
+
+void MeshletsTest::buildMeshletsDisconnected() {
+    /* Two triangles facing opposite directions, not connected to each
+       other */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f},
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        3, 4, 5
+    };
+
+    Meshlets meshlets = MeshTools::buildMeshlets(Containers::stridedArrayView(indices), positions);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].vertexCount, 6);
+    CORRADE_COMPARE(meshlets.meshlets[0].triangleCount, 2);
+    CORRADE_COMPARE_AS(meshletIndices(meshlets),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    /* The normals cancel each other out, so the meshlet is visible from
+       everywhere */
+    CORRADE_COMPARE(meshlets.meshlets[0].coneAxis, Vector3{});
+    CORRADE_COMPARE(meshlets.meshlets[0].coneCutoff, 1.0f);
+}
+
+void MeshletsTest::buildMeshletsErased() {
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<UnsignedShort> indices{NoInit, grid.indexCount()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = grid.indices<UnsignedInt>()[i];
+
+    Meshlets expected = MeshTools::buildMeshlets(grid.indices<UnsignedInt>(), positions);
+    Meshlets meshlets = MeshTools::buildMeshlets(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), positions);
+    CORRADE_COMPARE(meshlets.meshlets.size(), expected.meshlets.size());
+    CORRADE_COMPARE_AS(meshlets.vertices,
+        expected.vertices,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles,
+        expected.triangles,
+        TestSuite::Compare::Container);
+}
+
+void MeshletsTest::buildMeshletsErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::buildMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, Containers::arrayView<const Vector3>({{}, {}, {}, {}, {}, {}}));
+    CORRADE_COMPARE(out, "MeshTools::buildMeshlets(): second index view dimension is not contiguous\n");
+}
+
+void MeshletsTest::buildMeshletsErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::buildMeshlets(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, Containers::arrayView<const Vector3>({{}, {}, {}, {}, {}, {}}));
+    CORRADE_COMPARE(out, "MeshTools::buildMeshlets(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void MeshletsTest::buildMeshletsMeshData() {
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+
+    Meshlets expected = MeshTools::buildMeshlets(grid.indices<UnsignedInt>(), positions, 32, 40);
+    Meshlets meshlets = MeshTools::buildMeshlets(grid, 32, 40);
+    CORRADE_COMPARE(meshlets.meshlets.size(), expected.meshlets.size());
+    CORRADE_COMPARE_AS(meshlets.vertices,
+        expected.vertices,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles,
+        expected.triangles,
+        TestSuite::Compare::Container);
+}
+
+void MeshletsTest::buildMeshletsEmpty() {
+    Meshlets meshlets = MeshTools::buildMeshlets(Containers::StridedArrayView1D<const UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{});
+    CORRADE_COMPARE(meshlets.meshlets.size(), 0);
+    CORRADE_COMPARE(meshlets.vertices.size(), 0);
+    CORRADE_COMPARE(meshlets.triangles.size(), 0);
+}
+
+void MeshletsTest::buildMeshletsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const UnsignedInt indices[]{0, 1, 2, 3, 1, 0};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles, 3};
+    Trade::MeshData notTriangles{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::buildMeshlets(Containers::stridedArrayView(indices).prefix(5), positions);
+    MeshTools::buildMeshlets(Containers::stridedArrayView(indices).prefix(3), positions, 2, 124);
+    MeshTools::buildMeshlets(Containers::stridedArrayView(indices).prefix(3), positions, 257, 124);
+    MeshTools::buildMeshlets(Containers::stridedArrayView(indices).prefix(3), positions, 64, 0);
+    MeshTools::buildMeshlets(Containers::stridedArrayView(indices), positions);
+    MeshTools::buildMeshlets(notIndexed);
+    MeshTools::buildMeshlets(notTriangles);
+    MeshTools::buildMeshlets(implementationSpecificIndexType);
+    MeshTools::buildMeshlets(noPositions);
+    CORRADE_COMPARE(out,
+        "MeshTools::buildMeshlets(): index count not divisible by 3\n"
+        "MeshTools::buildMeshlets(): expected max vertex count to be in range [3, 256], got 2\n"
+        "MeshTools::buildMeshlets(): expected max vertex count to be in range [3, 256], got 257\n"
+        "MeshTools::buildMeshlets(): expected non-zero max triangle count\n"
+        "MeshTools::buildMeshlets(): index 3 out of range for 3 vertices\n"
+        "MeshTools::buildMeshlets(): mesh data not indexed\n"
+        "MeshTools::buildMeshlets(): expected a MeshPrimitive::Triangles mesh but got MeshPrimitive::Lines\n"
+        "MeshTools::buildMeshlets(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::buildMeshlets(): the mesh has no positions\n");
+}
+
+void MeshletsTest::backfacing() {
+    Meshlet meshlet{};
+    meshlet.center = {};
+    meshlet.radius = 1.0f;
+    meshlet.coneAxis = Vector3::zAxis();
+    meshlet.coneCutoff = 0.5f;
+
+    /* Looking from behind, within the cone */
+    CORRADE_VERIFY(MeshTools::isMeshletBackfacing(meshlet, {0.0f, 0.0f, -10.0f}));
+    /* Looking from the front */
+    CORRADE_VERIFY(!MeshTools::isMeshletBackfacing(meshlet, {0.0f, 0.0f, 10.0f}));
+    /* Looking from the side */
+    CORRADE_VERIFY(!MeshTools::isMeshletBackfacing(meshlet, {10.0f, 0.0f, -1.0f}));
+    /* Looking from behind, but too close for the bounding sphere */
+    CORRADE_VERIFY(!MeshTools::isMeshletBackfacing(meshlet, {0.0f, 0.0f, -1.5f}));
+
+    /* With the cutoff being 1 it's never backfacing */
+    meshlet.coneCutoff = 1.0f;
+    CORRADE_VERIFY(!MeshTools::isMeshletBackfacing(meshlet, {0.0f, 0.0f, -10.0f}));
+}
+
+void MeshletsTest::backfacingSphere() {
+    Trade::MeshData sphere = Primitives::uvSphereSolid(32, 64);
+    Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+
+    Meshlets meshlets = MeshTools::buildMeshlets(sphere);
+    verifyMeshlets(meshlets, positions, 64, 124);
+
+    /* The culling is conservative, so it should never cull a meshlet that has
+       any triangle facing the camera */
+    const Vector3 viewPosition{0.0f, 0.0f, 5.0f};
+    std::size_t culledCount = 0;
+    for(std::size_t i = 0; i != meshlets.meshlets.size(); ++i) {
+        const Meshlet& meshlet = meshlets.meshlets[i];
+        CORRADE_ITERATION(i);
+        /* All cones point outwards */
+        CORRADE_COMPARE_AS(Math::dot(meshlet.coneAxis, meshlet.center), 0.0f, TestSuite::Compare::Greater);
+
+        if(!MeshTools::isMeshletBackfacing(meshlet, viewPosition))
+            continue;
+
+        ++culledCount;
+        for(std::size_t j = 0; j != meshlet.triangleCount; ++j) {
+            Vector3 p[3];
+            for(std::size_t k = 0; k != 3; ++k)
+                p[k] = positions[meshlets.vertices[meshlet.vertexOffset + meshlets.triangles[(meshlet.triangleOffset + j)*3 + k]]];
+            CORRADE_COMPARE_AS(Math::dot(p[0] - viewPosition, Math::cross(p[1] - p[0], p[2] - p[0])), 0.0f, TestSuite::Compare::GreaterOrEqual);
+        }
+    }
+
+    /* But it should cull at least some */
+    CORRADE_COMPARE_AS(culledCount, 0, TestSuite::Compare::Greater);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshletsTest)
@@ -0,0 +1,586 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm> /* std::sort() */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Optimize.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeTest: TestSuite::Tester {
+    explicit OptimizeTest();
+
+    template<class T> void analyzeVertexCache();
+    void analyzeVertexCacheErased();
+    void analyzeVertexCacheErasedNonContiguous();
+    void analyzeVertexCacheErasedWrongIndexSize();
+    void analyzeVertexCacheMeshData();
+    void analyzeVertexCacheEmpty();
+    void analyzeVertexCacheInvalid();
+
+    template<class T> void optimizeVertexCache();
+    void optimizeVertexCacheDegenerateTriangles();
+    void optimizeVertexCacheErased();
+    void optimizeVertexCacheMeshData();
+    void optimizeVertexCacheEmpty();
+    void optimizeVertexCacheInvalid();
+
+    template<class T> void optimizeOverdraw();
+    void optimizeOverdrawErased();
+    void optimizeOverdrawMeshData();
+    void optimizeOverdrawInvalid();
+
+    template<class T> void optimizeVertexFetch();
+    void optimizeVertexFetchErased();
+    void optimizeVertexFetchMeshData();
+    void optimizeVertexFetchInvalid();
+};
+
+OptimizeTest::OptimizeTest() {
+    addTests({&OptimizeTest::analyzeVertexCache<UnsignedInt>,
+              &OptimizeTest::analyzeVertexCache<UnsignedShort>,
+              &OptimizeTest::analyzeVertexCache<UnsignedByte>,
+              &OptimizeTest::analyzeVertexCacheErased,
+              &OptimizeTest::analyzeVertexCacheErasedNonContiguous,
+              &OptimizeTest::analyzeVertexCacheErasedWrongIndexSize,
+              &OptimizeTest::analyzeVertexCacheMeshData,
+              &OptimizeTest::analyzeVertexCacheEmpty,
+              &OptimizeTest::analyzeVertexCacheInvalid,
+
+              &OptimizeTest::optimizeVertexCache<UnsignedInt>,
+              &OptimizeTest::optimizeVertexCache<UnsignedShort>,
+              &OptimizeTest::optimizeVertexCache<UnsignedByte>,
+              &OptimizeTest::optimizeVertexCacheDegenerateTriangles,
+              &OptimizeTest::optimizeVertexCacheErased,
+              &OptimizeTest::optimizeVertexCacheMeshData,
+              &OptimizeTest::optimizeVertexCacheEmpty,
+              &OptimizeTest::optimizeVertexCacheInvalid,
+
+              &OptimizeTest::optimizeOverdraw<UnsignedInt>,
+              &OptimizeTest::optimizeOverdraw<UnsignedShort>,
+              &OptimizeTest::optimizeOverdraw<UnsignedByte>,
+              &OptimizeTest::optimizeOverdrawErased,
+              &OptimizeTest::optimizeOverdrawMeshData,
+              &OptimizeTest::optimizeOverdrawInvalid,
+
+              &OptimizeTest::optimizeVertexFetch<UnsignedInt>,
+              &OptimizeTest::optimizeVertexFetch<UnsignedShort>,
+              &OptimizeTest::optimizeVertexFetch<UnsignedByte>,
+              &OptimizeTest::optimizeVertexFetchErased,
+              &OptimizeTest::optimizeVertexFetchMeshData,
+              &OptimizeTest::optimizeVertexFetchInvalid});
+}
+
+/* With a cache of size 3, the last triangle makes vertex 0 a miss again. With
+   a cache of size 4 everything fits. */
+constexpr UnsignedInt CacheIndices[]{
+    0, 1, 2,
+    2, 1, 3,
+    0, 3, 2
+};
+
+template<class T> void OptimizeTest::analyzeVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(CacheIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(CacheIndices); ++i)
+        indices[i] = CacheIndices[i];
+
+    VertexCacheStatistics smallCache = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 5, 3);
+    CORRADE_COMPARE(smallCache.transformedVertexCount, 5);
+    CORRADE_COMPARE(smallCache.averageCacheMissRatio, 5.0f/3.0f);
+    CORRADE_COMPARE(smallCache.averageTransformedToVertexRatio, 1.25f);
+
+    VertexCacheStatistics largeCache = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 5, 4);
+    CORRADE_COMPARE(largeCache.transformedVertexCount, 4);
+    CORRADE_COMPARE(largeCache.averageCacheMissRatio, 4.0f/3.0f);
+    CORRADE_COMPARE(largeCache.averageTransformedToVertexRatio, 1.0f);
+}
+
+void OptimizeTest::analyzeVertexCacheErased() {
+    UnsignedShort indices[Containers::arraySize(CacheIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(CacheIndices); ++i)
+        indices[i] = CacheIndices[i];
+
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)), 5, 3);
+    CORRADE_COMPARE(out.transformedVertexCount, 5);
+    CORRADE_COMPARE(out.averageCacheMissRatio, 5.0f/3.0f);
+    CORRADE_COMPARE(out.averageTransformedToVertexRatio, 1.25f);
+}
+
+void OptimizeTest::analyzeVertexCacheErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+    UnsignedInt positions[6]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, 6, 16);
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, 6);
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, Containers::arrayView<const Vector3>({{}, {}, {}, {}, {}, {}}));
+    MeshTools::optimizeVertexFetchInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, Containers::arrayCast<2, char>(Containers::stridedArrayView(positions)));
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): second index view dimension is not contiguous\n"
+        "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous\n"
+        "MeshTools::optimizeOverdrawInPlace(): second index view dimension is not contiguous\n"
+        "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous\n");
+}
+
+void OptimizeTest::analyzeVertexCacheErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+    UnsignedInt positions[6]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, 6, 16);
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, 6);
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, Containers::arrayView<const Vector3>({{}, {}, {}, {}, {}, {}}));
+    MeshTools::optimizeVertexFetchInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, Containers::arrayCast<2, char>(Containers::stridedArrayView(positions)));
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::optimizeOverdrawInPlace(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void OptimizeTest::analyzeVertexCacheMeshData() {
+    Vector3 positions[5];
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, CacheIndices, Trade::MeshIndexData{CacheIndices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(mesh, 3);
+    CORRADE_COMPARE(out.transformedVertexCount, 5);
+    CORRADE_COMPARE(out.averageCacheMissRatio, 5.0f/3.0f);
+    CORRADE_COMPARE(out.averageTransformedToVertexRatio, 1.25f);
+}
+
+void OptimizeTest::analyzeVertexCacheEmpty() {
+    VertexCacheStatistics out = MeshTools::analyzeVertexCache(Containers::StridedArrayView1D<const UnsignedInt>{}, 5, 16);
+    CORRADE_COMPARE(out.transformedVertexCount, 0);
+    CORRADE_COMPARE(out.averageCacheMissRatio, 0.0f);
+    CORRADE_COMPARE(out.averageTransformedToVertexRatio, 0.0f);
+}
+
+void OptimizeTest::analyzeVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3, 1, 0};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles, 3};
+    Trade::MeshData notTriangles{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices).prefix(5), 4, 16);
+    MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 3, 16);
+    MeshTools::analyzeVertexCache(notIndexed, 16);
+    MeshTools::analyzeVertexCache(notTriangles, 16);
+    MeshTools::analyzeVertexCache(implementationSpecificIndexType, 16);
+    CORRADE_COMPARE(out,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3\n"
+        "MeshTools::analyzeVertexCache(): index 3 out of range for 3 vertices\n"
+        "MeshTools::analyzeVertexCache(): mesh data not indexed\n"
+        "MeshTools::analyzeVertexCache(): expected a MeshPrimitive::Triangles mesh but got MeshPrimitive::Lines\n"
+        "MeshTools::analyzeVertexCache(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+/* A regular grid with triangles in a scrambled order. The grid has 144
+   vertices so it fits into 8-bit indices as well. */
+Containers::Array<UnsignedInt> scrambledGridIndices(const Trade::MeshData& grid) {
+    const Containers::StridedArrayView1D<const UnsignedInt> indices = grid.indices<UnsignedInt>();
+    const std::size_t triangleCount = indices.size()/3;
+    Containers::Array<UnsignedInt> out{NoInit, indices.size()};
+    /* 97 is coprime with the 242 triangles, so this visits each of them
+       exactly once */
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const std::size_t triangle = i*97 % triangleCount;
+        for(std::size_t j = 0; j != 3; ++j)
+            out[i*3 + j] = indices[triangle*3 + j];
+    }
+    return out;
+}
+
+/* Triangles sorted to compare whether they're the same regardless of order */
+template<class T> Containers::Array<Vector3ui> sortedTriangles(const Containers::StridedArrayView1D<const T>& indices) {
+    Containers::Array<Vector3ui> out{NoInit, indices.size()/3};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = {indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+    std::sort(out.begin(), out.end(), [](const Vector3ui& a, const Vector3ui& b) {
+        if(a.x() != b.x()) return a.x() < b.x();
+        if(a.y() != b.y()) return a.y() < b.y();
+        return a.z() < b.z();
+    });
+    return out;
+}
+
+template<class T> void OptimizeTest::optimizeVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    CORRADE_COMPARE(grid.vertexCount(), 144);
+    CORRADE_COMPARE(grid.indexCount(), 242*3);
+
+    Containers::Array<UnsignedInt> scrambled = scrambledGridIndices(grid);
+    Containers::Array<T> indices{NoInit, scrambled.size()};
+    for(std::size_t i = 0; i != scrambled.size(); ++i)
+        indices[i] = scrambled[i];
+
+    const VertexCacheStatistics before = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 144, 16);
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 144);
+    const VertexCacheStatistics after = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 144, 16);
+
+    /* The scrambled order reuses almost no vertices from the cache, the
+       optimized one should get reasonably close to the theoretical 0.5 */
+    CORRADE_COMPARE_AS(before.averageCacheMissRatio, 1.5f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(after.averageCacheMissRatio, 0.8f,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(after.averageTransformedToVertexRatio, 1.3f,
+        TestSuite::Compare::Less);
+
+    /* The triangles are only reordered, with vertex order preserved */
+    CORRADE_COMPARE_AS(sortedTriangles<T>(Containers::stridedArrayView(indices)),
+        sortedTriangles<UnsignedInt>(Containers::stridedArrayView(scrambled)),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexCacheDegenerateTriangles() {
+    /* Degenerate triangles list the same vertex multiple times in the
+       adjacency, which has to be handled when removing them */
+    UnsignedInt indices[]{
+        0, 0, 0,
+        1, 2, 1,
+        0, 1, 2
+    };
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedInt>({
+        1, 2, 1,
+        0, 1, 2,
+        0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexCacheErased() {
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<UnsignedInt> expected = scrambledGridIndices(grid);
+    Containers::Array<UnsignedInt> indices = scrambledGridIndices(grid);
+
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(expected), 144);
+    MeshTools::optimizeVertexCacheInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), 144);
+    CORRADE_COMPARE_AS(indices, expected, TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexCacheMeshData() {
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<UnsignedInt> indices = scrambledGridIndices(grid);
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, grid.vertexData(), Trade::meshAttributeDataNonOwningArray(grid.attributeData())};
+
+    Containers::Array<UnsignedInt> expected = scrambledGridIndices(grid);
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(expected), 144);
+
+    Trade::MeshData out = MeshTools::optimizeVertexCache(mesh);
+    CORRADE_COMPARE(out.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(out.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(out.indices<UnsignedInt>(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    /* The original isn't modified */
+    CORRADE_COMPARE_AS(mesh.indices<UnsignedInt>(),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    /* Vertex data are passed through unchanged */
+    CORRADE_COMPARE(out.vertexCount(), 144);
+    CORRADE_COMPARE_AS(out.positions3DAsArray(),
+        grid.positions3DAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexCacheEmpty() {
+    MeshTools::optimizeVertexCacheInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, 5);
+    MeshTools::optimizeOverdrawInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{});
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetchInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, Containers::StridedArrayView2D<char>{}), 0);
+}
+
+void OptimizeTest::optimizeVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3, 1, 0};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles, 3};
+    Trade::MeshData notTriangles{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices).prefix(5), 4);
+    MeshTools::optimizeVertexCacheInPlace(Containers::stridedArrayView(indices), 3);
+    MeshTools::optimizeVertexCache(notIndexed);
+    MeshTools::optimizeVertexCache(notTriangles);
+    MeshTools::optimizeVertexCache(implementationSpecificIndexType);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexCacheInPlace(): index count not divisible by 3\n"
+        "MeshTools::optimizeVertexCacheInPlace(): index 3 out of range for 3 vertices\n"
+        "MeshTools::optimizeVertexCache(): mesh data not indexed\n"
+        "MeshTools::optimizeVertexCache(): expected a MeshPrimitive::Triangles mesh but got MeshPrimitive::Lines\n"
+        "MeshTools::optimizeVertexCache(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+/* Two disconnected quads facing +Z, one in front of the mesh center and one
+   behind it. The one behind it faces towards the center and should thus be
+   drawn last. */
+const Vector3 OverdrawPositions[]{
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f},
+
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f}
+};
+
+constexpr UnsignedInt OverdrawIndices[]{
+    0, 1, 3,
+    0, 3, 2,
+
+    4, 5, 7,
+    4, 7, 6
+};
+
+template<class T> void OptimizeTest::optimizeOverdraw() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    T indices[Containers::arraySize(OverdrawIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(OverdrawIndices); ++i)
+        indices[i] = OverdrawIndices[i];
+
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), OverdrawPositions);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        4, 5, 7,
+        4, 7, 6,
+
+        0, 1, 3,
+        0, 3, 2
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeOverdrawErased() {
+    UnsignedShort indices[Containers::arraySize(OverdrawIndices)];
+    for(std::size_t i = 0; i != Containers::arraySize(OverdrawIndices); ++i)
+        indices[i] = OverdrawIndices[i];
+
+    MeshTools::optimizeOverdrawInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), OverdrawPositions);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<UnsignedShort>({
+        4, 5, 7,
+        4, 7, 6,
+
+        0, 1, 3,
+        0, 3, 2
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeOverdrawMeshData() {
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, OverdrawIndices, Trade::MeshIndexData{OverdrawIndices},
+        {}, OverdrawPositions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(OverdrawPositions)}
+        }};
+
+    Trade::MeshData out = MeshTools::optimizeOverdraw(mesh);
+    CORRADE_COMPARE(out.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(out.indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        4, 5, 7,
+        4, 7, 6,
+
+        0, 1, 3,
+        0, 3, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView(OverdrawPositions),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeOverdrawInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3, 1, 0};
+    Vector3 positions[4];
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles, 3};
+    Trade::MeshData notTriangles{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices).prefix(5), positions);
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions, 0.9f);
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), Containers::arrayView(positions).prefix(3));
+    MeshTools::optimizeOverdraw(notIndexed);
+    MeshTools::optimizeOverdraw(notTriangles);
+    MeshTools::optimizeOverdraw(implementationSpecificIndexType);
+    MeshTools::optimizeOverdraw(noPositions);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3\n"
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1, got 0.9\n"
+        "MeshTools::optimizeOverdrawInPlace(): index 3 out of range for 3 vertices\n"
+        "MeshTools::optimizeOverdraw(): mesh data not indexed\n"
+        "MeshTools::optimizeOverdraw(): expected a MeshPrimitive::Triangles mesh but got MeshPrimitive::Lines\n"
+        "MeshTools::optimizeOverdraw(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::optimizeOverdraw(): the mesh has no positions\n");
+}
+
+template<class T> void OptimizeTest::optimizeVertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Vertex 1 is unused */
+    T indices[]{4, 2, 0, 2, 4, 3};
+    Int data[]{0, 10, 20, 30, 40};
+
+    std::size_t count = MeshTools::optimizeVertexFetchInPlace(Containers::stridedArrayView(indices), Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(count, 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<T>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(count),
+        Containers::arrayView<Int>({40, 20, 0, 30}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchErased() {
+    UnsignedByte indices[]{4, 2, 0, 2, 4, 3};
+    Int data[]{0, 10, 20, 30, 40};
+
+    std::size_t count = MeshTools::optimizeVertexFetchInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(count, 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedByte>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(count),
+        Containers::arrayView<Int>({40, 20, 0, 30}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchMeshData() {
+    const UnsignedShort indices[]{4, 2, 0, 2, 4, 3};
+    /* Non-interleaved on input, which gets interleaved */
+    const Vector2 positions[]{
+        {0.0f, 0.0f}, {1.0f, 1.0f}, {2.0f, 2.0f}, {3.0f, 3.0f}, {4.0f, 4.0f}
+    };
+    const UnsignedShort ids[]{0, 10, 20, 30, 40};
+    Containers::Array<char> vertexData{NoInit, sizeof(positions) + sizeof(ids)};
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(positions)), vertexData.prefix(sizeof(positions)));
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(ids)), vertexData.exceptPrefix(sizeof(positions)));
+    Trade::MeshData mesh{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices},
+        Utility::move(vertexData), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, 0, 5, sizeof(Vector2)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId, VertexFormat::UnsignedShort, sizeof(positions), 5, sizeof(UnsignedShort)}
+        }};
+
+    Trade::MeshData out = MeshTools::optimizeVertexFetch(mesh);
+    CORRADE_COMPARE(out.primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(out.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(out.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 1, 2, 1, 0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.vertexCount(), 4);
+    /* Tightly packed */
+    CORRADE_COMPARE(out.attributeStride(0), 10);
+    CORRADE_COMPARE_AS(out.attribute<Vector2>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector2>({
+            {4.0f, 4.0f}, {2.0f, 2.0f}, {0.0f, 0.0f}, {3.0f, 3.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.attribute<UnsignedShort>(Trade::MeshAttribute::ObjectId),
+        Containers::arrayView<UnsignedShort>({40, 20, 0, 30}),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2, 3, 1, 0};
+    Int data[3]{};
+    Vector3 positions[4];
+    Trade::MeshData attributeless{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 4};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles,
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+    Trade::MeshData implementationSpecificVertexFormat{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xcaca), nullptr}
+        }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(Containers::stridedArrayView(indices), Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    MeshTools::optimizeVertexFetch(attributeless);
+    MeshTools::optimizeVertexFetch(notIndexed);
+    MeshTools::optimizeVertexFetch(implementationSpecificIndexType);
+    MeshTools::optimizeVertexFetch(implementationSpecificVertexFormat);
+    CORRADE_COMPARE(out,
+        "MeshTools::optimizeVertexFetchInPlace(): index 3 out of range for 3 vertices\n"
+        "MeshTools::optimizeVertexFetch(): can't optimize an attributeless mesh\n"
+        "MeshTools::optimizeVertexFetch(): mesh data not indexed\n"
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::optimizeVertexFetch(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeTest)
@@ -26,11 +26,15 @@
 
 #include <algorithm> /* std::shuffle() */
 #include <random> /* random device for std::shuffle() */
+#include <cstring>
+#include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
@@ -83,11 +87,16 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicatesMeshDataFuzzyImplementationSpecificIndexType();
     void removeDuplicatesMeshDataFuzzyImplementationSpecificVertexFormat();
 
+    void removeDuplicatesMeshDataMultithreaded();
+    void removeDuplicatesMeshDataFuzzyMultithreaded();
+
     void soakTest();
     void soakTestFuzzy();
 
     void benchmark();
     void benchmarkFuzzy();
+    void benchmarkVertexSize();
+    void benchmarkVertexSizeStl();
 };
 
 const struct {
@@ -195,6 +204,27 @@ const struct {
     }), 0.0f, 1.0f, 0.0f, 9, false},
 };
 
+const struct {
+    const char* name;
+    bool indexed;
+    UnsignedInt threadCount;
+} RemoveDuplicatesMeshDataMultithreadedData[]{
+    {"2 threads", false, 2},
+    {"5 threads", false, 5},
+    {"all hardware threads", false, 0},
+    {"indexed, 2 threads", true, 2},
+    {"indexed, 5 threads", true, 5},
+};
+
+const struct {
+    const char* name;
+    std::size_t vertexSize;
+} BenchmarkVertexSizeData[]{
+    {"12-byte vertex, position", 12},
+    {"32-byte vertex, position + normal + texcoords", 32},
+    {"48-byte vertex, position + normal + tangent + texcoords", 48}
+};
+
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::removeDuplicates,
               &RemoveDuplicatesTest::removeDuplicatesNonContiguous,
@@ -257,11 +287,19 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzyImplementationSpecificIndexType,
               &RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzyImplementationSpecificVertexFormat});
 
+    addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMeshDataMultithreaded,
+                       &RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzyMultithreaded},
+        Containers::arraySize(RemoveDuplicatesMeshDataMultithreadedData));
+
     addRepeatedTests({&RemoveDuplicatesTest::soakTest,
                       &RemoveDuplicatesTest::soakTestFuzzy}, 10);
 
     addBenchmarks({&RemoveDuplicatesTest::benchmark,
                    &RemoveDuplicatesTest::benchmarkFuzzy}, 10);
+
+    addInstancedBenchmarks({&RemoveDuplicatesTest::benchmarkVertexSize,
+                            &RemoveDuplicatesTest::benchmarkVertexSizeStl}, 10,
+        Containers::arraySize(BenchmarkVertexSizeData));
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -1207,6 +1245,86 @@ void RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzyImplementationSpecificVe
         "MeshTools::removeDuplicatesFuzzy(): attribute 1 has an implementation-specific format 0xcaca\n");
 }
 
+Trade::MeshData multithreadedTestMesh(const bool indexed) {
+    /* A few thousand vertices with a position, a normal and an integer
+       attribute, picked pseudorandomly from a small set so there's a lot of
+       duplicates spread across the whole mesh. The normals are slightly
+       perturbed to make the fuzzy variant collapse some of them. */
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        UnsignedShort id;
+    };
+
+    constexpr UnsignedInt VertexCount = 5000;
+    Containers::Array<char> vertexData{NoInit, VertexCount*sizeof(Vertex)};
+    const Containers::ArrayView<Vertex> vertices = Containers::arrayCast<Vertex>(vertexData);
+    for(UnsignedInt i = 0; i != VertexCount; ++i) {
+        const UnsignedInt unique = (i*7919) % 733;
+        vertices[i].position = Vector3{Float(unique % 7), Float(unique % 11), Float(unique % 13)};
+        vertices[i].normal = Vector3::zAxis(1.0f - (i % 2)*Math::TypeTraits<Float>::epsilon()/2);
+        vertices[i].id = unique % 17;
+    }
+
+    Containers::Array<char> indexData;
+    Trade::MeshIndexData indices;
+    if(indexed) {
+        indexData = Containers::Array<char>{NoInit, 3*VertexCount*sizeof(UnsignedInt)};
+        const Containers::ArrayView<UnsignedInt> indexView = Containers::arrayCast<UnsignedInt>(indexData);
+        for(UnsignedInt i = 0; i != indexView.size(); ++i)
+            indexView[i] = (i*4597) % VertexCount;
+        indices = Trade::MeshIndexData{indexView};
+    }
+
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::stridedArrayView(vertices).slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+                Containers::stridedArrayView(vertices).slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(0),
+                Containers::stridedArrayView(vertices).slice(&Vertex::id)},
+        }};
+}
+
+void RemoveDuplicatesTest::removeDuplicatesMeshDataMultithreaded() {
+    auto&& data = RemoveDuplicatesMeshDataMultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData mesh = multithreadedTestMesh(data.indexed);
+
+    /* The output should be bit-identical to the single-threaded variant */
+    Trade::MeshData expected = MeshTools::removeDuplicates(mesh);
+    Trade::MeshData actual = MeshTools::removeDuplicates(mesh, data.threadCount);
+    CORRADE_COMPARE(actual.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE(actual.indexType(), expected.indexType());
+    CORRADE_COMPARE_AS(actual.indexData(), expected.indexData(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual.vertexData(), expected.vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesMeshDataFuzzyMultithreaded() {
+    auto&& data = RemoveDuplicatesMeshDataMultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData mesh = multithreadedTestMesh(data.indexed);
+
+    /* The output should be bit-identical to the single-threaded variant */
+    Trade::MeshData expected = MeshTools::removeDuplicatesFuzzy(mesh);
+    Trade::MeshData actual = MeshTools::removeDuplicatesFuzzy(mesh, Math::TypeTraits<Float>::epsilon(), Math::TypeTraits<Double>::epsilon(), data.threadCount);
+    /* Verify the fuzzy comparison actually did something */
+    CORRADE_COMPARE_AS(expected.vertexCount(), MeshTools::removeDuplicates(mesh).vertexCount(),
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE(actual.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE(actual.indexType(), expected.indexType());
+    CORRADE_COMPARE_AS(actual.indexData(), expected.indexData(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual.vertexData(), expected.vertexData(),
+        TestSuite::Compare::Container);
+}
+
 void RemoveDuplicatesTest::soakTest() {
     /* Array of 100 unique items with 10 duplicates each, randomly shuffled */
     UnsignedInt data[1000];
@@ -1270,6 +1388,74 @@ void RemoveDuplicatesTest::benchmarkFuzzy() {
     CORRADE_COMPARE(count, 100);
 }
 
+constexpr std::size_t BenchmarkVertexCount = 120000;
+/* Non-indexed triangle meshes have each vertex shared by ~6 triangles */
+constexpr std::size_t BenchmarkUniqueVertexCount = BenchmarkVertexCount/6;
+
+Containers::Array<char> benchmarkVertexData(const std::size_t vertexSize) {
+    /* Fill every four bytes of each vertex with its unique ID so the whole
+       vertex contributes to the hash and comparison. Scatter the duplicates
+       across the whole array in a deterministic order. */
+    Containers::Array<char> out{NoInit, BenchmarkVertexCount*vertexSize};
+    const Containers::StridedArrayView2D<UnsignedInt> vertices = Containers::arrayCast<2, UnsignedInt>(Containers::StridedArrayView2D<char>{out, {BenchmarkVertexCount, vertexSize}});
+    for(std::size_t i = 0; i != vertices.size()[0]; ++i)
+        for(UnsignedInt& j: vertices[i])
+            j = (i*7919) % BenchmarkUniqueVertexCount;
+    return out;
+}
+
+void RemoveDuplicatesTest::benchmarkVertexSize() {
+    auto&& data = BenchmarkVertexSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> vertexData = benchmarkVertexData(data.vertexSize);
+    const Containers::StridedArrayView2D<const char> vertices{vertexData, {BenchmarkVertexCount, data.vertexSize}};
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, BenchmarkVertexCount};
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(vertices, indices);
+
+    CORRADE_COMPARE(count, BenchmarkUniqueVertexCount);
+}
+
+void RemoveDuplicatesTest::benchmarkVertexSizeStl() {
+    auto&& data = BenchmarkVertexSizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> vertexData = benchmarkVertexData(data.vertexSize);
+    const Containers::StridedArrayView2D<const char> vertices{vertexData, {BenchmarkVertexCount, data.vertexSize}};
+
+    /* Baseline for comparison -- equivalent to what removeDuplicatesInto()
+       was implemented with before the switch to a flat hash table */
+    struct Equal {
+        bool operator()(const void* a, const void* b) const {
+            return std::memcmp(a, b, size) == 0;
+        }
+        std::size_t size;
+    };
+    struct Hash {
+        std::size_t operator()(const void* a) const {
+            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), size).byteArray());
+        }
+        std::size_t size;
+    };
+
+    std::size_t count = 0;
+    Containers::Array<UnsignedInt> indices{NoInit, BenchmarkVertexCount};
+    CORRADE_BENCHMARK(1) {
+        std::unordered_map<const void*, UnsignedInt, Hash, Equal> table{
+            BenchmarkVertexCount,
+            Hash{data.vertexSize},
+            Equal{data.vertexSize}};
+        for(std::size_t i = 0; i != BenchmarkVertexCount; ++i)
+            indices[i] = table.emplace(vertices[i].data(), i).first->second;
+        count = table.size();
+    }
+
+    CORRADE_COMPARE(count, BenchmarkUniqueVertexCount);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
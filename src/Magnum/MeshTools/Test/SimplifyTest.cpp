@@ -0,0 +1,375 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    template<class T> void simplifyPlane();
+    void simplifySeams();
+    void simplifyMaxError();
+    void simplifyDegenerateTriangles();
+    void simplifyErased();
+    void simplifyErasedNonContiguous();
+    void simplifyErasedWrongIndexSize();
+    void simplifyEmpty();
+    void simplifyMeshData();
+    void simplifyInvalid();
+
+    void generateLods();
+    void generateLodsInvalid();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::simplifyPlane<UnsignedInt>,
+              &SimplifyTest::simplifyPlane<UnsignedShort>,
+              &SimplifyTest::simplifyPlane<UnsignedByte>,
+              &SimplifyTest::simplifySeams,
+              &SimplifyTest::simplifyMaxError,
+              &SimplifyTest::simplifyDegenerateTriangles,
+              &SimplifyTest::simplifyErased,
+              &SimplifyTest::simplifyErasedNonContiguous,
+              &SimplifyTest::simplifyErasedWrongIndexSize,
+              &SimplifyTest::simplifyEmpty,
+              &SimplifyTest::simplifyMeshData,
+              &SimplifyTest::simplifyInvalid,
+
+              &SimplifyTest::generateLods,
+              &SimplifyTest::generateLodsInvalid});
+}
+
+template<class T> void SimplifyTest::simplifyPlane() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* A 12x12 vertex grid, which fits into 8-bit indices as well */
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<T> indices{NoInit, grid.indexCount()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = grid.indices<UnsignedInt>()[i];
+    CORRADE_COMPARE(indices.size(), 726);
+
+    /* All collapses in a plane have zero error, so it gets simplified until
+       just the locked border vertices are left. A triangulation of a 44-gon
+       has 42 triangles. */
+    std::size_t count = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0);
+    CORRADE_COMPARE(count, 42*3);
+
+    /* The total area is preserved and no triangle got flipped */
+    Float area = 0.0f;
+    for(std::size_t i = 0; i != count; i += 3) {
+        const Float z = Math::cross(
+            positions[indices[i + 1]] - positions[indices[i]],
+            positions[indices[i + 2]] - positions[indices[i]]).z();
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(z, 0.0f, TestSuite::Compare::Greater);
+        area += z*0.5f;
+    }
+    CORRADE_COMPARE(area, 4.0f);
+
+    /* All border vertices are still there, no interior vertex is */
+    Containers::Array<bool> referenced{ValueInit, positions.size()};
+    for(std::size_t i = 0; i != count; ++i)
+        referenced[indices[i]] = true;
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(referenced[i], Math::abs(positions[i].x()) == 1.0f || Math::abs(positions[i].y()) == 1.0f);
+    }
+}
+
+void SimplifyTest::simplifySeams() {
+    Trade::MeshData sphere = Primitives::uvSphereSolid(16, 32, Primitives::UVSphereFlag::TextureCoordinates);
+    Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    CORRADE_COMPARE(indices.size(), 2880);
+
+    std::size_t count = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 720);
+    CORRADE_COMPARE_AS(count, 720, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(count, 0, TestSuite::Compare::Greater);
+
+    /* Vertices on the texture coordinate seam are all kept */
+    Containers::Array<bool> referenced{ValueInit, positions.size()};
+    for(std::size_t i = 0; i != count; ++i)
+        referenced[indices[i]] = true;
+    std::size_t seamVertexCount = 0;
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        for(std::size_t j = 0; j != positions.size(); ++j) {
+            if(i == j || positions[i] != positions[j]) continue;
+            CORRADE_ITERATION(i);
+            CORRADE_VERIFY(referenced[i]);
+            ++seamVertexCount;
+            break;
+        }
+    }
+    CORRADE_COMPARE(seamVertexCount, 2*15);
+
+    /* All triangles still face outwards */
+    for(std::size_t i = 0; i != count; i += 3) {
+        const Vector3 a = positions[indices[i + 0]];
+        const Vector3 b = positions[indices[i + 1]];
+        const Vector3 c = positions[indices[i + 2]];
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(Math::dot(Math::cross(b - a, c - a), a + b + c), 0.0f, TestSuite::Compare::Greater);
+    }
+}
+
+void SimplifyTest::simplifyMaxError() {
+    /* No two triangles of a sphere are coplanar, so with a zero error nothing
+       can be collapsed */
+    Trade::MeshData sphere = Primitives::uvSphereSolid(16, 32);
+    Containers::Array<Vector3> positions = sphere.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+
+    CORRADE_COMPARE(MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 0.0f), indices.size());
+    CORRADE_COMPARE_AS(indices,
+        sphere.indicesAsArray(),
+        TestSuite::Compare::Container);
+
+    /* With a small error it gets somewhere but not as far as with an
+       unlimited error */
+    Containers::Array<UnsignedInt> unlimited = sphere.indicesAsArray();
+    std::size_t count = MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0, 0.01f);
+    std::size_t unlimitedCount = MeshTools::simplifyInPlace(Containers::stridedArrayView(unlimited), positions, 0);
+    CORRADE_COMPARE_AS(count, indices.size(), TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(count, unlimitedCount, TestSuite::Compare::Greater);
+}
+
+void SimplifyTest::simplifyDegenerateTriangles() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+    };
+    UnsignedInt indices[]{
+        0, 1, 1,
+        0, 1, 2,
+        2, 2, 2
+    };
+
+    /* The target is not reached, but degenerate triangles are removed even
+       then */
+    CORRADE_COMPARE(MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 9), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices).prefix(3),
+        Containers::arrayView<UnsignedInt>({0, 1, 2}),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyErased() {
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<UnsignedInt> expected = grid.indicesAsArray();
+    Containers::Array<UnsignedShort> indices{NoInit, grid.indexCount()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = expected[i];
+
+    std::size_t expectedCount = MeshTools::simplifyInPlace(Containers::stridedArrayView(expected), positions, 360);
+    std::size_t count = MeshTools::simplifyInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(indices)), positions, 360);
+    CORRADE_COMPARE(count, expectedCount);
+    for(std::size_t i = 0; i != count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(indices[i], expected[i]);
+    }
+}
+
+void SimplifyTest::simplifyErasedNonContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 2}, {4, 2}}, Containers::arrayView<const Vector3>({{}, {}, {}, {}, {}, {}}), 0);
+    CORRADE_COMPARE(out, "MeshTools::simplifyInPlace(): second index view dimension is not contiguous\n");
+}
+
+void SimplifyTest::simplifyErasedWrongIndexSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char indices[6*3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::StridedArrayView2D<char>{indices, {6, 3}}, Containers::arrayView<const Vector3>({{}, {}, {}, {}, {}, {}}), 0);
+    CORRADE_COMPARE(out, "MeshTools::simplifyInPlace(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void SimplifyTest::simplifyEmpty() {
+    CORRADE_COMPARE(MeshTools::simplifyInPlace(Containers::StridedArrayView1D<UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{}, 0), 0);
+}
+
+void SimplifyTest::simplifyMeshData() {
+    Trade::MeshData grid = Primitives::grid3DSolid({10, 10});
+    Containers::Array<Vector3> positions = grid.positions3DAsArray();
+    Containers::Array<UnsignedInt> expected = grid.indicesAsArray();
+    std::size_t expectedCount = MeshTools::simplifyInPlace(Containers::stridedArrayView(expected), positions, 360);
+
+    Trade::MeshData out = MeshTools::simplify(grid, 360);
+    CORRADE_COMPARE(out.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(out.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(out.indices<UnsignedInt>(),
+        Containers::arrayView(expected).prefix(expectedCount),
+        TestSuite::Compare::Container);
+
+    /* Vertex data are an owned copy of the original, with all attributes */
+    CORRADE_COMPARE(out.indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(out.vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_VERIFY(out.vertexData().data() != grid.vertexData().data());
+    CORRADE_COMPARE(out.vertexCount(), grid.vertexCount());
+    CORRADE_COMPARE(out.attributeCount(), grid.attributeCount());
+    CORRADE_COMPARE_AS(out.positions3DAsArray(),
+        positions,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.normalsAsArray(),
+        grid.normalsAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::simplifyInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    UnsignedInt indices[]{0, 1, 2, 3, 1, 0};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles, 3};
+    Trade::MeshData notTriangles{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(5), positions, 0);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices), positions, 0);
+    MeshTools::simplifyInPlace(Containers::stridedArrayView(indices).prefix(3), positions, 0, -0.5f);
+    MeshTools::simplify(notIndexed, 0);
+    MeshTools::simplify(notTriangles, 0);
+    MeshTools::simplify(implementationSpecificIndexType, 0);
+    MeshTools::simplify(noPositions, 0);
+    CORRADE_COMPARE(out,
+        "MeshTools::simplifyInPlace(): index count not divisible by 3\n"
+        "MeshTools::simplifyInPlace(): index 3 out of range for 3 vertices\n"
+        "MeshTools::simplifyInPlace(): expected a non-negative max error, got -0.5\n"
+        "MeshTools::simplify(): mesh data not indexed\n"
+        "MeshTools::simplify(): expected a MeshPrimitive::Triangles mesh but got MeshPrimitive::Lines\n"
+        "MeshTools::simplify(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::simplify(): the mesh has no positions\n");
+}
+
+void SimplifyTest::generateLods() {
+    Trade::MeshData sphere = Primitives::uvSphereSolid(16, 32, Primitives::UVSphereFlag::TextureCoordinates);
+
+    Containers::Array<Trade::MeshData> out = MeshTools::generateLods(sphere, {0.5f, 0.25f, 0.25f});
+    CORRADE_COMPARE(out.size(), 4);
+
+    /* The first level is a copy of the original */
+    CORRADE_COMPARE(out[0].indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(out[0].vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_VERIFY(out[0].vertexData().data() != sphere.vertexData().data());
+    CORRADE_COMPARE_AS(out[0].indicesAsArray(),
+        sphere.indicesAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out[0].attributeCount(), sphere.attributeCount());
+
+    /* The other are simplified to the target ratio and reference vertex data
+       of the first */
+    CORRADE_COMPARE_AS(out[1].indexCount(), 1440, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(out[2].indexCount(), 720, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(out[2].indexCount(), 0, TestSuite::Compare::Greater);
+    for(std::size_t i: {1, 2, 3}) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[i].primitive(), MeshPrimitive::Triangles);
+        CORRADE_COMPARE(out[i].indexType(), MeshIndexType::UnsignedInt);
+        CORRADE_COMPARE(out[i].indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+        CORRADE_COMPARE(out[i].vertexDataFlags(), Trade::DataFlags{});
+        CORRADE_COMPARE(out[i].vertexData().data(), out[0].vertexData().data());
+        CORRADE_COMPARE(out[i].vertexCount(), out[0].vertexCount());
+        CORRADE_COMPARE(out[i].attributeCount(), out[0].attributeCount());
+        CORRADE_COMPARE_AS(out[i].indexCount(), out[i - 1].indexCount(), TestSuite::Compare::LessOrEqual);
+    }
+
+    /* Simplifying to the same ratio again results in the same mesh */
+    CORRADE_COMPARE_AS(out[3].indicesAsArray(),
+        out[2].indicesAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::generateLodsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 2};
+    Vector3 positions[3]{};
+    Trade::MeshData notIndexed{MeshPrimitive::Triangles, 3};
+    Trade::MeshData notTriangles{MeshPrimitive::Lines,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}}, 1};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices}, 3};
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, positions, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::generateLods(notIndexed, {0.5f});
+    MeshTools::generateLods(notTriangles, {0.5f});
+    MeshTools::generateLods(implementationSpecificIndexType, {0.5f});
+    MeshTools::generateLods(noPositions, {0.5f});
+    MeshTools::generateLods(mesh, {1.5f});
+    MeshTools::generateLods(mesh, {0.5f, 0.75f});
+    MeshTools::generateLods(mesh, {0.5f, -0.25f});
+    CORRADE_COMPARE(out,
+        "MeshTools::generateLods(): mesh data not indexed\n"
+        "MeshTools::generateLods(): expected a MeshPrimitive::Triangles mesh but got MeshPrimitive::Lines\n"
+        "MeshTools::generateLods(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::generateLods(): the mesh has no positions\n"
+        "MeshTools::generateLods(): expected ratio 0 to be in range [0, 1], got 1.5\n"
+        "MeshTools::generateLods(): expected ratio 1 to be in range [0, 0.5], got 0.75\n"
+        "MeshTools::generateLods(): expected ratio 1 to be in range [0, 0.5], got -0.25\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
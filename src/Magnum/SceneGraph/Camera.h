@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
+ * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, @ref Magnum::SceneGraph::DrawableDepthOrder, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
 #include "Magnum/Math/Matrix3.h"
@@ -53,6 +53,29 @@ enum class AspectRatioPolicy: UnsignedByte {
     Clip            /**< Clip on smaller side of view */
 };
 
+/**
+@brief Drawable depth order
+@m_since_latest
+
+@see @ref Camera::drawableTransformations(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const UnsignedInt>&, DrawableDepthOrder),
+    @ref Camera::draw(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const UnsignedInt>&, DrawableDepthOrder)
+*/
+enum class DrawableDepthOrder: UnsignedByte {
+    /** Don't sort by depth (default) */
+    Unsorted,
+
+    /**
+     * Nearest drawables first. Useful for opaque objects to reduce overdraw.
+     */
+    FrontToBack,
+
+    /**
+     * Farthest drawables first. Useful for correct blending of transparent
+     * objects.
+     */
+    BackToFront
+};
+
 namespace Implementation {
     template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
 }
@@ -214,6 +237,74 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         void draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations);
 
+        /**
+         * @brief Culled and sorted drawable transformations
+         * @param group         Drawable group
+         * @param bounds        Bounds of each drawable in the group, relative
+         *      to the object the drawable is attached to
+         * @param sortKeys      Sort key for each drawable in the group, such
+         *      as a shader, material or mesh ID. If empty, all keys are
+         *      treated as equal.
+         * @param depthOrder    Depth order of drawables with the same sort
+         *      key
+         * @m_since_latest
+         *
+         * Like @ref drawableTransformations(DrawableGroup<dimensions, T>&),
+         * but drawables with @p bounds that are outside of the camera view
+         * are omitted from the output. The @p bounds are transformed with
+         * the camera-relative transformation of each drawable and then
+         * tested using @ref Math::Intersection::aabbFrustum() against a
+         * @ref Math::Frustum created from @ref projectionMatrix() in 3D, or
+         * against the @f$ [-1; 1] @f$ square after projection in 2D. The
+         * culling is conservative, so a drawable can still be included if
+         * its bounds are just near a frustum corner.
+         *
+         * The remaining drawables are then sorted by @p sortKeys in an
+         * ascending order and drawables with the same key by camera-space
+         * depth of the center of their @p bounds according to
+         * @p depthOrder. The @p depthOrder has no effect
+         * in 2D. Drawables that compare equal are kept in the order they are
+         * in the group. If @p sortKeys is empty and @p depthOrder is
+         * @ref DrawableDepthOrder::Unsorted, no sorting is done.
+         *
+         * Expects that size of @p bounds and size of @p sortKeys, if not
+         * empty, is equal to size of @p group. The @p bounds and
+         * @p sortKeys are indexed the same as @ref FeatureGroup::operator[](),
+         * which isn't necessarily the order the drawables were added in
+         * --- removing a drawable from the group moves the last one to its
+         * place, see @ref SceneGraph-FeatureGroup-order.
+         */
+        std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawableTransformations(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, const Containers::StridedArrayView1D<const UnsignedInt>& sortKeys, DrawableDepthOrder depthOrder = DrawableDepthOrder::Unsorted);
+
+        /**
+         * @brief Culled and sorted drawable transformations without sort keys
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref drawableTransformations(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const UnsignedInt>&, DrawableDepthOrder)
+         * with empty @p sortKeys.
+         */
+        std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawableTransformations(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, DrawableDepthOrder depthOrder = DrawableDepthOrder::Unsorted);
+
+        /**
+         * @brief Draw a culled and sorted group of drawables
+         * @m_since_latest
+         *
+         * Equivalent to passing the output of
+         * @ref drawableTransformations(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const UnsignedInt>&, DrawableDepthOrder)
+         * to @ref draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&).
+         * See @ref SceneGraph-Drawable-draw-order for more information.
+         */
+        void draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, const Containers::StridedArrayView1D<const UnsignedInt>& sortKeys, DrawableDepthOrder depthOrder = DrawableDepthOrder::Unsorted);
+
+        /**
+         * @brief Draw a culled and sorted group of drawables without sort keys
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref draw(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const UnsignedInt>&, DrawableDepthOrder)
+         * with empty @p sortKeys.
+         */
+        void draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, DrawableDepthOrder depthOrder = DrawableDepthOrder::Unsorted);
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -229,6 +320,9 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        /* Reused between draw() calls */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
 };
 
 /**
@@ -30,7 +30,14 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <algorithm> /* std::sort() */
+#include <cstring>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
@@ -54,6 +61,62 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* Half-size of an axis-aligned box after transforming it with given matrix,
+   i.e. Arvo's method for transforming an AABB */
+template<UnsignedInt dimensions, class T> Math::Vector<dimensions, T> transformedExtents(const MatrixTypeFor<dimensions, T>& transformation, const Math::Vector<dimensions, T>& extents) {
+    Math::Vector<dimensions, T> out;
+    for(std::size_t i = 0; i != dimensions; ++i)
+        out += Math::abs(Math::Vector<dimensions, T>::pad(transformation[i]))*extents[i];
+    return out;
+}
+
+template<UnsignedInt, class> struct CameraCulling;
+template<class T> struct CameraCulling<2, T> {
+    explicit CameraCulling(const Math::Matrix3<T>& projectionMatrix): projectionMatrix{projectionMatrix} {}
+
+    /* The 2D projection is affine, so the bounds can be transformed directly
+       to the [-1; 1] clip space */
+    bool isVisible(const Math::Matrix3<T>& transformation, const Math::Range2D<T>& bounds) const {
+        const Math::Matrix3<T> matrix = projectionMatrix*transformation;
+        const Math::Vector2<T> center = matrix.transformPoint(bounds.center());
+        const Math::Vector2<T> extents = transformedExtents<2, T>(matrix, bounds.size()*T(0.5));
+        return (Math::abs(center) - extents <= Math::Vector2<T>{T(1)}).all();
+    }
+
+    static T depth(const Math::Matrix3<T>&, const Math::Range2D<T>&) { return T(0); }
+
+    Math::Matrix3<T> projectionMatrix;
+};
+template<class T> struct CameraCulling<3, T> {
+    /* The transformations are already relative to the camera, so the frustum
+       is created just from the projection matrix */
+    explicit CameraCulling(const Math::Matrix4<T>& projectionMatrix): frustum{Math::Frustum<T>::fromMatrix(projectionMatrix)} {}
+
+    bool isVisible(const Math::Matrix4<T>& transformation, const Math::Range3D<T>& bounds) const {
+        return Math::Intersection::aabbFrustum(
+            transformation.transformPoint(bounds.center()),
+            transformedExtents<3, T>(transformation, bounds.size()*T(0.5)),
+            frustum);
+    }
+
+    /* Camera looks in the direction of -Z, so the depth is positive for
+       objects in front of it. Calculated from the bounds center and not the
+       object origin, as the bounds can be far from it. */
+    static T depth(const Math::Matrix4<T>& transformation, const Math::Range3D<T>& bounds) {
+        return -transformation.transformPoint(bounds.center()).z();
+    }
+
+    Math::Frustum<T> frustum;
+};
+
+/* Maps a float to an unsigned integer with the same ordering, so it can be
+   combined with the user-supplied key into a single integer sort key */
+inline UnsignedInt sortableDepth(const Float depth) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &depth, sizeof(Float));
+    return bits & 0x80000000u ? ~bits : bits|0x80000000u;
+}
+
 }
 
 template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
@@ -90,13 +153,15 @@ template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_w
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Compute transformations of all objects in the group relative to the
+       camera. The object list is kept between calls to avoid allocating it
+       every frame. */
+    _objects.clear();
+    _objects.reserve(group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
+        _objects.push_back(group[i].object());
     std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        scene->transformationMatrices(_objects, _cameraMatrix);
 
     /* Combine drawable references and transformation matrices */
     std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> combined;
@@ -114,13 +179,15 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(Drawa
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Compute transformations of all objects in the group relative to the
+       camera. The object list is kept between calls to avoid allocating it
+       every frame. */
+    _objects.clear();
+    _objects.reserve(group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
+        _objects.push_back(group[i].object());
     std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        scene->transformationMatrices(_objects, _cameraMatrix);
 
     /* Perform the drawing */
     for(std::size_t i = 0; i != transformations.size(); ++i)
@@ -132,6 +199,58 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const
         drawableTransformation.first.get().draw(drawableTransformation.second, *this);
 }
 
+template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, const Containers::StridedArrayView1D<const UnsignedInt>& sortKeys, const DrawableDepthOrder depthOrder) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(),
+        "SceneGraph::Camera::drawableTransformations(): cannot draw when camera is not part of any scene", {});
+    CORRADE_ASSERT(bounds.size() == group.size(),
+        "SceneGraph::Camera::drawableTransformations(): expected" << group.size() << "bounds but got" << bounds.size(), {});
+    CORRADE_ASSERT(sortKeys.isEmpty() || sortKeys.size() == group.size(),
+        "SceneGraph::Camera::drawableTransformations(): expected" << group.size() << "sort keys but got" << sortKeys.size(), {});
+
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> transformations = drawableTransformations(group);
+
+    /* Cull, and for the remaining drawables calculate a sort key consisting
+       of the user-supplied key in the upper half and the depth in the lower
+       half. Index of the drawable is used as a last criterion to make the
+       sort stable. */
+    const Implementation::CameraCulling<dimensions, T> culling{_projectionMatrix};
+    std::vector<std::pair<UnsignedLong, std::size_t>> visible;
+    visible.reserve(transformations.size());
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        const MatrixTypeFor<dimensions, T>& transformation = transformations[i].second;
+        if(!culling.isVisible(transformation, bounds[i])) continue;
+
+        UnsignedLong key = sortKeys.isEmpty() ? 0 : UnsignedLong(sortKeys[i]) << 32;
+        if(depthOrder == DrawableDepthOrder::FrontToBack)
+            key |= Implementation::sortableDepth(Float(culling.depth(transformation, bounds[i])));
+        else if(depthOrder == DrawableDepthOrder::BackToFront)
+            key |= ~Implementation::sortableDepth(Float(culling.depth(transformation, bounds[i])));
+        visible.emplace_back(key, i);
+    }
+
+    if(!sortKeys.isEmpty() || depthOrder != DrawableDepthOrder::Unsorted)
+        std::sort(visible.begin(), visible.end());
+
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> out;
+    out.reserve(visible.size());
+    for(const std::pair<UnsignedLong, std::size_t>& i: visible)
+        out.push_back(transformations[i.second]);
+
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, const DrawableDepthOrder depthOrder) {
+    return drawableTransformations(group, bounds, nullptr, depthOrder);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, const Containers::StridedArrayView1D<const UnsignedInt>& sortKeys, const DrawableDepthOrder depthOrder) {
+    draw(drawableTransformations(group, bounds, sortKeys, depthOrder));
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>& bounds, const DrawableDepthOrder depthOrder) {
+    draw(drawableTransformations(group, bounds, nullptr, depthOrder));
+}
+
 }}
 
 #endif
@@ -114,10 +114,13 @@ parameters once for whole group instead of setting them again in each
 
 @section SceneGraph-Drawable-draw-order Custom draw order and object culling
 
-By default all contents of a drawable group are drawn, in the order they were
-added. In some cases you may want to draw them in a different order (for
-example to have correctly sorted transparent objects) or draw just a subset
-(for example to cull invisible objects away). That can be achieved using
+By default all contents of a drawable group are drawn, in the order they are
+in the group. That's the order they were added in, unless some drawables were
+removed since, in which case the last drawable got moved to the place of each
+removed one, as described in @ref SceneGraph-FeatureGroup-order. In some
+cases you may want to draw them in a different order (for example to have
+correctly sorted transparent objects) or draw just a subset (for example to
+cull invisible objects away). That can be achieved using
 @ref Camera::drawableTransformations() in combination with
 @ref Camera::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>&).
 For example, to have the objects sorted back-to-front, apply @ref std::sort()
@@ -134,6 +137,17 @@ get used in any way except being passed to the draw function:
 
 @snippet SceneGraph.cpp Drawable-culling
 
+For the common case where each drawable has bounds relative to its object,
+the culling, together with sorting by a state key such as a shader or a
+material ID and by depth, can be done directly by passing the bounds and keys
+to @ref Camera::draw(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const RangeTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const UnsignedInt>&, DrawableDepthOrder).
+The bounds and keys are expected to be in the same order as drawables in the
+group, i.e. matching @ref FeatureGroup::operator[](). Because removing a
+drawable from the group moves the last drawable to its place, the bounds and
+keys have to be reordered the same way on every removal:
+
+@snippet SceneGraph.cpp Drawable-culling-sorted
+
 @section SceneGraph-Drawable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -66,7 +66,9 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
         virtual ~AbstractFeatureGroup();
 
         void add(AbstractFeature<dimensions, T>& feature);
-        void remove(AbstractFeature<dimensions, T>& feature);
+        /* Moves the last feature to given index, the caller is responsible
+           for updating its back-reference */
+        void remove(std::size_t index);
 
         std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> _features;
 };
@@ -75,6 +77,15 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
 @brief Group of features
 
 See @ref AbstractGroupedFeature for more information.
+
+@section SceneGraph-FeatureGroup-order Feature order
+
+Features are stored in a contiguous array in the order they were added. Each
+feature remembers its position in the group, so both @ref add() and
+@ref remove() are done in constant time, and removing a feature moves the
+last feature in the group to its place. If you need the features in a
+particular order, such as when drawing transparent objects, sort them
+explicitly as described in @ref SceneGraph-Drawable-draw-order.
 @see @ref scenegraph, @ref BasicFeatureGroup2D, @ref BasicFeatureGroup3D,
     @ref FeatureGroup2D, @ref FeatureGroup3D
 */
@@ -124,7 +135,9 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
          * @brief Remove a feature from the group
          * @return Reference to self (for method chaining)
          *
-         * The feature must be part of the group.
+         * The feature must be part of the group. The last feature in the
+         * group is moved to the place of the removed feature, see
+         * @ref SceneGraph-FeatureGroup-order for more information.
          * @see @ref add()
          */
         FeatureGroup<dimensions, Feature, T>& remove(Feature& feature);
@@ -184,8 +197,9 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
         feature._group->remove(feature);
 
     /* Crossreference the feature and group together */
-    AbstractFeatureGroup<dimensions, T>::add(feature);
     feature._group = this;
+    feature._groupIndex = AbstractFeatureGroup<dimensions, T>::_features.size();
+    AbstractFeatureGroup<dimensions, T>::add(feature);
     return *this;
 }
 
@@ -193,7 +207,12 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
     CORRADE_ASSERT(feature._group == this,
         "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group", *this);
 
-    AbstractFeatureGroup<dimensions, T>::remove(feature);
+    /* Swap the last feature into the place of the removed one and update
+       its back-reference */
+    const std::size_t index = feature._groupIndex;
+    AbstractFeatureGroup<dimensions, T>::remove(index);
+    if(index < AbstractFeatureGroup<dimensions, T>::_features.size())
+        (*this)[index]._groupIndex = index;
     feature._group = nullptr;
     return *this;
 }
@@ -0,0 +1,528 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene, @ref Magnum::SceneGraph::FlatObject, alias @ref Magnum::SceneGraph::BasicFlatScene2D, @ref Magnum::SceneGraph::BasicFlatScene3D, @ref Magnum::SceneGraph::BasicFlatObject2D, @ref Magnum::SceneGraph::BasicFlatObject3D, typedef @ref Magnum::SceneGraph::FlatScene2D, @ref Magnum::SceneGraph::FlatScene3D, @ref Magnum::SceneGraph::FlatObject2D, @ref Magnum::SceneGraph::FlatObject3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    enum class FlatObjectFlag: UnsignedByte {
+        /* Local transformation or parent changed since last update() */
+        Dirty = 1 << 0,
+        /* Absolute transformation changed since the features were cleaned */
+        FeaturesDirty = 1 << 1
+    };
+
+    typedef Containers::EnumSet<FlatObjectFlag> FlatObjectFlags;
+
+    CORRADE_ENUMSET_OPERATORS(FlatObjectFlags)
+}
+
+/**
+@brief Scene with flat transformation storage
+@m_since_latest
+
+An alternative to @ref Scene and @ref Object for large dynamic scenes. Instead
+of storing the transformation inside each heap-allocated node of a linked
+tree, the scene keeps local transformations, absolute transformations, parent
+indices and dirty flags of all its @ref FlatObject instances in contiguous
+arrays indexed by @ref FlatObject::id(). Absolute transformations are then
+calculated in a single batch in @ref update(), going through the objects
+sorted by their depth in the hierarchy, which means each transformation is
+calculated exactly once and the memory is accessed in a predictable way.
+
+@snippet SceneGraph.cpp FlatScene
+
+Both classes implement the @ref AbstractObject interface, which means
+@ref Camera, @ref Drawable, @ref Animable and other features can be attached
+to @ref FlatObject instances the same way as to @ref Object instances. The
+@ref transformationMatrices() call done by @ref Camera::draw() is implemented
+as an @ref update() followed by a lookup into the absolute transformation
+array instead of walking the parent chain of each object.
+
+The transformation is always stored as a matrix, there's no equivalent to the
+various transformation implementations such as @ref DualQuaternionTransformation
+or @ref TranslationRotationScalingTransformation3D.
+
+@section SceneGraph-FlatScene-caching Transformation caching
+
+Transformation caching in features works similarly as with @ref Object, with
+one difference --- @ref AbstractFeature::markDirty() is called only on
+features of the object that was changed, not recursively on features of all
+its children, as that would defeat the purpose of a batch update. The
+features are then cleaned with the new absolute transformation in
+@ref FlatObject::setClean() as usual.
+
+@section SceneGraph-FlatScene-ownership Object ownership
+
+Similarly to @ref Object, objects are deleted by their parent or the scene
+upon destruction. Because the hierarchy isn't stored as a linked list,
+destroying a single object has a complexity linear in the count of all objects
+in the scene, destroying the whole scene is linear as well.
+
+@section SceneGraph-FlatScene-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into the @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use the @ref FlatScene.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatScene2D, @ref FlatObject2D
+-   @ref FlatScene3D, @ref FlatObject3D
+
+@see @ref BasicFlatScene2D, @ref BasicFlatScene3D, @ref FlatScene2D,
+    @ref FlatScene3D, @ref SceneTools::AbsoluteTransformations
+*/
+template<UnsignedInt dimensions, class T> class FlatScene: public AbstractObject<dimensions, T> {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /** @brief Constructor */
+        explicit FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene(FlatScene<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all objects in the scene. Features are then deleted in the
+         * @ref AbstractObject destructor.
+         */
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<dimensions, T>& operator=(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene<dimensions, T>& operator=(FlatScene<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Object ID bound
+         *
+         * Upper bound on @ref FlatObject::id() of all objects in the scene.
+         * IDs of deleted objects get reused by newly created objects, so this
+         * is the maximum count of objects that existed in the scene at the
+         * same time.
+         * @see @ref objectCount()
+         */
+        std::size_t objectIdBound() const { return _objects.size(); }
+
+        /**
+         * @brief Object count
+         *
+         * Count of objects currently in the scene, excluding the scene
+         * itself.
+         * @see @ref objectIdBound()
+         */
+        std::size_t objectCount() const { return _objects.size() - _freeIds.size(); }
+
+        /**
+         * @brief Whether any absolute transformation needs to be updated
+         *
+         * Returns @cpp true @ce if a transformation or a parent of any object
+         * changed, or any object was added since the last call to
+         * @ref update(), @cpp false @ce otherwise.
+         */
+        bool needsUpdate() const { return _needsUpdate; }
+
+        /**
+         * @brief Update absolute transformations
+         *
+         * Goes through all objects sorted by their depth in the hierarchy
+         * and calculates absolute transformations of objects that have their
+         * own or any parent transformation changed. If the hierarchy changed
+         * since last update, the depth order is recalculated first. If
+         * @ref needsUpdate() is @cpp false @ce, the function does nothing.
+         *
+         * The function is called implicitly from @ref absoluteTransformations(),
+         * @ref transformationMatrices() and @ref FlatObject::setClean(), so
+         * there's usually no need to call it directly.
+         */
+        void update() { updateInternal(); }
+
+        /**
+         * @brief Absolute transformations of all objects
+         *
+         * Calls @ref update() and returns absolute transformations of all
+         * objects in the scene, indexed by @ref FlatObject::id(). Size of the
+         * view is @ref objectIdBound(), contents of items corresponding to
+         * deleted objects are unspecified.
+         */
+        Containers::ArrayView<const MatrixType> absoluteTransformations() const;
+
+    private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend FlatObject<dimensions, T>;
+        #endif
+
+        FlatScene<dimensions, T>* doScene() override final { return this; }
+        const FlatScene<dimensions, T>* doScene() const override final { return this; }
+
+        AbstractObject<dimensions, T>* doParent() override final { return nullptr; }
+        const AbstractObject<dimensions, T>* doParent() const override final { return nullptr; }
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final { return {}; }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final { return {}; }
+
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return false; }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final {}
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final {}
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+
+        /* Called from the FlatObject constructor, returns the new ID */
+        UnsignedInt MAGNUM_SCENEGRAPH_LOCAL addInternal(FlatObject<dimensions, T>* object, UnsignedInt parent);
+        /* Called from the FlatObject destructor */
+        void MAGNUM_SCENEGRAPH_LOCAL removeInternal(UnsignedInt id);
+        /* Const because it's called from transformationMatrices(), modifies
+           only the mutable caches */
+        void updateInternal() const;
+        void MAGNUM_SCENEGRAPH_LOCAL updateOrderInternal() const;
+
+        /* All indexed by object ID. The parent index is ~UnsignedInt{} for
+           objects that are directly in the scene, the object pointer is
+           nullptr for deleted objects. */
+        Containers::Array<FlatObject<dimensions, T>*> _objects;
+        Containers::Array<UnsignedInt> _parents;
+        Containers::Array<MatrixType> _transformations;
+        mutable Containers::Array<MatrixType> _absoluteTransformations;
+        mutable Containers::Array<Implementation::FlatObjectFlags> _flags;
+        /* IDs of deleted objects, reused for newly created objects */
+        Containers::Array<UnsignedInt> _freeIds;
+        /* IDs of all objects sorted by depth, with parents always before
+           their children. Recalculated in update() if _orderDirty is set. */
+        mutable Containers::Array<UnsignedInt> _order;
+        mutable bool _needsUpdate{}, _orderDirty{};
+        bool _destructing{};
+};
+
+/**
+@brief Object in a scene with flat transformation storage
+@m_since_latest
+
+A lightweight handle to a transformation stored in a @ref FlatScene, to which
+features can be attached. See the @ref FlatScene documentation for more
+information.
+@see @ref BasicFlatObject2D, @ref BasicFlatObject3D, @ref FlatObject2D,
+    @ref FlatObject3D
+*/
+template<UnsignedInt dimensions, class T> class FlatObject: public AbstractObject<dimensions, T> {
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /**
+         * @brief Construct an object directly in the scene
+         *
+         * The object has an identity transformation.
+         */
+        explicit FlatObject(FlatScene<dimensions, T>& scene);
+
+        /**
+         * @brief Construct a child object
+         *
+         * The object has an identity transformation and is in the same scene
+         * as @p parent.
+         */
+        explicit FlatObject(FlatObject<dimensions, T>& parent);
+
+        /** @brief Copying is not allowed */
+        FlatObject(const FlatObject<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject(FlatObject<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all own children and then removes itself from the scene.
+         * Features are then deleted in the @ref AbstractObject destructor.
+         */
+        ~FlatObject();
+
+        /** @brief Copying is not allowed */
+        FlatObject<dimensions, T>& operator=(const FlatObject<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject<dimensions, T>& operator=(FlatObject<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Object ID
+         *
+         * Index into @ref FlatScene::absoluteTransformations(). Always less
+         * than @ref FlatScene::objectIdBound().
+         */
+        UnsignedInt id() const { return _id; }
+
+        /** @brief Scene */
+        FlatScene<dimensions, T>& scene() { return *_scene; }
+        const FlatScene<dimensions, T>& scene() const { return *_scene; } /**< @overload */
+
+        /**
+         * @brief Parent object
+         *
+         * Returns @cpp nullptr @ce if the object is directly in the scene.
+         * Note that @ref AbstractObject::parent() returns the scene in that
+         * case, for consistency with @ref Object.
+         */
+        FlatObject<dimensions, T>* parent();
+        const FlatObject<dimensions, T>* parent() const; /**< @overload */
+
+        /**
+         * @brief Set parent object
+         * @return Reference to self (for method chaining)
+         *
+         * Passing @cpp nullptr @ce puts the object directly into the scene.
+         * Expects that @p parent is in the same scene and isn't this object
+         * or any of its children. Marks the object as dirty.
+         */
+        FlatObject<dimensions, T>& setParent(FlatObject<dimensions, T>* parent);
+
+        /** @brief Object transformation */
+        MatrixType transformation() const;
+
+        /**
+         * @brief Set object transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the object as dirty.
+         */
+        FlatObject<dimensions, T>& setTransformation(const MatrixType& transformation);
+
+        /**
+         * @brief Transform the object
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @cpp setTransformation(transformation*this->transformation()) @ce.
+         * @see @ref transformLocal()
+         */
+        FlatObject<dimensions, T>& transform(const MatrixType& transformation) {
+            return setTransformation(transformation*this->transformation());
+        }
+
+        /**
+         * @brief Transform the object as a local transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to @cpp setTransformation(this->transformation()*transformation) @ce.
+         * @see @ref transform()
+         */
+        FlatObject<dimensions, T>& transformLocal(const MatrixType& transformation) {
+            return setTransformation(this->transformation()*transformation);
+        }
+
+        /**
+         * @brief Transformation relative to the scene
+         *
+         * Calculated by walking the parent chain, doesn't depend on the
+         * @ref FlatScene::update() state. Use
+         * @ref FlatScene::absoluteTransformations() to get absolute
+         * transformations of many objects at once.
+         */
+        MatrixType absoluteTransformation() const;
+
+        /**
+         * @{ @name Transformation caching
+         *
+         * See @ref SceneGraph-FlatScene-caching for more information.
+         */
+
+        /**
+         * @brief Whether absolute transformation is dirty
+         *
+         * Returns @cpp true @ce if transformation of the object or any parent
+         * has changed since last call to @ref setClean(), @cpp false @ce
+         * otherwise. All objects are dirty by default.
+         */
+        bool isDirty() const;
+
+        /**
+         * @brief Set object absolute transformation as dirty
+         *
+         * Calls @ref AbstractFeature::markDirty() on all object features and
+         * marks the object transformation for recalculation in the next
+         * @ref FlatScene::update(). Unlike @ref Object::setDirty(), the
+         * features of child objects aren't marked as dirty.
+         */
+        void setDirty();
+
+        /**
+         * @brief Clean object absolute transformation
+         *
+         * Calls @ref FlatScene::update() and then
+         * @ref AbstractFeature::clean() and/or
+         * @ref AbstractFeature::cleanInverted() on all object features which
+         * have caching enabled. If the object is already clean, the function
+         * does nothing.
+         */
+        void setClean();
+
+        /* Since 1.8.17, the original short-hand group closing doesn't work
+           anymore. FFS. */
+        /**
+         * @}
+         */
+
+    private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend FlatScene<dimensions, T>;
+        #endif
+
+        FlatScene<dimensions, T>* doScene() override final { return _scene; }
+        const FlatScene<dimensions, T>* doScene() const override final { return _scene; }
+
+        AbstractObject<dimensions, T>* doParent() override final;
+        const AbstractObject<dimensions, T>* doParent() const override final;
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final {
+            return transformation();
+        }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final {
+            return absoluteTransformation();
+        }
+
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+
+        void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal();
+
+        FlatScene<dimensions, T>* _scene;
+        UnsignedInt _id;
+};
+
+/**
+@brief Two-dimensional scene with flat transformation storage
+@m_since_latest
+
+Convenience alternative to @cpp FlatScene<2, T> @ce. See @ref FlatScene for
+more information.
+@see @ref FlatScene2D, @ref BasicFlatScene3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+#endif
+
+/**
+@brief Two-dimensional float scene with flat transformation storage
+@m_since_latest
+
+@see @ref FlatScene3D
+*/
+typedef BasicFlatScene2D<Float> FlatScene2D;
+
+/**
+@brief Three-dimensional scene with flat transformation storage
+@m_since_latest
+
+Convenience alternative to @cpp FlatScene<3, T> @ce. See @ref FlatScene for
+more information.
+@see @ref FlatScene3D, @ref BasicFlatScene2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+#endif
+
+/**
+@brief Three-dimensional float scene with flat transformation storage
+@m_since_latest
+
+@see @ref FlatScene2D
+*/
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+/**
+@brief Two-dimensional object in a scene with flat transformation storage
+@m_since_latest
+
+Convenience alternative to @cpp FlatObject<2, T> @ce. See @ref FlatObject for
+more information.
+@see @ref FlatObject2D, @ref BasicFlatObject3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+#endif
+
+/**
+@brief Two-dimensional float object in a scene with flat transformation storage
+@m_since_latest
+
+@see @ref FlatObject3D
+*/
+typedef BasicFlatObject2D<Float> FlatObject2D;
+
+/**
+@brief Three-dimensional object in a scene with flat transformation storage
+@m_since_latest
+
+Convenience alternative to @cpp FlatObject<3, T> @ce. See @ref FlatObject for
+more information.
+@see @ref FlatObject3D, @ref BasicFlatObject2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+#endif
+
+/**
+@brief Three-dimensional float object in a scene with flat transformation storage
+@m_since_latest
+
+@see @ref FlatObject2D
+*/
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<3, Float>;
+#endif
+
+}}
+
+#endif
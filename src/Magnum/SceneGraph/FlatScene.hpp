@@ -0,0 +1,338 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Parent index of objects that are directly in the scene */
+    constexpr UnsignedInt FlatSceneRoot = ~UnsignedInt{};
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::FlatScene() = default;
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::~FlatScene() {
+    /* Objects don't need to remove themselves from the arrays or look for
+       their children when the whole scene is going away */
+    _destructing = true;
+    for(FlatObject<dimensions, T>* object: _objects) delete object;
+}
+
+template<UnsignedInt dimensions, class T> Containers::ArrayView<const MatrixTypeFor<dimensions, T>> FlatScene<dimensions, T>::absoluteTransformations() const {
+    updateInternal();
+    return _absoluteTransformations;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt FlatScene<dimensions, T>::addInternal(FlatObject<dimensions, T>* const object, const UnsignedInt parent) {
+    UnsignedInt id;
+    if(!_freeIds.isEmpty()) {
+        id = _freeIds.back();
+        arrayRemoveSuffix(_freeIds);
+    } else {
+        CORRADE_ASSERT(_objects.size() < Implementation::FlatSceneRoot,
+            "SceneGraph::FlatObject: too large scene", {});
+        id = _objects.size();
+        arrayAppend(_objects, nullptr);
+        arrayAppend(_parents, NoInit, 1);
+        arrayAppend(_transformations, NoInit, 1);
+        arrayAppend(_absoluteTransformations, NoInit, 1);
+        arrayAppend(_flags, NoInit, 1);
+    }
+
+    _objects[id] = object;
+    _parents[id] = parent;
+    _transformations[id] = MatrixType{};
+    _absoluteTransformations[id] = MatrixType{};
+    _flags[id] = Implementation::FlatObjectFlag::Dirty|Implementation::FlatObjectFlag::FeaturesDirty;
+    _needsUpdate = _orderDirty = true;
+    return id;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::removeInternal(const UnsignedInt id) {
+    _objects[id] = nullptr;
+    _flags[id] = {};
+    arrayAppend(_freeIds, id);
+    _orderDirty = true;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::updateOrderInternal() const {
+    /* Calculate depth of every live object. Parents can have larger IDs than
+       their children, so for each object walk up until an object with known
+       depth or the root is found, and then fill in the whole chain. */
+    constexpr UnsignedInt Unknown = ~UnsignedInt{};
+    Containers::Array<UnsignedInt> depths{NoInit, _objects.size()};
+    /** @todo Utility::fill() */
+    for(UnsignedInt& i: depths) i = Unknown;
+    UnsignedInt maxDepth = 0;
+    for(std::size_t i = 0; i != _objects.size(); ++i) {
+        if(!_objects[i] || depths[i] != Unknown) continue;
+
+        UnsignedInt chainLength = 0;
+        UnsignedInt p = i;
+        while(p != Implementation::FlatSceneRoot && depths[p] == Unknown) {
+            p = _parents[p];
+            ++chainLength;
+        }
+
+        UnsignedInt depth = (p == Implementation::FlatSceneRoot ? 0 : depths[p] + 1) + chainLength - 1;
+        maxDepth = Math::max(maxDepth, depth);
+        for(p = i; p != Implementation::FlatSceneRoot && depths[p] == Unknown; p = _parents[p])
+            depths[p] = depth--;
+    }
+
+    /* Counting sort by depth, preserving the ID order within each level */
+    Containers::Array<UnsignedInt> offsets{ValueInit, std::size_t(maxDepth) + 2};
+    for(std::size_t i = 0; i != _objects.size(); ++i)
+        if(_objects[i]) ++offsets[depths[i] + 1];
+    for(std::size_t i = 1; i != offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+
+    arrayResize(_order, NoInit, offsets.back());
+    for(std::size_t i = 0; i != _objects.size(); ++i)
+        if(_objects[i]) _order[offsets[depths[i]]++] = i;
+
+    _orderDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::updateInternal() const {
+    if(!_needsUpdate) return;
+
+    if(_orderDirty) updateOrderInternal();
+
+    /* Parents are always before their children in the order, so their dirty
+       flag and absolute transformation is final at this point. Dirty objects
+       propagate the dirty flag to their children. */
+    for(const UnsignedInt id: _order) {
+        const UnsignedInt parent = _parents[id];
+        if(parent == Implementation::FlatSceneRoot) {
+            if(!(_flags[id] & Implementation::FlatObjectFlag::Dirty)) continue;
+            _absoluteTransformations[id] = _transformations[id];
+        } else {
+            if(!(_flags[id] & Implementation::FlatObjectFlag::Dirty) && !(_flags[parent] & Implementation::FlatObjectFlag::Dirty)) continue;
+            _absoluteTransformations[id] = _absoluteTransformations[parent]*_transformations[id];
+        }
+
+        _flags[id] |= Implementation::FlatObjectFlag::Dirty|Implementation::FlatObjectFlag::FeaturesDirty;
+    }
+
+    for(const UnsignedInt id: _order)
+        _flags[id] &= ~Implementation::FlatObjectFlag::Dirty;
+
+    _needsUpdate = false;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
+    updateInternal();
+
+    std::vector<MatrixType> transformationMatrices;
+    transformationMatrices.reserve(objects.size());
+    for(const auto& o: objects) {
+        if(&o.get() == this) {
+            transformationMatrices.push_back(finalTransformationMatrix);
+            continue;
+        }
+
+        /** @todo Ensure this doesn't crash, somehow */
+        const FlatObject<dimensions, T>& object = static_cast<const FlatObject<dimensions, T>&>(o.get());
+        CORRADE_ASSERT(object._scene == this,
+            "SceneGraph::FlatScene::transformationMatrices(): the objects are not part of the same scene", {});
+        transformationMatrices.push_back(finalTransformationMatrix*_absoluteTransformations[object._id]);
+    }
+
+    return transformationMatrices;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) {
+    updateInternal();
+
+    for(const auto& o: objects) {
+        /* The scene itself is always clean */
+        if(&o.get() == this) continue;
+
+        /** @todo Ensure this doesn't crash, somehow */
+        FlatObject<dimensions, T>& object = static_cast<FlatObject<dimensions, T>&>(o.get());
+        CORRADE_ASSERT(object._scene == this,
+            "SceneGraph::FlatScene::setClean(): the objects are not part of the same scene", );
+        object.setCleanInternal();
+    }
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::FlatObject(FlatScene<dimensions, T>& scene): _scene{&scene}, _id{scene.addInternal(this, Implementation::FlatSceneRoot)} {}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::FlatObject(FlatObject<dimensions, T>& parent): _scene{parent._scene}, _id{parent._scene->addInternal(this, parent._id)} {}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::~FlatObject() {
+    if(_scene->_destructing) return;
+
+    /* Delete all children first. Their destructors recursively delete their
+       children and mark the slots as free, which doesn't affect the
+       iteration. */
+    for(std::size_t i = 0; i != _scene->_objects.size(); ++i)
+        if(_scene->_objects[i] && _scene->_parents[i] == _id)
+            delete _scene->_objects[i];
+
+    _scene->removeInternal(_id);
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() {
+    const UnsignedInt parent = _scene->_parents[_id];
+    return parent == Implementation::FlatSceneRoot ? nullptr : _scene->_objects[parent];
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() const {
+    const UnsignedInt parent = _scene->_parents[_id];
+    return parent == Implementation::FlatSceneRoot ? nullptr : _scene->_objects[parent];
+}
+
+template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doParent() {
+    if(FlatObject<dimensions, T>* const p = parent()) return p;
+    return _scene;
+}
+
+template<UnsignedInt dimensions, class T> const AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doParent() const {
+    if(const FlatObject<dimensions, T>* const p = parent()) return p;
+    return _scene;
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatObject<dimensions, T>::setParent(FlatObject<dimensions, T>* const parent) {
+    UnsignedInt parentId = Implementation::FlatSceneRoot;
+    if(parent) {
+        CORRADE_ASSERT(parent->_scene == _scene,
+            "SceneGraph::FlatObject::setParent(): the parent is in a different scene", *this);
+
+        /* Object cannot be parented to itself or its child */
+        for(UnsignedInt p = parent->_id; p != Implementation::FlatSceneRoot; p = _scene->_parents[p])
+            CORRADE_ASSERT(p != _id,
+                "SceneGraph::FlatObject::setParent(): can't parent an object to itself or its child", *this);
+
+        parentId = parent->_id;
+    }
+
+    if(_scene->_parents[_id] == parentId) return *this;
+
+    _scene->_parents[_id] = parentId;
+    _scene->_orderDirty = true;
+    setDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::transformation() const -> MatrixType {
+    return _scene->_transformations[_id];
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatObject<dimensions, T>::setTransformation(const MatrixType& transformation) {
+    _scene->_transformations[_id] = transformation;
+    setDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::absoluteTransformation() const -> MatrixType {
+    MatrixType transformation = _scene->_transformations[_id];
+    for(UnsignedInt p = _scene->_parents[_id]; p != Implementation::FlatSceneRoot; p = _scene->_parents[p])
+        transformation = _scene->_transformations[p]*transformation;
+    return transformation;
+}
+
+template<UnsignedInt dimensions, class T> bool FlatObject<dimensions, T>::isDirty() const {
+    if(_scene->_flags[_id] & Implementation::FlatObjectFlag::FeaturesDirty)
+        return true;
+
+    /* A transformation change of any parent that wasn't propagated yet makes
+       this object dirty as well */
+    for(UnsignedInt p = _id; p != Implementation::FlatSceneRoot; p = _scene->_parents[p])
+        if(_scene->_flags[p] & Implementation::FlatObjectFlag::Dirty)
+            return true;
+
+    return false;
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setDirty() {
+    _scene->_needsUpdate = true;
+
+    /* Already marked for update, the features were marked dirty already */
+    if(_scene->_flags[_id] & Implementation::FlatObjectFlag::Dirty) return;
+
+    for(AbstractFeature<dimensions, T>& feature: this->features())
+        feature.markDirty();
+
+    _scene->_flags[_id] |= Implementation::FlatObjectFlag::Dirty;
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setClean() {
+    _scene->updateInternal();
+    setCleanInternal();
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setCleanInternal() {
+    if(!(_scene->_flags[_id] & Implementation::FlatObjectFlag::FeaturesDirty))
+        return;
+
+    /* "Lazy storage" for transformation matrix and inverted transformation
+       matrix, same as in Object::setCleanInternal() */
+    const MatrixType& matrix = _scene->_absoluteTransformations[_id];
+    CachedTransformations cached;
+    MatrixType invertedMatrix;
+    for(AbstractFeature<dimensions, T>& feature: this->features()) {
+        if(feature.cachedTransformations() & CachedTransformation::Absolute)
+            feature.clean(matrix);
+
+        if(feature.cachedTransformations() & CachedTransformation::InvertedAbsolute) {
+            if(!(cached & CachedTransformation::InvertedAbsolute)) {
+                cached |= CachedTransformation::InvertedAbsolute;
+                invertedMatrix = matrix.inverted();
+            }
+
+            feature.cleanInverted(invertedMatrix);
+        }
+    }
+
+    _scene->_flags[_id] &= ~Implementation::FlatObjectFlag::FeaturesDirty;
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
+    /* Relative to this object, which is the scene-relative transformation
+       premultiplied with inverse of the absolute transformation */
+    return _scene->doTransformationMatrices(objects, finalTransformationMatrix*_scene->absoluteTransformations()[_id].inverted());
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) {
+    _scene->doSetClean(objects);
+}
+
+}}
+
+#endif
@@ -36,6 +36,7 @@
 namespace Magnum { namespace SceneGraph {
 
 enum class AspectRatioPolicy: UnsignedByte;
+enum class DrawableDepthOrder: UnsignedByte;
 
 /* Enum CachedTransformation and CachedTransformations used only directly */
 
@@ -118,6 +119,18 @@ template<class Feature, class T> using BasicFeatureGroup3D = FeatureGroup<3, Fea
 template<class Feature> using FeatureGroup2D = BasicFeatureGroup2D<Feature, Float>;
 template<class Feature> using FeatureGroup3D = BasicFeatureGroup3D<Feature, Float>;
 
+template<UnsignedInt, class> class FlatObject;
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+typedef BasicFlatObject2D<Float> FlatObject2D;
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+template<UnsignedInt, class> class FlatScene;
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+typedef BasicFlatScene2D<Float> FlatScene2D;
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
 template<UnsignedInt dimensions, class T> using DrawableGroup = FeatureGroup<dimensions, Drawable<dimensions, T>, T>;
 template<class T> using BasicDrawableGroup2D = DrawableGroup<2, T>;
 template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
@@ -54,6 +54,9 @@ struct CameraTest: TestSuite::Tester {
 
     template<class T> void draw();
     template<class T> void drawOrdered();
+    template<class T> void drawCulled2D();
+    template<class T> void drawCulled3D();
+    template<class T> void drawSorted();
 };
 
 CameraTest::CameraTest() {
@@ -78,11 +81,18 @@ CameraTest::CameraTest() {
         &CameraTest::draw<Float>,
         &CameraTest::draw<Double>,
         &CameraTest::drawOrdered<Float>,
-        &CameraTest::drawOrdered<Double>});
+        &CameraTest::drawOrdered<Double>,
+        &CameraTest::drawCulled2D<Float>,
+        &CameraTest::drawCulled2D<Double>,
+        &CameraTest::drawCulled3D<Float>,
+        &CameraTest::drawCulled3D<Double>,
+        &CameraTest::drawSorted<Float>,
+        &CameraTest::drawSorted<Double>});
 }
 
 template<class T> using Object2D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Object3D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<T>>;
+template<class T> using Scene2D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Scene3D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation3D<T>>;
 
 template<class T> void CameraTest::fixAspectRatio() {
@@ -303,6 +313,225 @@ template<class T> void CameraTest::drawOrdered() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void CameraTest::drawCulled2D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable2D<T> {
+        public:
+            Drawable(AbstractBasicObject2D<T>& object, BasicDrawableGroup2D<T>* group, std::vector<Int>& result, Int id): SceneGraph::BasicDrawable2D<T>{object, group}, _result(result), _id{id} {}
+
+        protected:
+            void draw(const Math::Matrix3<T>&, BasicCamera2D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            std::vector<Int>& _result;
+            Int _id;
+    };
+
+    BasicDrawableGroup2D<T> group;
+    Scene2D<T> scene;
+    std::vector<Int> drawn;
+
+    /* Visible area is [-2; 2] on both axes */
+    Object2D<T> cameraObject{&scene};
+    BasicCamera2D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix3<T>::projection({T(4.0), T(4.0)}));
+
+    /* In the center, visible */
+    Object2D<T> first{&scene};
+    new Drawable{first, &group, drawn, 0};
+
+    /* Fully outside on the right, culled */
+    Object2D<T> second{&scene};
+    second.translate(Math::Vector2<T>::xAxis(T(2.6)));
+    new Drawable{second, &group, drawn, 1};
+
+    /* Partially inside on the left, visible */
+    Object2D<T> third{&scene};
+    third.translate(Math::Vector2<T>::xAxis(T(-2.4)));
+    new Drawable{third, &group, drawn, 2};
+
+    /* Same as the second, but rotated so the transformed bounds reach back
+       into the visible area */
+    Object2D<T> fourth{&scene};
+    fourth.rotate(Math::Deg<T>{T(45.0)})
+        .translate(Math::Vector2<T>::xAxis(T(2.6)));
+    new Drawable{fourth, &group, drawn, 3};
+
+    const Math::Range2D<T> bounds[]{
+        {{T(-0.5), T(-0.5)}, {T(0.5), T(0.5)}},
+        {{T(-0.5), T(-0.5)}, {T(0.5), T(0.5)}},
+        {{T(-0.5), T(-0.5)}, {T(0.5), T(0.5)}},
+        {{T(-0.5), T(-0.5)}, {T(0.5), T(0.5)}},
+    };
+    camera.draw(group, bounds);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 2, 3}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawCulled3D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Int>& result, Int id): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result), _id{id} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            std::vector<Int>& _result;
+            Int _id;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    /* Camera is looking at -Z with a 90° FoV, so at Z = -5 the visible area
+       is [-5; 5] on both X and Y */
+    Object3D<T> cameraObject{&scene};
+    cameraObject.translate(Math::Vector3<T>::zAxis(T(5.0)));
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>{T(90.0)}, T(1.0), T(0.1), T(100.0)));
+
+    /* In front of the camera, visible */
+    Object3D<T> first{&scene};
+    new Drawable{first, &group, drawn, 0};
+
+    /* Behind the camera, culled */
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::zAxis(T(10.0)));
+    new Drawable{second, &group, drawn, 1};
+
+    /* Partially visible at the right edge */
+    Object3D<T> third{&scene};
+    third.translate(Math::Vector3<T>::xAxis(T(5.4)));
+    new Drawable{third, &group, drawn, 2};
+
+    /* Far off to the side, culled */
+    Object3D<T> fourth{&scene};
+    fourth.translate(Math::Vector3<T>::xAxis(T(100.0)));
+    new Drawable{fourth, &group, drawn, 3};
+
+    /* Beyond the far plane, culled */
+    Object3D<T> fifth{&scene};
+    fifth.translate(Math::Vector3<T>::zAxis(T(-200.0)));
+    new Drawable{fifth, &group, drawn, 4};
+
+    /* Child of a culled object, but scaled so it gets visible again */
+    Object3D<T> sixth{&fourth};
+    sixth.scale(Math::Vector3<T>{T(100.0)});
+    new Drawable{sixth, &group, drawn, 5};
+
+    const Math::Range3D<T> bounds[]{
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+    };
+    std::vector<std::pair<std::reference_wrapper<SceneGraph::BasicDrawable3D<T>>, Math::Matrix4<T>>> drawableTransformations = camera.drawableTransformations(group, bounds);
+    CORRADE_COMPARE(drawableTransformations.size(), 3);
+    CORRADE_COMPARE(&drawableTransformations[0].first.get(), &group[0]);
+    CORRADE_COMPARE(drawableTransformations[0].second, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(-5.0))));
+    CORRADE_COMPARE(&drawableTransformations[1].first.get(), &group[2]);
+    CORRADE_COMPARE(&drawableTransformations[2].first.get(), &group[5]);
+
+    camera.draw(group, bounds);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 2, 5}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawSorted() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Int>& result, Int id): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result), _id{id} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            std::vector<Int>& _result;
+            Int _id;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::orthographicProjection({T(20.0), T(20.0)}, T(0.1), T(100.0)));
+
+    /* All visible, each farther away from the camera */
+    Object3D<T> first{&scene}, second{&scene}, third{&scene}, fourth{&scene};
+    Object3D<T>* objects[]{&first, &second, &third, &fourth};
+    for(Int i = 0; i != 4; ++i) {
+        objects[i]->translate(Math::Vector3<T>::zAxis(-T(i + 1)));
+        new Drawable{*objects[i], &group, drawn, i};
+    }
+
+    const Math::Range3D<T> bounds[]{
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+    };
+    const UnsignedInt keys[]{2, 1, 2, 1};
+
+    /* No sorting */
+    camera.draw(group, bounds);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+
+    /* Just depth */
+    drawn.clear();
+    camera.draw(group, bounds, DrawableDepthOrder::FrontToBack);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+
+    drawn.clear();
+    camera.draw(group, bounds, DrawableDepthOrder::BackToFront);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{3, 2, 1, 0}),
+        TestSuite::Compare::Container);
+
+    /* Just keys, the order is preserved for drawables with the same key */
+    drawn.clear();
+    camera.draw(group, bounds, keys);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{1, 3, 0, 2}),
+        TestSuite::Compare::Container);
+
+    /* Keys and depth */
+    drawn.clear();
+    camera.draw(group, bounds, keys, DrawableDepthOrder::BackToFront);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{3, 1, 2, 0}),
+        TestSuite::Compare::Container);
+
+    /* The depth is taken from the bounds center, not the object origin. The
+       first object is the nearest one but its bounds are behind all others,
+       so it's drawn last. */
+    const Math::Range3D<T> offsetBounds[]{
+        {{T(-1.0), T(-1.0), T(-11.0)}, {T(1.0), T(1.0), T(-9.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+        {Math::Vector3<T>{T(-1.0)}, Math::Vector3<T>{T(1.0)}},
+    };
+    drawn.clear();
+    camera.draw(group, offsetBounds, DrawableDepthOrder::FrontToBack);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{1, 2, 3, 0}),
+        TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,216 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FeatureGroupTest: TestSuite::Tester {
+    explicit FeatureGroupTest();
+
+    void add();
+    void addToAnotherGroup();
+    void remove();
+    void removeLast();
+    void removeNotInGroup();
+    void destructFeature();
+    void destructGroup();
+};
+
+FeatureGroupTest::FeatureGroupTest() {
+    addTests({&FeatureGroupTest::add,
+              &FeatureGroupTest::addToAnotherGroup,
+              &FeatureGroupTest::remove,
+              &FeatureGroupTest::removeLast,
+              &FeatureGroupTest::removeNotInGroup,
+              &FeatureGroupTest::destructFeature,
+              &FeatureGroupTest::destructGroup});
+}
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+class Feature: public SceneGraph::AbstractGroupedFeature3D<Feature> {
+    public:
+        explicit Feature(AbstractObject3D& object, FeatureGroup3D<Feature>* group = nullptr): AbstractGroupedFeature3D<Feature>{object, group} {}
+};
+
+void FeatureGroupTest::add() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+    CORRADE_VERIFY(group.isEmpty());
+
+    Feature a{object, &group};
+    Feature b{object};
+    CORRADE_VERIFY(!b.group());
+    group.add(b);
+
+    CORRADE_VERIFY(!group.isEmpty());
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &b);
+    CORRADE_COMPARE(a.group(), &group);
+    CORRADE_COMPARE(b.group(), &group);
+
+    /* Adding again to the same group moves the feature to the end */
+    group.add(a);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &b);
+    CORRADE_COMPARE(&group[1], &a);
+}
+
+void FeatureGroupTest::addToAnotherGroup() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group1, group2;
+
+    Feature a{object, &group1};
+    Feature b{object, &group1};
+    Feature c{object, &group1};
+
+    /* The feature gets removed from the original group */
+    group2.add(a);
+    CORRADE_COMPARE(a.group(), &group2);
+    CORRADE_COMPARE(group1.size(), 2);
+    CORRADE_COMPARE(&group1[0], &c);
+    CORRADE_COMPARE(&group1[1], &b);
+    CORRADE_COMPARE(group2.size(), 1);
+    CORRADE_COMPARE(&group2[0], &a);
+}
+
+void FeatureGroupTest::remove() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    /* The last feature gets moved to the place of the removed one */
+    group.remove(b);
+    CORRADE_VERIFY(!b.group());
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &d);
+    CORRADE_COMPARE(&group[2], &c);
+
+    /* Removing the moved feature works correctly as well, verifying its
+       position got updated */
+    group.remove(d);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &c);
+
+    group.remove(a);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &c);
+
+    group.remove(c);
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+void FeatureGroupTest::removeLast() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+
+    group.remove(b);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &a);
+
+    /* The feature can be added back */
+    group.add(b);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[1], &b);
+    group.remove(a);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &b);
+}
+
+void FeatureGroupTest::removeNotInGroup() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group1, group2;
+
+    Feature a{object, &group1};
+    Feature b{object};
+
+    Containers::String out;
+    Error redirectError{&out};
+    group2.remove(a);
+    group2.remove(b);
+    CORRADE_COMPARE(out,
+        "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group\n"
+        "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group\n");
+}
+
+void FeatureGroupTest::destructFeature() {
+    Scene3D scene;
+    Object3D object{&scene};
+    FeatureGroup3D<Feature> group;
+
+    Feature a{object, &group};
+    {
+        Feature b{object, &group};
+        Feature c{object, &group};
+        CORRADE_COMPARE(group.size(), 3);
+    }
+
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &a);
+}
+
+void FeatureGroupTest::destructGroup() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Feature a{object};
+
+    {
+        FeatureGroup3D<Feature> group;
+        group.add(a);
+        CORRADE_COMPARE(a.group(), &group);
+    }
+
+    CORRADE_VERIFY(!a.group());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FeatureGroupTest)
@@ -0,0 +1,497 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void construct();
+    void constructChild();
+    void destructChildren();
+    void idReuse();
+
+    void parent();
+    void setParent();
+    void setParentInvalid();
+
+    void transformation();
+    void absoluteTransformation();
+    void update();
+    void updateReparented();
+    void transformationMatrices();
+    void transformationMatricesRelative();
+
+    void setClean();
+    void setCleanList();
+
+    void draw();
+};
+
+using namespace Math::Literals;
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::construct,
+              &FlatSceneTest::constructChild,
+              &FlatSceneTest::destructChildren,
+              &FlatSceneTest::idReuse,
+
+              &FlatSceneTest::parent,
+              &FlatSceneTest::setParent,
+              &FlatSceneTest::setParentInvalid,
+
+              &FlatSceneTest::transformation,
+              &FlatSceneTest::absoluteTransformation,
+              &FlatSceneTest::update,
+              &FlatSceneTest::updateReparented,
+              &FlatSceneTest::transformationMatrices,
+              &FlatSceneTest::transformationMatricesRelative,
+
+              &FlatSceneTest::setClean,
+              &FlatSceneTest::setCleanList,
+
+              &FlatSceneTest::draw});
+}
+
+void FlatSceneTest::construct() {
+    FlatScene3D scene;
+    CORRADE_COMPARE(scene.objectIdBound(), 0);
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_VERIFY(!scene.needsUpdate());
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_COMPARE(scene.scene(), &scene);
+    CORRADE_VERIFY(!scene.parent());
+
+    FlatObject3D* object = new FlatObject3D{scene};
+    CORRADE_COMPARE(object->id(), 0);
+    CORRADE_COMPARE(&object->scene(), &scene);
+    CORRADE_COMPARE(object->transformation(), Matrix4{});
+    CORRADE_VERIFY(object->isDirty());
+    CORRADE_COMPARE(scene.objectIdBound(), 1);
+    CORRADE_COMPARE(scene.objectCount(), 1);
+    CORRADE_VERIFY(scene.needsUpdate());
+
+    /* Polymorphic access */
+    AbstractObject3D& abstractObject = *object;
+    CORRADE_COMPARE(abstractObject.scene(), &scene);
+    CORRADE_COMPARE(abstractObject.parent(), &scene);
+}
+
+void FlatSceneTest::constructChild() {
+    FlatScene2D scene;
+    FlatObject2D* a = new FlatObject2D{scene};
+    FlatObject2D* b = new FlatObject2D{*a};
+    CORRADE_COMPARE(b->id(), 1);
+    CORRADE_COMPARE(&b->scene(), &scene);
+    CORRADE_COMPARE(b->parent(), a);
+    CORRADE_COMPARE(static_cast<AbstractObject2D&>(*b).parent(), a);
+    CORRADE_COMPARE(scene.objectCount(), 2);
+}
+
+void FlatSceneTest::destructChildren() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    FlatObject3D* b = new FlatObject3D{scene};
+    FlatObject3D* c = new FlatObject3D{*a};
+    new FlatObject3D{*c};
+    new FlatObject3D{*c};
+    /* Child with a lower ID than the parent */
+    b->setParent(c);
+    CORRADE_COMPARE(scene.objectCount(), 5);
+
+    /* Deleting an object deletes all its children as well */
+    delete a;
+    CORRADE_COMPARE(scene.objectIdBound(), 5);
+    CORRADE_COMPARE(scene.objectCount(), 0);
+}
+
+void FlatSceneTest::idReuse() {
+    FlatScene3D scene;
+    new FlatObject3D{scene};
+    FlatObject3D* b = new FlatObject3D{scene};
+    new FlatObject3D{scene};
+    delete b;
+    CORRADE_COMPARE(scene.objectIdBound(), 3);
+    CORRADE_COMPARE(scene.objectCount(), 2);
+
+    /* The new object gets the free slot and has its state reset */
+    FlatObject3D* d = new FlatObject3D{scene};
+    CORRADE_COMPARE(d->id(), 1);
+    CORRADE_COMPARE(d->transformation(), Matrix4{});
+    CORRADE_VERIFY(!d->parent());
+    CORRADE_COMPARE(scene.objectIdBound(), 3);
+    CORRADE_COMPARE(scene.objectCount(), 3);
+    CORRADE_COMPARE(scene.absoluteTransformations()[1], Matrix4{});
+}
+
+void FlatSceneTest::parent() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    FlatObject3D* b = new FlatObject3D{*a};
+
+    const FlatObject3D& ca = *a;
+    const FlatObject3D& cb = *b;
+    CORRADE_VERIFY(!a->parent());
+    CORRADE_VERIFY(!ca.parent());
+    CORRADE_COMPARE(b->parent(), a);
+    CORRADE_COMPARE(cb.parent(), a);
+
+    /* The abstract interface returns the scene for top-level objects */
+    const AbstractObject3D& abstractA = *a;
+    CORRADE_COMPARE(abstractA.parent(), &scene);
+}
+
+void FlatSceneTest::setParent() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    FlatObject3D* b = new FlatObject3D{scene};
+    FlatObject3D* c = new FlatObject3D{*a};
+    scene.update();
+    CORRADE_VERIFY(!scene.needsUpdate());
+
+    c->setParent(b);
+    CORRADE_COMPARE(c->parent(), b);
+    CORRADE_VERIFY(scene.needsUpdate());
+    CORRADE_VERIFY(c->isDirty());
+
+    c->setParent(nullptr);
+    CORRADE_VERIFY(!c->parent());
+
+    /* Setting the same parent again is a no-op */
+    scene.update();
+    c->setParent(nullptr);
+    CORRADE_VERIFY(!scene.needsUpdate());
+}
+
+void FlatSceneTest::setParentInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene, another;
+    FlatObject3D* a = new FlatObject3D{scene};
+    FlatObject3D* b = new FlatObject3D{*a};
+    FlatObject3D* c = new FlatObject3D{another};
+
+    Containers::String out;
+    Error redirectError{&out};
+    a->setParent(a);
+    a->setParent(b);
+    a->setParent(c);
+    CORRADE_COMPARE(out,
+        "SceneGraph::FlatObject::setParent(): can't parent an object to itself or its child\n"
+        "SceneGraph::FlatObject::setParent(): can't parent an object to itself or its child\n"
+        "SceneGraph::FlatObject::setParent(): the parent is in a different scene\n");
+}
+
+void FlatSceneTest::transformation() {
+    FlatScene3D scene;
+    FlatObject3D object{scene};
+
+    object.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(object.transformation(), Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(object).transformationMatrix(), Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    object.transform(Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(object.transformation(),
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    object.transformLocal(Matrix4::rotationZ(90.0_degf));
+    CORRADE_COMPARE(object.transformation(),
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::rotationZ(90.0_degf));
+}
+
+void FlatSceneTest::absoluteTransformation() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    a->setTransformation(Matrix4::translation({1.0f, 2.0f, 3.0f}));
+    FlatObject3D* b = new FlatObject3D{*a};
+    b->setTransformation(Matrix4::rotationX(90.0_degf));
+
+    /* Calculated directly, without needing an update */
+    CORRADE_COMPARE(b->absoluteTransformation(),
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotationX(90.0_degf));
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(*b).absoluteTransformationMatrix(),
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotationX(90.0_degf));
+    CORRADE_VERIFY(scene.needsUpdate());
+}
+
+void FlatSceneTest::update() {
+    FlatScene2D scene;
+    FlatObject2D* a = new FlatObject2D{scene};
+    FlatObject2D* b = new FlatObject2D{*a};
+    FlatObject2D* c = new FlatObject2D{*b};
+    FlatObject2D* d = new FlatObject2D{scene};
+    a->setTransformation(Matrix3::translation({1.0f, 2.0f}));
+    b->setTransformation(Matrix3::rotation(90.0_degf));
+    c->setTransformation(Matrix3::scaling({2.0f, 3.0f}));
+    d->setTransformation(Matrix3::translation({4.0f, 5.0f}));
+    CORRADE_VERIFY(scene.needsUpdate());
+
+    scene.update();
+    CORRADE_VERIFY(!scene.needsUpdate());
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        Matrix3::translation({1.0f, 2.0f}),
+        Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::rotation(90.0_degf),
+        Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::rotation(90.0_degf)*
+            Matrix3::scaling({2.0f, 3.0f}),
+        Matrix3::translation({4.0f, 5.0f})
+    }), TestSuite::Compare::Container);
+
+    /* Changing a transformation in the middle updates only the subtree */
+    b->setTransformation(Matrix3::rotation(-90.0_degf));
+    CORRADE_VERIFY(scene.needsUpdate());
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView({
+        Matrix3::translation({1.0f, 2.0f}),
+        Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::rotation(-90.0_degf),
+        Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::rotation(-90.0_degf)*
+            Matrix3::scaling({2.0f, 3.0f}),
+        Matrix3::translation({4.0f, 5.0f})
+    }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(!scene.needsUpdate());
+}
+
+void FlatSceneTest::updateReparented() {
+    FlatScene3D scene;
+    /* Created in an order where the child has a lower ID than the parent, to
+       verify the depth sorting */
+    FlatObject3D* child = new FlatObject3D{scene};
+    child->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    FlatObject3D* parent = new FlatObject3D{scene};
+    parent->setTransformation(Matrix4::scaling(Vector3{3.0f}));
+    FlatObject3D* grandparent = new FlatObject3D{scene};
+    grandparent->setTransformation(Matrix4::translation(Vector3::yAxis(2.0f)));
+    child->setParent(parent);
+    parent->setParent(grandparent);
+
+    CORRADE_COMPARE(scene.absoluteTransformations()[child->id()],
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+        Matrix4::scaling(Vector3{3.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    /* Moving the parent back to the scene updates its subtree */
+    parent->setParent(nullptr);
+    CORRADE_COMPARE(scene.absoluteTransformations()[child->id()],
+        Matrix4::scaling(Vector3{3.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(scene.absoluteTransformations()[grandparent->id()],
+        Matrix4::translation(Vector3::yAxis(2.0f)));
+}
+
+void FlatSceneTest::transformationMatrices() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    a->setTransformation(Matrix4::translation({1.0f, 2.0f, 3.0f}));
+    FlatObject3D* b = new FlatObject3D{*a};
+    b->setTransformation(Matrix4::rotationY(90.0_degf));
+
+    const Matrix4 finalTransformation = Matrix4::scaling(Vector3{0.5f});
+    CORRADE_COMPARE_AS(scene.transformationMatrices({*b, scene, *a, *b}, finalTransformation), (std::vector<Matrix4>{
+        finalTransformation*Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationY(90.0_degf),
+        finalTransformation,
+        finalTransformation*Matrix4::translation({1.0f, 2.0f, 3.0f}),
+        finalTransformation*Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationY(90.0_degf)
+    }), TestSuite::Compare::Container);
+}
+
+void FlatSceneTest::transformationMatricesRelative() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    a->setTransformation(Matrix4::translation({1.0f, 2.0f, 3.0f}));
+    FlatObject3D* b = new FlatObject3D{*a};
+    b->setTransformation(Matrix4::rotationY(90.0_degf));
+
+    /* Relative to a, the transformation of b is just its local one */
+    CORRADE_COMPARE_AS(a->transformationMatrices({*b, *a}), (std::vector<Matrix4>{
+        Matrix4::rotationY(90.0_degf),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+class CachingFeature: public AbstractFeature3D {
+    public:
+        explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object} {
+            setCachedTransformations(CachedTransformation::Absolute|CachedTransformation::InvertedAbsolute);
+        }
+
+        Int markedDirty = 0, cleaned = 0;
+        Matrix4 cleanedAbsoluteTransformation, cleanedInvertedAbsoluteTransformation;
+
+    private:
+        void markDirty() override {
+            ++markedDirty;
+        }
+        void clean(const Matrix4& absoluteTransformation) override {
+            ++cleaned;
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+        void cleanInverted(const Matrix4& invertedAbsoluteTransformation) override {
+            cleanedInvertedAbsoluteTransformation = invertedAbsoluteTransformation;
+        }
+};
+
+void FlatSceneTest::setClean() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    a->setTransformation(Matrix4::scaling(Vector3{2.0f}));
+    FlatObject3D* b = new FlatObject3D{*a};
+    b->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CachingFeature& feature = b->addFeature<CachingFeature>();
+
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+
+    b->setClean();
+    CORRADE_VERIFY(!b->isDirty());
+    /* The parent was updated, but its features weren't cleaned */
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_COMPARE(feature.cleaned, 1);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation,
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(feature.cleanedInvertedAbsoluteTransformation,
+        (Matrix4::scaling(Vector3{2.0f})*
+         Matrix4::translation(Vector3::xAxis(1.0f))).inverted());
+
+    /* Cleaning again does nothing */
+    b->setClean();
+    CORRADE_COMPARE(feature.cleaned, 1);
+
+    /* Changing the parent makes the child dirty, but markDirty() is called
+       only on the features of the parent */
+    a->setTransformation(Matrix4::scaling(Vector3{4.0f}));
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+    CORRADE_COMPARE(feature.markedDirty, 0);
+
+    b->setClean();
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_COMPARE(feature.cleaned, 2);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation,
+        Matrix4::scaling(Vector3{4.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    /* Changing the object itself calls markDirty() */
+    b->setTransformation({});
+    CORRADE_COMPARE(feature.markedDirty, 1);
+    b->setTransformation(Matrix4::translation(Vector3::xAxis(3.0f)));
+    CORRADE_COMPARE(feature.markedDirty, 1);
+    CORRADE_VERIFY(b->isDirty());
+    b->setClean();
+    CORRADE_COMPARE(feature.cleaned, 3);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation,
+        Matrix4::scaling(Vector3{4.0f})*
+        Matrix4::translation(Vector3::xAxis(3.0f)));
+}
+
+void FlatSceneTest::setCleanList() {
+    FlatScene3D scene;
+    FlatObject3D* a = new FlatObject3D{scene};
+    a->setTransformation(Matrix4::scaling(Vector3{2.0f}));
+    FlatObject3D* b = new FlatObject3D{*a};
+    b->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CachingFeature& featureA = a->addFeature<CachingFeature>();
+    CachingFeature& featureB = b->addFeature<CachingFeature>();
+
+    AbstractObject3D::setClean({*b, scene, *a, *b});
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_COMPARE(featureA.cleaned, 1);
+    CORRADE_COMPARE(featureB.cleaned, 1);
+    CORRADE_COMPARE(featureA.cleanedAbsoluteTransformation,
+        Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(featureB.cleanedAbsoluteTransformation,
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+void FlatSceneTest::draw() {
+    class Drawable: public Drawable3D {
+        public:
+            explicit Drawable(AbstractObject3D& object, DrawableGroup3D* group, Matrix4& result): Drawable3D{object, group}, _result(result) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                _result = transformationMatrix;
+            }
+
+        private:
+            Matrix4& _result;
+    };
+
+    FlatScene3D scene;
+    DrawableGroup3D group;
+
+    FlatObject3D* cameraObject = new FlatObject3D{scene};
+    cameraObject->setTransformation(Matrix4::translation(Vector3::zAxis(5.0f)));
+    Camera3D& camera = cameraObject->addFeature<Camera3D>();
+
+    FlatObject3D* a = new FlatObject3D{scene};
+    a->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    FlatObject3D* b = new FlatObject3D{*a};
+    b->setTransformation(Matrix4::rotationZ(90.0_degf));
+
+    Matrix4 resultA, resultB;
+    new Drawable{*a, &group, resultA};
+    new Drawable{*b, &group, resultB};
+
+    camera.draw(group);
+    CORRADE_COMPARE(camera.cameraMatrix(), Matrix4::translation(Vector3::zAxis(-5.0f)));
+    CORRADE_COMPARE(resultA,
+        Matrix4::translation(Vector3::zAxis(-5.0f))*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(resultB,
+        Matrix4::translation(Vector3::zAxis(-5.0f))*
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::rotationZ(90.0_degf));
+
+    /* Moving the camera gets picked up in the next draw */
+    cameraObject->setTransformation(Matrix4::translation(Vector3::zAxis(3.0f)));
+    camera.draw(group);
+    CORRADE_COMPARE(resultA,
+        Matrix4::translation(Vector3::zAxis(-3.0f))*
+        Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
@@ -0,0 +1,374 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AbsoluteTransformations.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace Implementation {
+
+template<UnsignedInt dimensions> struct AbsoluteTransformationsState {
+    Containers::ArrayTuple data;
+    /* Parent ID for each object, -1 for root and -2 for objects that aren't a
+       part of the hierarchy */
+    Containers::ArrayView<Int> parents;
+    /* Objects in a breadth-first order, with each level in a range given by
+       levelOffsets */
+    Containers::ArrayView<UnsignedInt> objects;
+    Containers::ArrayView<UnsignedInt> levelOffsets;
+    /* Objects in a depth-first order, where each object is directly followed
+       by all its descendants. Position of each object in it and the count of
+       its descendants including itself is indexed by object ID, undefined
+       for objects that aren't a part of the hierarchy. */
+    Containers::ArrayView<UnsignedInt> depthFirstObjects;
+    Containers::ArrayView<UnsignedInt> depthFirstPositions;
+    Containers::ArrayView<UnsignedInt> subtreeSizes;
+    Containers::ArrayView<MatrixTypeFor<dimensions, Float>> transformations;
+    /* Absolute transformations shifted by one, the first item is the global
+       transformation */
+    Containers::ArrayView<MatrixTypeFor<dimensions, Float>> absoluteTransformations;
+    /* Shifted by one as well, with the first item for the global
+       transformation. Not a BitArray because the items get written to from
+       multiple threads. */
+    Containers::ArrayView<bool> dirty;
+    bool anyDirty;
+    /* Objects marked as dirty since the last update(), excluding the global
+       transformation and the initial state where everything is dirty. Each
+       object is there at most once, dirty roots of the subtrees to update
+       are collected to the second array. Both are reused across updates to
+       avoid repeated allocations. */
+    Containers::Array<UnsignedInt> dirtyObjects;
+    Containers::Array<UnsignedInt> dirtyRoots;
+};
+
+}
+
+namespace {
+
+template<UnsignedInt> struct SceneDataDimensionTraits;
+template<> struct SceneDataDimensionTraits<2> {
+    static bool isDimensions(const Trade::SceneData& scene) {
+        return scene.is2D();
+    }
+    static void transformationsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix3>& transformationDestination) {
+        return scene.transformations2DInto(mappingDestination, transformationDestination);
+    }
+};
+template<> struct SceneDataDimensionTraits<3> {
+    static bool isDimensions(const Trade::SceneData& scene) {
+        return scene.is3D();
+    }
+    static void transformationsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix4>& transformationDestination) {
+        return scene.transformations3DInto(mappingDestination, transformationDestination);
+    }
+};
+
+/* Levels smaller than this many objects per thread are processed on fewer
+   threads, as spawning a thread would cost more than the matrix
+   multiplications themselves */
+constexpr std::size_t MinObjectsPerThread = 1024;
+
+}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::AbsoluteTransformations(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation): _state{InPlaceInit} {
+    CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
+        "SceneTools::AbsoluteTransformations: the scene is not" << dimensions << Debug::nospace << "D", );
+    const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
+    CORRADE_ASSERT(parentFieldId,
+        "SceneTools::AbsoluteTransformations: the scene has no hierarchy", );
+
+    Implementation::AbsoluteTransformationsState<dimensions>& state = *_state;
+    const std::size_t parentFieldSize = scene.fieldSize(*parentFieldId);
+    const std::size_t mappingBound = scene.mappingBound();
+
+    /* Allocate a single storage for all temporary data */
+    Containers::ArrayView<Containers::Pair<UnsignedInt, Int>> orderedClusteredParents;
+    Containers::ArrayView<Containers::Pair<UnsignedInt, MatrixTypeFor<dimensions, Float>>> transformations;
+    Containers::ArrayView<UnsignedInt> depths;
+    Containers::ArrayView<UnsignedInt> depthFirstCursors;
+    Containers::ArrayTuple storage{
+        /* Output of parentsBreadthFirstInto() */
+        {NoInit, parentFieldSize, orderedClusteredParents},
+        /* Output of scene.transformationsXDInto() */
+        {NoInit, scene.transformationFieldSize(), transformations},
+        /* Distance from the root for each object including root */
+        {NoInit, mappingBound + 1, depths},
+        /* Next free depth-first position for a child of each object including
+           root */
+        {NoInit, mappingBound + 1, depthFirstCursors}
+    };
+    parentsBreadthFirstInto(scene,
+        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first),
+        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second));
+    SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
+        stridedArrayView(transformations).slice(&decltype(transformations)::Type::first),
+        stridedArrayView(transformations).slice(&decltype(transformations)::Type::second));
+
+    /* Calculate depth of each object. Since the order is breadth-first, the
+       depth is never decreasing and a parent is always before its
+       children. */
+    depths[0] = 0;
+    std::size_t levelCount = 0;
+    for(const Containers::Pair<UnsignedInt, Int>& parent: orderedClusteredParents) {
+        const UnsignedInt depth = depths[parent.second() + 1] + 1;
+        CORRADE_INTERNAL_ASSERT(depth >= levelCount);
+        depths[parent.first() + 1] = depth;
+        levelCount = depth;
+    }
+
+    /* Allocate the persistent state */
+    state.data = Containers::ArrayTuple{
+        {NoInit, mappingBound, state.parents},
+        {NoInit, parentFieldSize, state.objects},
+        {NoInit, levelCount + 1, state.levelOffsets},
+        {NoInit, parentFieldSize, state.depthFirstObjects},
+        {NoInit, mappingBound, state.depthFirstPositions},
+        {NoInit, mappingBound, state.subtreeSizes},
+        {NoInit, mappingBound, state.transformations},
+        {NoInit, mappingBound + 1, state.absoluteTransformations},
+        {NoInit, mappingBound + 1, state.dirty}
+    };
+
+    /* Objects that aren't a part of the hierarchy have the parent set to -2,
+       the rest gets filled below. All objects are dirty initially. */
+    /** @todo Utility::fill() */
+    for(Int& i: state.parents) i = -2;
+    for(MatrixTypeFor<dimensions, Float>& i: state.transformations)
+        i = MatrixTypeFor<dimensions, Float>{Math::IdentityInit};
+    for(bool& i: state.dirty) i = true;
+
+    /* Save the object order, parents and level offsets */
+    state.levelOffsets[0] = 0;
+    for(std::size_t i = 0; i != orderedClusteredParents.size(); ++i) {
+        const Containers::Pair<UnsignedInt, Int>& parent = orderedClusteredParents[i];
+        state.objects[i] = parent.first();
+        state.parents[parent.first()] = parent.second();
+        /* Objects of depth d are in level d - 1, which ends at offset
+           levelOffsets[d] */
+        state.levelOffsets[depths[parent.first() + 1]] = i + 1;
+    }
+
+    /* Calculate subtree sizes by going through the breadth-first order
+       backwards, where all children are before their parent. */
+    for(const Containers::Pair<UnsignedInt, Int>& parent: orderedClusteredParents)
+        state.subtreeSizes[parent.first()] = 1;
+    for(std::size_t i = orderedClusteredParents.size(); i != 0; --i) {
+        const Containers::Pair<UnsignedInt, Int>& parent = orderedClusteredParents[i - 1];
+        if(parent.second() != -1)
+            state.subtreeSizes[parent.second()] += state.subtreeSizes[parent.first()];
+    }
+
+    /* Then place each object right after its parent or after the subtrees of
+       its previous siblings, which gives a depth-first order. Going through
+       the breadth-first order again, a parent is always placed before its
+       children. */
+    depthFirstCursors[0] = 0;
+    for(const Containers::Pair<UnsignedInt, Int>& parent: orderedClusteredParents) {
+        const UnsignedInt position = depthFirstCursors[parent.second() + 1];
+        depthFirstCursors[parent.second() + 1] += state.subtreeSizes[parent.first()];
+        depthFirstCursors[parent.first() + 1] = position + 1;
+        state.depthFirstPositions[parent.first()] = position;
+        state.depthFirstObjects[position] = parent.first();
+    }
+
+    /* Retrieve local transformations, indexed by object ID */
+    for(const Containers::Pair<UnsignedInt, MatrixTypeFor<dimensions, Float>>& transformation: transformations) {
+        CORRADE_INTERNAL_ASSERT(transformation.first() < mappingBound);
+        state.transformations[transformation.first()] = transformation.second();
+    }
+
+    /* Absolute transformations of objects outside of the hierarchy are equal
+       to the local transformations, the rest is calculated in update() */
+    state.absoluteTransformations[0] = globalTransformation;
+    for(std::size_t i = 0; i != mappingBound; ++i)
+        state.absoluteTransformations[i + 1] = state.transformations[i];
+
+    state.anyDirty = true;
+}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::AbsoluteTransformations(NoCreateT) noexcept {}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::AbsoluteTransformations(AbsoluteTransformations<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::~AbsoluteTransformations() = default;
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>& AbsoluteTransformations<dimensions>::operator=(AbsoluteTransformations<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> std::size_t AbsoluteTransformations<dimensions>::mappingBound() const {
+    return _state->transformations.size();
+}
+
+template<UnsignedInt dimensions> std::size_t AbsoluteTransformations<dimensions>::levelCount() const {
+    return _state->levelOffsets.size() - 1;
+}
+
+template<UnsignedInt dimensions> MatrixTypeFor<dimensions, Float> AbsoluteTransformations<dimensions>::globalTransformation() const {
+    return _state->absoluteTransformations[0];
+}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>& AbsoluteTransformations<dimensions>::setGlobalTransformation(const MatrixTypeFor<dimensions, Float>& transformation) {
+    Implementation::AbsoluteTransformationsState<dimensions>& state = *_state;
+    state.absoluteTransformations[0] = transformation;
+    state.dirty[0] = true;
+    state.anyDirty = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions> Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> AbsoluteTransformations<dimensions>::transformations() const {
+    return _state->transformations;
+}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>& AbsoluteTransformations<dimensions>::setTransformation(const UnsignedLong object, const MatrixTypeFor<dimensions, Float>& transformation) {
+    Implementation::AbsoluteTransformationsState<dimensions>& state = *_state;
+    CORRADE_ASSERT(object < state.transformations.size(),
+        "SceneTools::AbsoluteTransformations::setTransformation(): object" << object << "out of range for" << state.transformations.size() << "objects", *this);
+
+    state.transformations[object] = transformation;
+
+    /* Objects outside of the hierarchy have the absolute transformation equal
+       to the local one, update it directly */
+    if(state.parents[object] == -2) {
+        state.absoluteTransformations[object + 1] = transformation;
+    } else if(!state.dirty[object + 1]) {
+        state.dirty[object + 1] = true;
+        state.anyDirty = true;
+        arrayAppend(state.dirtyObjects, UnsignedInt(object));
+    }
+
+    return *this;
+}
+
+template<UnsignedInt dimensions> bool AbsoluteTransformations<dimensions>::isDirty() const {
+    return _state->anyDirty;
+}
+
+template<UnsignedInt dimensions> void AbsoluteTransformations<dimensions>::update(UnsignedInt threadCount) {
+    Implementation::AbsoluteTransformationsState<dimensions>& state = *_state;
+    if(!state.anyDirty) return;
+
+    threadCount = Magnum::Implementation::parallelForThreadCount(threadCount);
+
+    /* Unless the global transformation changed, which affects everything,
+       collect dirty objects that don't have any dirty ancestor. Their
+       subtrees are disjoint and contain all objects that need to be
+       updated. */
+    std::size_t updateCount = state.objects.size();
+    arrayClear(state.dirtyRoots);
+    if(!state.dirty[0]) {
+        updateCount = 0;
+        for(const UnsignedInt object: state.dirtyObjects) {
+            bool dirtyAncestor = false;
+            for(Int parent = state.parents[object]; parent != -1; parent = state.parents[parent]) {
+                if(state.dirty[parent + 1]) {
+                    dirtyAncestor = true;
+                    break;
+                }
+            }
+            if(dirtyAncestor) continue;
+
+            arrayAppend(state.dirtyRoots, object);
+            updateCount += state.subtreeSizes[object];
+        }
+    }
+
+    /* If just a small part of the hierarchy is affected, update only the
+       dirty subtrees. A subtree is a contiguous range in the depth-first
+       order with a parent always before its children, so it can be
+       processed in a single pass. Different subtrees don't depend on each
+       other, so they're distributed across threads. */
+    if(updateCount*2 <= state.objects.size()) {
+        const std::size_t chunkCount = Math::max(Math::min(Math::min(std::size_t(threadCount), updateCount/MinObjectsPerThread), state.dirtyRoots.size()), std::size_t{1});
+        Magnum::Implementation::parallelFor(chunkCount, state.dirtyRoots.size(), [&state](std::size_t, const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const UnsignedInt root = state.dirtyRoots[i];
+                const std::size_t subtreeBegin = state.depthFirstPositions[root];
+                const std::size_t subtreeEnd = subtreeBegin + state.subtreeSizes[root];
+                for(std::size_t j = subtreeBegin; j != subtreeEnd; ++j) {
+                    const UnsignedInt object = state.depthFirstObjects[j];
+                    state.absoluteTransformations[object + 1] =
+                        state.absoluteTransformations[state.parents[object] + 1]*
+                        state.transformations[object];
+                }
+            }
+        });
+
+        /* Only the explicitly marked objects have the dirty bit set */
+        for(const UnsignedInt object: state.dirtyObjects)
+            state.dirty[object + 1] = false;
+
+    /* Otherwise go through all levels in order, which can split each level
+       across threads. A parent is always in one of the previous levels, so
+       its dirty bit and absolute transformation is final at this point, and
+       each object in the level is written to only from a single thread. */
+    } else {
+        for(std::size_t level = 0; level != state.levelOffsets.size() - 1; ++level) {
+            const std::size_t levelBegin = state.levelOffsets[level];
+            const std::size_t levelSize = state.levelOffsets[level + 1] - levelBegin;
+            const std::size_t chunkCount = Math::max(Math::min(std::size_t(threadCount), levelSize/MinObjectsPerThread), std::size_t{1});
+            Magnum::Implementation::parallelFor(chunkCount, levelSize, [&state, levelBegin](std::size_t, const std::size_t begin, const std::size_t end) {
+                for(std::size_t i = levelBegin + begin, iMax = levelBegin + end; i != iMax; ++i) {
+                    const UnsignedInt object = state.objects[i];
+                    const Int parent = state.parents[object];
+                    if(!state.dirty[object + 1] && !state.dirty[parent + 1])
+                        continue;
+
+                    state.absoluteTransformations[object + 1] =
+                        state.absoluteTransformations[parent + 1]*
+                        state.transformations[object];
+                    state.dirty[object + 1] = true;
+                }
+            });
+        }
+
+        std::memset(state.dirty.data(), 0, state.dirty.size());
+    }
+
+    arrayClear(state.dirtyObjects);
+    state.anyDirty = false;
+}
+
+template<UnsignedInt dimensions> Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> AbsoluteTransformations<dimensions>::absoluteTransformations() const {
+    return _state->absoluteTransformations.exceptPrefix(1);
+}
+
+template class MAGNUM_SCENETOOLS_EXPORT AbsoluteTransformations<2>;
+template class MAGNUM_SCENETOOLS_EXPORT AbsoluteTransformations<3>;
+
+}}
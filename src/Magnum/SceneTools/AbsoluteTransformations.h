@@ -0,0 +1,257 @@
+#ifndef Magnum_SceneTools_AbsoluteTransformations_h
+#define Magnum_SceneTools_AbsoluteTransformations_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::AbsoluteTransformations, typedef @ref Magnum::SceneTools::AbsoluteTransformations2D, @ref Magnum::SceneTools::AbsoluteTransformations3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace Implementation {
+    template<UnsignedInt> struct AbsoluteTransformationsState;
+}
+
+/**
+@brief Incremental absolute transformation calculation
+@m_since_latest
+
+While @ref absoluteFieldTransformations3D() and related functions calculate
+absolute transformations of a scene from scratch on every call, this class
+caches the hierarchy of a @ref Trade::SceneData so it can be used to
+repeatedly calculate absolute transformations for changing local
+transformations, such as when the scene is animated. The hierarchy is
+extracted once in the constructor using @ref parentsBreadthFirst() and split
+into levels, with each level containing objects that have the same distance
+from the root, and additionally ordered depth-first, so each object is followed
+by all its descendants. Local transformations are then changed using
+@ref setTransformation(), which marks given object as dirty, and
+@ref update() recalculates absolute transformations only for the dirty
+objects and their descendants. If that's just a small part of the hierarchy,
+only the affected subtrees are visited, so the cost of an update is
+proportional to the count of changed objects and their descendants, not to
+the total object count.
+
+@snippet SceneTools.cpp AbsoluteTransformations
+
+@section SceneTools-AbsoluteTransformations-multithreading Multithreaded update
+
+Since objects in the same level don't depend on each other, @ref update() can
+process each level on multiple threads. Levels that are too small to benefit
+from multithreading are processed serially. When only the dirty subtrees are
+updated, different subtrees are processed on different threads instead. The
+resulting transformations are the same regardless of the thread count used.
+
+@experimental
+
+@see @ref AbsoluteTransformations2D, @ref AbsoluteTransformations3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SCENETOOLS_EXPORT AbsoluteTransformations {
+    public:
+        /**
+         * @brief Constructor
+         * @param scene                 Scene to take the hierarchy and
+         *      initial local transformations from
+         * @param globalTransformation  Global transformation to prepend to
+         *      all objects in the hierarchy
+         *
+         * The @ref Trade::SceneField::Parent field is expected to be contained
+         * in the scene, having no cycles or duplicates, and the scene is
+         * expected to be 2D for @ref AbsoluteTransformations2D and 3D for
+         * @ref AbsoluteTransformations3D. Objects that don't have a
+         * transformation in @p scene have it set to an identity. All objects
+         * are marked as dirty, call @ref update() to calculate the absolute
+         * transformations.
+         *
+         * The operation is done in an @f$ \mathcal{O}(n) @f$ execution time
+         * and memory complexity, with @f$ n @f$ being
+         * @ref Trade::SceneData::mappingBound(). The @p scene isn't referenced
+         * after the constructor exits.
+         */
+        explicit AbsoluteTransformations(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation = {});
+
+        /**
+         * @brief Construct without creating the internal state
+         *
+         * The constructed instance is equivalent to moved-from state, i.e. no
+         * APIs can be safely called on the object. Useful in cases where you
+         * will overwrite the instance later anyway. Move another object over
+         * it to make it useful.
+         *
+         * Note that this is a low-level and a potentially dangerous API, see
+         * the documentation of @ref NoCreate for alternatives.
+         */
+        explicit AbsoluteTransformations(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        AbsoluteTransformations(const AbsoluteTransformations<dimensions>&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * Performs a destructive move, i.e. the original object isn't usable
+         * afterwards anymore.
+         */
+        AbsoluteTransformations(AbsoluteTransformations<dimensions>&&) noexcept;
+
+        ~AbsoluteTransformations();
+
+        /** @brief Copying is not allowed */
+        AbsoluteTransformations<dimensions>& operator=(const AbsoluteTransformations<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        AbsoluteTransformations<dimensions>& operator=(AbsoluteTransformations<dimensions>&&) noexcept;
+
+        /**
+         * @brief Mapping bound
+         *
+         * Same as @ref Trade::SceneData::mappingBound() of the scene passed to
+         * the constructor.
+         */
+        std::size_t mappingBound() const;
+
+        /**
+         * @brief Count of hierarchy levels
+         *
+         * Count of distinct distances of objects from the root. Objects
+         * directly parented to the root are in the first level, their
+         * children in the second level and so on. If the scene has no
+         * objects in the hierarchy, returns @cpp 0 @ce.
+         */
+        std::size_t levelCount() const;
+
+        /** @brief Global transformation */
+        MatrixTypeFor<dimensions, Float> globalTransformation() const;
+
+        /**
+         * @brief Set global transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Marks all objects in the hierarchy as dirty.
+         */
+        AbsoluteTransformations<dimensions>& setGlobalTransformation(const MatrixTypeFor<dimensions, Float>& transformation);
+
+        /**
+         * @brief Local transformations
+         *
+         * Indexed by object ID, the size is equal to @ref mappingBound().
+         * @see @ref setTransformation()
+         */
+        Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> transformations() const;
+
+        /**
+         * @brief Set local transformation of an object
+         * @return Reference to self (for method chaining)
+         *
+         * The @p object is expected to be less than @ref mappingBound(). If
+         * the object is a part of the hierarchy, it's marked as dirty and its
+         * absolute transformation as well as absolute transformations of all
+         * its children get recalculated on next @ref update(). Otherwise the
+         * absolute transformation is set to @p transformation directly.
+         */
+        AbsoluteTransformations<dimensions>& setTransformation(UnsignedLong object, const MatrixTypeFor<dimensions, Float>& transformation);
+
+        /**
+         * @brief Whether there are any objects to update
+         *
+         * Returns @cpp true @ce after construction, and after
+         * @ref setTransformation() or @ref setGlobalTransformation() was
+         * called for an object in the hierarchy. Returns @cpp false @ce after
+         * @ref update() was called.
+         */
+        bool isDirty() const;
+
+        /**
+         * @brief Update absolute transformations
+         * @param threadCount   Count of threads to process each hierarchy
+         *      level or the dirty subtrees on. Passing @cpp 0 @ce uses all
+         *      available hardware threads.
+         *
+         * Calculates absolute transformations for all objects that were
+         * marked as dirty and all their descendants. If @ref isDirty() is
+         * @cpp false @ce, the function is a no-op.
+         *
+         * If the global transformation changed or the dirty objects together
+         * with their descendants make up more than half of the hierarchy, it
+         * goes through all hierarchy levels in order, which is done in an
+         * @f$ \mathcal{O}(n) @f$ execution time complexity with @f$ n @f$
+         * being the count of objects in the hierarchy, but matrix
+         * multiplication is done only for objects that need it. Otherwise
+         * only the subtrees of the dirty objects are visited, which is done
+         * in an @f$ \mathcal{O}(d h + m) @f$ execution time complexity, where
+         * @f$ d @f$ is the count of objects marked as dirty, @f$ h @f$ the
+         * hierarchy depth and @f$ m @f$ the count of dirty objects and their
+         * descendants.
+         * @see @ref absoluteTransformations()
+         */
+        void update(UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Absolute transformations
+         *
+         * Indexed by object ID, the size is equal to @ref mappingBound().
+         * Contains the global transformation multiplied with local
+         * transformations of all parents of given object and the local
+         * transformation of the object itself. Objects that aren't a part of
+         * the hierarchy have the absolute transformation equal to the local
+         * one. The values are valid only if @ref isDirty() is @cpp false @ce,
+         * i.e. after @ref update() was called.
+         */
+        Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>> absoluteTransformations() const;
+
+    private:
+        Containers::Pointer<Implementation::AbsoluteTransformationsState<dimensions>> _state;
+};
+
+/**
+@brief Incremental absolute transformation calculation for 2D scenes
+@m_since_latest
+
+@experimental
+*/
+typedef AbsoluteTransformations<2> AbsoluteTransformations2D;
+
+/**
+@brief Incremental absolute transformation calculation for 3D scenes
+@m_since_latest
+
+@experimental
+*/
+typedef AbsoluteTransformations<3> AbsoluteTransformations3D;
+
+}}
+
+#endif
@@ -0,0 +1,509 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/AbsoluteTransformations.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct AbsoluteTransformationsTest: TestSuite::Tester {
+    explicit AbsoluteTransformationsTest();
+
+    void construct2D();
+    void construct3D();
+    void constructNoCreate();
+    void constructCopy();
+    void constructMove();
+
+    void constructNot2DNot3D();
+    void constructNoParentField();
+
+    void setTransformation();
+    void setTransformationOutsideHierarchy();
+    void setTransformationInvalid();
+    void setGlobalTransformation();
+
+    void updateThreaded();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} UpdateThreadedData[]{
+    {"single thread", 1},
+    {"four threads", 4},
+    {"all hardware threads", 0}
+};
+
+AbsoluteTransformationsTest::AbsoluteTransformationsTest() {
+    addTests({&AbsoluteTransformationsTest::construct2D,
+              &AbsoluteTransformationsTest::construct3D,
+              &AbsoluteTransformationsTest::constructNoCreate,
+              &AbsoluteTransformationsTest::constructCopy,
+              &AbsoluteTransformationsTest::constructMove,
+
+              &AbsoluteTransformationsTest::constructNot2DNot3D,
+              &AbsoluteTransformationsTest::constructNoParentField,
+
+              &AbsoluteTransformationsTest::setTransformation,
+              &AbsoluteTransformationsTest::setTransformationOutsideHierarchy,
+              &AbsoluteTransformationsTest::setTransformationInvalid,
+              &AbsoluteTransformationsTest::setGlobalTransformation});
+
+    addInstancedTests({&AbsoluteTransformationsTest::updateThreaded},
+        Containers::arraySize(UpdateThreadedData));
+}
+
+/* Object 2 and 5 are in the root, 0, 3 and 4 are in the second level and 1 in
+   the third. Object 6 isn't in the hierarchy, object 4 has no transformation. */
+const struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[6];
+
+    struct Transformation {
+        UnsignedInt object;
+        Matrix3 transformation2D;
+        Matrix4 transformation3D;
+    } transforms[6];
+} Data[]{{
+    {{2, -1},
+     {0, 2},
+     {5, -1},
+     {1, 0},
+     {3, 2},
+     {4, 5}},
+    {{2, Matrix3::translation({1.0f, 2.0f}),
+         Matrix4::translation({1.0f, 2.0f, 3.0f})},
+     {0, Matrix3::rotation(35.0_degf),
+         Matrix4::rotationZ(35.0_degf)},
+     {1, Matrix3::scaling({2.0f, 3.0f}),
+         Matrix4::scaling({2.0f, 3.0f, 4.0f})},
+     {3, Matrix3::translation({0.0f, 1.0f}),
+         Matrix4::translation({0.0f, 1.0f, 0.0f})},
+     {5, Matrix3::rotation(90.0_degf),
+         Matrix4::rotationX(90.0_degf)},
+     {6, Matrix3::translation({7.0f, 7.0f}),
+         Matrix4::translation({7.0f, 7.0f, 7.0f})}}
+}};
+
+Trade::SceneData scene2D() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 7, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation2D)},
+    }};
+}
+
+Trade::SceneData scene3D() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 7, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+    }};
+}
+
+void AbsoluteTransformationsTest::construct2D() {
+    const Matrix3 global = Matrix3::scaling(Vector2{0.5f});
+    AbsoluteTransformations2D transformations{scene2D(), global};
+    CORRADE_COMPARE(transformations.mappingBound(), 7);
+    CORRADE_COMPARE(transformations.levelCount(), 3);
+    CORRADE_COMPARE(transformations.globalTransformation(), global);
+    CORRADE_VERIFY(transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.transformations(), Containers::arrayView({
+        Matrix3::rotation(35.0_degf),
+        Matrix3::scaling({2.0f, 3.0f}),
+        Matrix3::translation({1.0f, 2.0f}),
+        Matrix3::translation({0.0f, 1.0f}),
+        Matrix3{},
+        Matrix3::rotation(90.0_degf),
+        Matrix3::translation({7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+
+    transformations.update();
+    CORRADE_VERIFY(!transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(), Containers::arrayView({
+        global*
+            Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::rotation(35.0_degf),
+        global*
+            Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::rotation(35.0_degf)*
+            Matrix3::scaling({2.0f, 3.0f}),
+        global*
+            Matrix3::translation({1.0f, 2.0f}),
+        global*
+            Matrix3::translation({1.0f, 2.0f})*
+            Matrix3::translation({0.0f, 1.0f}),
+        global*
+            Matrix3::rotation(90.0_degf),
+        global*
+            Matrix3::rotation(90.0_degf),
+        /* Not in the hierarchy, global transformation not applied */
+        Matrix3::translation({7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::construct3D() {
+    const Matrix4 global = Matrix4::scaling(Vector3{0.5f});
+    AbsoluteTransformations3D transformations{scene3D(), global};
+    CORRADE_COMPARE(transformations.mappingBound(), 7);
+    CORRADE_COMPARE(transformations.levelCount(), 3);
+    CORRADE_COMPARE(transformations.globalTransformation(), global);
+    CORRADE_VERIFY(transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.transformations(), Containers::arrayView({
+        Matrix4::rotationZ(35.0_degf),
+        Matrix4::scaling({2.0f, 3.0f, 4.0f}),
+        Matrix4::translation({1.0f, 2.0f, 3.0f}),
+        Matrix4::translation({0.0f, 1.0f, 0.0f}),
+        Matrix4{},
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+
+    transformations.update();
+    CORRADE_VERIFY(!transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(), Containers::arrayView({
+        global*
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        global*
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling({2.0f, 3.0f, 4.0f}),
+        global*
+            Matrix4::translation({1.0f, 2.0f, 3.0f}),
+        global*
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*
+            Matrix4::translation({0.0f, 1.0f, 0.0f}),
+        global*
+            Matrix4::rotationX(90.0_degf),
+        global*
+            Matrix4::rotationX(90.0_degf),
+        /* Not in the hierarchy, global transformation not applied */
+        Matrix4::translation({7.0f, 7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+
+    /* Calling update() again is a no-op */
+    transformations.update();
+    CORRADE_COMPARE(transformations.absoluteTransformations()[1], global*
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotationZ(35.0_degf)*
+        Matrix4::scaling({2.0f, 3.0f, 4.0f}));
+}
+
+void AbsoluteTransformationsTest::constructNoCreate() {
+    {
+        AbsoluteTransformations3D transformations{NoCreate};
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void AbsoluteTransformationsTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<AbsoluteTransformations3D>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<AbsoluteTransformations3D>{});
+}
+
+void AbsoluteTransformationsTest::constructMove() {
+    AbsoluteTransformations3D a{scene3D()};
+    a.update();
+
+    AbsoluteTransformations3D b = Utility::move(a);
+    CORRADE_COMPARE(b.mappingBound(), 7);
+    CORRADE_COMPARE(b.absoluteTransformations()[3], Matrix4::translation({1.0f, 3.0f, 3.0f}));
+
+    AbsoluteTransformations3D c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.mappingBound(), 7);
+    CORRADE_COMPARE(c.absoluteTransformations()[3], Matrix4::translation({1.0f, 3.0f, 3.0f}));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<AbsoluteTransformations3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<AbsoluteTransformations3D>::value);
+}
+
+void AbsoluteTransformationsTest::constructNot2DNot3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    AbsoluteTransformations2D{scene};
+    AbsoluteTransformations3D{scene};
+    CORRADE_COMPARE(out,
+        "SceneTools::AbsoluteTransformations: the scene is not 2D\n"
+        "SceneTools::AbsoluteTransformations: the scene is not 3D\n");
+}
+
+void AbsoluteTransformationsTest::constructNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix3x3, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    AbsoluteTransformations2D{scene};
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations: the scene has no hierarchy\n");
+}
+
+void AbsoluteTransformationsTest::setTransformation() {
+    AbsoluteTransformations3D transformations{scene3D()};
+    transformations.update();
+    CORRADE_VERIFY(!transformations.isDirty());
+
+    /* Changing object 2 affects also 0, 1 and 3 but not the others */
+    transformations.setTransformation(2, Matrix4::translation({3.0f, 2.0f, 1.0f}));
+    CORRADE_VERIFY(transformations.isDirty());
+    CORRADE_COMPARE(transformations.transformations()[2], Matrix4::translation({3.0f, 2.0f, 1.0f}));
+    /* Absolute transformations are unchanged until update() */
+    CORRADE_COMPARE(transformations.absoluteTransformations()[2], Matrix4::translation({1.0f, 2.0f, 3.0f}));
+
+    /* Changing object 1 only affects itself, and as it's in a deeper level it
+       gets also the new parent transformation */
+    transformations.setTransformation(1, Matrix4::scaling({4.0f, 3.0f, 2.0f}));
+
+    transformations.update();
+    CORRADE_VERIFY(!transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation({3.0f, 2.0f, 1.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        Matrix4::translation({3.0f, 2.0f, 1.0f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling({4.0f, 3.0f, 2.0f}),
+        Matrix4::translation({3.0f, 2.0f, 1.0f}),
+        Matrix4::translation({3.0f, 2.0f, 1.0f})*
+            Matrix4::translation({0.0f, 1.0f, 0.0f}),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+
+    /* Changing a leaf with the rest being already clean */
+    transformations.setTransformation(4, Matrix4::translation({0.0f, 0.0f, 1.0f}));
+    transformations.update();
+    CORRADE_COMPARE(transformations.absoluteTransformations()[4],
+        Matrix4::rotationX(90.0_degf)*
+        Matrix4::translation({0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(transformations.absoluteTransformations()[5],
+        Matrix4::rotationX(90.0_degf));
+
+    /* Changing an object and its child, the child gets updated only once as
+       a part of the parent subtree, but with both new transformations */
+    transformations.setTransformation(1, Matrix4::scaling({1.0f, 2.0f, 3.0f}));
+    transformations.setTransformation(0, Matrix4::rotationZ(-15.0_degf));
+    transformations.update();
+    CORRADE_VERIFY(!transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation({3.0f, 2.0f, 1.0f})*
+            Matrix4::rotationZ(-15.0_degf),
+        Matrix4::translation({3.0f, 2.0f, 1.0f})*
+            Matrix4::rotationZ(-15.0_degf)*
+            Matrix4::scaling({1.0f, 2.0f, 3.0f}),
+        Matrix4::translation({3.0f, 2.0f, 1.0f}),
+        Matrix4::translation({3.0f, 2.0f, 1.0f})*
+            Matrix4::translation({0.0f, 1.0f, 0.0f}),
+        Matrix4::rotationX(90.0_degf)*
+            Matrix4::translation({0.0f, 0.0f, 1.0f}),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::setTransformationOutsideHierarchy() {
+    AbsoluteTransformations3D transformations{scene3D(), Matrix4::scaling(Vector3{2.0f})};
+    transformations.update();
+
+    /* The absolute transformation is updated directly, global transformation
+       not applied and nothing is marked as dirty */
+    transformations.setTransformation(6, Matrix4::translation({1.0f, 0.0f, 0.0f}));
+    CORRADE_VERIFY(!transformations.isDirty());
+    CORRADE_COMPARE(transformations.transformations()[6], Matrix4::translation({1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(transformations.absoluteTransformations()[6], Matrix4::translation({1.0f, 0.0f, 0.0f}));
+}
+
+void AbsoluteTransformationsTest::setTransformationInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AbsoluteTransformations3D transformations{scene3D()};
+
+    Containers::String out;
+    Error redirectError{&out};
+    transformations.setTransformation(7, {});
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations::setTransformation(): object 7 out of range for 7 objects\n");
+}
+
+void AbsoluteTransformationsTest::setGlobalTransformation() {
+    AbsoluteTransformations3D transformations{scene3D()};
+    transformations.update();
+    CORRADE_COMPARE(transformations.globalTransformation(), Matrix4{});
+    CORRADE_COMPARE(transformations.absoluteTransformations()[5], Matrix4::rotationX(90.0_degf));
+
+    /* Updates all objects in the hierarchy */
+    transformations.setGlobalTransformation(Matrix4::translation(Vector3::yAxis(2.0f)));
+    CORRADE_VERIFY(transformations.isDirty());
+    CORRADE_COMPARE(transformations.globalTransformation(), Matrix4::translation(Vector3::yAxis(2.0f)));
+
+    transformations.update();
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling({2.0f, 3.0f, 4.0f}),
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+            Matrix4::translation({1.0f, 2.0f, 3.0f}),
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+            Matrix4::translation({1.0f, 2.0f, 3.0f})*
+            Matrix4::translation({0.0f, 1.0f, 0.0f}),
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+            Matrix4::rotationX(90.0_degf),
+        Matrix4::translation(Vector3::yAxis(2.0f))*
+            Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 7.0f, 7.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::updateThreaded() {
+    auto&& data = UpdateThreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A large enough hierarchy to make use of multiple threads, with 100
+       objects in the root, each having 50 children, each having 2 children */
+    constexpr UnsignedInt RootCount = 100;
+    constexpr UnsignedInt ObjectCount = RootCount*(1 + 50 + 100);
+    struct Object {
+        UnsignedInt object;
+        Int parent;
+        Matrix4 transformation;
+    };
+    Containers::Array<Object> objects{NoInit, ObjectCount};
+    for(UnsignedInt i = 0; i != ObjectCount; ++i) {
+        Int parent;
+        if(i < RootCount) parent = -1;
+        else if(i < RootCount*51) parent = (i - RootCount)/50;
+        else parent = RootCount + (i - RootCount*51)/2;
+        objects[i] = {i, parent, Matrix4::translation({Float(i%7), 1.0f, 0.0f})*Matrix4::rotationZ(Deg(Float(i%13)))};
+    }
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, ObjectCount, {}, Containers::arrayView(objects), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            stridedArrayView(objects).slice(&Object::object),
+            stridedArrayView(objects).slice(&Object::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            stridedArrayView(objects).slice(&Object::object),
+            stridedArrayView(objects).slice(&Object::transformation)}
+    }};
+
+    AbsoluteTransformations3D transformations{scene};
+    CORRADE_COMPARE(transformations.levelCount(), 3);
+
+    /* Calculate the expected output serially */
+    Containers::Array<Matrix4> expected{NoInit, ObjectCount};
+    for(UnsignedInt i = 0; i != ObjectCount; ++i)
+        expected[i] = objects[i].parent == -1 ?
+            objects[i].transformation :
+            expected[objects[i].parent]*objects[i].transformation;
+
+    transformations.update(data.threadCount);
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(),
+        stridedArrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* Change a transformation in the root and in the second level, the rest
+       should be updated accordingly */
+    transformations.setTransformation(3, Matrix4::translation({0.0f, 0.0f, 5.0f}));
+    transformations.setTransformation(RootCount + 60, Matrix4::scaling(Vector3{3.0f}));
+    objects[3].transformation = Matrix4::translation({0.0f, 0.0f, 5.0f});
+    objects[RootCount + 60].transformation = Matrix4::scaling(Vector3{3.0f});
+    for(UnsignedInt i = 0; i != ObjectCount; ++i)
+        expected[i] = objects[i].parent == -1 ?
+            objects[i].transformation :
+            expected[objects[i].parent]*objects[i].transformation;
+
+    transformations.update(data.threadCount);
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(),
+        stridedArrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* Change every fourth root and a few objects in their subtrees. That's a
+       small enough portion of the hierarchy to update just the dirty
+       subtrees, which are then spread across threads. */
+    for(UnsignedInt i = 0; i < RootCount; i += 4) {
+        transformations.setTransformation(i, Matrix4::translation({Float(i), 0.0f, 0.0f}));
+        objects[i].transformation = Matrix4::translation({Float(i), 0.0f, 0.0f});
+    }
+    for(UnsignedInt i: {RootCount + 0*50 + 7, RootCount*51 + 8*100 + 3, RootCount*51 + 9*100 + 1}) {
+        transformations.setTransformation(i, Matrix4::rotationY(Deg(Float(i%17))));
+        objects[i].transformation = Matrix4::rotationY(Deg(Float(i%17)));
+    }
+    for(UnsignedInt i = 0; i != ObjectCount; ++i)
+        expected[i] = objects[i].parent == -1 ?
+            objects[i].transformation :
+            expected[objects[i].parent]*objects[i].transformation;
+
+    transformations.update(data.threadCount);
+    CORRADE_VERIFY(!transformations.isDirty());
+    CORRADE_COMPARE_AS(transformations.absoluteTransformations(),
+        stridedArrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::AbsoluteTransformationsTest)
@@ -348,6 +348,20 @@ const struct {
         "Mesh 0 fuzzy duplicate removal: 5 -> 4 vertices\n"
         "Mesh 1 fuzzy duplicate removal: 6 -> 4 vertices\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    {"one implicit mesh, simplify, verbose", {InPlaceInit, {
+            /* Forcing the importer and converter to avoid AnySceneImporter /
+               AnySceneConverter delegation messages */
+            "--simplify", "0.5", "-v", "-I", "ObjImporter", "-C", "StanfordSceneConverter",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/grid.obj"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/grid.ply")
+        }},
+        "ObjImporter", nullptr, "StanfordSceneConverter", {}, nullptr,
+        /* Border vertices are locked, so only the center vertex gets
+           collapsed onto one of the edge midpoints, removing two triangles.
+           Which one is picked is an implementation detail, so the output
+           file isn't compared, just the resulting triangle count. */
+        nullptr, nullptr,
+        "Mesh 0 simplification: 8 -> 6 triangles\n"},
     {"one implicit mesh, two converters", {InPlaceInit, {
             /* Unfortunately *have to* use an option to make the output
                predictable. Using --set instead of -c as in this case as we
@@ -1038,6 +1052,16 @@ const struct {
         }},
         nullptr, nullptr, nullptr, nullptr,
         "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes\n"},
+    {"--simplify ratio out of range", {InPlaceInit, {
+            "--simplify", "1.5", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify ratio is expected to be in range [0, 1], got 1.5\n"},
+    {"--simplify-error negative", {InPlaceInit, {
+            "--simplify", "0.5", "--simplify-error", "-0.1", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --simplify-error value is expected to be non-negative, got -0.1\n"},
     {"--prefer without a colon", {InPlaceInit, {
             "--prefer", "PngImporter=StbImageImporter", "a", "b",
         }},
@@ -39,6 +39,7 @@
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Copy.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Simplify.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
@@ -152,6 +153,13 @@ Processing a glTF file and removing duplicates in all its meshes:
 magnum-sceneconverter scene.gltf --remove-duplicate-vertices scene.deduplicated.gltf
 @endcode
 
+Reducing all meshes to a quarter of their triangle count, with the error
+limited to 1% of the mesh size:
+
+@code{.sh}
+magnum-sceneconverter scene.gltf --simplify 0.25 --simplify-error 0.01 scene.simplified.gltf
+@endcode
+
 Processing a glTF file, resizing all its images to 512x512 with
 @relativeref{Trade,StbResizeImageConverter}, block-compressing their data to a
 BC3 using @relativeref{Trade,StbDxtImageConverter} with high-quality output and
@@ -185,8 +193,8 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [-M|--mesh-converter PLUGIN]... [--plugin-dir DIR]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
     [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
-    [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
-    [--remove-duplicate-materials]
+    [--remove-duplicate-vertices-fuzzy EPSILON] [--threads N]
+    [--simplify RATIO] [--simplify-error ERROR] [--phong-to-pbr] [--remove-duplicate-materials]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
@@ -229,6 +237,16 @@ Arguments:
 -   `--remove-duplicate-vertices-fuzzy EPSILON` --- remove duplicate vertices
     using @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double)
     in all meshes after import
+-   `--threads N` --- number of threads to use for
+    `--remove-duplicate-vertices` and `--remove-duplicate-vertices-fuzzy`, or
+    @cpp 0 @ce for all hardware threads (default: @cpp 1 @ce). See
+    @ref MeshTools::removeDuplicates(const Trade::MeshData&, UnsignedInt) for
+    more information.
+-   `--simplify RATIO` --- simplify all meshes after import to given ratio of
+    their original index count using
+    @ref MeshTools::simplify(const Trade::MeshData&, std::size_t, Float)
+-   `--simplify-error ERROR` --- max simplification error relative to the
+    mesh size (default: @cpp 1.0 @ce, i.e. unlimited)
 -   `--phong-to-pbr` --- convert Phong materials to PBR metallic/roughness
     using @ref MaterialTools::phongToPbrMetallicRoughness()
 -   `--remove-duplicate-materials` --- remove duplicate materials using
@@ -314,9 +332,13 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no `-P` / `-M` is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The `--remove-duplicate-vertices`, `--phong-to-pbr` and
+The `--remove-duplicate-vertices`, `--simplify`, `--phong-to-pbr` and
 `--remove-duplicate-materials` operations are performed on meshes and materials
-before passing them to any converter.
+before passing them to any converter. Simplification is done after duplicate
+removal, as vertices that differ only in attributes other than position would
+otherwise be treated as a seam and not simplified. It's performed only on
+indexed triangle meshes with positions, other meshes are passed through
+unchanged.
 
 If `--concatenate-meshes` is given, all meshes of the input file are
 first concatenated into a single mesh using @ref MeshTools::concatenate(), with
@@ -437,6 +459,9 @@ int main(int argc, char** argv) {
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
+        .addOption("threads", "1").setHelp("threads", "number of threads to use for --remove-duplicate-vertices and --remove-duplicate-vertices-fuzzy, 0 for all hardware threads", "N")
+        .addOption("simplify").setHelp("simplify", "simplify all meshes after import to given ratio of their original index count", "RATIO")
+        .addOption("simplify-error", "1.0").setHelp("simplify-error", "max simplification error relative to the mesh size", "ERROR")
         .addBooleanOption("phong-to-pbr").setHelp("phong-to-pbr", "convert Phong materials to PBR metallic/roughness")
         .addBooleanOption("remove-duplicate-materials").setHelp("remove-duplicate-materials", "remove duplicate materials")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
@@ -517,9 +542,11 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no -P / -M is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The --remove-duplicate-vertices, --phong-to-pbr and
+The --remove-duplicate-vertices, --simplify, --phong-to-pbr and
 --remove-duplicate-materials operations are performed on meshes and materials
-before passing them to any converter.
+before passing them to any converter. Simplification is done after duplicate
+removal and only on indexed triangle meshes with positions, other meshes are
+passed through unchanged.
 
 If --concatenate-meshes is given, all meshes of the input file are first
 concatenated into a single mesh, with the scene hierarchy transformation baked
@@ -581,6 +608,14 @@ well, the IDs reference attributes of the first mesh.)")
         Error{} << "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes";
         return 1;
     }
+    if(args.value<Containers::StringView>("simplify") && !(args.value<Float>("simplify") >= 0.0f && args.value<Float>("simplify") <= 1.0f)) {
+        Error{} << "The --simplify ratio is expected to be in range [0, 1], got" << args.value<Containers::StringView>("simplify");
+        return 1;
+    }
+    if(!(args.value<Float>("simplify-error") >= 0.0f)) {
+        Error{} << "The --simplify-error value is expected to be non-negative, got" << args.value<Containers::StringView>("simplify-error");
+        return 1;
+    }
 
     /* Importer manager */
     PluginManager::Manager<Trade::AbstractImporter> importerManager{
@@ -1034,6 +1069,7 @@ well, the IDs reference attributes of the first mesh.)")
     Containers::Array<Trade::MeshData> meshes;
     if(args.isSet("remove-duplicate-vertices") ||
        args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
+       args.value<Containers::StringView>("simplify") ||
        args.arrayValueCount("mesh-converter"))
     {
         const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
@@ -1064,10 +1100,10 @@ well, the IDs reference attributes of the first mesh.)")
                     and texcoords? ugh... */
                 if(fuzzy) {
                     Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
+                    mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"), Math::TypeTraits<Double>::epsilon(), args.value<UnsignedInt>("threads"));
                 } else {
                     Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
+                    mesh = MeshTools::removeDuplicates(*Utility::move(mesh), args.value<UnsignedInt>("threads"));
                 }
 
                 if(args.isSet("verbose")) {
@@ -1083,6 +1119,29 @@ well, the IDs reference attributes of the first mesh.)")
                 }
             }
 
+            /* Simplification */
+            if(args.value<Containers::StringView>("simplify")) {
+                if(!mesh->isIndexed() || mesh->primitive() != MeshPrimitive::Triangles || isMeshIndexTypeImplementationSpecific(mesh->indexType()) || !mesh->hasAttribute(Trade::MeshAttribute::Position)) {
+                    Warning{} << "Mesh" << i << "is not an indexed triangle mesh with positions, not simplifying";
+                } else {
+                    const UnsignedInt beforeIndexCount = mesh->indexCount();
+                    {
+                        Trade::Implementation::Duration d{conversionTime};
+                        mesh = MeshTools::simplify(*mesh, std::size_t(beforeIndexCount/3*args.value<Float>("simplify"))*3, args.value<Float>("simplify-error"));
+                    }
+
+                    if(args.isSet("verbose")) {
+                        Debug d;
+                        /* Same as with duplicate removal above */
+                        if(singleMesh)
+                            d << "Simplification:";
+                        else
+                            d << "Mesh" << i << "simplification:";
+                        d << beforeIndexCount/3 << "->" << mesh->indexCount()/3 << "triangles";
+                    }
+                }
+            }
+
             /* Arbitrary mesh converters */
             for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
                 const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
@@ -32,6 +32,10 @@
 #extension GL_ARB_shader_storage_buffer_object: require
 #endif
 
+#ifdef BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture: require
+#endif
+
 #ifndef NEW_GLSL
 #define fragmentColor gl_FragColor
 #define texture texture2D
@@ -122,8 +126,10 @@ layout(std140
 
 struct MaterialUniform {
     lowp vec4 color;
-    highp vec4 alphaMaskReservedReservedReserved;
-    #define material_alphaMask alphaMaskReservedReservedReserved.x
+    highp vec4 alphaMaskReservedTextureHandle;
+    #define material_alphaMask alphaMaskReservedTextureHandle.x
+    /* Lower and upper 32 bits of the handle */
+    #define material_textureHandle floatBitsToUint(alphaMaskReservedTextureHandle.zw)
 };
 
 layout(std140
@@ -137,7 +143,7 @@ layout(std140
 
 /* Textures */
 
-#ifdef TEXTURED
+#if defined(TEXTURED) && !defined(BINDLESS_TEXTURES)
 #ifdef EXPLICIT_BINDING
 layout(binding = 0)
 #endif
@@ -219,6 +225,13 @@ void main() {
     #ifdef ALPHA_MASK
     lowp const float alphaMask = materials[materialId].material_alphaMask;
     #endif
+    #ifdef BINDLESS_TEXTURES
+    #ifndef TEXTURE_ARRAYS
+    #define textureData sampler2D(materials[materialId].material_textureHandle)
+    #else
+    #define textureData sampler2DArray(materials[materialId].material_textureHandle)
+    #endif
+    #endif
     #endif
 
     fragmentColor =
@@ -206,10 +206,10 @@ Describes material properties referenced from
 */
 struct FlatMaterialUniform {
     /** @brief Construct with default parameters */
-    constexpr explicit FlatMaterialUniform(DefaultInitT = DefaultInit) noexcept: color{1.0f, 1.0f, 1.0f, 1.0f}, alphaMask{0.5f} {}
+    constexpr explicit FlatMaterialUniform(DefaultInitT = DefaultInit) noexcept: color{1.0f, 1.0f, 1.0f, 1.0f}, alphaMask{0.5f}, textureHandle{} {}
 
     /** @brief Construct without initializing the contents */
-    explicit FlatMaterialUniform(NoInitT) noexcept: color{NoInit} {}
+    explicit FlatMaterialUniform(NoInitT) noexcept: color{NoInit}, textureHandle{NoInit} {}
 
     /** @{
      * @name Convenience setters
@@ -238,6 +238,16 @@ struct FlatMaterialUniform {
         return *this;
     }
 
+    /**
+     * @brief Set the @ref textureHandle field
+     * @return Reference to self (for method chaining)
+     * @m_since_latest
+     */
+    FlatMaterialUniform& setTextureHandle(UnsignedLong handle) {
+        textureHandle = {UnsignedInt(handle), UnsignedInt(handle >> 32)};
+        return *this;
+    }
+
     /**
      * @}
      */
@@ -269,9 +279,23 @@ struct FlatMaterialUniform {
        I MADE THOSE UNNAMED, YOU DUMB FOOL */
     #ifndef DOXYGEN_GENERATING_OUTPUT
     Int:32;
-    Int:32;
-    Int:32;
     #endif
+
+    /**
+     * @brief Bindless texture handle
+     * @m_since_latest
+     *
+     * Lower and upper 32 bits of a handle of the texture to sample from, as
+     * returned by @ref GL::AbstractTexture::handle(). Split into two parts
+     * to keep the structure four-byte aligned, use @ref setTextureHandle()
+     * to fill it from a 64-bit value. The texture has to be made resident
+     * with @ref GL::AbstractTexture::makeHandleResident() before drawing.
+     * Default value is @cpp {0, 0} @ce.
+     *
+     * Used only if @ref FlatGL::Flag::BindlessTextures is enabled, ignored
+     * otherwise.
+     */
+    Vector2ui textureHandle;
 };
 
 #if defined(MAGNUM_TARGET_GL) && defined(MAGNUM_BUILD_DEPRECATED)
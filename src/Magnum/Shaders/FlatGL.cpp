@@ -116,6 +116,11 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
         "Shaders::FlatGL: texture arrays require texture transformation enabled as well if uniform buffers are used", CompileState{NoCreate});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(configuration.flags() & Flag::BindlessTextures) || configuration.flags() >= (Flag::UniformBuffers|Flag::Textured),
+        "Shaders::FlatGL: bindless textures require uniform buffers and texturing enabled as well", CompileState{NoCreate});
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(configuration.flags() & Flag::DynamicPerVertexJointCount) || (configuration.perVertexJointCount() || configuration.secondaryPerVertexJointCount()),
         "Shaders::FlatGL: dynamic per-vertex joint count enabled for zero joints", CompileState{NoCreate});
@@ -152,6 +157,8 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
     #ifndef MAGNUM_TARGET_GLES
     if(configuration.flags() >= Flag::TextureArrays)
         MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::EXT::texture_array);
+    if(configuration.flags() >= Flag::BindlessTextures)
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::bindless_texture);
     #endif
 
     #ifdef MAGNUM_BUILD_STATIC
@@ -164,7 +171,10 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
     const GL::Context& context = GL::Context::current();
 
     #ifndef MAGNUM_TARGET_GLES
-    const GL::Version version = context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
+    /* Bindless textures need GLSL 4.00 for constructing samplers from
+       handles */
+    const GL::Version version = configuration.flags() >= Flag::BindlessTextures ? GL::Version::GL400 :
+        context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #else
     const GL::Version version = context.supportedVersion({
         #ifndef MAGNUM_TARGET_WEBGL
@@ -327,6 +337,9 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
                 configuration.materialCount()));
         }
         frag.addSource(configuration.flags() >= Flag::MultiDraw ? "#define MULTI_DRAW\n"_s : ""_s);
+        #ifndef MAGNUM_TARGET_GLES
+        frag.addSource(configuration.flags() >= Flag::BindlessTextures ? "#define BINDLESS_TEXTURES\n"_s : ""_s);
+        #endif
     }
     #endif
     frag.addSource(rs.getString("generic.glsl"_s))
@@ -459,7 +472,12 @@ template<UnsignedInt dimensions> FlatGL<dimensions>::FlatGL(CompileState&& state
     if(state._version < GL::Version::GLES310)
     #endif
     {
-        if(_flags & Flag::Textured) setUniform(uniformLocation("textureData"_s), TextureUnit);
+        if(_flags & Flag::Textured
+            #ifndef MAGNUM_TARGET_GLES
+            && !(_flags & Flag::BindlessTextures)
+            #endif
+        )
+            setUniform(uniformLocation("textureData"_s), TextureUnit);
         #ifndef MAGNUM_TARGET_GLES2
         if(_flags >= Flag::ObjectIdTexture) setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
         /* SSBOs have bindings defined in the source always */
@@ -769,6 +787,10 @@ template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTex
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::FlatGL::bindTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::FlatGL::bindTexture(): the shader was created with bindless textures enabled, supply a texture handle in the material buffer instead", *this);
+    #endif
     texture.bind(TextureUnit);
     return *this;
 }
@@ -779,6 +801,10 @@ template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTex
         "Shaders::FlatGL::bindTexture(): the shader was not created with texturing enabled", *this);
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::FlatGL::bindTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::FlatGL::bindTexture(): the shader was created with bindless textures enabled, supply a texture handle in the material buffer instead", *this);
+    #endif
     texture.bind(TextureUnit);
     return *this;
 }
@@ -865,6 +891,9 @@ Debug& operator<<(Debug& debug, const FlatGLFlag value) {
         _c(TextureArrays)
         _c(DynamicPerVertexJointCount)
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        _c(BindlessTextures)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -903,6 +932,9 @@ Debug& operator<<(Debug& debug, const FlatGLFlags value) {
         FlatGLFlag::TextureArrays,
         FlatGLFlag::DynamicPerVertexJointCount,
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        FlatGLFlag::BindlessTextures,
+        #endif
     });
 }
 
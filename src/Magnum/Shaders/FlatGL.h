@@ -71,7 +71,10 @@ namespace Implementation {
         #endif
         MultiDraw = UniformBuffers|(1 << 9),
         TextureArrays = 1 << 10,
-        DynamicPerVertexJointCount = 1 << 12
+        DynamicPerVertexJointCount = 1 << 12,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        BindlessTextures = 1 << 14
         #endif
     };
     typedef Containers::EnumSet<FlatGLFlag> FlatGLFlags;
@@ -656,7 +659,13 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT FlatGL: public GL::
              * @ref setDrawOffset() before each draw. In a non-multidraw
              * scenario, @glsl gl_DrawID @ce is @cpp 0 @ce, which means a
              * shader with this flag enabled can be used for regular draws as
-             * well.
+             * well. On desktop GL with
+             * @gl_extension{ARB,multi_draw_indirect} the same applies to
+             * draws submitted via @ref GL::AbstractShaderProgram::drawIndirect(),
+             * where @glsl gl_DrawID @ce is the index of the indirect command.
+             * Without the extension the commands are submitted one by one
+             * and @glsl gl_DrawID @ce is @cpp 0 @ce for all of them, so all
+             * commands use the per-draw parameters at @ref setDrawOffset().
              * @requires_gl46 Extension @gl_extension{ARB,uniform_buffer_object}
              *      and @gl_extension{ARB,shader_draw_parameters}
              * @requires_es_extension OpenGL ES 3.0 and extension
@@ -713,6 +722,27 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT FlatGL: public GL::
              */
             DynamicPerVertexJointCount = 1 << 12,
             #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Use bindless textures. Instead of binding a texture with
+             * @ref bindTexture(), the texture is taken from a
+             * @ref FlatMaterialUniform::textureHandle supplied in the
+             * material buffer, which makes it possible to draw meshes with
+             * different textures in a single
+             * @ref GL::AbstractShaderProgram::draw(const Containers::Iterable<MeshView>&)
+             * call together with @ref Flag::MultiDraw. Expects that
+             * @ref Flag::UniformBuffers and @ref Flag::Textured are enabled
+             * as well. The object ID texture, if enabled, is still bound
+             * with @ref bindObjectIdTexture(). See
+             * @ref GL-AbstractTexture-bindless for more information.
+             * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES
+             *      or WebGL.
+             * @m_since_latest
+             */
+            BindlessTextures = 1 << 14,
+            #endif
         };
 
         /**
@@ -32,6 +32,10 @@
 #extension GL_ARB_shader_storage_buffer_object: require
 #endif
 
+#ifdef BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture: require
+#endif
+
 #ifndef NEW_GLSL
 #define in varying
 #define fragmentColor gl_FragColor
@@ -235,6 +239,25 @@ layout(std140
     BUFFER_READONLY MaterialUniform materials[MATERIAL_COUNT];
 };
 
+#ifdef BINDLESS_TEXTURES
+struct TextureHandleUniform {
+    highp uvec4 ambientTextureHandleDiffuseTextureHandle;
+    #define textureHandle_ambientTexture ambientTextureHandleDiffuseTextureHandle.xy
+    #define textureHandle_diffuseTexture ambientTextureHandleDiffuseTextureHandle.zw
+    highp uvec4 specularTextureHandleNormalTextureHandle;
+    #define textureHandle_specularTexture specularTextureHandleNormalTextureHandle.xy
+    #define textureHandle_normalTexture specularTextureHandleNormalTextureHandle.zw
+};
+
+layout(std140
+    #if defined(EXPLICIT_BINDING) || defined(SHADER_STORAGE_BUFFERS)
+    , binding = 7
+    #endif
+) BUFFER_OR_UNIFORM TextureHandle {
+    BUFFER_READONLY TextureHandleUniform textureHandles[MATERIAL_COUNT];
+};
+#endif
+
 /* With SSBOs LIGHT_COUNT is defined to be empty, +0 makes the condition not
    cause a compile error */
 #if defined(SHADER_STORAGE_BUFFERS) || LIGHT_COUNT+0
@@ -258,8 +281,10 @@ layout(std140
 #endif
 #endif
 
-/* Textures */
+/* Textures, with bindless textures taken from the TextureHandle block
+   instead */
 
+#ifndef BINDLESS_TEXTURES
 #ifdef AMBIENT_TEXTURE
 #ifdef EXPLICIT_BINDING
 layout(binding = 0)
@@ -313,6 +338,7 @@ uniform lowp
     normalTexture;
 #endif
 #endif
+#endif
 
 #ifdef OBJECT_ID_TEXTURE
 #ifdef EXPLICIT_BINDING
@@ -392,6 +418,17 @@ void main() {
     #else
     #define materialId 0u
     #endif
+    #ifdef BINDLESS_TEXTURES
+    #ifndef TEXTURE_ARRAYS
+    #define bindlessSampler sampler2D
+    #else
+    #define bindlessSampler sampler2DArray
+    #endif
+    #define ambientTexture bindlessSampler(textureHandles[materialId].textureHandle_ambientTexture)
+    #define diffuseTexture bindlessSampler(textureHandles[materialId].textureHandle_diffuseTexture)
+    #define specularTexture bindlessSampler(textureHandles[materialId].textureHandle_specularTexture)
+    #define normalTexture bindlessSampler(textureHandles[materialId].textureHandle_normalTexture)
+    #endif
     lowp const vec4 ambientColor = materials[materialId].ambientColor;
     #if PER_DRAW_LIGHT_COUNT
     lowp const vec4 diffuseColor = materials[materialId].diffuseColor;
@@ -424,6 +424,108 @@ struct PhongMaterialUniform {
     #endif
 };
 
+/**
+@brief Bindless texture handles for Phong shaders
+@m_since_latest
+
+Texture handles for a particular material, indexed with
+@ref PhongDrawUniform::materialId the same way as @ref PhongMaterialUniform.
+Kept separate from @ref PhongMaterialUniform in order to not make it larger.
+Each handle is split into lower and upper 32 bits in order to keep the
+structure four-byte aligned, use the convenience setters to fill them from
+64-bit values returned by @ref GL::AbstractTexture::handle().
+@see @ref PhongGL::bindTextureHandleBuffer(),
+    @ref PhongGL::Flag::BindlessTextures
+*/
+struct PhongTextureHandleUniform {
+    /** @brief Construct with default parameters */
+    constexpr explicit PhongTextureHandleUniform(DefaultInitT = DefaultInit) noexcept: ambientTextureHandle{}, diffuseTextureHandle{}, specularTextureHandle{}, normalTextureHandle{} {}
+
+    /** @brief Construct without initializing the contents */
+    explicit PhongTextureHandleUniform(NoInitT) noexcept: ambientTextureHandle{NoInit}, diffuseTextureHandle{NoInit}, specularTextureHandle{NoInit}, normalTextureHandle{NoInit} {}
+
+    /** @{
+     * @name Convenience setters
+     *
+     * Provided to allow the use of method chaining for populating a structure
+     * in a single expression, otherwise equivalent to accessing the fields
+     * directly. Also guaranteed to provide backwards compatibility when
+     * packing of the actual fields changes.
+     */
+
+    /**
+     * @brief Set the @ref ambientTextureHandle field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setAmbientTextureHandle(UnsignedLong handle) {
+        ambientTextureHandle = {UnsignedInt(handle), UnsignedInt(handle >> 32)};
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref diffuseTextureHandle field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setDiffuseTextureHandle(UnsignedLong handle) {
+        diffuseTextureHandle = {UnsignedInt(handle), UnsignedInt(handle >> 32)};
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref specularTextureHandle field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setSpecularTextureHandle(UnsignedLong handle) {
+        specularTextureHandle = {UnsignedInt(handle), UnsignedInt(handle >> 32)};
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref normalTextureHandle field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setNormalTextureHandle(UnsignedLong handle) {
+        normalTextureHandle = {UnsignedInt(handle), UnsignedInt(handle >> 32)};
+        return *this;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @brief Ambient texture handle
+     *
+     * Default value is @cpp {0, 0} @ce. Used only if
+     * @ref PhongGL::Flag::AmbientTexture is enabled, ignored otherwise.
+     */
+    Vector2ui ambientTextureHandle;
+
+    /**
+     * @brief Diffuse texture handle
+     *
+     * Default value is @cpp {0, 0} @ce. Used only if
+     * @ref PhongGL::Flag::DiffuseTexture is enabled, ignored otherwise.
+     */
+    Vector2ui diffuseTextureHandle;
+
+    /**
+     * @brief Specular texture handle
+     *
+     * Default value is @cpp {0, 0} @ce. Used only if
+     * @ref PhongGL::Flag::SpecularTexture is enabled, ignored otherwise.
+     */
+    Vector2ui specularTextureHandle;
+
+    /**
+     * @brief Normal texture handle
+     *
+     * Default value is @cpp {0, 0} @ce. Used only if
+     * @ref PhongGL::Flag::NormalTexture is enabled, ignored otherwise.
+     */
+    Vector2ui normalTextureHandle;
+};
+
 /**
 @brief Light parameters for Phong shaders
 @m_since_latest
@@ -82,6 +82,7 @@ namespace {
         MaterialBufferBinding = 4,
         LightBufferBinding = 5,
         JointBufferBinding = 6,
+        TextureHandleBufferBinding = 7
     };
     #endif
 }
@@ -131,6 +132,11 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
         "Shaders::PhongGL: light culling requires uniform buffers to be enabled", CompileState{NoCreate});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(configuration.flags() & Flag::BindlessTextures) || ((configuration.flags() & Flag::UniformBuffers) && (configuration.flags() & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture|Flag::NormalTexture))),
+        "Shaders::PhongGL: bindless textures require uniform buffers and at least one texture enabled as well", CompileState{NoCreate});
+    #endif
+
     CORRADE_ASSERT(!(configuration.flags() & Flag::SpecularTexture) || !(configuration.flags() & (Flag::NoSpecular)),
         "Shaders::PhongGL: specular texture requires the shader to not have specular disabled", CompileState{NoCreate});
 
@@ -170,6 +176,8 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
     #ifndef MAGNUM_TARGET_GLES
     if(configuration.flags() >= Flag::TextureArrays)
         MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::EXT::texture_array);
+    if(configuration.flags() >= Flag::BindlessTextures)
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::bindless_texture);
     #endif
 
     #ifdef MAGNUM_BUILD_STATIC
@@ -182,7 +190,10 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
     const GL::Context& context = GL::Context::current();
 
     #ifndef MAGNUM_TARGET_GLES
-    const GL::Version version = context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
+    /* Bindless textures need GLSL 4.00 for constructing samplers from
+       handles */
+    const GL::Version version = configuration.flags() >= Flag::BindlessTextures ? GL::Version::GL400 :
+        context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #else
     const GL::Version version = context.supportedVersion({
         #ifndef MAGNUM_TARGET_WEBGL
@@ -384,6 +395,9 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
                 configuration.perDrawLightCount()));
         frag.addSource(configuration.flags() >= Flag::MultiDraw ? "#define MULTI_DRAW\n"_s : ""_s)
             .addSource(configuration.flags() >= Flag::LightCulling ? "#define LIGHT_CULLING\n"_s : ""_s);
+        #ifndef MAGNUM_TARGET_GLES
+        frag.addSource(configuration.flags() >= Flag::BindlessTextures ? "#define BINDLESS_TEXTURES\n"_s : ""_s);
+        #endif
     } else
     #endif
     {
@@ -577,11 +591,17 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
     if(state._version < GL::Version::GLES310)
     #endif
     {
-        if(_flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"_s), AmbientTextureUnit);
-        if(_perDrawLightCount) {
-            if(_flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"_s), DiffuseTextureUnit);
-            if(_flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"_s), SpecularTextureUnit);
-            if(_flags & Flag::NormalTexture) setUniform(uniformLocation("normalTexture"_s), NormalTextureUnit);
+        #ifndef MAGNUM_TARGET_GLES
+        /* Bindless textures have no sampler uniforms */
+        if(!(_flags & Flag::BindlessTextures))
+        #endif
+        {
+            if(_flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"_s), AmbientTextureUnit);
+            if(_perDrawLightCount) {
+                if(_flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"_s), DiffuseTextureUnit);
+                if(_flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"_s), SpecularTextureUnit);
+                if(_flags & Flag::NormalTexture) setUniform(uniformLocation("normalTexture"_s), NormalTextureUnit);
+            }
         }
         #ifndef MAGNUM_TARGET_GLES2
         if(_flags >= Flag::ObjectIdTexture) setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
@@ -601,6 +621,10 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
                 setUniformBlockBinding(uniformBlockIndex("Light"_s), LightBufferBinding);
             if(_jointCount)
                 setUniformBlockBinding(uniformBlockIndex("Joint"_s), JointBufferBinding);
+            #ifndef MAGNUM_TARGET_GLES
+            if(_flags & Flag::BindlessTextures)
+                setUniformBlockBinding(uniformBlockIndex("TextureHandle"_s), TextureHandleBufferBinding);
+            #endif
         }
         #endif
     }
@@ -1178,6 +1202,26 @@ PhongGL& PhongGL::bindJointBuffer(GL::Buffer& buffer, const GLintptr offset, con
         GL::Buffer::Target::Uniform, JointBufferBinding, offset, size);
     return *this;
 }
+
+#ifndef MAGNUM_TARGET_GLES
+PhongGL& PhongGL::bindTextureHandleBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::BindlessTextures,
+        "Shaders::PhongGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled", *this);
+    buffer.bind(
+        _flags >= Flag::ShaderStorageBuffers ? GL::Buffer::Target::ShaderStorage :
+        GL::Buffer::Target::Uniform, TextureHandleBufferBinding);
+    return *this;
+}
+
+PhongGL& PhongGL::bindTextureHandleBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::BindlessTextures,
+        "Shaders::PhongGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled", *this);
+    buffer.bind(
+        _flags >= Flag::ShaderStorageBuffers ? GL::Buffer::Target::ShaderStorage :
+        GL::Buffer::Target::Uniform, TextureHandleBufferBinding, offset, size);
+    return *this;
+}
+#endif
 #endif
 
 PhongGL& PhongGL::bindAmbientTexture(GL::Texture2D& texture) {
@@ -1187,6 +1231,10 @@ PhongGL& PhongGL::bindAmbientTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindAmbientTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindAmbientTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     texture.bind(AmbientTextureUnit);
     return *this;
 }
@@ -1197,6 +1245,10 @@ PhongGL& PhongGL::bindAmbientTexture(GL::Texture2DArray& texture) {
         "Shaders::PhongGL::bindAmbientTexture(): the shader was not created with ambient texture enabled", *this);
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindAmbientTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindAmbientTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     texture.bind(AmbientTextureUnit);
     return *this;
 }
@@ -1209,6 +1261,10 @@ PhongGL& PhongGL::bindDiffuseTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     if(_perDrawLightCount) texture.bind(DiffuseTextureUnit);
     return *this;
 }
@@ -1219,6 +1275,10 @@ PhongGL& PhongGL::bindDiffuseTexture(GL::Texture2DArray& texture) {
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was not created with diffuse texture enabled", *this);
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     if(_perDrawLightCount) texture.bind(DiffuseTextureUnit);
     return *this;
 }
@@ -1231,6 +1291,10 @@ PhongGL& PhongGL::bindSpecularTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindSpecularTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindSpecularTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     if(_perDrawLightCount) texture.bind(SpecularTextureUnit);
     return *this;
 }
@@ -1241,6 +1305,10 @@ PhongGL& PhongGL::bindSpecularTexture(GL::Texture2DArray& texture) {
         "Shaders::PhongGL::bindSpecularTexture(): the shader was not created with specular texture enabled", *this);
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindSpecularTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindSpecularTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     if(_perDrawLightCount) texture.bind(SpecularTextureUnit);
     return *this;
 }
@@ -1253,6 +1321,10 @@ PhongGL& PhongGL::bindNormalTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindNormalTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindNormalTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     if(_perDrawLightCount) texture.bind(NormalTextureUnit);
     return *this;
 }
@@ -1263,6 +1335,10 @@ PhongGL& PhongGL::bindNormalTexture(GL::Texture2DArray& texture) {
         "Shaders::PhongGL::bindNormalTexture(): the shader was not created with normal texture enabled", *this);
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindNormalTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindNormalTexture(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     if(_perDrawLightCount) texture.bind(NormalTextureUnit);
     return *this;
 }
@@ -1297,6 +1373,10 @@ PhongGL& PhongGL::bindTextures(GL::Texture2D* ambient, GL::Texture2D* diffuse, G
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindTextures(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags & Flag::BindlessTextures),
+        "Shaders::PhongGL::bindTextures(): the shader was created with bindless textures enabled, supply texture handles via bindTextureHandleBuffer() instead", *this);
+    #endif
     GL::AbstractTexture::bind(AmbientTextureUnit, {ambient, diffuse, specular, normal});
     return *this;
 }
@@ -1372,6 +1452,9 @@ Debug& operator<<(Debug& debug, const PhongGL::Flag value) {
         #ifndef MAGNUM_TARGET_GLES2
         _c(DynamicPerVertexJointCount)
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        _c(BindlessTextures)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1419,6 +1502,9 @@ Debug& operator<<(Debug& debug, const PhongGL::Flags value) {
         #ifndef MAGNUM_TARGET_GLES2
         PhongGL::Flag::DynamicPerVertexJointCount,
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        PhongGL::Flag::BindlessTextures,
+        #endif
     });
 }
 
@@ -95,6 +95,16 @@ If @ref Flag::TextureArrays is enabled, pass @ref GL::Texture2DArray instances
 instead of @ref GL::Texture2D. By default layer @cpp 0 @ce is used, call
 @ref setTextureLayer() to pick a different texture array layer.
 
+On desktop GL with @gl_extension{ARB,bindless_texture}, the
+@ref Flag::BindlessTextures flag together with @ref Flag::UniformBuffers makes
+the shader fetch texture handles for each material from a
+@ref PhongTextureHandleUniform buffer bound with
+@ref bindTextureHandleBuffer() instead of needing the textures bound to
+texture units. Combined with @ref Flag::MultiDraw, meshes with different
+textures can be then drawn in a single multi-draw call:
+
+@snippet Shaders-gl.cpp PhongGL-bindless
+
 @section Shaders-PhongGL-lights Light specification
 
 By default, the shader provides a single directional "fill" light, coming from
@@ -860,7 +870,13 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
              * @ref setDrawOffset() before each draw. In a non-multidraw
              * scenario, @glsl gl_DrawID @ce is @cpp 0 @ce, which means a
              * shader with this flag enabled can be used for regular draws as
-             * well.
+             * well. On desktop GL with
+             * @gl_extension{ARB,multi_draw_indirect} the same applies to
+             * draws submitted via @ref GL::AbstractShaderProgram::drawIndirect(),
+             * where @glsl gl_DrawID @ce is the index of the indirect command.
+             * Without the extension the commands are submitted one by one
+             * and @glsl gl_DrawID @ce is @cpp 0 @ce for all of them, so all
+             * commands use the per-draw parameters at @ref setDrawOffset().
              * @requires_gl46 Extension @gl_extension{ARB,uniform_buffer_object}
              *      and @gl_extension{ARB,shader_draw_parameters}
              * @requires_es_extension OpenGL ES 3.0 and extension
@@ -949,6 +965,32 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
              */
             DynamicPerVertexJointCount = 1 << 18,
             #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Use bindless textures. Instead of binding textures with
+             * @ref bindAmbientTexture(), @ref bindDiffuseTexture(),
+             * @ref bindSpecularTexture(), @ref bindNormalTexture() or
+             * @ref bindTextures(), the textures are taken from
+             * @ref PhongTextureHandleUniform entries supplied via
+             * @ref bindTextureHandleBuffer() and indexed with
+             * @ref PhongDrawUniform::materialId. Together with
+             * @ref Flag::MultiDraw this makes it possible to draw meshes with
+             * different textures in a single
+             * @ref GL::AbstractShaderProgram::draw(const Containers::Iterable<MeshView>&)
+             * call. Expects that @ref Flag::UniformBuffers and at least one of
+             * @ref Flag::AmbientTexture, @ref Flag::DiffuseTexture,
+             * @ref Flag::SpecularTexture or @ref Flag::NormalTexture is
+             * enabled as well. The object ID texture, if enabled, is still
+             * bound with @ref bindObjectIdTexture(). See
+             * @ref GL-AbstractTexture-bindless for more information.
+             * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES
+             *      or WebGL.
+             * @m_since_latest
+             */
+            BindlessTextures = 1 << 21,
+            #endif
         };
 
         /**
@@ -1918,6 +1960,30 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
          */
         PhongGL& bindJointBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bind a bindless texture handle uniform / shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::BindlessTextures is set. The buffer is
+         * expected to contain @ref materialCount() instances of
+         * @ref PhongTextureHandleUniform, indexed the same way as the
+         * material buffer bound with @ref bindMaterialBuffer(). All
+         * referenced textures are expected to be made resident with
+         * @ref GL::AbstractTexture::makeHandleResident().
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        PhongGL& bindTextureHandleBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        PhongGL& bindTextureHandleBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
         /**
          * @}
          */
@@ -169,6 +169,9 @@ struct FlatGLTest: GL::OpenGLTester {
     void renderMulti3D();
     void renderMultiSkinning2D();
     void renderMultiSkinning3D();
+    #ifndef MAGNUM_TARGET_GLES
+    void renderMultiIndirect3D();
+    #endif
     #endif
 
     private:
@@ -318,7 +321,13 @@ constexpr struct {
     {"shader storage + multidraw with all the things except secondary per-vertex sets", FlatGL2D::Flag::ShaderStorageBuffers|FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::AlphaMask|FlatGL2D::Flag::ObjectId|FlatGL2D::Flag::InstancedTextureOffset|FlatGL2D::Flag::InstancedTransformation|FlatGL2D::Flag::InstancedObjectId|FlatGL2D::Flag::DynamicPerVertexJointCount,
         0, 0, 0, 4, 0},
     {"shader storage + multidraw with all the things except instancing", FlatGL2D::Flag::ShaderStorageBuffers|FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::AlphaMask|FlatGL2D::Flag::ObjectId|FlatGL2D::Flag::DynamicPerVertexJointCount,
-        0, 0, 0, 3, 4}
+        0, 0, 0, 3, 4},
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures", FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::Textured|FlatGL2D::Flag::BindlessTextures,
+        1, 1, 0, 0, 0},
+    {"multidraw with bindless texture arrays", FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::BindlessTextures,
+        8, 48, 0, 0, 0},
     #endif
 };
 #endif
@@ -353,7 +362,17 @@ constexpr struct {
     {"instancing together with secondary per-vertex sets",
         FlatGL2D::Flag::InstancedTransformation,
         10, 4, 1,
-        "TransformationMatrix attribute binding conflicts with the SecondaryJointIds / SecondaryWeights attributes, use a non-instanced rendering with secondary weights instead"}
+        "TransformationMatrix attribute binding conflicts with the SecondaryJointIds / SecondaryWeights attributes, use a non-instanced rendering with secondary weights instead"},
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures but no uniform buffers",
+        FlatGL2D::Flag::BindlessTextures|FlatGL2D::Flag::Textured,
+        0, 0, 0,
+        "bindless textures require uniform buffers and texturing enabled as well"},
+    {"bindless textures but not textured",
+        FlatGL2D::Flag::BindlessTextures|FlatGL2D::Flag::UniformBuffers,
+        0, 0, 0,
+        "bindless textures require uniform buffers and texturing enabled as well"},
     #endif
 };
 
@@ -471,6 +490,15 @@ const struct {
         Matrix3::translation(Vector2{1.0f})*Matrix3::scaling(Vector2{-1.0f}),
         6, true},
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless",
+        FlatGL2D::Flag::Textured|FlatGL2D::Flag::BindlessTextures,
+        {}, 0, false},
+    {"bindless, array, texture transformation, arbitrary layer",
+        FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::BindlessTextures,
+        Matrix3::translation(Vector2{1.0f})*Matrix3::scaling(Vector2{-1.0f}),
+        6, true},
+    #endif
 };
 
 const struct {
@@ -794,7 +822,22 @@ constexpr struct {
         0, 0, false, 1,
         /* Some difference at the UV edge (texture is wrapping in the 2D case
            while the 2D array has a black area around) */
-        65.0f, 0.15f}
+        65.0f, 0.15f},
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"multidraw, bindless textured",
+        "multidraw-textured2D.tga", "multidraw-textured3D.tga", {},
+        FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::BindlessTextures,
+        2, 3, false, 1,
+        /* Minor differences on ARM Mali */
+        2.34f, 0.01f},
+    {"multidraw, bindless texture array",
+        "multidraw-textured2D.tga", "multidraw-textured3D.tga", {},
+        FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::BindlessTextures,
+        2, 3, false, 1,
+        /* Some difference at the UV edge (texture is wrapping in the 2D case
+           while the 2D array has a black area around) */
+        65.0f, 0.15f},
     #endif
 };
 
@@ -1153,6 +1196,12 @@ FlatGLTest::FlatGLTest() {
         &FlatGLTest::renderTeardown);
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    addTests({&FlatGLTest::renderMultiIndirect3D},
+        &FlatGLTest::renderSetup,
+        &FlatGLTest::renderTeardown);
+    #endif
+
     /* Load the plugins directly from the build tree. Otherwise they're either
        static and already loaded or not present in the build tree */
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -1274,6 +1323,8 @@ template<UnsignedInt dimensions> void FlatGLTest::constructUniformBuffers() {
         CORRADE_SKIP(GL::Extensions::EXT::gpu_shader4::string() << "is not supported.");
     if((data.flags & FlatGL2D::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & FlatGL2D::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_WEBGL
@@ -2483,6 +2534,12 @@ template<FlatGL2D::Flag flag> void FlatGLTest::renderTextured2D() {
     #ifndef MAGNUM_TARGET_GLES
     if((data.flags & FlatGL2D::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+        if(!(flag & FlatGL2D::Flag::UniformBuffers))
+            CORRADE_SKIP("Bindless textures require uniform buffers.");
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+            CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
+    }
     #endif
 
     if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
@@ -2508,6 +2565,11 @@ template<FlatGL2D::Flag flag> void FlatGLTest::renderTextured2D() {
     FlatGL2D shader{FlatGL2D::Configuration{}
         .setFlags(flags)};
 
+    /* With bindless textures the handle is passed in the material uniform
+       instead of binding the texture */
+    #ifndef MAGNUM_TARGET_GLES
+    UnsignedLong textureHandle{};
+    #endif
     GL::Texture2D texture{NoCreate};
     #ifndef MAGNUM_TARGET_GLES2
     GL::Texture2DArray textureArray{NoCreate};
@@ -2518,7 +2580,15 @@ template<FlatGL2D::Flag flag> void FlatGLTest::renderTextured2D() {
             .setWrapping(GL::SamplerWrapping::ClampToEdge)
             .setStorage(1, TextureFormatRGB, {image->size(), data.layer + 1})
             .setSubImage(0, {0, 0, data.layer}, ImageView2D{*image});
-        shader.bindTexture(textureArray);
+        #ifndef MAGNUM_TARGET_GLES
+        if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+            textureHandle = textureArray.handle();
+            textureArray.makeHandleResident();
+        } else
+        #endif
+        {
+            shader.bindTexture(textureArray);
+        }
         if(!(flag & FlatGL2D::Flag::UniformBuffers) && data.layer != 0)
             shader.setTextureLayer(data.layer); /* to verify the default */
     } else
@@ -2530,7 +2600,15 @@ template<FlatGL2D::Flag flag> void FlatGLTest::renderTextured2D() {
             .setWrapping(GL::SamplerWrapping::ClampToEdge)
             .setStorage(1, TextureFormatRGB, image->size())
             .setSubImage(0, {}, *image);
-        shader.bindTexture(texture);
+        #ifndef MAGNUM_TARGET_GLES
+        if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+            textureHandle = texture.handle();
+            texture.makeHandleResident();
+        } else
+        #endif
+        {
+            shader.bindTexture(texture);
+        }
     }
 
     if(flag == FlatGL2D::Flag{}) {
@@ -2564,6 +2642,9 @@ template<FlatGL2D::Flag flag> void FlatGLTest::renderTextured2D() {
         GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, {
             FlatMaterialUniform{}
                 .setColor(0x9999ff_rgbf)
+                #ifndef MAGNUM_TARGET_GLES
+                .setTextureHandle(textureHandle)
+                #endif
         }};
         /* Also take into account the case when texture transform needs to be
            enabled for texture arrays, so not data.flags but flags */
@@ -2632,6 +2713,12 @@ template<FlatGL3D::Flag flag> void FlatGLTest::renderTextured3D() {
     #ifndef MAGNUM_TARGET_GLES
     if((data.flags & FlatGL2D::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+        if(!(flag & FlatGL2D::Flag::UniformBuffers))
+            CORRADE_SKIP("Bindless textures require uniform buffers.");
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+            CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
+    }
     #endif
 
     if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
@@ -2657,6 +2744,11 @@ template<FlatGL3D::Flag flag> void FlatGLTest::renderTextured3D() {
     FlatGL3D shader{FlatGL3D::Configuration{}
         .setFlags(flags)};
 
+    /* With bindless textures the handle is passed in the material uniform
+       instead of binding the texture */
+    #ifndef MAGNUM_TARGET_GLES
+    UnsignedLong textureHandle{};
+    #endif
     GL::Texture2D texture{NoCreate};
     #ifndef MAGNUM_TARGET_GLES2
     GL::Texture2DArray textureArray{NoCreate};
@@ -2667,7 +2759,15 @@ template<FlatGL3D::Flag flag> void FlatGLTest::renderTextured3D() {
             .setWrapping(GL::SamplerWrapping::ClampToEdge)
             .setStorage(1, TextureFormatRGB, {image->size(), data.layer + 1})
             .setSubImage(0, {0, 0, data.layer}, ImageView2D{*image});
-        shader.bindTexture(textureArray);
+        #ifndef MAGNUM_TARGET_GLES
+        if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+            textureHandle = textureArray.handle();
+            textureArray.makeHandleResident();
+        } else
+        #endif
+        {
+            shader.bindTexture(textureArray);
+        }
         if(!(flag & FlatGL3D::Flag::UniformBuffers) && data.layer != 0)
             shader.setTextureLayer(data.layer); /* to verify the default */
     } else
@@ -2679,7 +2779,15 @@ template<FlatGL3D::Flag flag> void FlatGLTest::renderTextured3D() {
             .setWrapping(GL::SamplerWrapping::ClampToEdge)
             .setStorage(1, TextureFormatRGB, image->size())
             .setSubImage(0, {}, *image);
-        shader.bindTexture(texture);
+        #ifndef MAGNUM_TARGET_GLES
+        if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+            textureHandle = texture.handle();
+            texture.makeHandleResident();
+        } else
+        #endif
+        {
+            shader.bindTexture(texture);
+        }
     }
 
     if(flag == FlatGL3D::Flag{}) {
@@ -2723,6 +2831,9 @@ template<FlatGL3D::Flag flag> void FlatGLTest::renderTextured3D() {
         GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, {
             FlatMaterialUniform{}
                 .setColor(0x9999ff_rgbf)
+                #ifndef MAGNUM_TARGET_GLES
+                .setTextureHandle(textureHandle)
+                #endif
         }};
         /* Also take into account the case when texture transform needs to be
            enabled for texture arrays */
@@ -4906,6 +5017,8 @@ void FlatGLTest::renderMulti2D() {
         CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
     if((data.flags & FlatGL2D::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & FlatGL2D::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_GLES
@@ -4952,6 +5065,11 @@ void FlatGLTest::renderMulti2D() {
         .setMaterialCount(data.materialCount)
         .setDrawCount(data.drawCount)};
 
+    /* With bindless textures the handle is passed in the material uniforms
+       instead of binding the texture */
+    #ifndef MAGNUM_TARGET_GLES
+    UnsignedLong textureHandle{};
+    #endif
     GL::Texture2D texture{NoCreate};
     GL::Texture2DArray textureArray{NoCreate};
     if(data.flags & FlatGL3D::Flag::Textured) {
@@ -4996,7 +5114,15 @@ void FlatGLTest::renderMulti2D() {
                    per-instance offset is used together with the layer */
                 .setSubImage(0, {image->size().x()/2, 0, 1}, second)
                 .setSubImage(0, {0, 0, 2}, third);
-            shader.bindTexture(textureArray);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+                textureHandle = textureArray.handle();
+                textureArray.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindTexture(textureArray);
+            }
 
         } else {
             texture = GL::Texture2D{};
@@ -5005,7 +5131,15 @@ void FlatGLTest::renderMulti2D() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, image->size())
                 .setSubImage(0, {}, *image);
-            shader.bindTexture(texture);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+                textureHandle = texture.handle();
+                texture.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindTexture(texture);
+            }
         }
     }
 
@@ -5080,6 +5214,11 @@ void FlatGLTest::renderMulti2D() {
     materialData[1*data.uniformIncrement] = FlatMaterialUniform{}
         .setColor(data.flags & FlatGL2D::Flag::Textured ?
             0xffffff_rgbf : 0xff0000_rgbf);
+    #ifndef MAGNUM_TARGET_GLES
+    /* Zero if not bindless, in which case it's ignored */
+    materialData[0*data.uniformIncrement].setTextureHandle(textureHandle);
+    materialData[1*data.uniformIncrement].setTextureHandle(textureHandle);
+    #endif
     GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, materialData};
 
     Containers::Array<TransformationProjectionUniform2D> transformationProjectionData{2*data.uniformIncrement + 1};
@@ -5271,6 +5410,8 @@ void FlatGLTest::renderMulti3D() {
         CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
     if((data.flags & FlatGL2D::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & FlatGL2D::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_GLES
@@ -5317,6 +5458,11 @@ void FlatGLTest::renderMulti3D() {
         .setMaterialCount(data.materialCount)
         .setDrawCount(data.drawCount)};
 
+    /* With bindless textures the handle is passed in the material uniforms
+       instead of binding the texture */
+    #ifndef MAGNUM_TARGET_GLES
+    UnsignedLong textureHandle{};
+    #endif
     GL::Texture2D texture{NoCreate};
     GL::Texture2DArray textureArray{NoCreate};
     if(data.flags & FlatGL3D::Flag::Textured) {
@@ -5361,7 +5507,15 @@ void FlatGLTest::renderMulti3D() {
                    per-instance offset is used together with the layer */
                 .setSubImage(0, {image->size().x()/2, 0, 1}, second)
                 .setSubImage(0, {0, 0, 2}, third);
-            shader.bindTexture(textureArray);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+                textureHandle = textureArray.handle();
+                textureArray.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindTexture(textureArray);
+            }
 
         } else {
             texture = GL::Texture2D{};
@@ -5370,7 +5524,15 @@ void FlatGLTest::renderMulti3D() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, image->size())
                 .setSubImage(0, {}, *image);
-            shader.bindTexture(texture);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & FlatGL2D::Flag::BindlessTextures) {
+                textureHandle = texture.handle();
+                texture.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindTexture(texture);
+            }
         }
     }
 
@@ -5445,6 +5607,11 @@ void FlatGLTest::renderMulti3D() {
     materialData[1*data.uniformIncrement] = FlatMaterialUniform{}
         .setColor(data.flags & FlatGL2D::Flag::Textured ?
             0xffffff_rgbf : 0xff0000_rgbf);
+    #ifndef MAGNUM_TARGET_GLES
+    /* Zero if not bindless, in which case it's ignored */
+    materialData[0*data.uniformIncrement].setTextureHandle(textureHandle);
+    materialData[1*data.uniformIncrement].setTextureHandle(textureHandle);
+    #endif
     GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, materialData};
 
     Containers::Array<TransformationProjectionUniform3D> transformationProjectionData{2*data.uniformIncrement + 1};
@@ -5634,6 +5801,98 @@ void FlatGLTest::renderMulti3D() {
     }
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void FlatGLTest::renderMultiIndirect3D() {
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_draw_parameters>())
+        CORRADE_SKIP(GL::Extensions::ARB::shader_draw_parameters::string() << "is not supported.");
+    /* Without it the commands are submitted one by one and gl_DrawID is 0 for
+       all of them */
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::multi_draw_indirect>())
+        CORRADE_SKIP(GL::Extensions::ARB::multi_draw_indirect::string() << "is not supported.");
+
+    FlatGL3D shader{FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::MultiDraw)
+        .setMaterialCount(2)
+        .setDrawCount(3)};
+
+    /* Same scene as in the colored renderMulti3D() case, except that the
+       draws are described by indirect commands instead of mesh views */
+    Trade::MeshData sphereData = Primitives::uvSphereSolid(16, 32);
+    /* Plane is a strip, make it indexed first */
+    Trade::MeshData planeData = MeshTools::generateIndices(Primitives::planeSolid());
+    Trade::MeshData coneData = Primitives::coneSolid(1, 32, 1.0f);
+    GL::Mesh mesh = MeshTools::compile(MeshTools::concatenate({sphereData, planeData, coneData}));
+
+    const GL::DrawElementsIndirectCommand commands[]{
+        {sphereData.indexCount(), 1, 0, 0, 0},
+        {planeData.indexCount(), 1, sphereData.indexCount(), 0, 0},
+        {coneData.indexCount(), 1, sphereData.indexCount() + planeData.indexCount(), 0, 0}
+    };
+    GL::Buffer commandBuffer{GL::Buffer::TargetHint::DrawIndirect, commands};
+
+    GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, {
+        FlatMaterialUniform{}
+            .setColor(0x0000ff_rgbf),
+        FlatMaterialUniform{}
+            .setColor(0xff0000_rgbf)
+    }};
+    GL::Buffer transformationProjectionUniform{GL::Buffer::TargetHint::Uniform, {
+        TransformationProjectionUniform3D{}
+            .setTransformationProjectionMatrix(
+                Matrix4::perspectiveProjection(60.0_degf, 1.0f, 0.1f, 10.0f)*
+                Matrix4::translation(Vector3::zAxis(-2.15f))*
+                Matrix4::scaling(Vector3{0.4f})*
+                Matrix4::translation({-1.25f, -1.25f, 0.0f})*
+                Matrix4::rotationX(90.0_degf)
+            ),
+        TransformationProjectionUniform3D{}
+            .setTransformationProjectionMatrix(
+                Matrix4::perspectiveProjection(60.0_degf, 1.0f, 0.1f, 10.0f)*
+                Matrix4::translation(Vector3::zAxis(-2.15f))*
+                Matrix4::scaling(Vector3{0.4f})*
+                Matrix4::translation({ 1.25f, -1.25f, 0.0f})
+            ),
+        TransformationProjectionUniform3D{}
+            .setTransformationProjectionMatrix(
+                Matrix4::perspectiveProjection(60.0_degf, 1.0f, 0.1f, 10.0f)*
+                Matrix4::translation(Vector3::zAxis(-2.15f))*
+                Matrix4::scaling(Vector3{0.4f})*
+                Matrix4::translation({  0.0f,  1.0f, 1.0f})
+            )
+    }};
+    GL::Buffer drawUniform{GL::Buffer::TargetHint::Uniform, {
+        FlatDrawUniform{}
+            .setMaterialId(1),
+        FlatDrawUniform{}
+            .setMaterialId(0),
+        FlatDrawUniform{}
+            .setMaterialId(1)
+    }};
+
+    shader.bindTransformationProjectionBuffer(transformationProjectionUniform)
+        .bindDrawBuffer(drawUniform)
+        .bindMaterialBuffer(materialUniform)
+        .drawIndirect(mesh, commandBuffer, 0, Containers::arraySize(commands));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    /* Sphere should be lower left, red, plane lower right, blue, cone up
+       center, red. If gl_DrawID wouldn't be the command index, all three
+       would use the sphere transformation. */
+    CORRADE_COMPARE_WITH(
+        /* Dropping the alpha channel, as it's always 1.0 */
+        _framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm}).pixels<Color4ub>().slice(&Color4ub::rgb),
+        Utility::Path::join({_testDir, "FlatTestFiles", "multidraw3D.tga"}),
+        (DebugTools::CompareImageToFile{_manager}));
+}
+#endif
+
 void FlatGLTest::renderMultiSkinning2D() {
     auto&& data = RenderMultiSkinningData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -175,6 +175,8 @@ void FlatTest::materialUniformConstructDefault() {
     CORRADE_COMPARE(b.color, 0xffffffff_rgbaf);
     CORRADE_COMPARE(a.alphaMask, 0.5f);
     CORRADE_COMPARE(b.alphaMask, 0.5f);
+    CORRADE_COMPARE(a.textureHandle, Vector2ui{});
+    CORRADE_COMPARE(b.textureHandle, Vector2ui{});
 
     constexpr FlatMaterialUniform ca;
     constexpr FlatMaterialUniform cb{DefaultInit};
@@ -182,6 +184,8 @@ void FlatTest::materialUniformConstructDefault() {
     CORRADE_COMPARE(cb.color, 0xffffffff_rgbaf);
     CORRADE_COMPARE(ca.alphaMask, 0.5f);
     CORRADE_COMPARE(cb.alphaMask, 0.5f);
+    CORRADE_COMPARE(ca.textureHandle, Vector2ui{});
+    CORRADE_COMPARE(cb.textureHandle, Vector2ui{});
 
     CORRADE_VERIFY(std::is_nothrow_default_constructible<FlatDrawUniform>::value);
     CORRADE_VERIFY(std::is_nothrow_constructible<FlatDrawUniform, DefaultInitT>::value);
@@ -217,9 +221,11 @@ void FlatTest::materialUniformConstructNoInit() {
 void FlatTest::materialUniformSetters() {
     FlatMaterialUniform a;
     a.setColor(0x354565fc_rgbaf)
-     .setAlphaMask(0.7f);
+     .setAlphaMask(0.7f)
+     .setTextureHandle(0x1234567890abcdefull);
     CORRADE_COMPARE(a.color, 0x354565fc_rgbaf);
     CORRADE_COMPARE(a.alphaMask, 0.7f);
+    CORRADE_COMPARE(a.textureHandle, (Vector2ui{0x90abcdef, 0x12345678}));
 }
 
 }}}}
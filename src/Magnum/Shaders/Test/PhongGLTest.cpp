@@ -369,6 +369,12 @@ constexpr struct {
     {"shader storage + multidraw with all the things except instancing", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::AmbientTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::AlphaMask|PhongGL::Flag::ObjectId|PhongGL::Flag::LightCulling|PhongGL::Flag::DynamicPerVertexJointCount,
         0, 4, 0, 0, 0, 3, 4},
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures", PhongGL::Flag::UniformBuffers|PhongGL::Flag::AmbientTexture|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::BindlessTextures,
+        1, 1, 1, 1, 0, 0, 0},
+    {"multidraw with bindless texture arrays", PhongGL::Flag::MultiDraw|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::TextureTransformation|PhongGL::Flag::BindlessTextures,
+        8, 4, 16, 24, 0, 0, 0},
+    #endif
 };
 #endif
 
@@ -455,6 +461,16 @@ constexpr struct {
         PhongGL::Flag::UniformBuffers,
         1, 1, 0, 0, 3, 1, 1,
         "joint count can't be zero if per-vertex joint count is non-zero"},
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures but no UBOs",
+        PhongGL::Flag::BindlessTextures|PhongGL::Flag::DiffuseTexture,
+        1, 1, 0, 0, 0, 1, 1,
+        "bindless textures require uniform buffers and at least one texture enabled as well"},
+    {"bindless textures but not textured",
+        PhongGL::Flag::BindlessTextures|PhongGL::Flag::UniformBuffers,
+        1, 1, 0, 0, 0, 1, 1,
+        "bindless textures require uniform buffers and at least one texture enabled as well"},
+    #endif
 };
 #endif
 
@@ -575,6 +591,17 @@ const struct {
         PhongGL::Flag::DiffuseTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::TextureTransformation,
         Matrix3::translation(Vector2{1.0f})*Matrix3::scaling(Vector2{-1.0f}), 6},
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"all, bindless", "textured.tga",
+        PhongGL::Flag::AmbientTexture|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::BindlessTextures,
+        {}, 0},
+    {"specular, bindless", "textured-specular.tga",
+        PhongGL::Flag::SpecularTexture|PhongGL::Flag::BindlessTextures,
+        {}, 0},
+    {"all, bindless, array, arbitrary layer", "textured.tga",
+        PhongGL::Flag::AmbientTexture|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::BindlessTextures,
+        {}, 6},
+    #endif
 };
 
 /* MSVC 2015 doesn't like constexpr here due to the angles */
@@ -1200,6 +1227,21 @@ constexpr struct {
            while the 2D array has a black area around) */
         50.34f, 0.141f},
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"multidraw, bindless textured",
+        "multidraw-textured.tga", {},
+        PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::BindlessTextures,
+        4, 4, 2, 3, false, 1,
+        /* Minor differences on ARM Mali */
+        4.67f, 0.02f},
+    {"multidraw, bindless texture array",
+        "multidraw-textured.tga", {},
+        PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::BindlessTextures,
+        4, 4, 2, 3, false, 1,
+        /* Some difference at the UV edge (texture is wrapping in the 2D case
+           while the 2D array has a black area around) */
+        50.34f, 0.141f},
+    #endif
     /** @todo test normal and per-draw scaling when there's usable texture */
 };
 
@@ -1661,6 +1703,8 @@ void PhongGLTest::constructUniformBuffers() {
         CORRADE_SKIP(GL::Extensions::EXT::gpu_shader4::string() << "is not supported.");
     if((data.flags & PhongGL::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & PhongGL::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_WEBGL
@@ -2762,6 +2806,12 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
     #ifndef MAGNUM_TARGET_GLES
     if((data.flags & PhongGL::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if(data.flags & PhongGL::Flag::BindlessTextures) {
+        if(!(flag & PhongGL::Flag::UniformBuffers))
+            CORRADE_SKIP("Bindless textures require uniform buffers.");
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+            CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
+    }
     #endif
 
     #ifndef MAGNUM_TARGET_GLES2
@@ -2819,6 +2869,11 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
     Containers::Pointer<Trade::AbstractImporter> importer = _manager.loadAndInstantiate("AnyImageImporter");
     CORRADE_VERIFY(importer);
 
+    /* With bindless textures the handles are passed in a uniform buffer
+       instead of binding the textures */
+    #ifndef MAGNUM_TARGET_GLES
+    PhongTextureHandleUniform textureHandleUniformData[1];
+    #endif
     GL::Texture2D ambient{NoCreate};
     GL::Texture2D diffuse{NoCreate};
     GL::Texture2D specular{NoCreate};
@@ -2839,7 +2894,15 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, {image->size(), data.layer + 1})
                 .setSubImage(0, {0, 0, data.layer}, ImageView2D{*image});
-            shader.bindAmbientTexture(ambientArray);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                textureHandleUniformData->setAmbientTextureHandle(ambientArray.handle());
+                ambientArray.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindAmbientTexture(ambientArray);
+            }
         } else
         #endif
         {
@@ -2849,7 +2912,15 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, image->size())
                 .setSubImage(0, {}, *image);
-            shader.bindAmbientTexture(ambient);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                textureHandleUniformData->setAmbientTextureHandle(ambient.handle());
+                ambient.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindAmbientTexture(ambient);
+            }
         }
     }
 
@@ -2867,7 +2938,15 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, {image->size(), data.layer + 1})
                 .setSubImage(0, {0, 0, data.layer}, ImageView2D{*image});
-            shader.bindDiffuseTexture(diffuseArray);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                textureHandleUniformData->setDiffuseTextureHandle(diffuseArray.handle());
+                diffuseArray.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindDiffuseTexture(diffuseArray);
+            }
         } else
         #endif
         {
@@ -2877,7 +2956,15 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, image->size())
                 .setSubImage(0, {}, *image);
-            shader.bindDiffuseTexture(diffuse);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                textureHandleUniformData->setDiffuseTextureHandle(diffuse.handle());
+                diffuse.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindDiffuseTexture(diffuse);
+            }
         }
     }
 
@@ -2893,7 +2980,15 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, {image->size(), data.layer + 1})
                 .setSubImage(0, {0, 0, data.layer}, ImageView2D{*image});
-            shader.bindSpecularTexture(specularArray);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                textureHandleUniformData->setSpecularTextureHandle(specularArray.handle());
+                specularArray.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindSpecularTexture(specularArray);
+            }
         } else
         #endif
         {
@@ -2903,7 +2998,15 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, image->size())
                 .setSubImage(0, {}, *image);
-            shader.bindSpecularTexture(specular);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                textureHandleUniformData->setSpecularTextureHandle(specular.handle());
+                specular.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindSpecularTexture(specular);
+            }
         }
     }
 
@@ -2987,6 +3090,14 @@ template<PhongGL::Flag flag> void PhongGLTest::renderTextured() {
             materialUniformData->setSpecularColor(0x99ff99_rgbf);
         GL::Buffer materialUniform{materialUniformData};
 
+        #ifndef MAGNUM_TARGET_GLES
+        GL::Buffer textureHandleUniform{NoCreate};
+        if(data.flags & PhongGL::Flag::BindlessTextures) {
+            textureHandleUniform = GL::Buffer{textureHandleUniformData};
+            shader.bindTextureHandleBuffer(textureHandleUniform);
+        }
+        #endif
+
         /* Also take into account the case when texture transform needs to be
            enabled for texture arrays, so not data.flags but flags */
         if(flags & PhongGL::Flag::TextureTransformation)
@@ -5333,6 +5444,8 @@ void PhongGLTest::renderMulti() {
         CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
     if((data.flags & PhongGL::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & PhongGL::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_GLES
@@ -5380,6 +5493,11 @@ void PhongGLTest::renderMulti() {
         .setMaterialCount(data.materialCount)
         .setDrawCount(data.drawCount)};
 
+    /* With bindless textures the handle is passed in a uniform buffer
+       instead of binding the texture */
+    #ifndef MAGNUM_TARGET_GLES
+    UnsignedLong diffuseHandle{};
+    #endif
     GL::Texture2D diffuse{NoCreate};
     GL::Texture2DArray diffuseArray{NoCreate};
     if(data.flags & PhongGL::Flag::DiffuseTexture) {
@@ -5428,7 +5546,15 @@ void PhongGLTest::renderMulti() {
                    per-instance offset is used together with the layer */
                 .setSubImage(0, {image->size().x()/2, 0, 1}, second)
                 .setSubImage(0, {0, 0, 2}, third);
-            shader.bindDiffuseTexture(diffuseArray);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                diffuseHandle = diffuseArray.handle();
+                diffuseArray.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindDiffuseTexture(diffuseArray);
+            }
 
         } else {
             diffuse = GL::Texture2D{};
@@ -5437,7 +5563,15 @@ void PhongGLTest::renderMulti() {
                 .setWrapping(GL::SamplerWrapping::ClampToEdge)
                 .setStorage(1, TextureFormatRGB, image->size())
                 .setSubImage(0, {}, *image);
-            shader.bindDiffuseTexture(diffuse);
+            #ifndef MAGNUM_TARGET_GLES
+            if(data.flags & PhongGL::Flag::BindlessTextures) {
+                diffuseHandle = diffuse.handle();
+                diffuse.makeHandleResident();
+            } else
+            #endif
+            {
+                shader.bindDiffuseTexture(diffuse);
+            }
         }
     }
 
@@ -5523,6 +5657,22 @@ void PhongGLTest::renderMulti() {
             0xffffff_rgbf : 0xffff00_rgbf);
     GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, materialData};
 
+    /* Texture handles are indexed with the material ID the same way as the
+       materials. Bindless is tested only with draw offset / multidraw, so
+       the whole buffer is bound at once. */
+    #ifndef MAGNUM_TARGET_GLES
+    GL::Buffer textureHandleUniform{NoCreate};
+    if(data.flags & PhongGL::Flag::BindlessTextures) {
+        textureHandleUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            PhongTextureHandleUniform{}
+                .setDiffuseTextureHandle(diffuseHandle),
+            PhongTextureHandleUniform{}
+                .setDiffuseTextureHandle(diffuseHandle)
+        }};
+        shader.bindTextureHandleBuffer(textureHandleUniform);
+    }
+    #endif
+
     /* The shader has two lights hardcoded, so make sure the buffer can fit
        2 items enough even though the last draw needs just one light. Not a
        problem on desktop, but WebGL complains. */
@@ -46,6 +46,10 @@ struct PhongTest: TestSuite::Tester {
     void materialUniformConstructNoInit();
     void materialUniformSetters();
 
+    void textureHandleUniformConstructDefault();
+    void textureHandleUniformConstructNoInit();
+    void textureHandleUniformSetters();
+
     void lightUniformConstructDefault();
     void lightUniformConstructNoInit();
     void lightUniformSetters();
@@ -55,6 +59,7 @@ PhongTest::PhongTest() {
     addTests({&PhongTest::uniformSizeAlignment<PhongDrawUniform>,
               &PhongTest::uniformSizeAlignment<PhongMaterialUniform>,
               &PhongTest::uniformSizeAlignment<PhongLightUniform>,
+              &PhongTest::uniformSizeAlignment<PhongTextureHandleUniform>,
 
               &PhongTest::drawUniformConstructDefault,
               &PhongTest::drawUniformConstructNoInit,
@@ -65,6 +70,10 @@ PhongTest::PhongTest() {
               &PhongTest::materialUniformConstructNoInit,
               &PhongTest::materialUniformSetters,
 
+              &PhongTest::textureHandleUniformConstructDefault,
+              &PhongTest::textureHandleUniformConstructNoInit,
+              &PhongTest::textureHandleUniformSetters,
+
               &PhongTest::lightUniformConstructDefault,
               &PhongTest::lightUniformConstructNoInit,
               &PhongTest::lightUniformSetters});
@@ -82,6 +91,9 @@ template<> struct UniformTraits<PhongMaterialUniform> {
 template<> struct UniformTraits<PhongLightUniform> {
     static const char* name() { return "PhongLightUniform"; }
 };
+template<> struct UniformTraits<PhongTextureHandleUniform> {
+    static const char* name() { return "PhongTextureHandleUniform"; }
+};
 
 template<class T> void PhongTest::uniformSizeAlignment() {
     setTestCaseTemplateName(UniformTraits<T>::name());
@@ -306,6 +318,66 @@ void PhongTest::materialUniformSetters() {
     CORRADE_COMPARE(a.alphaMask, 2.5f);
 }
 
+void PhongTest::textureHandleUniformConstructDefault() {
+    PhongTextureHandleUniform a;
+    PhongTextureHandleUniform b{DefaultInit};
+    CORRADE_COMPARE(a.ambientTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(b.ambientTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(a.diffuseTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(b.diffuseTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(a.specularTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(b.specularTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(a.normalTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(b.normalTextureHandle, Vector2ui{});
+
+    constexpr PhongTextureHandleUniform ca;
+    constexpr PhongTextureHandleUniform cb{DefaultInit};
+    CORRADE_COMPARE(ca.ambientTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(cb.ambientTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(ca.normalTextureHandle, Vector2ui{});
+    CORRADE_COMPARE(cb.normalTextureHandle, Vector2ui{});
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<PhongTextureHandleUniform>::value);
+    CORRADE_VERIFY(std::is_nothrow_constructible<PhongTextureHandleUniform, DefaultInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<DefaultInitT, PhongTextureHandleUniform>::value);
+}
+
+void PhongTest::textureHandleUniformConstructNoInit() {
+    /* Testing only some fields, should be enough */
+    PhongTextureHandleUniform a;
+    a.diffuseTextureHandle = {0x12345678, 0x9abcdef0};
+
+    new(&a) PhongTextureHandleUniform{NoInit};
+    {
+        /* Explicitly check we're not on Clang because certain Clang-based IDEs
+           inherit __GNUC__ if GCC is used instead of leaving it at 4 like
+           Clang itself does */
+        #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__*100 + __GNUC_MINOR__ >= 601 && __OPTIMIZE__
+        CORRADE_EXPECT_FAIL("GCC 6.1+ misoptimizes and overwrites the value.");
+        #endif
+        CORRADE_COMPARE(a.diffuseTextureHandle, (Vector2ui{0x12345678, 0x9abcdef0}));
+    }
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<PhongTextureHandleUniform, NoInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoInitT, PhongTextureHandleUniform>::value);
+}
+
+void PhongTest::textureHandleUniformSetters() {
+    PhongTextureHandleUniform a;
+    a.setAmbientTextureHandle(0x1234567890abcdefull)
+     .setDiffuseTextureHandle(0xfedcba0987654321ull)
+     .setSpecularTextureHandle(0x00000000ffffffffull)
+     .setNormalTextureHandle(0xffffffff00000000ull);
+    CORRADE_COMPARE(a.ambientTextureHandle, (Vector2ui{0x90abcdef, 0x12345678}));
+    CORRADE_COMPARE(a.diffuseTextureHandle, (Vector2ui{0x87654321, 0xfedcba09}));
+    CORRADE_COMPARE(a.specularTextureHandle, (Vector2ui{0xffffffff, 0x00000000}));
+    CORRADE_COMPARE(a.normalTextureHandle, (Vector2ui{0x00000000, 0xffffffff}));
+}
+
 void PhongTest::lightUniformConstructDefault() {
     PhongLightUniform a;
     PhongLightUniform b{DefaultInit};
@@ -26,6 +26,7 @@
 
 #include "AbstractImporter.h"
 
+#include <atomic>
 #include <string> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
@@ -34,9 +35,11 @@
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/PluginManager/Manager.hpp>
 #include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/FileCallback.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
@@ -81,6 +84,87 @@ namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
+namespace {
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+/* Set for the duration of a batch item import on importBatch() worker
+   threads, queried through AbstractImporter::isConcurrentBatchWorker() */
+CORRADE_THREAD_LOCAL bool concurrentBatchWorker = false;
+#endif
+
+/* Calls `function(i)` for all i in [0, count), on up to `threadCount` threads
+   if `concurrent` is set and serially otherwise. Unlike other parallel
+   algorithms the range isn't split into equally sized chunks upfront, as the
+   time to import a single item can vary wildly --- instead each thread picks
+   the next unprocessed item once it's done with the previous one.
+
+   Debug, Warning and Error output from the worker threads is captured per
+   item and printed on the calling thread once everything is done, in item
+   order. That way the messages end up in whatever the calling thread has the
+   output redirected to, without multiple threads writing into the same
+   stream at once, and their order doesn't depend on the scheduling. The
+   redirection is thread-local only if Corrade is built with
+   CORRADE_BUILD_MULTITHREADED, otherwise the workers would overwrite each
+   other's redirections and so the import is always serial in that case. */
+template<class F> void importBatch(const bool concurrent, const UnsignedInt threadCount, const std::size_t count, F&& function) {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    const std::size_t workerCount = concurrent ? Math::min(std::size_t(Magnum::Implementation::parallelForThreadCount(threadCount)), count) : 1;
+    #else
+    static_cast<void>(concurrent);
+    static_cast<void>(threadCount);
+    const std::size_t workerCount = 1;
+    #endif
+    if(workerCount <= 1) {
+        for(std::size_t i = 0; i != count; ++i) function(i);
+        return;
+    }
+
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    struct Messages {
+        Containers::String debug, warning, error;
+    };
+    Containers::Array<Messages> messages{count};
+    std::atomic<std::size_t> next{0};
+    Magnum::Implementation::parallelFor(workerCount, workerCount, [&](std::size_t, std::size_t, std::size_t) {
+        /* The first chunk is executed on the calling thread, so the flag has
+           to be reset again at the end */
+        concurrentBatchWorker = true;
+        for(std::size_t i; (i = next++) < count; ) {
+            Debug redirectDebug{&messages[i].debug};
+            Warning redirectWarning{&messages[i].warning};
+            Error redirectError{&messages[i].error};
+            function(i);
+        }
+        concurrentBatchWorker = false;
+    });
+
+    for(const Messages& i: messages) {
+        if(!i.debug.isEmpty())
+            Debug{Debug::Flag::NoNewlineAtTheEnd} << i.debug;
+        if(!i.warning.isEmpty())
+            Warning{Debug::Flag::NoNewlineAtTheEnd} << i.warning;
+        if(!i.error.isEmpty())
+            Error{Debug::Flag::NoNewlineAtTheEnd} << i.error;
+    }
+    #endif
+}
+
+#ifndef CORRADE_NO_ASSERT
+/* Importer implementations are allowed to return arrays only with the default
+   or the non-owning deleter, and data arrays where it's documented additionally
+   with the ArrayAllocator deleter. Any other deleter could be a function pointer into
+   the plugin binary, which would dangle once the plugin is unloaded. */
+template<class T> bool isDeleterAllowed(const Containers::Array<T>& array) {
+    return !array.deleter() || array.deleter() == static_cast<void(*)(T*, std::size_t)>(Implementation::nonOwnedArrayDeleter);
+}
+
+bool isDataDeleterAllowed(const Containers::Array<char>& array) {
+    return isDeleterAllowed(array) || array.deleter() == ArrayAllocator<char>::deleter;
+}
+#endif
+
+}
+
 Containers::StringView AbstractImporter::pluginInterface() {
     return MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE ""_s;
 }
@@ -108,17 +192,23 @@ Containers::Array<Containers::String> AbstractImporter::pluginSearchPaths() {
 }
 #endif
 
+struct AbstractImporter::MappedFile {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Utility::Path::MapDeleter> data;
+    #endif
+};
+
 AbstractImporter::AbstractImporter() = default;
 
 AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& manager): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager} {}
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager, plugin} {}
 
-#ifdef MAGNUM_BUILD_DEPRECATED
-/* These twp needed because of the Array<CachedScenes> member */
+/* These two needed because of the Pointer<MappedFile> member and the
+   deprecated Pointer<CachedScenes> member. Destroying the MappedFile also
+   unmaps the file if it's still opened at that point. */
 AbstractImporter::AbstractImporter(AbstractImporter&&) noexcept = default;
 AbstractImporter::~AbstractImporter() = default;
-#endif
 
 void AbstractImporter::setFlags(ImporterFlags flags) {
     CORRADE_ASSERT(!isOpened(),
@@ -264,6 +354,29 @@ void AbstractImporter::doOpenFile(const Containers::StringView filename) {
 
     /* Otherwise open the file directly */
     } else {
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        /* Map the file if requested. Empty files can't be mapped on all
+           platforms so those, together with any mapping failures, are read
+           below instead, which also prints an error if the reading fails as
+           well. */
+        if(_flags & ImporterFlag::MapFile) {
+            Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
+            {
+                Error silenceError{nullptr};
+                mapped = Utility::Path::mapRead(filename);
+            }
+            if(mapped && !mapped->isEmpty()) {
+                _mappedFile.reset(new MappedFile{*Utility::move(mapped)});
+                doOpenData(Containers::Array<char>{const_cast<char*>(_mappedFile->data.data()), _mappedFile->data.size(), Implementation::nonOwnedArrayDeleter}, DataFlag::ExternallyOwned);
+
+                /* If the opening failed, nothing references the memory
+                   anymore, so it can be unmapped right away */
+                if(!isOpened()) _mappedFile = nullptr;
+                return;
+            }
+        }
+        #endif
+
         Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
@@ -279,6 +392,10 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Unmap the file only after the implementation is closed, as it may
+       reference the memory until then */
+    _mappedFile = nullptr;
 }
 
 Int AbstractImporter::defaultScene() const {
@@ -352,8 +469,8 @@ Containers::Optional<SceneData> AbstractImporter::scene(const UnsignedInt id) {
     CORRADE_ASSERT(id < doSceneCount(), "Trade::AbstractImporter::scene(): index" << id << "out of range for" << doSceneCount() << "entries", {});
     Containers::Optional<SceneData> scene = doScene(id);
     CORRADE_ASSERT(!scene || (
-        (!scene->_data.deleter() || scene->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter)) &&
-        (!scene->_fields.deleter() || scene->_fields.deleter() == static_cast<void(*)(SceneFieldData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        isDeleterAllowed(scene->_data) &&
+        isDeleterAllowed(scene->_fields)),
         "Trade::AbstractImporter::scene(): implementation is not allowed to use a custom Array deleter", {});
     return scene;
 }
@@ -429,8 +546,8 @@ Containers::Optional<AnimationData> AbstractImporter::animation(const UnsignedIn
     /** @todo maybe this should also disallow custom interpolators? since thise
         would be dangling on plugin unload */
     CORRADE_ASSERT(!animation ||
-        ((!animation->_data.deleter() || animation->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || animation->_data.deleter() == ArrayAllocator<char>::deleter) &&
-        (!animation->_tracks.deleter() || animation->_tracks.deleter() == static_cast<void(*)(AnimationTrackData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        (isDataDeleterAllowed(animation->_data) &&
+        isDeleterAllowed(animation->_tracks)),
         "Trade::AbstractImporter::animation(): implementation is not allowed to use a custom Array deleter", {});
     return animation;
 }
@@ -1014,8 +1131,8 @@ Containers::Optional<SkinData2D> AbstractImporter::skin2D(const UnsignedInt id)
     CORRADE_ASSERT(id < doSkin2DCount(), "Trade::AbstractImporter::skin2D(): index" << id << "out of range for" << doSkin2DCount() << "entries", {});
     Containers::Optional<SkinData2D> skin = doSkin2D(id);
     CORRADE_ASSERT(!skin || (
-        (!skin->_jointData.deleter() || skin->_jointData.deleter() == static_cast<void(*)(UnsignedInt*, std::size_t)>(Implementation::nonOwnedArrayDeleter)) &&
-        (!skin->_inverseBindMatrixData.deleter() || skin->_inverseBindMatrixData.deleter() == static_cast<void(*)(Matrix3*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        isDeleterAllowed(skin->_jointData) &&
+        isDeleterAllowed(skin->_inverseBindMatrixData)),
         "Trade::AbstractImporter::skin2D(): implementation is not allowed to use a custom Array deleter", {});
     return skin;
 }
@@ -1067,8 +1184,8 @@ Containers::Optional<SkinData3D> AbstractImporter::skin3D(const UnsignedInt id)
     CORRADE_ASSERT(id < doSkin3DCount(), "Trade::AbstractImporter::skin3D(): index" << id << "out of range for" << doSkin3DCount() << "entries", {});
     Containers::Optional<SkinData3D> skin = doSkin3D(id);
     CORRADE_ASSERT(!skin || (
-        (!skin->_jointData.deleter() || skin->_jointData.deleter() == static_cast<void(*)(UnsignedInt*, std::size_t)>(Implementation::nonOwnedArrayDeleter)) &&
-        (!skin->_inverseBindMatrixData.deleter() || skin->_inverseBindMatrixData.deleter() == static_cast<void(*)(Matrix4*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        isDeleterAllowed(skin->_jointData) &&
+        isDeleterAllowed(skin->_inverseBindMatrixData)),
         "Trade::AbstractImporter::skin3D(): implementation is not allowed to use a custom Array deleter", {});
     return skin;
 }
@@ -1141,13 +1258,52 @@ Containers::Optional<MeshData> AbstractImporter::mesh(const UnsignedInt id, cons
     #endif
     Containers::Optional<MeshData> mesh = doMesh(id, level);
     CORRADE_ASSERT(!mesh || (
-        (!mesh->_indexData.deleter() || mesh->_indexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || mesh->_indexData.deleter() == ArrayAllocator<char>::deleter) &&
-        (!mesh->_vertexData.deleter() || mesh->_vertexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || mesh->_vertexData.deleter() == ArrayAllocator<char>::deleter) &&
-        (!mesh->_attributes.deleter() || mesh->_attributes.deleter() == static_cast<void(*)(MeshAttributeData*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        isDataDeleterAllowed(mesh->_indexData) &&
+        isDataDeleterAllowed(mesh->_vertexData) &&
+        isDeleterAllowed(mesh->_attributes)),
         "Trade::AbstractImporter::mesh(): implementation is not allowed to use a custom Array deleter", {});
     return mesh;
 }
 
+bool AbstractImporter::isConcurrentBatchWorker() {
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    return concurrentBatchWorker;
+    #else
+    return false;
+    #endif
+}
+
+bool AbstractImporter::isBatchConcurrent() const {
+    /* File callbacks aren't expected to be called from multiple threads at
+       once, so if the importer uses them, import serially */
+    const ImporterFeatures features = doFeatures();
+    return (features & ImporterFeature::ConcurrentDataAccess) && !(_fileCallback && (features & ImporterFeature::FileCallback));
+}
+
+Containers::Array<Containers::Optional<MeshData>> AbstractImporter::meshes(const Containers::ArrayView<const UnsignedInt> ids, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::meshes(): no file opened", {});
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedInt count = doMeshCount();
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        CORRADE_ASSERT(ids[i] < count, "Trade::AbstractImporter::meshes(): index" << ids[i] << "at position" << i << "out of range for" << count << "entries", {});
+    #endif
+
+    Containers::Array<Containers::Optional<MeshData>> out{ids.size()};
+    importBatch(isBatchConcurrent(), threadCount, ids.size(), [&](const std::size_t i) {
+        out[i] = doMesh(ids[i], 0);
+    });
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const Containers::Optional<MeshData>& mesh: out)
+        CORRADE_ASSERT(!mesh || (
+            isDataDeleterAllowed(mesh->_indexData) &&
+            isDataDeleterAllowed(mesh->_vertexData) &&
+            isDeleterAllowed(mesh->_attributes)),
+            "Trade::AbstractImporter::meshes(): implementation is not allowed to use a custom Array deleter", {});
+    #endif
+    return out;
+}
+
 Containers::Optional<MeshData> AbstractImporter::doMesh(UnsignedInt, UnsignedInt) {
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::mesh(): not implemented", {});
 }
@@ -1313,8 +1469,8 @@ AbstractImporter::material(const UnsignedInt id) {
 
     Containers::Optional<MaterialData> material = doMaterial(id);
     CORRADE_ASSERT(!material || (
-        (!material->_data.deleter() || material->_data.deleter() == static_cast<void(*)(MaterialAttributeData*, std::size_t)>(Implementation::nonOwnedArrayDeleter)) &&
-        (!material->_layerOffsets.deleter() || material->_layerOffsets.deleter() == static_cast<void(*)(UnsignedInt*, std::size_t)>(Implementation::nonOwnedArrayDeleter))),
+        isDeleterAllowed(material->_data) &&
+        isDeleterAllowed(material->_layerOffsets)),
         "Trade::AbstractImporter::material(): implementation is not allowed to use a custom Array deleter", {});
 
     /* GCC 4.8 and clang-cl needs an explicit conversion here */
@@ -1325,6 +1481,29 @@ AbstractImporter::material(const UnsignedInt id) {
     #endif
 }
 
+Containers::Array<Containers::Optional<MaterialData>> AbstractImporter::materials(const Containers::ArrayView<const UnsignedInt> ids, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::materials(): no file opened", {});
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedInt count = doMaterialCount();
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        CORRADE_ASSERT(ids[i] < count, "Trade::AbstractImporter::materials(): index" << ids[i] << "at position" << i << "out of range for" << count << "entries", {});
+    #endif
+
+    Containers::Array<Containers::Optional<MaterialData>> out{ids.size()};
+    importBatch(isBatchConcurrent(), threadCount, ids.size(), [&](const std::size_t i) {
+        out[i] = doMaterial(ids[i]);
+    });
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const Containers::Optional<MaterialData>& material: out)
+        CORRADE_ASSERT(!material || (
+            isDeleterAllowed(material->_data) &&
+            isDeleterAllowed(material->_layerOffsets)),
+            "Trade::AbstractImporter::materials(): implementation is not allowed to use a custom Array deleter", {});
+    #endif
+    return out;
+}
+
 Containers::Optional<MaterialData> AbstractImporter::doMaterial(UnsignedInt) {
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::material(): not implemented", {});
 }
@@ -1446,7 +1625,7 @@ Containers::Optional<ImageData1D> AbstractImporter::image1D(const UnsignedInt id
     }
     #endif
     Containers::Optional<ImageData1D> image = doImage1D(id, level);
-    CORRADE_ASSERT(!image || !image->_data.deleter() || image->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image1D(): implementation is not allowed to use a custom Array deleter", {});
+    CORRADE_ASSERT(!image || isDataDeleterAllowed(image->_data), "Trade::AbstractImporter::image1D(): implementation is not allowed to use a custom Array deleter", {});
     return image;
 }
 
@@ -1519,10 +1698,30 @@ Containers::Optional<ImageData2D> AbstractImporter::image2D(const UnsignedInt id
     }
     #endif
     Containers::Optional<ImageData2D> image = doImage2D(id, level);
-    CORRADE_ASSERT(!image || !image->_data.deleter() || image->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image2D(): implementation is not allowed to use a custom Array deleter", {});
+    CORRADE_ASSERT(!image || isDataDeleterAllowed(image->_data), "Trade::AbstractImporter::image2D(): implementation is not allowed to use a custom Array deleter", {});
     return image;
 }
 
+Containers::Array<Containers::Optional<ImageData2D>> AbstractImporter::images2D(const Containers::ArrayView<const UnsignedInt> ids, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::images2D(): no file opened", {});
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedInt count = doImage2DCount();
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        CORRADE_ASSERT(ids[i] < count, "Trade::AbstractImporter::images2D(): index" << ids[i] << "at position" << i << "out of range for" << count << "entries", {});
+    #endif
+
+    Containers::Array<Containers::Optional<ImageData2D>> out{ids.size()};
+    importBatch(isBatchConcurrent(), threadCount, ids.size(), [&](const std::size_t i) {
+        out[i] = doImage2D(ids[i], 0);
+    });
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const Containers::Optional<ImageData2D>& image: out)
+        CORRADE_ASSERT(!image || isDataDeleterAllowed(image->_data), "Trade::AbstractImporter::images2D(): implementation is not allowed to use a custom Array deleter", {});
+    #endif
+    return out;
+}
+
 Containers::Optional<ImageData2D> AbstractImporter::doImage2D(UnsignedInt, UnsignedInt) {
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractImporter::image2D(): not implemented", {});
 }
@@ -1592,7 +1791,7 @@ Containers::Optional<ImageData3D> AbstractImporter::image3D(const UnsignedInt id
     }
     #endif
     Containers::Optional<ImageData3D> image = doImage3D(id, level);
-    CORRADE_ASSERT(!image || !image->_data.deleter() || image->_data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image->_data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image3D(): implementation is not allowed to use a custom Array deleter", {});
+    CORRADE_ASSERT(!image || isDataDeleterAllowed(image->_data), "Trade::AbstractImporter::image3D(): implementation is not allowed to use a custom Array deleter", {});
     return image;
 }
 
@@ -1630,6 +1829,7 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         _c(OpenData)
         _c(OpenState)
         _c(FileCallback)
+        _c(ConcurrentDataAccess)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1641,7 +1841,8 @@ Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "Trade::ImporterFeatures{}", {
         ImporterFeature::OpenData,
         ImporterFeature::OpenState,
-        ImporterFeature::FileCallback});
+        ImporterFeature::FileCallback,
+        ImporterFeature::ConcurrentDataAccess});
 }
 
 Debug& operator<<(Debug& debug, const ImporterFlag value) {
@@ -1652,6 +1853,7 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
         #define _c(v) case ImporterFlag::v: return debug << "::" #v;
         _c(Quiet)
         _c(Verbose)
+        _c(MapFile)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1662,7 +1864,8 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
 Debug& operator<<(Debug& debug, const ImporterFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::ImporterFlags{}", {
         ImporterFlag::Quiet,
-        ImporterFlag::Verbose});
+        ImporterFlag::Verbose,
+        ImporterFlag::MapFile});
 }
 
 }}
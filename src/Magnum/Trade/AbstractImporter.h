@@ -31,6 +31,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 #include <Corrade/Utility/StlForwardString.h> /** @todo remove once file callbacks are std::string-free */
 
@@ -71,7 +72,19 @@ enum class ImporterFeature: UnsignedByte {
      * See @ref Trade-AbstractImporter-usage-callbacks and particular importer
      * documentation for more information.
      */
-    FileCallback = 1 << 2
+    FileCallback = 1 << 2,
+
+    /**
+     * Importing different data concurrently from multiple threads. If the
+     * importer exposes this feature, @ref AbstractImporter::meshes(),
+     * @relativeref{AbstractImporter,images2D()} and
+     * @relativeref{AbstractImporter,materials()} import the data on
+     * multiple threads, otherwise they're imported serially. See
+     * @ref Trade-AbstractImporter-usage-batch and
+     * @ref Trade-AbstractImporter-subclassing for more information.
+     * @m_since_latest
+     */
+    ConcurrentDataAccess = 1 << 3
 };
 
 /**
@@ -116,6 +129,31 @@ enum class ImporterFlag: UnsignedByte {
      */
     Verbose = 1 << 0,
 
+    /**
+     * Memory-map files opened with @ref AbstractImporter::openFile() instead
+     * of reading them into memory. Applies only to importers that support
+     * @ref ImporterFeature::OpenData and delegate file opening to the base
+     * @ref AbstractImporter::doOpenFile() implementation, and only if no
+     * file callback is set. The mapped memory is then passed to
+     * @ref AbstractImporter::doOpenData() with @ref DataFlag::ExternallyOwned
+     * and kept alive until the file is closed, which allows importers that
+     * reference the input data in the returned @ref MeshData or
+     * @ref ImageData instances to avoid copying them. If the file can't be
+     * mapped, for example because it's empty, it's read into memory as
+     * usual. Available only on platforms that support memory mapping,
+     * ignored elsewhere.
+     *
+     * Note that with this flag, the data returned from the importer may
+     * reference the mapped file and thus become dangling once the file is
+     * closed, unlike the usual
+     * @ref Trade-AbstractImporter-data-dependency "data dependency"
+     * guarantees. Use @ref MeshData::vertexDataFlags(),
+     * @ref ImageData::dataFlags() and related queries to check whether given
+     * instance owns its data.
+     * @m_since_latest
+     */
+    MapFile = 1 << 2,
+
     /** @todo is warning as error (like in ShaderConverter) usable for anything
         here? in case of a compiler it makes sense, in case of an importer not
         so much probably? it'd also mean expanding each and every Warning
@@ -324,6 +362,28 @@ name doesn't exist.
 -   Texture names using @ref textureName() & @ref textureForName(), imported
     with @ref texture(Containers::StringView)
 
+@subsection Trade-AbstractImporter-usage-batch Importing multiple data at once
+
+Meshes, 2D images and materials can be also imported in batches using
+@ref meshes(), @ref images2D() and @ref materials(). If the importer
+advertises @ref ImporterFeature::ConcurrentDataAccess, the data get decoded on
+multiple threads, which can give a significant speedup for example for scenes
+with many compressed textures. Otherwise the batch functions import the data
+serially on the calling thread, so they can be used unconditionally:
+
+@snippet Trade.cpp AbstractImporter-usage-batch
+
+Messages printed by the importer on the worker threads are captured and printed
+on the calling thread once the whole batch is imported, ordered by the
+position in the ID list. They thus respect @relativeref{Magnum,Debug},
+@relativeref{Magnum,Warning} and @relativeref{Magnum,Error} redirection done
+on the calling thread. If a file
+callback is set and the importer supports @ref ImporterFeature::FileCallback,
+the import is always done serially, as the callback isn't expected to be
+called from multiple threads at once. The import is serial also if Corrade
+isn't built with @ref CORRADE_BUILD_MULTITHREADED, as the output redirection
+isn't thread-local in that case.
+
 @subsection Trade-AbstractImporter-usage-state Internal importer state
 
 Some importers, especially ones that make use of well-known external libraries,
@@ -419,6 +479,18 @@ checked by the implementation:
     implementations are called only if it is from valid range. Level zero is
     always expected to be present and thus no check is done in that case.
 
+If the importer exposes @ref ImporterFeature::ConcurrentDataAccess,
+@ref doMesh(), @ref doImage2D() and @ref doMaterial() can be called from
+multiple threads at the same time, for different IDs, while a file is opened.
+The implementations thus shouldn't modify any importer state without
+synchronization. No other `do*()` functions are called while a batch import
+is in progress. File callbacks are never used from multiple threads at once,
+if a callback is set and the importer supports
+@ref ImporterFeature::FileCallback, the base implementation imports the data
+serially. If an implementation itself parallelizes import of a single item,
+it should check @ref isConcurrentBatchWorker() and import the item on a
+single thread if it's already called from a concurrent batch.
+
 @m_class{m-block m-warning}
 
 @par Dangling function pointers on plugin unload
@@ -492,10 +564,12 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
            header. */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
-        #if defined(MAGNUM_BUILD_DEPRECATED) && !defined(DOXYGEN_GENERATING_OUTPUT)
-        /* These twp needed because of the Array<CachedScenes> member
-           (AnyImageImporter relies on the move), move assignment disabled by
-           AbstractPlugin already */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* These two needed because of the Pointer<MappedFile> member and,
+           with MAGNUM_BUILD_DEPRECATED, the Pointer<CachedScenes> member, which
+           are both of types defined only in the source file (AnyImageImporter
+           relies on the move). Move assignment disabled by AbstractPlugin
+           already. */
         AbstractImporter(AbstractImporter&&) noexcept;
         ~AbstractImporter();
         #endif
@@ -708,7 +782,9 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * @ref setFileCallback() and @ref ImporterFeature::OpenData is
          * supported, this function uses the callback to load the file and
          * passes the memory view to @ref openData() instead. See
-         * @ref setFileCallback() for more information.
+         * @ref setFileCallback() for more information. If
+         * @ref ImporterFlag::MapFile is set, the file may be memory-mapped
+         * instead of read, see the flag documentation for details.
          * @see @ref features(), @ref openData(), @ref openMemory(),
          *      @ref openState()
          */
@@ -1349,6 +1425,25 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<MeshData> mesh(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Import multiple meshes
+         * @param ids           Mesh IDs, each from range
+         *      [0, @ref meshCount())
+         * @param threadCount   Count of threads to use
+         * @m_since_latest
+         *
+         * Returns a list of the same size as @p ids, with each item being
+         * the same as if @ref mesh(UnsignedInt, UnsignedInt) was called for
+         * the corresponding ID and level @cpp 0 @ce, including a
+         * @relativeref{Corrade,Containers::NullOpt} on failure. If the
+         * importer supports @ref ImporterFeature::ConcurrentDataAccess, the
+         * meshes are imported on up to @p threadCount threads, otherwise
+         * they're imported serially. If @p threadCount is @cpp 0 @ce, all
+         * hardware threads are used. Expects that a file is opened. See
+         * @ref Trade-AbstractImporter-usage-batch for more information.
+         */
+        Containers::Array<Containers::Optional<MeshData>> meshes(Containers::ArrayView<const UnsignedInt> ids, UnsignedInt threadCount);
+
         /**
          * @brief Mesh attribute for given name
          * @m_since{2020,06}
@@ -1520,6 +1615,22 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         #endif
         material(Containers::StringView name);
 
+        /**
+         * @brief Import multiple materials
+         * @param ids           Material IDs, each from range
+         *      [0, @ref materialCount())
+         * @param threadCount   Count of threads to use
+         * @m_since_latest
+         *
+         * Returns a list of the same size as @p ids, with each item being
+         * the same as if @ref material(UnsignedInt) was called for the
+         * corresponding ID, including a
+         * @relativeref{Corrade,Containers::NullOpt} on failure. Threading
+         * behavior is the same as with @ref meshes(). Expects that a file is
+         * opened.
+         */
+        Containers::Array<Containers::Optional<MaterialData>> materials(Containers::ArrayView<const UnsignedInt> ids, UnsignedInt threadCount);
+
         /**
          * @brief Texture count
          *
@@ -1699,6 +1810,22 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData2D> image2D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Import multiple two-dimensional images
+         * @param ids           Image IDs, each from range
+         *      [0, @ref image2DCount())
+         * @param threadCount   Count of threads to use
+         * @m_since_latest
+         *
+         * Returns a list of the same size as @p ids, with each item being
+         * the same as if @ref image2D(UnsignedInt, UnsignedInt) was called
+         * for the corresponding ID and level @cpp 0 @ce, including a
+         * @relativeref{Corrade,Containers::NullOpt} on failure. Threading
+         * behavior is the same as with @ref meshes(). Expects that a file is
+         * opened.
+         */
+        Containers::Array<Containers::Optional<ImageData2D>> images2D(Containers::ArrayView<const UnsignedInt> ids, UnsignedInt threadCount);
+
         /**
          * @brief Three-dimensional image count
          *
@@ -1799,7 +1926,10 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          * contents. It is allowed to call this function from your
          * @ref doOpenFile() implementation --- in particular, this
          * implementation will also correctly handle callbacks set through
-         * @ref setFileCallback().
+         * @ref setFileCallback(). If @ref ImporterFlag::MapFile is set and
+         * no callbacks are set, the file is memory-mapped and passed to
+         * @ref doOpenData() with @ref DataFlag::ExternallyOwned, with the
+         * mapping kept alive until @ref doClose() is called.
          *
          * This function is not called when file callbacks are set through
          * @ref setFileCallback() and @ref ImporterFeature::FileCallback is not
@@ -1808,6 +1938,23 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         virtual void doOpenFile(Containers::StringView filename);
 
+        /**
+         * @brief Whether called on a worker thread of a concurrent batch import
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if called from a @ref doMesh(),
+         * @ref doImage2D() or @ref doMaterial() implementation that's
+         * executed on a worker thread of a @ref meshes(), @ref images2D() or
+         * @ref materials() batch import spread over multiple threads,
+         * @cpp false @ce otherwise. As the batch already occupies all
+         * threads it was given, implementations that parallelize import of
+         * a single item can use this to import it on just the calling thread
+         * instead of oversubscribing the CPU. Always returns @cpp false @ce
+         * if Corrade isn't built with @ref CORRADE_BUILD_MULTITHREADED, as
+         * the batch import is serial in that case.
+         */
+        static bool isConcurrentBatchWorker();
+
     private:
         /** @brief Implementation for @ref features() */
         virtual ImporterFeatures doFeatures() const = 0;
@@ -2609,8 +2756,16 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref importerState() */
         virtual const void* doImporterState() const;
 
+        /* Whether meshes(), images2D() and materials() can run concurrently */
+        MAGNUM_TRADE_LOCAL bool isBatchConcurrent() const;
+
         ImporterFlags _flags;
 
+        /* Used by doOpenFile() if ImporterFlag::MapFile is set, kept alive
+           until the file is closed */
+        struct MappedFile;
+        Containers::Pointer<MappedFile> _mappedFile;
+
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
 
@@ -2646,7 +2801,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractImporter/0.5.2"
+"cz.mosra.magnum.Trade.AbstractImporter/0.5.3"
 /* [interface] */
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
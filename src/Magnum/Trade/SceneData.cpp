@@ -787,7 +787,7 @@ Containers::Array<SceneFieldData> sceneFieldDataNonOwningArray(const Containers:
     return Containers::Array<SceneFieldData>{const_cast<SceneFieldData*>(view.data()), view.size(), Implementation::nonOwnedArrayDeleter};
 }
 
-SceneData::SceneData(const SceneMappingType mappingType, const UnsignedLong mappingBound, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* const importerState) noexcept: _dataFlags{DataFlag::Owned|DataFlag::Mutable}, _mappingType{mappingType}, _dimensions{}, _mappingBound{mappingBound}, _importerState{importerState}, _fields{Utility::move(fields)}, _data{Utility::move(data)} {
+SceneData::SceneData(const SceneMappingType mappingType, const UnsignedLong mappingBound, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* const importerState) noexcept: _dataFlags{DataFlag::Owned|DataFlag::Mutable}, _mappingType{mappingType}, _dimensions{}, _hasObjectIndex{}, _mappingBound{mappingBound}, _importerState{importerState}, _fields{Utility::move(fields)}, _data{Utility::move(data)} {
     /* Check that mapping type is large enough */
     CORRADE_ASSERT(
         (mappingType == SceneMappingType::UnsignedByte && mappingBound <= 0xffull) ||
@@ -1024,7 +1024,7 @@ SceneData::SceneData(const SceneMappingType mappingType, const UnsignedLong mapp
 SceneData::SceneData(const SceneMappingType mappingType, const UnsignedLong mappingBound, const DataFlags dataFlags, const Containers::ArrayView<const void> data, const std::initializer_list<SceneFieldData> fields, const void* const importerState): SceneData{mappingType, mappingBound, dataFlags, data, Implementation::initializerListToArrayWithDefaultDeleter(fields), importerState} {}
 
 #ifdef MAGNUM_BUILD_DEPRECATED
-SceneData::SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, const void* const importerState): _dataFlags{DataFlag::Owned|DataFlag::Mutable}, _mappingType {SceneMappingType::UnsignedInt}, _importerState{importerState} {
+SceneData::SceneData(std::vector<UnsignedInt> children2D, std::vector<UnsignedInt> children3D, const void* const importerState): _dataFlags{DataFlag::Owned|DataFlag::Mutable}, _mappingType {SceneMappingType::UnsignedInt}, _hasObjectIndex{}, _importerState{importerState} {
     /* Assume nobody ever created a scene with both 2D and 3D children.
        (PrimitiveImporter did, but that's an exception and blame goes on me.)
        If this blows up for you, please complain. Or rather upgrade to the new
@@ -1212,9 +1212,83 @@ template<class T> std::size_t findObject(const SceneFieldFlags flags, const Cont
     return max;
 }
 
+template<class T> void buildObjectIndexInto(const Containers::StridedArrayView1D<const void>& mapping, const Containers::ArrayView<UnsignedInt> first, const Containers::ArrayView<UnsignedInt> next) {
+    const Containers::StridedArrayView1D<const T> mappingT = Containers::arrayCast<const T>(mapping);
+
+    /* Going backwards so the first occurence ends up being the earliest one
+       and the next occurences are chained in an increasing order */
+    for(std::size_t i = mappingT.size(); i != 0; --i) {
+        const T object = mappingT[i - 1];
+        /* Objects out of bounds can't be queried, skip them */
+        if(object >= first.size()) continue;
+        next[i - 1] = first[object];
+        first[object] = i - 1;
+    }
+}
+
+}
+
+void SceneData::buildObjectIndex() {
+    /* Decide which fields to index and calculate the total index size.
+       Implicit mapping is a superset of ordered mapping, so this skips both. */
+    Containers::Array<std::size_t> objectIndexOffsets{NoInit, _fields.size()};
+    std::size_t objectIndexSize = 0;
+    for(std::size_t i = 0; i != _fields.size(); ++i) {
+        const SceneFieldData& field = _fields[i];
+        if(field._flags >= SceneFieldFlag::OrderedMapping) {
+            objectIndexOffsets[i] = ~std::size_t{};
+            continue;
+        }
+
+        CORRADE_ASSERT(field._size < 0xffffffffull,
+            "Trade::SceneData::buildObjectIndex(): expected" << field._name << "to have less than 4294967295 entries but got" << field._size, );
+        objectIndexOffsets[i] = objectIndexSize;
+        objectIndexSize += _mappingBound + field._size;
+    }
+
+    /* Fill the index */
+    Containers::Array<UnsignedInt> objectIndex{DirectInit, objectIndexSize, ~UnsignedInt{}};
+    for(std::size_t i = 0; i != _fields.size(); ++i) {
+        if(objectIndexOffsets[i] == ~std::size_t{}) continue;
+
+        const SceneFieldData& field = _fields[i];
+        const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field);
+        const Containers::ArrayView<UnsignedInt> first = objectIndex.sliceSize(objectIndexOffsets[i], _mappingBound);
+        const Containers::ArrayView<UnsignedInt> next = objectIndex.sliceSize(objectIndexOffsets[i] + _mappingBound, field._size);
+        const SceneMappingType mappingType = field.mappingType();
+        if(mappingType == SceneMappingType::UnsignedInt)
+            buildObjectIndexInto<UnsignedInt>(mapping, first, next);
+        else if(mappingType == SceneMappingType::UnsignedShort)
+            buildObjectIndexInto<UnsignedShort>(mapping, first, next);
+        else if(mappingType == SceneMappingType::UnsignedByte)
+            buildObjectIndexInto<UnsignedByte>(mapping, first, next);
+        else if(mappingType == SceneMappingType::UnsignedLong)
+            buildObjectIndexInto<UnsignedLong>(mapping, first, next);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    _objectIndexOffsets = Utility::move(objectIndexOffsets);
+    _objectIndex = Utility::move(objectIndex);
+    _hasObjectIndex = true;
 }
 
 std::size_t SceneData::findFieldObjectOffsetInternal(const SceneFieldData& field, const UnsignedLong object, const std::size_t offset) const {
+    /* If there's an index for the field, use it. All callers pass a reference
+       to an item in _fields, so the ID can be calculated from it. */
+    if(_hasObjectIndex) {
+        const std::size_t objectIndexOffset = _objectIndexOffsets[&field - _fields.data()];
+        if(objectIndexOffset != ~std::size_t{}) {
+            if(object >= _mappingBound) return field._size;
+
+            /* Walk the chain of occurences until reaching the offset */
+            const UnsignedInt* const next = _objectIndex.data() + objectIndexOffset + _mappingBound;
+            UnsignedInt found = _objectIndex[objectIndexOffset + object];
+            while(found != ~UnsignedInt{} && found < offset)
+                found = next[found];
+            return found == ~UnsignedInt{} ? field._size : found;
+        }
+    }
+
     const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field, offset, field._size - offset);
     const SceneMappingType mappingType = field.mappingType();
     if(mappingType == SceneMappingType::UnsignedInt)
@@ -2907,12 +2981,18 @@ std::vector<UnsignedInt> SceneData::children3D() const {
 Containers::Array<SceneFieldData> SceneData::releaseFieldData() {
     Containers::Array<SceneFieldData> out = Utility::move(_fields);
     _fields = {};
+    _objectIndexOffsets = {};
+    _objectIndex = {};
+    _hasObjectIndex = false;
     return out;
 }
 
 Containers::Array<char> SceneData::releaseData() {
     Containers::Array<char> out = Utility::move(_data);
     _data = {};
+    _objectIndexOffsets = {};
+    _objectIndex = {};
+    _hasObjectIndex = false;
     return out;
 }
 
@@ -2248,7 +2248,11 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * done in an @f$ \mathcal{O}(1) @f$ complexity. Otherwise, if the
          * field has @ref SceneFieldFlag::OrderedMapping, the lookup is done in
          * an @f$ \mathcal{O}(\log{} n) @f$ complexity with @f$ n @f$ being the
-         * size of the field. Otherwise, the lookup is done in an
+         * size of the field. Otherwise, if @ref buildObjectIndex() was called,
+         * the lookup is done in an @f$ \mathcal{O}(1) @f$ complexity for
+         * @p offset being @cpp 0 @ce and in an @f$ \mathcal{O}(k) @f$
+         * complexity with @f$ k @f$ being the count of occurences of
+         * @p object before @p offset. Otherwise, the lookup is done in an
          * @f$ \mathcal{O}(n) @f$ complexity.
          *
          * You can also use @ref findFieldObjectOffset(SceneField, UnsignedLong, std::size_t) const
@@ -2273,8 +2277,13 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * the field count. Otherwise, if the field has
          * @ref SceneFieldFlag::OrderedMapping, the lookup is done in an
          * @f$ \mathcal{O}(m + \log{} n) @f$ complexity with @f$ m @f$ being
-         * the field count and @f$ n @f$ the size of the field. Otherwise, the
-         * lookup is done in an @f$ \mathcal{O}(m + n) @f$ complexity.
+         * the field count and @f$ n @f$ the size of the field. Otherwise, if
+         * @ref buildObjectIndex() was called, the lookup is done in an
+         * @f$ \mathcal{O}(m) @f$ complexity for @p offset being @cpp 0 @ce
+         * and in an @f$ \mathcal{O}(m + k) @f$ complexity with @f$ k @f$
+         * being the count of occurences of @p object before @p offset.
+         * Otherwise, the lookup is done in an @f$ \mathcal{O}(m + n) @f$
+         * complexity.
          *
          * @see @ref hasField(), @ref hasFieldObject(SceneField, UnsignedLong) const,
          *      @ref fieldObjectOffset(SceneField, UnsignedLong, std::size_t) const
@@ -2326,6 +2335,46 @@ class MAGNUM_TRADE_EXPORT SceneData {
          */
         bool hasFieldObject(SceneField fieldName, UnsignedLong object) const;
 
+        /**
+         * @brief Build an object index for fields with unordered mapping
+         * @m_since_latest
+         *
+         * Fields that don't have @ref SceneFieldFlag::OrderedMapping or
+         * @ref SceneFieldFlag::ImplicitMapping set have to be searched
+         * linearly in order to find a particular object, which makes
+         * per-object queries such as @ref findFieldObjectOffset(),
+         * @ref parentFor(), @ref transformation3DFor() or
+         * @ref meshesMaterialsFor() have an @f$ \mathcal{O}(n) @f$
+         * complexity and processing of all objects in a large scene
+         * quadratic. This function builds a lookup table for all such fields,
+         * making the queries @f$ \mathcal{O}(1) @f$ without having to
+         * reorder the field data. Calling this function again rebuilds the
+         * index from scratch.
+         *
+         * The index takes @cpp 4*(b + n) @ce bytes for each unordered field,
+         * where @f$ b @f$ is @ref mappingBound() and @f$ n @f$ the size of the
+         * field. Object IDs in the mapping that are not smaller than
+         * @ref mappingBound() are ignored. Each unordered field is expected
+         * to have less than @cpp 4294967295 @ce entries.
+         *
+         * @attention The index isn't updated when the mapping data are
+         *      modified through @ref mutableMapping() or @ref mutableData().
+         *      Call this function again in that case, otherwise the queries
+         *      may return wrong results.
+         * @see @ref hasObjectIndex(), @ref SceneFieldData::flags()
+         */
+        void buildObjectIndex();
+
+        /**
+         * @brief Whether an object index is built
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if @ref buildObjectIndex() was called and
+         * neither @ref releaseFieldData() nor @ref releaseData() was called
+         * after, @cpp false @ce otherwise.
+         */
+        bool hasObjectIndex() const { return _hasObjectIndex; }
+
         /**
          * @brief Flags of a named field
          * @m_since_latest
@@ -3820,11 +3869,20 @@ class MAGNUM_TRADE_EXPORT SceneData {
         DataFlags _dataFlags;
         SceneMappingType _mappingType;
         UnsignedByte _dimensions;
-        /* 1/5 bytes free */
+        bool _hasObjectIndex;
+        /* 0/4 bytes free */
         UnsignedLong _mappingBound;
         const void* _importerState;
         Containers::Array<SceneFieldData> _fields;
         Containers::Array<char> _data;
+        /* Populated by buildObjectIndex(). For each field either
+           ~std::size_t{} if the field isn't indexed, or an offset into
+           _objectIndex where a first occurence of each object in the field
+           (mappingBound() items) is followed by a next occurence of the
+           object for each field entry (field size items). ~UnsignedInt{}
+           denotes no occurence. */
+        Containers::Array<std::size_t> _objectIndexOffsets;
+        Containers::Array<UnsignedInt> _objectIndex;
 };
 
 namespace Implementation {
@@ -24,7 +24,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
 #include <string> /** @todo remove once file callbacks are std::string-free */
+#include <thread>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
@@ -90,6 +92,8 @@ struct AbstractImporterTest: TestSuite::Tester {
     void openFileFailed();
     void openFileAsData();
     void openFileAsDataNotFound();
+    void openFileAsDataMapped();
+    void openFileAsDataMappedNotFound();
     void openState();
     void openStateFailed();
 
@@ -373,6 +377,11 @@ struct AbstractImporterTest: TestSuite::Tester {
     void image3DGrowableDeleter();
     void image3DCustomDeleter();
 
+    void batch();
+    void batchNoFile();
+    void batchOutOfRange();
+    void batchCustomDeleter();
+
     void importerState();
     void importerStateNotImplemented();
     void importerStateNoFile();
@@ -393,6 +402,21 @@ constexpr struct {
     {"verify the message", true}
 };
 
+const struct {
+    const char* name;
+    ImporterFeatures features;
+    bool fileCallback;
+    UnsignedInt threadCount;
+    bool expectSerial;
+} BatchData[]{
+    {"not concurrent", {}, false, 4, true},
+    {"concurrent, single thread", ImporterFeature::ConcurrentDataAccess, false, 1, true},
+    {"concurrent, four threads", ImporterFeature::ConcurrentDataAccess, false, 4, false},
+    {"concurrent, all threads", ImporterFeature::ConcurrentDataAccess, false, 0, false},
+    {"concurrent, file callback used only for opening", ImporterFeature::ConcurrentDataAccess|ImporterFeature::OpenData, true, 4, false},
+    {"concurrent, file callback", ImporterFeature::ConcurrentDataAccess|ImporterFeature::FileCallback, true, 4, true},
+};
+
 using namespace Math::Literals;
 
 AbstractImporterTest::AbstractImporterTest() {
@@ -414,6 +438,8 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::openFileFailed,
               &AbstractImporterTest::openFileAsData,
               &AbstractImporterTest::openFileAsDataNotFound,
+              &AbstractImporterTest::openFileAsDataMapped,
+              &AbstractImporterTest::openFileAsDataMappedNotFound,
               &AbstractImporterTest::openState,
               &AbstractImporterTest::openStateFailed,
 
@@ -704,7 +730,14 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::image3DLevelOutOfRange,
               &AbstractImporterTest::image3DNonOwningDeleter,
               &AbstractImporterTest::image3DGrowableDeleter,
-              &AbstractImporterTest::image3DCustomDeleter,
+              &AbstractImporterTest::image3DCustomDeleter});
+
+    addInstancedTests({&AbstractImporterTest::batch},
+        Containers::arraySize(BatchData));
+
+    addTests({&AbstractImporterTest::batchNoFile,
+              &AbstractImporterTest::batchOutOfRange,
+              &AbstractImporterTest::batchCustomDeleter,
 
               &AbstractImporterTest::importerState,
               &AbstractImporterTest::importerStateNotImplemented,
@@ -1017,6 +1050,71 @@ void AbstractImporterTest::openFileAsDataNotFound() {
         TestSuite::Compare::StringHasSuffix);
 }
 
+void AbstractImporterTest::openFileAsDataMapped() {
+    #if !defined(CORRADE_TARGET_UNIX) && (!defined(CORRADE_TARGET_WINDOWS) || defined(CORRADE_TARGET_WINDOWS_RT))
+    CORRADE_SKIP("Memory mapping is not available on this platform.");
+    #else
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override {
+            CORRADE_COMPARE_AS(data,
+                Containers::arrayView({'\xa5'}),
+                TestSuite::Compare::Container);
+            CORRADE_COMPARE(dataFlags, DataFlag::ExternallyOwned);
+            /* I.e., it's just a view on the mapped memory */
+            CORRADE_VERIFY(data.deleter());
+            _data = data;
+            _opened = true;
+        }
+
+        Containers::ArrayView<const char> _data;
+        bool _opened = false;
+    } importer;
+    importer.addFlags(ImporterFlag::MapFile);
+
+    CORRADE_VERIFY(!importer.isOpened());
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+
+    /* The mapping is kept alive while the file is opened */
+    CORRADE_COMPARE_AS(importer._data,
+        Containers::arrayView({'\xa5'}),
+        TestSuite::Compare::Container);
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+    #endif
+}
+
+void AbstractImporterTest::openFileAsDataMappedNotFound() {
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        void doOpenData(Containers::Array<char>&&, DataFlags) override {
+            _opened = true;
+        }
+
+        bool _opened = false;
+    } importer;
+    importer.addFlags(ImporterFlag::MapFile);
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!importer.openFile("nonexistent.bin"));
+    CORRADE_VERIFY(!importer.isOpened());
+    /* The mapping failure is silent, there's just an error message from
+       Path::read() before, same as without the flag */
+    CORRADE_COMPARE_AS(out,
+        "\nTrade::AbstractImporter::openFile(): cannot open file nonexistent.bin\n",
+        TestSuite::Compare::StringHasSuffix);
+}
+
 void AbstractImporterTest::openState() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override {
@@ -7736,6 +7834,219 @@ void AbstractImporterTest::image3DCustomDeleter() {
         "Trade::AbstractImporter::image3D(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    struct Importer: AbstractImporter {
+        explicit Importer(ImporterFeatures features): features{features} {}
+
+        ImporterFeatures doFeatures() const override { return features; }
+        bool doIsOpened() const override { return opened; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 7; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override {
+            CORRADE_INTERNAL_ASSERT(level == 0);
+            if(std::this_thread::get_id() != caller) ++otherThreadCalls;
+            if(isConcurrentBatchWorker()) ++batchWorkerCalls;
+            /* Odd IDs fail to verify the failures get propagated */
+            if(id % 2) {
+                Error{} << "mesh" << id << "failed";
+                return {};
+            }
+            return MeshData{MeshPrimitive::Points, id};
+        }
+
+        UnsignedInt doImage2DCount() const override { return 7; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+            CORRADE_INTERNAL_ASSERT(level == 0);
+            if(std::this_thread::get_id() != caller) ++otherThreadCalls;
+            if(isConcurrentBatchWorker()) ++batchWorkerCalls;
+            if(id % 2) {
+                Error{} << "image" << id << "failed";
+                return {};
+            }
+            return ImageData2D{PixelFormat::R8Unorm, {Int(id), 1}, Containers::Array<char>{ValueInit, id*4}};
+        }
+
+        UnsignedInt doMaterialCount() const override { return 7; }
+        Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override {
+            if(std::this_thread::get_id() != caller) ++otherThreadCalls;
+            if(isConcurrentBatchWorker()) ++batchWorkerCalls;
+            if(id % 2) {
+                Error{} << "material" << id << "failed";
+                return {};
+            }
+            return MaterialData{{}, {
+                {MaterialAttribute::Shininess, Float(id)}
+            }};
+        }
+
+        ImporterFeatures features;
+        bool opened = false;
+        std::thread::id caller = std::this_thread::get_id();
+        std::atomic<UnsignedInt> otherThreadCalls{0};
+        std::atomic<UnsignedInt> batchWorkerCalls{0};
+    } importer{data.features};
+
+    if(data.fileCallback)
+        importer.setFileCallback([](const std::string&, InputFileCallbackPolicy, void*) -> Containers::Optional<Containers::ArrayView<const char>> {
+            return {};
+        });
+    importer.opened = true;
+
+    const UnsignedInt ids[]{4, 0, 6, 1, 2, 2, 5};
+
+    Containers::String out;
+    Containers::Array<Containers::Optional<MeshData>> meshes;
+    Containers::Array<Containers::Optional<ImageData2D>> images;
+    Containers::Array<Containers::Optional<MaterialData>> materials;
+    {
+        Error redirectError{&out};
+        meshes = importer.meshes(ids, data.threadCount);
+        images = importer.images2D(ids, data.threadCount);
+        materials = importer.materials(ids, data.threadCount);
+    }
+
+    CORRADE_COMPARE(meshes.size(), Containers::arraySize(ids));
+    CORRADE_COMPARE(images.size(), Containers::arraySize(ids));
+    CORRADE_COMPARE(materials.size(), Containers::arraySize(ids));
+    for(std::size_t i = 0; i != Containers::arraySize(ids); ++i) {
+        CORRADE_ITERATION(i);
+        if(ids[i] % 2) {
+            CORRADE_VERIFY(!meshes[i]);
+            CORRADE_VERIFY(!images[i]);
+            CORRADE_VERIFY(!materials[i]);
+        } else {
+            CORRADE_VERIFY(meshes[i]);
+            CORRADE_COMPARE(meshes[i]->vertexCount(), ids[i]);
+            CORRADE_VERIFY(images[i]);
+            CORRADE_COMPARE(images[i]->size(), (Vector2i{Int(ids[i]), 1}));
+            CORRADE_VERIFY(materials[i]);
+            CORRADE_COMPARE(materials[i]->attribute<Float>(MaterialAttribute::Shininess), Float(ids[i]));
+        }
+    }
+
+    /* The messages from the failed imports are printed to the redirected
+       output even if done on other threads, in the order of the IDs */
+    CORRADE_COMPARE(out,
+        "mesh 1 failed\n"
+        "mesh 5 failed\n"
+        "image 1 failed\n"
+        "image 5 failed\n"
+        "material 1 failed\n"
+        "material 5 failed\n");
+
+    /* Implementations can query whether they're called from a batch worker
+       thread only if the batch is actually concurrent */
+    if(data.expectSerial) {
+        CORRADE_COMPARE(importer.otherThreadCalls, 0);
+        CORRADE_COMPARE(importer.batchWorkerCalls, 0);
+    } else {
+        /* Every item imported on another thread is imported by a batch
+           worker, the calling thread participates in the batch as well */
+        CORRADE_VERIFY(importer.batchWorkerCalls >= importer.otherThreadCalls);
+    }
+
+    /* The flag isn't left set on the calling thread after the batch is done,
+       even though it was importing some of the batch items */
+    const UnsignedInt batchWorkerCalls = importer.batchWorkerCalls;
+    CORRADE_VERIFY(importer.mesh(0));
+    CORRADE_VERIFY(importer.image2D(0));
+    CORRADE_VERIFY(importer.material(0));
+    CORRADE_COMPARE(importer.batchWorkerCalls, batchWorkerCalls);
+}
+
+void AbstractImporterTest::batchNoFile() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedInt ids[]{0};
+    importer.meshes(ids, 1);
+    importer.images2D(ids, 1);
+    importer.materials(ids, 1);
+    CORRADE_COMPARE(out,
+        "Trade::AbstractImporter::meshes(): no file opened\n"
+        "Trade::AbstractImporter::images2D(): no file opened\n"
+        "Trade::AbstractImporter::materials(): no file opened\n");
+}
+
+void AbstractImporterTest::batchOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ConcurrentDataAccess; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 8; }
+        UnsignedInt doImage2DCount() const override { return 3; }
+        UnsignedInt doMaterialCount() const override { return 5; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.meshes(Containers::arrayView<UnsignedInt>({0, 7, 8}), 4);
+    importer.images2D(Containers::arrayView<UnsignedInt>({3}), 4);
+    importer.materials(Containers::arrayView<UnsignedInt>({1, 5, 0}), 4);
+    CORRADE_COMPARE(out,
+        "Trade::AbstractImporter::meshes(): index 8 at position 2 out of range for 8 entries\n"
+        "Trade::AbstractImporter::images2D(): index 3 at position 0 out of range for 3 entries\n"
+        "Trade::AbstractImporter::materials(): index 5 at position 1 out of range for 5 entries\n");
+}
+
+void AbstractImporterTest::batchCustomDeleter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::ConcurrentDataAccess; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Triangles, Containers::Array<char>{data, 1, [](char*, std::size_t) {}}, MeshIndexData{MeshIndexType::UnsignedByte, data}, 1};
+        }
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{PixelFormat::RGBA8Unorm, {}, Containers::Array<char>{data, 1, [](char*, std::size_t) {}}};
+        }
+
+        UnsignedInt doMaterialCount() const override { return 1; }
+        Containers::Optional<MaterialData> doMaterial(UnsignedInt) override {
+            return MaterialData{{}, Containers::Array<MaterialAttributeData>{attributeData, 1, [](MaterialAttributeData*, std::size_t) {}}};
+        }
+
+        char data[1];
+        MaterialAttributeData attributeData[1]{
+            {MaterialAttribute::Shininess, 0.0f}
+        };
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    const UnsignedInt ids[]{0, 0};
+    importer.meshes(ids, 2);
+    importer.images2D(ids, 2);
+    importer.materials(ids, 2);
+    CORRADE_COMPARE(out,
+        "Trade::AbstractImporter::meshes(): implementation is not allowed to use a custom Array deleter\n"
+        "Trade::AbstractImporter::images2D(): implementation is not allowed to use a custom Array deleter\n"
+        "Trade::AbstractImporter::materials(): implementation is not allowed to use a custom Array deleter\n");
+}
+
 void AbstractImporterTest::importerState() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -7777,8 +8088,8 @@ void AbstractImporterTest::importerStateNoFile() {
 void AbstractImporterTest::debugFeature() {
     Containers::String out;
 
-    Debug{&out} << ImporterFeature::OpenData << ImporterFeature(0xf0);
-    CORRADE_COMPARE(out, "Trade::ImporterFeature::OpenData Trade::ImporterFeature(0xf0)\n");
+    Debug{&out} << ImporterFeature::OpenData << ImporterFeature::ConcurrentDataAccess << ImporterFeature(0xf0);
+    CORRADE_COMPARE(out, "Trade::ImporterFeature::OpenData Trade::ImporterFeature::ConcurrentDataAccess Trade::ImporterFeature(0xf0)\n");
 }
 
 void AbstractImporterTest::debugFeaturePacked() {
@@ -7805,8 +8116,8 @@ void AbstractImporterTest::debugFeaturesPacked() {
 void AbstractImporterTest::debugFlag() {
     Containers::String out;
 
-    Debug{&out} << ImporterFlag::Verbose << ImporterFlag(0xf0);
-    CORRADE_COMPARE(out, "Trade::ImporterFlag::Verbose Trade::ImporterFlag(0xf0)\n");
+    Debug{&out} << ImporterFlag::Verbose << ImporterFlag::MapFile << ImporterFlag(0xf0);
+    CORRADE_COMPARE(out, "Trade::ImporterFlag::Verbose Trade::ImporterFlag::MapFile Trade::ImporterFlag(0xf0)\n");
 }
 
 void AbstractImporterTest::debugFlags() {
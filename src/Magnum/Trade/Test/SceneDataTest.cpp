@@ -169,6 +169,9 @@ struct SceneDataTest: TestSuite::Tester {
     template<class T> void findFieldObjectOffset();
     void findFieldObjectOffsetInvalidOffset();
     void fieldObjectOffsetNotFound();
+    void objectIndex();
+    void objectIndexRebuild();
+    void objectIndexRelease();
 
     template<class T> void mappingAsArrayByIndex();
     template<class T> void mappingAsArrayByName();
@@ -535,6 +538,9 @@ SceneDataTest::SceneDataTest() {
 
     addTests({&SceneDataTest::findFieldObjectOffsetInvalidOffset,
               &SceneDataTest::fieldObjectOffsetNotFound,
+              &SceneDataTest::objectIndex,
+              &SceneDataTest::objectIndexRebuild,
+              &SceneDataTest::objectIndexRelease,
 
               &SceneDataTest::mappingAsArrayByIndex<UnsignedByte>,
               &SceneDataTest::mappingAsArrayByIndex<UnsignedShort>,
@@ -4309,6 +4315,22 @@ template<class T> void SceneDataTest::findFieldObjectOffset() {
         CORRADE_COMPARE(scene.fieldObjectOffset(1, data.object, data.offset), *data.expected);
         CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, data.object, data.offset), *data.expected);
     }
+
+    /* The results should be the same with an object index, which is used for
+       the unordered fields */
+    CORRADE_VERIFY(!scene.hasObjectIndex());
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(scene.hasObjectIndex());
+    {
+        CORRADE_ITERATION("object index");
+        if(data.offset == 0) {
+            CORRADE_COMPARE(scene.findFieldObjectOffset(0, data.object), Containers::NullOpt);
+            CORRADE_VERIFY(!scene.hasFieldObject(0, data.object));
+            CORRADE_COMPARE(scene.hasFieldObject(1, data.object), !!data.expected);
+        }
+        CORRADE_COMPARE(scene.findFieldObjectOffset(1, data.object, data.offset), data.expected);
+        CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, data.object, data.offset), data.expected);
+    }
 }
 
 void SceneDataTest::findFieldObjectOffsetInvalidOffset() {
@@ -4375,6 +4397,118 @@ void SceneDataTest::fieldObjectOffsetNotFound() {
         "Trade::SceneData::fieldObjectOffset(): object 1 not found in field Trade::SceneField::Mesh starting at offset 2\n");
 }
 
+void SceneDataTest::objectIndex() {
+    struct Field {
+        UnsignedShort object;
+        UnsignedInt mesh;
+        Int meshMaterial;
+        Int parent;
+    };
+    struct Data {
+        Field fields[6];
+        UnsignedShort orderedMapping[5];
+        Matrix4 transformations[5];
+    } data{{
+        {4, 1, -1, -1},
+        {2, 3, 0, -1},
+        {2, 4, 1, -1},
+        {9, 7, 0, -1}, /* out of bounds, should be ignored */
+        {0, 5, -1, 4},
+        {2, 1, 0, 4},
+    }, {1, 2, 3, 3, 5}, {}};
+    Containers::StridedArrayView1D<Field> view = data.fields;
+
+    SceneData scene{SceneMappingType::UnsignedShort, 7, {}, Containers::arrayView(&data, 1), {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)},
+        SceneFieldData{SceneField::MeshMaterial, view.slice(&Field::object), view.slice(&Field::meshMaterial)},
+        /* This one is ordered and thus isn't indexed, but should still work */
+        SceneFieldData{SceneField::Transformation, Containers::arrayView(data.orderedMapping), Containers::arrayView(data.transformations), SceneFieldFlag::OrderedMapping},
+        SceneFieldData{SceneField::Parent, view.slice(&Field::object), view.slice(&Field::parent)},
+    }};
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(scene.hasObjectIndex());
+
+    /* Walking through multiple occurences */
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2), 1);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 2), 2);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 3), 5);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 6), Containers::NullOpt);
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(2),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+            {3, 0}, {4, 1}, {1, 0}
+        })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(6),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({})),
+        TestSuite::Compare::Container);
+
+    /* Convenience accessors use the index as well */
+    CORRADE_COMPARE(scene.parentFor(0), 4);
+    CORRADE_COMPARE(scene.parentFor(4), -1);
+    CORRADE_COMPARE(scene.parentFor(6), Containers::NullOpt);
+
+    /* Ordered field isn't indexed */
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Transformation, 3), 2);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Transformation, 3, 3), 3);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Transformation, 4), Containers::NullOpt);
+}
+
+void SceneDataTest::objectIndexRebuild() {
+    struct Field {
+        UnsignedInt object;
+        UnsignedInt mesh;
+    } fields[]{
+        {4, 1},
+        {2, 3},
+        {1, 5}
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    SceneData scene{SceneMappingType::UnsignedInt, 7, DataFlag::Mutable, fields, {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)}
+    }};
+    scene.buildObjectIndex();
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2), 1);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 3), Containers::NullOpt);
+
+    /* The index doesn't know about the change until rebuilt */
+    scene.mutableMapping<UnsignedInt>(SceneField::Mesh)[1] = 3;
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 3), Containers::NullOpt);
+
+    scene.buildObjectIndex();
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2), Containers::NullOpt);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 3), 1);
+}
+
+void SceneDataTest::objectIndexRelease() {
+    struct Field {
+        UnsignedInt object;
+        UnsignedInt mesh;
+    } fields[]{
+        {4, 1},
+        {2, 3}
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    SceneData scene{SceneMappingType::UnsignedInt, 7, {}, fields, {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)}
+    }};
+    scene.buildObjectIndex();
+    CORRADE_VERIFY(scene.hasObjectIndex());
+
+    /* Moving the scene moves the index as well */
+    SceneData moved = Utility::move(scene);
+    CORRADE_VERIFY(moved.hasObjectIndex());
+    CORRADE_COMPARE(moved.findFieldObjectOffset(SceneField::Mesh, 2), 1);
+
+    moved.releaseFieldData();
+    CORRADE_VERIFY(!moved.hasObjectIndex());
+
+    moved.buildObjectIndex();
+    CORRADE_VERIFY(moved.hasObjectIndex());
+    moved.releaseData();
+    CORRADE_VERIFY(!moved.hasObjectIndex());
+}
+
 template<class T> void SceneDataTest::mappingAsArrayByIndex() {
     setTestCaseTemplateName(NameTraits<T>::name());
 
@@ -185,6 +185,10 @@ FlextGL flextGL{
     /* GL_ARB_compute_variable_group_size */
     nullptr,
 
+    /* GL_ARB_indirect_parameters */
+    nullptr,
+    nullptr,
+
     /* GL_ARB_robustness */
     nullptr,
     nullptr,
@@ -1638,6 +1638,11 @@ typedef void (APIENTRY *GLDEBUGPROC)(GLenum source,GLenum type,GLuint id,GLenum
 #define GL_MAX_COMPUTE_VARIABLE_GROUP_SIZE_ARB 0x9345
 #define GL_MAX_COMPUTE_FIXED_GROUP_SIZE_ARB 0x91BF
 
+/* GL_ARB_indirect_parameters */
+
+#define GL_PARAMETER_BUFFER_ARB 0x80EE
+#define GL_PARAMETER_BUFFER_BINDING_ARB 0x80EF
+
 /* GL_ARB_seamless_cubemap_per_texture */
 
 #define GL_TEXTURE_CUBE_MAP_SEAMLESS 0x884F
@@ -1847,6 +1852,11 @@ struct FlextGL {
 
     void(APIENTRY *DispatchComputeGroupSizeARB)(GLuint, GLuint, GLuint, GLuint, GLuint, GLuint);
 
+    /* GL_ARB_indirect_parameters */
+
+    void(APIENTRY *MultiDrawArraysIndirectCountARB)(GLenum, const void *, GLintptr, GLsizei, GLsizei);
+    void(APIENTRY *MultiDrawElementsIndirectCountARB)(GLenum, GLenum, const void *, GLintptr, GLsizei, GLsizei);
+
     /* GL_ARB_robustness */
 
     GLenum(APIENTRY *GetGraphicsResetStatusARB)(void);
@@ -2661,6 +2671,11 @@ extern FLEXTGL_EXPORT FlextGL flextGL;
 
 #define glDispatchComputeGroupSizeARB flextGL.DispatchComputeGroupSizeARB
 
+/* GL_ARB_indirect_parameters */
+
+#define glMultiDrawArraysIndirectCountARB flextGL.MultiDrawArraysIndirectCountARB
+#define glMultiDrawElementsIndirectCountARB flextGL.MultiDrawElementsIndirectCountARB
+
 /* GL_ARB_robustness */
 
 #define glGetGraphicsResetStatusARB flextGL.GetGraphicsResetStatusARB
@@ -26,19 +26,21 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
-#include <sstream>
 #include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
-#include <Corrade/Containers/StringStl.h> /** @todo remove once iostream is dropped */
-#include <Corrade/Utility/DebugStl.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/StringStl.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
@@ -46,15 +48,26 @@
 
 namespace Magnum { namespace Trade {
 
+using namespace Containers::Literals;
+
 namespace {
 
 struct Mesh {
-    std::streampos begin;
-    std::streampos end;
+    /* Byte offsets of the first line belonging to the mesh and one after the
+       last line */
+    std::size_t begin;
+    std::size_t end;
     UnsignedInt positionIndexOffset;
     UnsignedInt textureCoordinateIndexOffset;
     UnsignedInt normalIndexOffset;
-    std::string name;
+    /* Vertex data and index counts, used to reserve the arrays upfront in
+       doMesh(). The index count is calculated from the primitive keywords and
+       thus is exact only for valid files. */
+    UnsignedInt positionCount;
+    UnsignedInt textureCoordinateCount;
+    UnsignedInt normalCount;
+    std::size_t indexCount;
+    Containers::String name;
 };
 
 }
@@ -62,36 +75,204 @@ struct Mesh {
 struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     Containers::Array<Mesh> meshes;
-    Containers::Pointer<std::istream> in;
+    /* Either the data passed to openData() / openMemory(), a file mapped by
+       the base AbstractImporter::doOpenFile() if ImporterFlag::MapFile is
+       set, or a copy of them. The in view points to the data. */
+    Containers::Array<char> data;
+    Containers::ArrayView<const char> in;
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+/* Newlines are not whitespace here, as the parsing is line-based. Including
+   \r in order to handle CRLF files transparently. */
+inline bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool isDigit(const char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline const char* skipWhitespace(const char* i, const char* const end) {
+    while(i != end && isWhitespace(*i)) ++i;
+    return i;
+}
+
+inline const char* findWhitespace(const char* i, const char* const end) {
+    while(i != end && !isWhitespace(*i)) ++i;
+    return i;
+}
+
+/* Returns a pointer to the newline ending the line that starts at begin, or
+   end if it's the last line without a trailing newline */
+inline const char* findLineEnd(const char* const begin, const char* const end) {
+    const void* const found = std::memchr(begin, '\n', end - begin);
+    return found ? static_cast<const char*>(found) : end;
+}
+
+/* A single trimmed line split into a keyword and its contents. Returns false
+   if the line is empty or a comment. */
+inline bool splitLine(const char* const begin, const char* const end, Containers::StringView& keyword, const char*& contentsBegin, const char*& contentsEnd) {
+    const char* const i = skipWhitespace(begin, end);
+    const char* e = end;
+    while(e != i && isWhitespace(e[-1])) --e;
+    if(i == e || *i == '#') return false;
+
+    const char* const keywordEnd = findWhitespace(i, e);
+    keyword = Containers::StringView{i, std::size_t(keywordEnd - i)};
+    contentsBegin = skipWhitespace(keywordEnd, e);
+    contentsEnd = e;
+    return true;
+}
+
+/* Splits a whitespace-separated list into at most `capacity` tokens and
+   returns the total token count, which can be larger than `capacity` */
+std::size_t splitTokens(const char* i, const char* const end, Containers::StringView* const out, const std::size_t capacity) {
+    std::size_t count = 0;
+    for(;;) {
+        i = skipWhitespace(i, end);
+        if(i == end) break;
+        const char* const tokenEnd = findWhitespace(i, end);
+        if(count < capacity)
+            out[count] = Containers::StringView{i, std::size_t(tokenEnd - i)};
+        ++count;
+        i = tokenEnd;
+    }
+    return count;
+}
+
+/* Fallback for everything the fast path in parseFloat() doesn't handle, such
+   as inf, nan, hexadecimal floats, very long mantissas or exponents that are
+   not exactly representable. The token isn't null-terminated, so it's copied
+   first, which doesn't allocate for the usual short literals thanks to SSO. */
+bool parseFloatSlow(const Containers::StringView token, Float& out) {
+    const Containers::String buffer = Containers::String::nullTerminatedView(token);
+
+    char* end;
+    errno = 0;
+    out = std::strtof(buffer.data(), &end);
+    return end == buffer.data() + buffer.size() && end != buffer.data() && errno != ERANGE;
+}
+
+/* Parses the whole token as a float. Decimal mantissas that fit into 53 bits
+   with a power-of-ten exponent of at most 22 can be converted with a single
+   correctly rounded double multiplication or division, as both operands are
+   exactly representable. The double -> float conversion then gives the same
+   result as parsing straight to a float unless the double lands exactly on a
+   midpoint between two floats, in which case the slow path is taken to avoid
+   double rounding. */
+bool parseFloat(const Containers::StringView token, Float& out) {
+    constexpr Double Powers[]{
+        1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+        1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18,
+        1.0e19, 1.0e20, 1.0e21, 1.0e22
+    };
+
+    const char* i = token.begin();
+    const char* const end = token.end();
+
+    bool negative = false;
+    if(i != end && (*i == '-' || *i == '+')) {
+        negative = *i == '-';
+        ++i;
+    }
+
+    UnsignedLong mantissa = 0;
+    Int exponent = 0;
+    std::size_t significantDigitCount = 0;
+    bool hasDigits = false;
+    for(; i != end && isDigit(*i); ++i) {
+        if(mantissa || *i != '0') ++significantDigitCount;
+        mantissa = mantissa*10 + (*i - '0');
+        hasDigits = true;
+    }
+    if(i != end && *i == '.') for(++i; i != end && isDigit(*i); ++i) {
+        if(mantissa || *i != '0') ++significantDigitCount;
+        mantissa = mantissa*10 + (*i - '0');
+        --exponent;
+        hasDigits = true;
+    }
+    if(hasDigits && i != end && (*i == 'e' || *i == 'E')) {
+        const char* e = i + 1;
+        bool negativeExponent = false;
+        if(e != end && (*e == '-' || *e == '+')) {
+            negativeExponent = *e == '-';
+            ++e;
+        }
+        if(e != end && isDigit(*e)) {
+            Int value = 0;
+            for(; e != end && isDigit(*e); ++e)
+                if(value < 100000) value = value*10 + (*e - '0');
+            exponent += negativeExponent ? -value : value;
+            i = e;
+        }
+    }
+
+    /* Anything unexpected or out of the exactly representable range goes to
+       the slow path. The mantissa could have overflowed above if there's more
+       than 19 significant digits, which is caught here as well. */
+    if(!hasDigits || i != end || significantDigitCount > 19 ||
+       mantissa > (1ull << 53) || exponent < -22 || exponent > 22)
+        return parseFloatSlow(token, out);
+
+    const Double value = exponent < 0 ?
+        Double(mantissa)/Powers[-exponent] : Double(mantissa)*Powers[exponent];
+
+    /* Denormals, overflows and float midpoints go to the slow path as well */
+    if(value != 0.0 && (value < Double(std::numeric_limits<Float>::min()) || value > Double(std::numeric_limits<Float>::max())))
+        return parseFloatSlow(token, out);
+    UnsignedLong bits;
+    std::memcpy(&bits, &value, sizeof(Double));
+    if((bits & ((1ull << 29) - 1)) == (1ull << 28))
+        return parseFloatSlow(token, out);
+
+    out = negative ? -Float(value) : Float(value);
+    return true;
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
-        throw 0;
+/* Parses the whole token as a non-negative 32-bit integer */
+bool parseUnsignedInt(const Containers::StringView token, UnsignedInt& out) {
+    if(token.isEmpty()) return false;
+
+    UnsignedLong value = 0;
+    for(const char c: token) {
+        if(!isDigit(c)) return false;
+        value = value*10 + (c - '0');
+        if(value > ~UnsignedInt{}) return false;
     }
 
-    Math::Vector<size, Float> output;
+    out = UnsignedInt(value);
+    return true;
+}
 
-    for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+template<std::size_t size> bool extractFloatData(const char* const begin, const char* const end, const bool printErrors, Math::Vector<size, Float>& output, Float* const extra = nullptr) {
+    Containers::StringView data[size + 1];
+    const std::size_t count = splitTokens(begin, end, data, size + 1);
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        if(printErrors) Error() << "Trade::ObjImporter::mesh(): invalid float array size";
+        return false;
+    }
 
-    if(data.size() == size+1) {
+    for(std::size_t i = 0; i != size; ++i) {
+        if(!parseFloat(data[i], output[i])) {
+            if(printErrors) Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+            return false;
+        }
+    }
+
+    if(count == size + 1) {
         /* This should be obvious from the first if, but add this just to make
            Clang Analyzer happy */
         CORRADE_INTERNAL_ASSERT(extra);
 
-        *extra = std::stof(data.back());
+        if(!parseFloat(data[size], *extra)) {
+            if(printErrors) Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+            return false;
+        }
     }
 
-    return output;
+    return true;
 }
 
 }
@@ -102,121 +283,120 @@ ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, const Containe
 
 ObjImporter::~ObjImporter() = default;
 
-ImporterFeatures ObjImporter::doFeatures() const { return ImporterFeature::OpenData; }
+ImporterFeatures ObjImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::ConcurrentDataAccess; }
 
 void ObjImporter::doClose() { _file.reset(); }
 
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
-void ObjImporter::doOpenFile(const Containers::StringView filename) {
-    /** @todo ARGH clean this up, won't work with UTF-8 */
-    Containers::Pointer<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
-    }
-
+void ObjImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     _file.reset(new File);
-    _file->in = Utility::move(in);
-    parseMeshNames();
-}
 
-void ObjImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
-    _file.reset(new File);
-    /** @todo ARGH MY EYES what is this cursed thing, burn it to the ground */
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+    /* Take over the existing array or copy the data if we can't */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned))
+        _file->data = Utility::move(data);
+    else
+        _file->data = Containers::Array<char>{InPlaceInit, data};
+    _file->in = _file->data;
 
     parseMeshNames();
 }
 
 void ObjImporter::parseMeshNames() {
+    const char* const begin = _file->in.begin();
+    const char* const end = _file->in.end();
+
     /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
+       offset and counts will be updated to proper values later. */
     UnsignedInt positionIndexOffset = 1;
-    UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
+    UnsignedInt normalIndexOffset = 1;
+    std::size_t indexCount = 0;
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
-    arrayAppend(_file->meshes, InPlaceInit, 0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset, std::string{});
-
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
-
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
+    arrayAppend(_file->meshes, InPlaceInit, std::size_t{}, std::size_t{}, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0u, 0u, 0u, std::size_t{}, Containers::String{});
+
+    /* Fills in the end offset and vertex / index counts of the last mesh */
+    auto finishMesh = [&](const std::size_t meshEnd) {
+        Mesh& mesh = _file->meshes.back();
+        mesh.end = meshEnd;
+        mesh.positionCount = positionIndexOffset - mesh.positionIndexOffset;
+        mesh.textureCoordinateCount = textureCoordinateIndexOffset - mesh.textureCoordinateIndexOffset;
+        mesh.normalCount = normalIndexOffset - mesh.normalIndexOffset;
+        mesh.indexCount = indexCount - mesh.indexCount;
+    };
+
+    const char* next;
+    for(const char* line = begin; line < end; line = next) {
+        const char* const lineEnd = findLineEnd(line, end);
+        next = lineEnd + (lineEnd != end);
+
+        Containers::StringView keyword;
+        const char* contentsBegin;
+        const char* contentsEnd;
+        if(!splitLine(line, lineEnd, keyword, contentsBegin, contentsEnd))
             continue;
-        }
-
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
 
         /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        if(keyword == "o"_s) {
+            Containers::String name{Containers::StringView{contentsBegin, std::size_t(contentsEnd - contentsBegin)}};
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
                 thisIsFirstMeshAndItHasNoData = false;
 
                 /* Update its name and add it to name map */
-                if(!name.empty())
+                if(!name.isEmpty())
                     _file->meshesForName.emplace(name, _file->meshes.size() - 1);
                 _file->meshes.back().name = Utility::move(name);
 
                 /* Update its begin offset to be more precise */
-                _file->meshes.back().begin = _file->in->tellg();
+                _file->meshes.back().begin = next - begin;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                _file->meshes.back().end = end;
+                finishMesh(line - begin);
 
-                /* Save name and offset of the new one. The end offset will be
-                   updated later. */
-                if(!name.empty())
+                /* Save name and offset of the new one. The end offset and
+                   counts will be updated later, the index count is temporarily
+                   used to store the running index count at its beginning. */
+                if(!name.isEmpty())
                     _file->meshesForName.emplace(name, _file->meshes.size());
-                arrayAppend(_file->meshes, InPlaceInit, _file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, Utility::move(name));
+                arrayAppend(_file->meshes, InPlaceInit, std::size_t(next - begin), std::size_t{}, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0u, 0u, 0u, indexCount, Utility::move(name));
             }
 
-            continue;
-
         /* If there are any data/indices before the first name, it means that
            the first object is unnamed. We need to check for them. */
 
         /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
+        } else if(keyword == "v"_s) {
             ++positionIndexOffset;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
+        } else if(keyword == "vt"_s) {
             ++textureCoordinateIndexOffset;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
+        } else if(keyword == "vn"_s) {
             ++normalIndexOffset;
             thisIsFirstMeshAndItHasNoData = false;
 
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        /* Index data, count them and mark that we found something for first
+           unnamed object */
+        } else if(keyword == "p"_s) {
+            indexCount += 1;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(keyword == "l"_s) {
+            indexCount += 2;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(keyword == "f"_s) {
+            indexCount += 3;
+            thisIsFirstMeshAndItHasNoData = false;
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    _file->meshes.back().end = _file->in->tellg();
+    finishMesh(end - begin);
 }
 
 UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
@@ -244,215 +424,335 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
     return true;
 }
 
-}
-
-Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
-    const Mesh& mesh = _file->meshes[id];
-    _file->in->seekg(mesh.begin);
+/* Minimal size of a chunk parsed on a single thread */
+constexpr std::size_t MinChunkSize = 256*1024;
 
+/* Data parsed from a line-aligned range of a mesh. Taking a shortcut as
+   there's fortunately nothing else than just 3 types of data, the index
+   tuples are first positions, then normals, then texture coordinates. */
+struct MeshChunk {
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
     Containers::Array<Vector3> normals;
     Containers::Array<Vector2> textureCoordinates;
-    /* Taking a shortcut as there's fortunately nothing else than just 3 types
-       of data. First positions, then normals, then texture coordinates. */
     Containers::Array<Vector3ui> indices;
-    std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+    std::size_t textureCoordinateIndexCount;
+    std::size_t normalIndexCount;
+};
 
-    try { while(_file->in->good() && _file->in->tellg() < mesh.end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
+/* Parses lines in the [begin, end) range into out. With printErrors disabled
+   the function only returns false on failure, which is used when parsing on
+   multiple threads. */
+bool parseMeshChunk(const char* const begin, const char* const end, const Mesh& mesh, const bool printErrors, MeshChunk& out) {
+    const char* next;
+    for(const char* line = begin; line < end; line = next) {
+        const char* const lineEnd = findLineEnd(line, end);
+        next = lineEnd + (lineEnd != end);
+
+        /* Ignore empty lines and comments */
+        Containers::StringView keyword;
+        const char* contentsBegin;
+        const char* contentsEnd;
+        if(!splitLine(line, lineEnd, keyword, contentsBegin, contentsEnd))
             continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(keyword == "v"_s) {
+            Vector3 data;
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            if(!extractFloatData(contentsBegin, contentsEnd, printErrors, data, &extra))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
-                return Containers::NullOpt;
+                if(printErrors) Error() << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
+                return false;
             }
 
-            arrayAppend(positions, data);
+            arrayAppend(out.positions, data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(keyword == "vt"_s) {
+            Vector2 data;
             Float extra{0.0f};
-            const Vector2 data = extractFloatData<2>(contents, &extra);
+            if(!extractFloatData(contentsBegin, contentsEnd, printErrors, data, &extra))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
-                return Containers::NullOpt;
+                if(printErrors) Error() << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
+                return false;
             }
 
-            arrayAppend(textureCoordinates, data);
+            arrayAppend(out.textureCoordinates, data);
 
         /* Normal */
-        } else if(keyword == "vn") {
-            arrayAppend(normals, Vector3{extractFloatData<3>(contents)});
+        } else if(keyword == "vn"_s) {
+            Vector3 data;
+            if(!extractFloatData(contentsBegin, contentsEnd, printErrors, data))
+                return false;
+
+            arrayAppend(out.normals, data);
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(keyword == "p"_s || keyword == "l"_s || keyword == "f"_s) {
+            /* At most three tuples are needed, a fourth one is only counted to
+               detect polygons */
+            Containers::StringView indexTuples[3];
+            const std::size_t indexTupleCount = splitTokens(contentsBegin, contentsEnd, indexTuples, 3);
 
             /* Points */
-            if(keyword == "p") {
+            if(keyword == "p"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Points) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Points;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for point";
-                    return Containers::NullOpt;
+                if(indexTupleCount != 1) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): wrong index count for point";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Points;
+                out.primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(keyword == "l"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Lines) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Lines;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for line";
-                    return Containers::NullOpt;
+                if(indexTupleCount != 2) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): wrong index count for line";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Lines;
+                out.primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(keyword == "f"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Triangles) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Triangles;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh(): wrong index count for triangle";
-                    return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh(): polygons are not supported";
-                    return Containers::NullOpt;
+                if(indexTupleCount < 3) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): wrong index count for triangle";
+                    return false;
+                } else if(indexTupleCount != 3) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): polygons are not supported";
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Triangles;
+                out.primitive = MeshPrimitive::Triangles;
 
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indexStrings = Utility::String::split(indexTuple, '/');
-                if(indexStrings.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh(): invalid index data";
-                    return Containers::NullOpt;
+            for(std::size_t i = 0; i != indexTupleCount; ++i) {
+                /* Split the tuple on slashes, a fourth part is only detected
+                   to be able to fail on it */
+                const Containers::StringView indexTuple = indexTuples[i];
+                Containers::StringView indexStrings[3];
+                std::size_t indexStringCount = 0;
+                const char* partBegin = indexTuple.begin();
+                for(const char* c = indexTuple.begin(); ; ++c) {
+                    if(c != indexTuple.end() && *c != '/') continue;
+                    if(indexStringCount == 3) {
+                        indexStringCount = 4;
+                        break;
+                    }
+                    indexStrings[indexStringCount++] = Containers::StringView{partBegin, std::size_t(c - partBegin)};
+                    if(c == indexTuple.end()) break;
+                    partBegin = c + 1;
+                }
+                if(indexStringCount > 3) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): invalid index data";
+                    return false;
                 }
 
                 Vector3ui index;
 
                 /* Position indices */
-                index[0] = std::stoul(indexStrings[0]) - mesh.positionIndexOffset;
+                if(!parseUnsignedInt(indexStrings[0], index[0])) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                    return false;
+                }
+                index[0] -= mesh.positionIndexOffset;
 
                 /* Texture coordinates */
-                if(indexStrings.size() == 2 || (indexStrings.size() == 3 && !indexStrings[1].empty())) {
-                    index[2] = std::stoul(indexStrings[1]) - mesh.textureCoordinateIndexOffset;
-                    ++textureCoordinateIndexCount;
+                if(indexStringCount == 2 || (indexStringCount == 3 && !indexStrings[1].isEmpty())) {
+                    if(!parseUnsignedInt(indexStrings[1], index[2])) {
+                        if(printErrors) Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return false;
+                    }
+                    index[2] -= mesh.textureCoordinateIndexOffset;
+                    ++out.textureCoordinateIndexCount;
                 }
 
                 /* Normal indices */
-                if(indexStrings.size() == 3) {
-                    index[1] = std::stoul(indexStrings[2]) - mesh.normalIndexOffset;
-                    ++normalIndexCount;
+                if(indexStringCount == 3) {
+                    if(!parseUnsignedInt(indexStrings[2], index[1])) {
+                        if(printErrors) Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                        return false;
+                    }
+                    index[1] -= mesh.normalIndexOffset;
+                    ++out.normalIndexCount;
                 }
 
-                arrayAppend(indices, index);
+                arrayAppend(out.indices, index);
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
+        } else if(keyword != "mtllib"_s && keyword != "usemtl"_s &&
+                  keyword != "g"_s && keyword != "s"_s) {
+            if(printErrors) Error() << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
             return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
-            return Containers::NullOpt;
         }
+    }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
-        /* Error message already printed */
-        return Containers::NullOpt;
+    return true;
+}
+
+/* Parses the [begin, end) range split into chunkCount line-aligned chunks on
+   multiple threads and stitches the results together into out. Returns false
+   if any chunk fails to parse or if different chunks have different
+   primitives, in which case the caller is expected to parse the whole range
+   again serially to print the exact same error as a serial import would. */
+bool parseMeshChunksParallel(const char* const begin, const char* const end, const Mesh& mesh, const std::size_t chunkCount, MeshChunk& out) {
+    /* Moves an offset forward to the beginning of the next line. An offset
+       that's already at a line beginning stays, so neighboring chunks always
+       agree on the boundary between them. */
+    const std::size_t size = end - begin;
+    const auto lineBegin = [begin, end, size](const std::size_t offset) {
+        if(offset == 0 || offset == size) return begin + offset;
+        const char* const lineEnd = findLineEnd(begin + offset - 1, end);
+        return lineEnd + (lineEnd != end);
+    };
+
+    Containers::Array<MeshChunk> chunks{ValueInit, chunkCount};
+    Containers::Array<bool> parsed{ValueInit, chunkCount};
+    Magnum::Implementation::parallelFor(chunkCount, size, [&](const std::size_t chunk, const std::size_t chunkBegin, const std::size_t chunkEnd) {
+        parsed[chunk] = parseMeshChunk(lineBegin(chunkBegin), lineBegin(chunkEnd), mesh, false, chunks[chunk]);
+    });
+
+    /* Prefix sums of the per-chunk counts give the output offset of each
+       chunk. The indices are already relative to the mesh index offsets
+       calculated in parseMeshNames(), so they don't need any patching. */
+    struct Offsets {
+        std::size_t positions;
+        std::size_t normals;
+        std::size_t textureCoordinates;
+        std::size_t indices;
+    };
+    Containers::Array<Offsets> offsets{ValueInit, chunkCount + 1};
+    for(std::size_t i = 0; i != chunkCount; ++i) {
+        const MeshChunk& chunk = chunks[i];
+        if(!parsed[i]) return false;
+        if(chunk.primitive) {
+            if(out.primitive && *out.primitive != *chunk.primitive)
+                return false;
+            out.primitive = chunk.primitive;
+        }
+
+        offsets[i + 1].positions = offsets[i].positions + chunk.positions.size();
+        offsets[i + 1].normals = offsets[i].normals + chunk.normals.size();
+        offsets[i + 1].textureCoordinates = offsets[i].textureCoordinates + chunk.textureCoordinates.size();
+        offsets[i + 1].indices = offsets[i].indices + chunk.indices.size();
+        out.textureCoordinateIndexCount += chunk.textureCoordinateIndexCount;
+        out.normalIndexCount += chunk.normalIndexCount;
+    }
+
+    out.positions = Containers::Array<Vector3>{NoInit, offsets[chunkCount].positions};
+    out.normals = Containers::Array<Vector3>{NoInit, offsets[chunkCount].normals};
+    out.textureCoordinates = Containers::Array<Vector2>{NoInit, offsets[chunkCount].textureCoordinates};
+    out.indices = Containers::Array<Vector3ui>{NoInit, offsets[chunkCount].indices};
+    Magnum::Implementation::parallelFor(chunkCount, chunkCount, [&](const std::size_t i, std::size_t, std::size_t) {
+        const MeshChunk& chunk = chunks[i];
+        Utility::copy(chunk.positions, out.positions.sliceSize(offsets[i].positions, chunk.positions.size()));
+        Utility::copy(chunk.normals, out.normals.sliceSize(offsets[i].normals, chunk.normals.size()));
+        Utility::copy(chunk.textureCoordinates, out.textureCoordinates.sliceSize(offsets[i].textureCoordinates, chunk.textureCoordinates.size()));
+        Utility::copy(chunk.indices, out.indices.sliceSize(offsets[i].indices, chunk.indices.size()));
+    });
+
+    return true;
+}
+
+}
+
+Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
+    const Mesh& mesh = _file->meshes[id];
+    const char* const begin = _file->in.begin() + mesh.begin;
+    const char* const end = _file->in.begin() + mesh.end;
+
+    /* Split large meshes into chunks parsed on multiple threads if enabled,
+       but make the chunks at least MinChunkSize bytes large so the threading
+       overhead doesn't dominate. If called from a concurrent meshes() batch,
+       all threads are already busy with other meshes, so parse on just this
+       one. */
+    const std::size_t chunkCount = isConcurrentBatchWorker() ? 1 : Math::min(
+        std::size_t(Magnum::Implementation::parallelForThreadCount(configuration().value<UnsignedInt>("threads"))),
+        Math::max(std::size_t(end - begin)/MinChunkSize, std::size_t{1}));
+
+    MeshChunk parsed{};
+    if(chunkCount == 1 || !parseMeshChunksParallel(begin, end, mesh, chunkCount, parsed)) {
+        parsed = MeshChunk{};
+
+        /* The counts were gathered in parseMeshNames(), so there's no need for
+           repeated reallocations */
+        arrayReserve(parsed.positions, mesh.positionCount);
+        arrayReserve(parsed.normals, mesh.normalCount);
+        arrayReserve(parsed.textureCoordinates, mesh.textureCoordinateCount);
+        arrayReserve(parsed.indices, mesh.indexCount);
+
+        if(!parseMeshChunk(begin, end, mesh, true, parsed))
+            return Containers::NullOpt;
     }
 
     /* There should be at least indexed position data */
-    if(positions.isEmpty() || indices.isEmpty()) {
+    if(parsed.positions.isEmpty() || parsed.indices.isEmpty()) {
         Error() << "Trade::ObjImporter::mesh(): incomplete position data";
         return Containers::NullOpt;
     }
 
     /* If there are index data, there should be also vertex data (and also the other way) */
-    if(normals.isEmpty() != (normalIndexCount == 0)) {
+    if(parsed.normals.isEmpty() != (parsed.normalIndexCount == 0)) {
         Error() << "Trade::ObjImporter::mesh(): incomplete normal data";
         return Containers::NullOpt;
     }
-    if(textureCoordinates.isEmpty() != (textureCoordinateIndexCount == 0)) {
+    if(parsed.textureCoordinates.isEmpty() != (parsed.textureCoordinateIndexCount == 0)) {
         Error() << "Trade::ObjImporter::mesh(): incomplete texture coordinate data";
         return Containers::NullOpt;
     }
 
     /* All index arrays should have the same length */
-    if(normalIndexCount && normalIndexCount != indices.size()) {
-        CORRADE_INTERNAL_ASSERT(normalIndexCount < indices.size());
+    if(parsed.normalIndexCount && parsed.normalIndexCount != parsed.indices.size()) {
+        CORRADE_INTERNAL_ASSERT(parsed.normalIndexCount < parsed.indices.size());
         Error() << "Trade::ObjImporter::mesh(): some normal indices are missing";
         return Containers::NullOpt;
     }
-    if(textureCoordinateIndexCount && textureCoordinateIndexCount != indices.size()) {
-        CORRADE_INTERNAL_ASSERT(textureCoordinateIndexCount < indices.size());
+    if(parsed.textureCoordinateIndexCount && parsed.textureCoordinateIndexCount != parsed.indices.size()) {
+        CORRADE_INTERNAL_ASSERT(parsed.textureCoordinateIndexCount < parsed.indices.size());
         Error() << "Trade::ObjImporter::mesh(): some texture coordinate indices are missing";
         return Containers::NullOpt;
     }
 
     /* Merge index arrays. If any of the attributes was not there, the whole
        index array has zeros, not affecting the uniqueness in any way. */
-    Containers::Array<char> indexData{NoInit, indices.size()*sizeof(UnsignedInt)};
+    Containers::Array<char> indexData{NoInit, parsed.indices.size()*sizeof(UnsignedInt)};
     const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
     const std::size_t vertexCount = MeshTools::removeDuplicatesInPlaceInto(
-        Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
+        Containers::arrayCast<2, char>(arrayView(parsed.indices)), indexDataI);
 
     /* Allocate attribute and vertex data */
     std::size_t attributeCount = 1;
     UnsignedInt stride = sizeof(Vector3);
-    if(normalIndexCount) {
+    if(parsed.normalIndexCount) {
         ++attributeCount;
         stride += sizeof(Vector3);
     }
-    if(textureCoordinateIndexCount) {
+    if(parsed.textureCoordinateIndexCount) {
         ++attributeCount;
         stride += sizeof(Vector2);
     }
@@ -460,36 +760,36 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     Containers::Array<char> vertexData{NoInit, vertexCount*stride};
 
     /* Duplicate the vertices into the output */
-    const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(indices)).transposed<0, 1>();
+    const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(parsed.indices)).transposed<0, 1>();
     std::size_t attributeIndex = 0;
     std::size_t offset = 0;
     {
         Containers::StridedArrayView1D<Vector3> view{vertexData,
             reinterpret_cast<Vector3*>(vertexData.data()), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), positions, view, mesh.positionIndexOffset))
+        if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), parsed.positions, view, mesh.positionIndexOffset))
             return Containers::NullOpt;
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Position, view};
         offset += sizeof(Vector3);
     }
-    if(normalIndexCount) {
+    if(parsed.normalIndexCount) {
         Containers::StridedArrayView1D<Vector3> view{vertexData,
             reinterpret_cast<Vector3*>(vertexData.data() + offset), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), normals, view, mesh.normalIndexOffset))
+        if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), parsed.normals, view, mesh.normalIndexOffset))
             return Containers::NullOpt;
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Normal, view};
         offset += sizeof(Vector3);
     }
-    if(textureCoordinateIndexCount) {
+    if(parsed.textureCoordinateIndexCount) {
         Containers::StridedArrayView1D<Vector2> view{vertexData,
             reinterpret_cast<Vector2*>(vertexData.data() + offset), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), textureCoordinates, view, mesh.textureCoordinateIndexOffset))
+        if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), parsed.textureCoordinates, view, mesh.textureCoordinateIndexOffset))
             return Containers::NullOpt;
         attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::TextureCoordinates, view};
         offset += sizeof(Vector2);
     }
     CORRADE_INTERNAL_ASSERT(offset == stride && attributeIndex == attributeCount);
 
-    return MeshData{*primitive,
+    return MeshData{*parsed.primitive,
         Utility::move(indexData), Trade::MeshIndexData{indexDataI},
         Utility::move(vertexData), Utility::move(attributeData)};
 }
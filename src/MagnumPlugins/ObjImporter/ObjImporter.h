@@ -106,6 +106,39 @@ positions with optional @ref VertexFormat::Vector3 normals and
 @ref VertexFormat::Vector2 texture coordinates, if present in the source file.
 
 Polygons (quads etc.) and material properties are currently not supported.
+
+The file is parsed directly from the memory passed to @ref openData() or
+@ref openMemory() without any intermediate copies or per-line allocations.
+Data passed to @ref openData() are copied, as the importer needs them to stay
+in scope until it's closed. If @ref ImporterFlag::MapFile is set,
+@ref openFile() memory-maps the file instead of reading it into memory and the
+importer parses directly from the mapped memory, which is kept mapped until
+the importer is closed. The imported meshes don't reference the input data, so
+they stay valid after the file is closed even with the flag set.
+
+By default, meshes are parsed on a single thread. Setting the
+@cb{.ini} threads @ce @ref Trade-ObjImporter-configuration "configuration option"
+to a value other than @cpp 1 @ce splits large meshes into line-aligned chunks
+that are parsed in parallel and then concatenated. The output as well as the
+errors reported for invalid files are the same as with a serial import. If
+Corrade isn't built with @ref CORRADE_BUILD_MULTITHREADED, the option is
+ignored and everything is parsed on a single thread.
+
+The importer supports @ref ImporterFeature::ConcurrentDataAccess, so
+different meshes can be imported on multiple threads using
+@ref meshes(). Meshes imported by a concurrent batch are parsed each on a
+single thread, independently of the @cb{.ini} threads @ce option, in order to
+not oversubscribe the CPU.
+
+@section Trade-ObjImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/ObjImporter/ObjImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -124,7 +157,6 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
 
         MAGNUM_OBJIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_OBJIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
-        MAGNUM_OBJIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
         MAGNUM_OBJIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_OBJIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
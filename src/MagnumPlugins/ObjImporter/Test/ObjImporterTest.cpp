@@ -24,14 +24,17 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
@@ -40,6 +43,8 @@
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
 
+using namespace Containers::Literals;
+
 struct ObjImporterTest: TestSuite::Tester {
     explicit ObjImporterTest();
 
@@ -57,11 +62,15 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshTextureCoordinatesNormals();
 
     void meshIgnoredKeyword();
+    void meshFloatLiterals();
+    void meshIndexLiterals();
+    void meshTabSeparators();
 
     void meshNamed();
     void meshNamedFirstUnnamed();
 
     void moreMeshes();
+    void moreMeshesBatch();
 
     /* Technically, all invalid cases could be put into a single file, but
        because the indexing is global, it would get increasingly hard to
@@ -71,14 +80,22 @@ struct ObjImporterTest: TestSuite::Tester {
     void invalid();
     void invalidMixedPrimitives();
     void invalidNumbers();
+    void invalidNumberLiterals();
     void invalidNumberCount();
     void invalidInconsistentIndexTuple();
     void invalidIncompleteData();
     void invalidOptionalCoordinate();
 
+    void openFileMapped();
     void openTwice();
     void importTwice();
 
+    void meshMultithreaded();
+    void meshMultithreadedInvalid();
+
+    void benchmarkOpen();
+    void benchmarkMesh();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -124,6 +141,57 @@ const struct {
     {"zero index", "index 0 out of range for 1 vertices"}
 };
 
+const struct {
+    const char* name;
+    const char* literal;
+    Float expected;
+} FloatLiteralsData[]{
+    {"integer", "17", 17.0f},
+    {"negative", "-1.5", -1.5f},
+    {"explicit plus sign", "+2.25", 2.25f},
+    {"negative zero", "-0", -0.0f},
+    {"no integer part", ".5", 0.5f},
+    {"no fractional part", "3.", 3.0f},
+    {"not exactly representable", "0.1", 0.1f},
+    {"exponent", "1e3", 1000.0f},
+    {"negative exponent, uppercase", "1.5E-2", 0.015f},
+    {"explicit plus exponent", "2.5e+1", 25.0f},
+    /* These go through the slow path */
+    {"more than 19 significant digits", "3.14159265358979323846264338327950288", 3.14159265358979323846f},
+    {"many leading zeros", "0.000000000000000000000000000001", 1.0e-30f},
+    {"exponent out of fast range", "1.0e30", 1.0e30f},
+    {"hexadecimal", "0x1.8p3", 12.0f},
+    {"very long literal", "1.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001", 1.0f},
+    {"infinity", "inf", Constants::inf()},
+    {"negative infinity", "-inf", -Constants::inf()},
+    {"NaN", "nan", Constants::nan()},
+};
+
+const struct {
+    const char* name;
+    const char* data;
+    const char* message;
+} InvalidNumberLiteralsData[]{
+    {"trailing garbage after a float", "v 1.0abc 0 0\np 1\n",
+        "error while converting numeric data"},
+    {"trailing garbage after an exponent", "v 1e5x 0 0\np 1\n",
+        "error while converting numeric data"},
+    {"two decimal points", "v 1.0.0 0 0\np 1\n",
+        "error while converting numeric data"},
+    {"sign only", "v - 0 0\np 1\n",
+        "error while converting numeric data"},
+    {"exponent only", "v e5 0 0\np 1\n",
+        "error while converting numeric data"},
+    {"float overflow", "v 1e39 0 0\np 1\n",
+        "error while converting numeric data"},
+    {"trailing garbage after an index", "v 1 0 0\np 1x\n",
+        "error while converting numeric data"},
+    {"negative index", "v 1 0 0\np -1\n",
+        "error while converting numeric data"},
+    {"32-bit index overflow", "v 1 0 0\np 4294967296\n",
+        "error while converting numeric data"},
+};
+
 const struct {
     const char* name;
     const char* message;
@@ -166,6 +234,77 @@ const struct {
     {"texture with optional third component not zero", "3D texture coordinates are not supported"}
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threads;
+} MeshMultithreadedData[]{
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"all threads", 0}
+};
+
+const struct {
+    const char* name;
+    const char* insertBeforeFaces;
+    const char* append;
+    const char* message;
+} MeshMultithreadedInvalidData[]{
+    {"unknown keyword", "", "bleh\n",
+        "unknown keyword bleh"},
+    {"two errors, first reported", "vn 1 2\n", "bleh\n",
+        "invalid float array size"},
+    {"mixed primitives", "l 1 2\n", "",
+        "mixed primitive MeshPrimitive::Lines and MeshPrimitive::Triangles"},
+    {"mixed primitives at the end", "", "p 1\n",
+        "mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Points"},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threads;
+} BenchmarkMeshData[]{
+    {"", 1},
+    {"all threads", 0}
+};
+
+/* A grid of size x size vertices with positions, texture coordinates and
+   normals, and faces referencing them. The 512x512 variant used for
+   benchmarks has about half a million triangles and roughly 40 MB of text. */
+constexpr UnsignedInt BenchmarkGridSize = 512;
+
+Containers::Array<char> gridObj(const UnsignedInt size, const Containers::StringView insertBeforeFaces = {}, const Containers::StringView append = {}) {
+    Containers::Array<char> out;
+    const auto appendLine = [&out](const Containers::StringView line) {
+        arrayAppend(out, line);
+    };
+
+    appendLine("o Grid\n");
+    for(UnsignedInt y = 0; y != size; ++y)
+        for(UnsignedInt x = 0; x != size; ++x)
+            appendLine(Utility::format("v {} {} {}\n", x*0.125f - 32.0f, y*0.125f - 32.0f, Float(x*y % 17)*0.0625f - 0.5f));
+    for(UnsignedInt y = 0; y != size; ++y)
+        for(UnsignedInt x = 0; x != size; ++x)
+            appendLine(Utility::format("vt {} {}\n", Float(x)/(size - 1), Float(y)/(size - 1)));
+    for(UnsignedInt y = 0; y != size; ++y)
+        for(UnsignedInt x = 0; x != size; ++x)
+            appendLine(Utility::format("vn {} {} 0.987654\n", Float(x % 11)*0.01f, -Float(y % 13)*0.01f));
+
+    appendLine(insertBeforeFaces);
+    for(UnsignedInt y = 0; y != size - 1; ++y) {
+        for(UnsignedInt x = 0; x != size - 1; ++x) {
+            const UnsignedInt a = y*size + x + 1;
+            const UnsignedInt b = a + 1;
+            const UnsignedInt c = a + size;
+            const UnsignedInt d = c + 1;
+            appendLine(Utility::format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", a, b, d));
+            appendLine(Utility::format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", a, d, c));
+        }
+    }
+    appendLine(append);
+
+    return out;
+}
+
 ObjImporterTest::ObjImporterTest() {
     addTests({&ObjImporterTest::empty,
 
@@ -183,10 +322,17 @@ ObjImporterTest::ObjImporterTest() {
 
               &ObjImporterTest::meshNamed});
 
+    addInstancedTests({&ObjImporterTest::meshFloatLiterals},
+        Containers::arraySize(FloatLiteralsData));
+
+    addTests({&ObjImporterTest::meshIndexLiterals,
+              &ObjImporterTest::meshTabSeparators});
+
     addInstancedTests({&ObjImporterTest::meshNamedFirstUnnamed},
         Containers::arraySize(MeshNamedFirstUnnamedData));
 
-    addTests({&ObjImporterTest::moreMeshes});
+    addTests({&ObjImporterTest::moreMeshes,
+              &ObjImporterTest::moreMeshesBatch});
 
     addInstancedTests({&ObjImporterTest::invalid},
         Containers::arraySize(InvalidData));
@@ -194,6 +340,9 @@ ObjImporterTest::ObjImporterTest() {
     addInstancedTests({&ObjImporterTest::invalidMixedPrimitives},
         Containers::arraySize(InvalidMixedPrimitivesData));
 
+    addInstancedTests({&ObjImporterTest::invalidNumberLiterals},
+        Containers::arraySize(InvalidNumberLiteralsData));
+
     addInstancedTests({&ObjImporterTest::invalidNumbers},
         Containers::arraySize(InvalidNumbersData));
 
@@ -209,9 +358,21 @@ ObjImporterTest::ObjImporterTest() {
     addInstancedTests({&ObjImporterTest::invalidOptionalCoordinate},
         Containers::arraySize(InvalidOptionalCoordinateData));
 
-    addTests({&ObjImporterTest::openTwice,
+    addTests({&ObjImporterTest::openFileMapped,
+              &ObjImporterTest::openTwice,
               &ObjImporterTest::importTwice});
 
+    addInstancedTests({&ObjImporterTest::meshMultithreaded},
+        Containers::arraySize(MeshMultithreadedData));
+
+    addInstancedTests({&ObjImporterTest::meshMultithreadedInvalid},
+        Containers::arraySize(MeshMultithreadedInvalidData));
+
+    addBenchmarks({&ObjImporterTest::benchmarkOpen}, 5);
+
+    addInstancedBenchmarks({&ObjImporterTest::benchmarkMesh}, 5,
+        Containers::arraySize(BenchmarkMeshData));
+
     #ifdef OBJIMPORTER_PLUGIN_FILENAME
     CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
     #endif
@@ -451,6 +612,56 @@ void ObjImporterTest::meshIgnoredKeyword() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshFloatLiterals() {
+    auto&& data = FloatLiteralsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::String obj = Utility::format("v {} 0 0\np 1\n", data.literal);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(obj));
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->vertexCount(), 1);
+    CORRADE_COMPARE(mesh->attribute<Vector3>(MeshAttribute::Position)[0].x(), data.expected);
+}
+
+void ObjImporterTest::meshIndexLiterals() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    /* Leading zeros are allowed */
+    CORRADE_VERIFY(importer->openData(
+        "v 1 0 0\n"
+        "v 2 0 0\n"
+        "p 0002\n"_s));
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {2.0f, 0.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshTabSeparators() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    /* Tabs are treated the same as spaces, mixed together and also around
+       keywords */
+    CORRADE_VERIFY(importer->openData(
+        "v\t1\t2 \t3\r\n"
+        "\tv 4\t\t5 6\n"
+        "l\t1 \t2\t\n"_s));
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f}
+        }), TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::meshNamed() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-named.obj")));
@@ -554,6 +765,36 @@ void ObjImporterTest::moreMeshes() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::moreMeshesBatch() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->features() & ImporterFeature::ConcurrentDataAccess);
+    /* Gets ignored for the meshes imported by the batch, but should still
+       give back the same data if it isn't */
+    importer->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-multiple.obj")));
+    CORRADE_COMPARE(importer->meshCount(), 3);
+
+    /* The contents are verified in moreMeshes() above, here it's just checked
+       that the batch import gives back the same data in the right order */
+    const UnsignedInt ids[]{2, 0, 1, 2};
+    Containers::Array<Containers::Optional<MeshData>> meshes = importer->meshes(ids, 4);
+    CORRADE_COMPARE(meshes.size(), Containers::arraySize(ids));
+    for(std::size_t i = 0; i != Containers::arraySize(ids); ++i) {
+        CORRADE_ITERATION(i);
+        const Containers::Optional<MeshData> expected = importer->mesh(ids[i]);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(meshes[i]);
+        CORRADE_COMPARE(meshes[i]->primitive(), expected->primitive());
+        CORRADE_COMPARE(meshes[i]->attributeCount(), expected->attributeCount());
+        CORRADE_COMPARE_AS(meshes[i]->attribute<Vector3>(MeshAttribute::Position),
+            expected->attribute<Vector3>(MeshAttribute::Position),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(meshes[i]->indices<UnsignedInt>(),
+            expected->indices<UnsignedInt>(),
+            TestSuite::Compare::Container);
+    }
+}
+
 void ObjImporterTest::invalid() {
     auto&& data = InvalidData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -601,6 +842,19 @@ void ObjImporterTest::invalidNumbers() {
     CORRADE_COMPARE(out, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
 }
 
+void ObjImporterTest::invalidNumberLiterals() {
+    auto&& data = InvalidNumberLiteralsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(Containers::StringView{data.data}));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
+}
+
 void ObjImporterTest::invalidNumberCount() {
     auto&& data = InvalidNumberCountData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -665,6 +919,30 @@ void ObjImporterTest::invalidOptionalCoordinate() {
     CORRADE_COMPARE(out, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
 }
 
+void ObjImporterTest::openFileMapped() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->addFlags(ImporterFlag::MapFile);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-primitive-points.obj")));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<MeshData> data = importer->mesh(0);
+    CORRADE_VERIFY(data);
+
+    /* The imported data don't reference the mapped file, so they stay valid
+       after it gets unmapped on close */
+    importer->close();
+    CORRADE_COMPARE(data->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.5f, 2.0f, 3.0f},
+            {2.0f, 3.0f, 5.0f},
+            {0.0f, 1.5f, 1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data->indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 0}),
+        TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
 
@@ -690,6 +968,89 @@ void ObjImporterTest::importTwice() {
     }
 }
 
+void ObjImporterTest::meshMultithreaded() {
+    auto&& data = MeshMultithreadedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough to be split into several chunks */
+    const Containers::Array<char> obj = gridObj(128);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openMemory(obj));
+    Containers::Optional<MeshData> expected = importer->mesh(0);
+    CORRADE_VERIFY(expected);
+
+    importer->configuration().setValue("threads", data.threads);
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->vertexCount(), 128*128);
+
+    /* The output should be the same as with a serial import */
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(),
+        expected->indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        expected->attribute<Vector3>(MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Normal),
+        expected->attribute<Vector3>(MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        expected->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshMultithreadedInvalid() {
+    auto&& data = MeshMultithreadedInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char> obj = gridObj(128, data.insertBeforeFaces, data.append);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(importer->openMemory(obj));
+
+    /* The error should be the same as with a serial import, i.e. the first
+       one in the file */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
+}
+
+void ObjImporterTest::benchmarkOpen() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    const Containers::Array<char> obj = gridObj(BenchmarkGridSize);
+
+    /* Measures just the initial scan for mesh names and offsets */
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openMemory(obj));
+    }
+
+    CORRADE_COMPARE(importer->meshCount(), 1);
+}
+
+void ObjImporterTest::benchmarkMesh() {
+    auto&& data = BenchmarkMeshData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", data.threads);
+    const Containers::Array<char> obj = gridObj(BenchmarkGridSize);
+    CORRADE_VERIFY(importer->openMemory(obj));
+
+    Containers::Optional<MeshData> mesh;
+    CORRADE_BENCHMARK(1) {
+        mesh = importer->mesh(0);
+    }
+
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->indexCount(), (BenchmarkGridSize - 1)*(BenchmarkGridSize - 1)*6);
+    CORRADE_COMPARE(mesh->vertexCount(), BenchmarkGridSize*BenchmarkGridSize);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)